@@ -49,6 +49,7 @@ function make
                '../src/linalg/blaslapack.c', ...
                '../src/linalg/magma_wrapper.c', ...
                '../src/linalg/memman.c', ...
+               '../src/linalg/profile.c', ...
                '../src/linalg/wtime.c', ...
                '../src/svds/primme_svds_c.c', ...
                '../src/svds/primme_svds_f77.c', ...
@@ -232,6 +232,7 @@ function [varargout] = primme_eigs(varargin)
       ABfun = 1;
    end
 
+   B = [];
    if nargin >= nextArg && (~isnumeric(varargin{nextArg}) || ~isscalar(varargin{nextArg}))
       B = varargin{nextArg};
       if isnumeric(B)
@@ -539,6 +540,14 @@ function [varargout] = primme_eigs(varargin)
       % Set other options in primme_params
       primme_set_members(opts, primme);
 
+      % Let the mex multiply by sparse matrices without calling MATLAB
+      if ~Agpu && Aherm && isnumeric(A) && issparse(A)
+         primme_mex('primme_set_member', primme, 'matrixMatvec', A);
+      end
+      if ~Agpu && isnumeric(B) && issparse(B)
+         primme_mex('primme_set_member', primme, 'massMatrixMatvec', B);
+      end
+
       % Set method
       try
          primme_mex('primme_set_method', method, primme);
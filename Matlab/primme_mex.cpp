@@ -431,6 +431,191 @@ static mxArray *create_mxArray(
    return mxCreateString(y ? y : "");
 }
 
+// Operator passed as matrixMatvec, massMatrixMatvec or applyPreconditioner
+// together with the mxArrays reused between calls.
+// Fields:
+// - f: function handle, or sparse matrix (only for matrixMatvec and
+//      massMatrixMatvec)
+// - fh: conjugate transpose of f if f is sparse and the products with f and
+//      with its conjugate transpose are needed (svds); otherwise NULL
+// - x: persistent mxArray passed as input to the function handle
+// - xCapacity: number of elements allocated in x
+// - modes, modeNames: persistent strings passed as mode to the function handle
+
+struct MexOperator {
+   mxArray *f, *fh, *x;
+   size_t xCapacity;
+   mxArray *modes[3];
+   const char *modeNames[3];
+};
+
+// Return a new MexOperator for the function handle or sparse matrix f.
+// Arguments:
+// - f: function handle or sparse matrix
+// - needsTranspose: if f is sparse, whether to store its conjugate transpose
+
+static MexOperator *createMexOperator(const mxArray *f, bool needsTranspose) {
+   MexOperator *op = new MexOperator;
+   op->f = mxDuplicateArray(f);
+   mexMakeArrayPersistent(op->f);
+   op->fh = op->x = NULL;
+   op->xCapacity = 0;
+   for (int i = 0; i < 3; i++) op->modes[i] = NULL, op->modeNames[i] = NULL;
+   if (mxIsSparse(f) && needsTranspose) {
+      mxArray *prhs[1] = {op->f};
+      if (mexCallMATLAB(1, &op->fh, 1, prhs, "ctranspose") != 0)
+         mexErrMsgTxt("Error computing the conjugate transpose of the matrix");
+      mexMakeArrayPersistent(op->fh);
+   }
+   return op;
+}
+
+static void destroyMexOperator(MexOperator *op) {
+   if (!op) return;
+   mxDestroyArray(op->f);
+   if (op->fh) mxDestroyArray(op->fh);
+   if (op->x) mxDestroyArray(op->x);
+   for (int i = 0; i < 3; i++) if (op->modes[i]) mxDestroyArray(op->modes[i]);
+   delete op;
+}
+
+// Return a mxArray with the content of y to pass to the function handle of op.
+// The mxArray is op->x, which is allocated the first time and reused while it
+// has room for m x n elements of type T, so the function handle should not
+// keep references to its input. In Octave, when y is real and m == ldy, y
+// is used directly as the data of a temporary mxArray instead.
+// Arguments:
+// - op: operator
+// - y: C type array from to get the values
+// - m: number of rows of matrix y and output mxArray
+// - n: number of columns of matrix y and output mxArray
+// - ldy: leading dimension of y
+
+template <typename T, typename I>
+static mxArray *acquire_input_mxArray(MexOperator *op, T *y, I m, I n, I ldy,
+      CPU) {
+
+#ifdef HAVE_OCTAVE
+   if (!isComplex<T>() && m == ldy) return create_mxArray(y, m, n, ldy, CPU(), true);
+#endif
+
+   typedef typename Real<T>::type R;
+   size_t size = (size_t)macro_max(m, 0) * (size_t)macro_max(n, 0);
+   mxArray *x = op->x;
+   if (!x || mxGetClassID(x) != toClassID<T>() ||
+         (bool)mxIsComplex(x) != isComplex<T>() || op->xCapacity < size) {
+      if (x) mxDestroyArray(x);
+      x = op->x = mxCreateNumericMatrix((mwSize)macro_max(m, 0),
+            (mwSize)macro_max(n, 0), toClassID<T>(),
+            isComplex<T>() ? mxCOMPLEX : mxREAL);
+      mexMakeArrayPersistent(x);
+      op->xCapacity = size;
+   }
+   else {
+      mxSetM(x, (mwSize)macro_max(m, 0));
+      mxSetN(x, (mwSize)macro_max(n, 0));
+   }
+
+   // Copy the content of y into the mxArray
+
+   R *pxr = (R *)mxGetData(x), *pxi = (R *)mxGetImagData(x);
+   for (I i = 0; i < n; i++) {
+      for (I j = 0; j < m; j++) {
+         pxr[m * i + j] = std::real(y[ldy * i + j]);
+         if (pxi) pxi[m * i + j] = std::imag(y[ldy * i + j]);
+      }
+   }
+
+   return x;
+}
+
+#ifdef USE_GPUARRAY
+
+template <typename T, typename I>
+static mxArray *acquire_input_mxArray(MexOperator *op, T *y, I m, I n, I ldy,
+      GPU) {
+   (void)op;
+   return create_mxArray(y, m, n, ldy, GPU(), true);
+}
+
+#endif /* USE_GPUARRAY */
+
+// Free the mxArray returned by acquire_input_mxArray if it isn't persistent
+
+template <typename CPUGPU>
+static void release_input_mxArray(MexOperator *op, mxArray *x, void *y,
+      CPUGPU) {
+   if (x == op->x) return;
+   if (isCPU(CPUGPU()) && mxGetData(x) == y) mxSetData(x, NULL);
+   mxDestroyArray(x);
+}
+
+// Return a persistent string with the content of str owned by op
+
+static mxArray *mode_mxArray(MexOperator *op, const char *str) {
+   for (int i = 0; i < 3; i++) {
+      if (!op->modes[i]) {
+         op->modes[i] = mxCreateString(str);
+         mexMakeArrayPersistent(op->modes[i]);
+         op->modeNames[i] = str;
+      }
+      if (strcmp(op->modeNames[i], str) == 0) return op->modes[i];
+   }
+   mexErrMsgTxt("This should not happen");
+   return NULL;
+}
+
+// Return the conjugate of the k-th nonzero of a MATLAB sparse matrix with
+// values pr and, if complex, imaginary parts pi
+
+template <typename T>
+static inline T conjSparseValue(const double *pr, const double *pi, mwIndex k) {
+   (void)pi;
+   return (T)pr[k];
+}
+template <>
+inline std::complex<float> conjSparseValue<std::complex<float> >(
+      const double *pr, const double *pi, mwIndex k) {
+   return std::complex<float>((float)pr[k], pi ? -(float)pi[k] : 0.0f);
+}
+template <>
+inline std::complex<double> conjSparseValue<std::complex<double> >(
+      const double *pr, const double *pi, mwIndex k) {
+   return std::complex<double>(pr[k], pi ? -pi[k] : 0.0);
+}
+
+// Compute y = A' * x, where A is a MATLAB sparse matrix and ' is the
+// conjugate transpose. Every column of A produces a row of y, so the loop over
+// the columns is parallelized with OpenMP without races.
+// Arguments:
+// - A: sparse matrix
+// - blockSize: number of columns in x and y
+// - x, ldx: input matrix and its leading dimension
+// - y, ldy: output matrix and its leading dimension
+
+template <typename T>
+static void sparse_conj_transpose_matvec(const mxArray *A, int blockSize,
+      const T *x, PRIMME_INT ldx, T *y, PRIMME_INT ldy) {
+
+   const mwIndex *jc = mxGetJc(A), *ir = mxGetIr(A);
+   const double *pr = (const double *)mxGetData(A),
+                *pi = (const double *)mxGetImagData(A);
+   mwSignedIndex n = (mwSignedIndex)mxGetN(A);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided) if ((double)jc[n] * blockSize > 1e5)
+#endif
+   for (mwSignedIndex j = 0; j < n; j++) {
+      for (int b = 0; b < blockSize; b++) y[ldy * b + j] = 0.0;
+      for (mwIndex k = jc[j]; k < jc[j + 1]; k++) {
+         T a = conjSparseValue<T>(pr, pi, k);
+         for (int b = 0; b < blockSize; b++) {
+            y[ldy * b + j] += a * x[ldx * b + ir[k]];
+         }
+      }
+   }
+}
+
 // Template version of sprimme, cprimme, dprimme and zprimme
 
 static int tprimme(float *evals, float *evecs, float *resNorms, primme_params *primme, CPU) {
@@ -576,6 +761,15 @@ typename S<T, F, G>::t select_fun(primme_op_datatype t) {
       mexErrMsgTxtPrintf1("Argument %d should be function handler", (NARG)+2); \
    }
 
+// Check that argument NARG is a function handler or a sparse matrix in a MATLAB
+// function
+
+#define ASSERT_FUNCTION_OR_SPARSE(NARG) \
+   if (mxGetClassID(prhs[(NARG)]) != mxFUNCTION_CLASS && \
+         !(mxIsSparse(prhs[(NARG)]) && mxIsDouble(prhs[(NARG)]))) { \
+      mexErrMsgTxtPrintf1("Argument %d should be function handler or sparse matrix", (NARG)+2); \
+   }
+
 // Check that argument NARG is compatible with a number/string in a MATLAB function
 
 #define ASSERT_NUMERIC_OR_CHAR(NARG) \
@@ -728,9 +922,9 @@ static void mexFunction_primme_free(int nlhs, mxArray *plhs[], int nrhs,
 
    primme_params *primme = (primme_params*)mxArrayToPointer(prhs[0]);
    if (primme->targetShifts) delete [] primme->targetShifts;
-   if (primme->matrix) mxDestroyArray((mxArray*)primme->matrix);
-   if (primme->massMatrix) mxDestroyArray((mxArray*)primme->massMatrix);
-   if (primme->preconditioner) mxDestroyArray((mxArray*)primme->preconditioner);
+   destroyMexOperator((MexOperator*)primme->matrix);
+   destroyMexOperator((MexOperator*)primme->massMatrix);
+   destroyMexOperator((MexOperator*)primme->preconditioner);
    if (primme->convtest) mxDestroyArray((mxArray*)primme->convtest);
    if (primme->monitor) mxDestroyArray((mxArray*)primme->monitor);
    if (primme->commInfo) mxDestroyArray((mxArray*)primme->commInfo);
@@ -788,29 +982,23 @@ static void mexFunction_primme_set_member(int nlhs, mxArray *plhs[], int nrhs,
 
       case PRIMME_matrixMatvec:
       {
-         ASSERT_FUNCTION(2);
-         if (primme->matrix) mxDestroyArray((mxArray*)primme->matrix);
-         mxArray *a = mxDuplicateArray(prhs[2]);
-         mexMakeArrayPersistent(a);
-         primme->matrix = (void*)a;
+         ASSERT_FUNCTION_OR_SPARSE(2);
+         destroyMexOperator((MexOperator*)primme->matrix);
+         primme->matrix = createMexOperator(prhs[2], false);
          break;
       }
       case PRIMME_applyPreconditioner:
       {
          ASSERT_FUNCTION(2);
-         if (primme->preconditioner) mxDestroyArray((mxArray*)primme->preconditioner);
-         mxArray *a = mxDuplicateArray(prhs[2]);
-         mexMakeArrayPersistent(a);
-         primme->preconditioner = (void*)a;
+         destroyMexOperator((MexOperator*)primme->preconditioner);
+         primme->preconditioner = createMexOperator(prhs[2], false);
          break;
       }
       case PRIMME_massMatrixMatvec:
       {
-         ASSERT_FUNCTION(2);
-         if (primme->massMatrix) mxDestroyArray((mxArray*)primme->massMatrix);
-         mxArray *a = mxDuplicateArray(prhs[2]);
-         mexMakeArrayPersistent(a);
-         primme->massMatrix = (void*)a;
+         ASSERT_FUNCTION_OR_SPARSE(2);
+         destroyMexOperator((MexOperator*)primme->massMatrix);
+         primme->massMatrix = createMexOperator(prhs[2], false);
          break;
       }
       case PRIMME_convTestFun:
@@ -939,17 +1127,20 @@ static void mexFunction_primme_get_member(int nlhs, mxArray *plhs[], int nrhs,
 
       case PRIMME_matrixMatvec:
       {
-         plhs[0] = (mxArray*)primme->matrix;
+         plhs[0] = primme->matrix ?
+               mxDuplicateArray(((MexOperator*)primme->matrix)->f) : NULL;
          break;
       }
       case PRIMME_applyPreconditioner:
       {
-         plhs[0] = (mxArray*)primme->preconditioner;
+         plhs[0] = primme->preconditioner ?
+               mxDuplicateArray(((MexOperator*)primme->preconditioner)->f) : NULL;
          break;
       }
       case PRIMME_massMatrixMatvec:
       {
-         plhs[0] = (mxArray*)primme->massMatrix;
+         plhs[0] = primme->massMatrix ?
+               mxDuplicateArray(((MexOperator*)primme->massMatrix)->f) : NULL;
          break;
       }
       case PRIMME_convTestFun:
@@ -1056,7 +1247,8 @@ struct getMassMatrixField {
 // Auxiliary function for mexFunction_xprimme; PRIMME wrapper around
 // matrixMatvec, massMatrixMatvec and applyPreconditioner. Create a mxArray
 // from input vector x, call the function handler returned by F(primme) and
-// copy the content of its returned mxArray into the output vector y.
+// copy the content of its returned mxArray into the output vector y. If
+// F(primme) is a sparse matrix, which is Hermitian, do the product here.
 
 template <typename T, typename F, typename CPUGPU>
 struct matrixMatvecEigs {
@@ -1077,14 +1269,22 @@ struct matrixMatvecEigs {
 
       if (*blockSize <= 0) {*ierr = 0; return;}
 
+      MexOperator *op = (MexOperator*)F::get(primme);
+      if (isCPU(CPUGPU()) && mxIsSparse(op->f)) {
+         sparse_conj_transpose_matvec(
+               op->f, *blockSize, (T *)x, *ldx, (T *)y, *ldy);
+         *ierr = 0;
+         return;
+      }
+
       // Create input vector x (avoid copy if possible)
 
-      prhs[1] = create_mxArray(
-            (T *)x, primme->n, (PRIMME_INT)*blockSize, *ldx, CPUGPU(), true);
+      prhs[1] = acquire_input_mxArray(
+            op, (T *)x, primme->n, (PRIMME_INT)*blockSize, *ldx, CPUGPU());
 
       // Call the callback
 
-      prhs[0] = (mxArray*)F::get(primme);
+      prhs[0] = op->f;
       *ierr = mexCallMATLAB(1, plhs, 2, prhs, "feval");
 
       // Copy lhs[0] to y and destroy it
@@ -1095,10 +1295,9 @@ struct matrixMatvecEigs {
          mxDestroyArray(plhs[0]);
       }
 
-      // Destroy prhs[1]
+      // Destroy prhs[1] if it isn't persistent
 
-      if (isCPU(CPUGPU()) && mxGetData(prhs[1]) == x) mxSetData(prhs[1], NULL);
-      mxDestroyArray(prhs[1]); 
+      release_input_mxArray(op, prhs[1], x, CPUGPU());
    }
 };
 
@@ -1437,8 +1636,8 @@ static void mexFunction_primme_svds_free(int nlhs, mxArray *plhs[], int nrhs,
 
    primme_svds_params *primme_svds = (primme_svds_params*)mxArrayToPointer(prhs[0]);
    if (primme_svds->targetShifts) delete [] primme_svds->targetShifts;
-   if (primme_svds->matrix) mxDestroyArray((mxArray*)primme_svds->matrix);
-   if (primme_svds->preconditioner) mxDestroyArray((mxArray*)primme_svds->preconditioner);
+   destroyMexOperator((MexOperator*)primme_svds->matrix);
+   destroyMexOperator((MexOperator*)primme_svds->preconditioner);
    if (primme_svds->monitor) mxDestroyArray((mxArray*)primme_svds->monitor);
    if (primme_svds->convtest) mxDestroyArray((mxArray*)primme_svds->convtest);
    if (primme_svds->commInfo) mxDestroyArray((mxArray*)primme_svds->commInfo);
@@ -1496,20 +1695,16 @@ static void mexFunction_primme_svds_set_member(int nlhs, mxArray *plhs[],
 
       case PRIMME_SVDS_matrixMatvec: 
       {
-         ASSERT_FUNCTION(2);
-         if (primme_svds->matrix) mxDestroyArray((mxArray*)primme_svds->matrix);
-         mxArray *a = mxDuplicateArray(prhs[2]);
-         mexMakeArrayPersistent(a);
-         primme_svds->matrix = (void*)a;
+         ASSERT_FUNCTION_OR_SPARSE(2);
+         destroyMexOperator((MexOperator*)primme_svds->matrix);
+         primme_svds->matrix = createMexOperator(prhs[2], true);
          break;
       }
       case PRIMME_SVDS_applyPreconditioner:
       {
          ASSERT_FUNCTION(2);
-         if (primme_svds->preconditioner) mxDestroyArray((mxArray*)primme_svds->preconditioner);
-         mxArray *a = mxDuplicateArray(prhs[2]);
-         mexMakeArrayPersistent(a);
-         primme_svds->preconditioner = (void*)a;
+         destroyMexOperator((MexOperator*)primme_svds->preconditioner);
+         primme_svds->preconditioner = createMexOperator(prhs[2], false);
          break;
       }
       case PRIMME_SVDS_convTestFun:
@@ -1637,12 +1832,14 @@ static void mexFunction_primme_svds_get_member(int nlhs, mxArray *plhs[],
 
       case PRIMME_SVDS_matrixMatvec: 
       {
-         plhs[0] = (mxArray*)primme_svds->matrix;
+         plhs[0] = primme_svds->matrix ?
+               mxDuplicateArray(((MexOperator*)primme_svds->matrix)->f) : NULL;
          break;
       }
       case PRIMME_SVDS_applyPreconditioner:
       {
-         plhs[0] = (mxArray*)primme_svds->preconditioner;
+         plhs[0] = primme_svds->preconditioner ?
+               mxDuplicateArray(((MexOperator*)primme_svds->preconditioner)->f) : NULL;
          break;
       }
       case PRIMME_SVDS_convTestFun:
@@ -1744,30 +1941,39 @@ static void mexFunction_primme_svds_get_member(int nlhs, mxArray *plhs[],
 // - primme_svds: primme_svds_params
 // - mx: return the number of rows of input vectors x
 // - my: return the number of rows of output vectors y
+// - op: return the operator
+// - sp: return the sparse matrix B such that the product is B' * x, or NULL
+//       if the operator is a function handle
 // - str: return the corresponding string for mode (notransp/transp or
 //        AHA/AAH/aug).
 
 struct getSvdsForMatrix {
    static void get(int transpose, primme_svds_params *primme_svds,
-         PRIMME_INT *mx, PRIMME_INT *my, mxArray **AFUN, const char **str) {
-      *AFUN = (mxArray*)primme_svds->matrix;
+         PRIMME_INT *mx, PRIMME_INT *my, MexOperator **op, const mxArray **sp,
+         const char **str) {
+      *op = (MexOperator*)primme_svds->matrix;
+      *sp = NULL;
       if (transpose == 0) { /* Doing y <- A * x */
          *mx = primme_svds->n;
          *my = primme_svds->m;
          *str = "notransp";
+         if (mxIsSparse((*op)->f)) *sp = (*op)->fh;
       }
       else { /* Doing y <- A' * x */
          *mx = primme_svds->m;
          *my = primme_svds->n;
          *str = "transp";
+         if (mxIsSparse((*op)->f)) *sp = (*op)->f;
       }
    }
 };
 
 struct getSvdsForPreconditioner {
    static void get(int mode, primme_svds_params *primme_svds,
-         PRIMME_INT *mx, PRIMME_INT *my, mxArray **AFUN, const char **str) {
-      *AFUN = (mxArray*)primme_svds->preconditioner;
+         PRIMME_INT *mx, PRIMME_INT *my, MexOperator **op, const mxArray **sp,
+         const char **str) {
+      *op = (MexOperator*)primme_svds->preconditioner;
+      *sp = NULL;
       if (mode == primme_svds_op_AtA) {
          /* Preconditioner for A^t*A */
          *mx = *my = primme_svds->n;
@@ -1797,7 +2003,8 @@ struct getSvdsForPreconditioner {
 // from input vector x, call the function handler returned by F and
 // copy the content of its returned mxArray into the output vector y. The
 // functor F returns also the number of rows in x and y and the string
-// passed in callback depending on mode.
+// passed in callback depending on mode. If F returns a sparse matrix, do the
+// product here.
 
 template <typename T, typename F, typename CPUGPU>
 struct matrixMatvecSvds {
@@ -1822,15 +2029,24 @@ struct matrixMatvecSvds {
 
       // Get numbers of rows of x and y
       PRIMME_INT mx, my;
+      MexOperator *op;
+      const mxArray *sp;
       const char *str;
-      F::get(*mode, primme_svds, &mx, &my, &prhs[0], &str);
+      F::get(*mode, primme_svds, &mx, &my, &op, &sp, &str);
       assert(mx > 0);
 
+      if (isCPU(CPUGPU()) && sp) {
+         sparse_conj_transpose_matvec(sp, *blockSize, (T *)x, *ldx, (T *)y, *ldy);
+         *ierr = 0;
+         return;
+      }
+
       // Create input vector x (avoid copy if possible)
 
-      prhs[1] = create_mxArray(
-            (T *)x, mx, (PRIMME_INT)*blockSize, *ldx, CPUGPU(), true);
-      prhs[2] = mxCreateString(str);
+      prhs[0] = op->f;
+      prhs[1] = acquire_input_mxArray(
+            op, (T *)x, mx, (PRIMME_INT)*blockSize, *ldx, CPUGPU());
+      prhs[2] = mode_mxArray(op, str);
 
       // Call the callback
 
@@ -1844,11 +2060,9 @@ struct matrixMatvecSvds {
          mxDestroyArray(plhs[0]);
       }
 
-      // Destroy prhs[*]
+      // Destroy prhs[1] if it isn't persistent
 
-      if (isCPU(CPUGPU()) && mxGetData(prhs[1]) == x) mxSetData(prhs[1], NULL);
-      mxDestroyArray(prhs[1]); 
-      mxDestroyArray(prhs[2]); 
+      release_input_mxArray(op, prhs[1], x, CPUGPU());
    }
 };
 
@@ -510,6 +510,11 @@ function [varargout] = primme_svds(varargin)
       % Set other options in primme_svds_params
       primme_svds_set_members(opts, primme_svds);
 
+      % Let the mex multiply by sparse matrices without calling MATLAB
+      if ~Agpu && isnumeric(A) && issparse(A)
+         primme_mex('primme_svds_set_member', primme_svds, 'matrixMatvec', A);
+      end
+
       % Set method in primme_svds_params
       primme_mex('primme_svds_set_method', method, primmeStage0method, ...
                                            primmeStage1method, primme_svds);
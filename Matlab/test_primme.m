@@ -244,6 +244,17 @@ for i = 1:numel(eigs_meths)
                              eigs_meths{i});
 end
 
+% Test products with complex sparse matrices done in the mex
+
+A = sparse(diag(1:50) + diag(1i*ones(49,1), 1) - diag(1i*ones(49,1), -1));
+evals = primme_eigs(A, 5, 'LA', struct('tol', 1e-10));
+d = sort(eig(full(A)), 'descend');
+assert(norm(evals - d(1:5)) < 1e-6)
+A = A(:, 1:40);
+svals = primme_svds(A, 5, 'L', struct('tol', 1e-10));
+s = svd(full(A));
+assert(norm(svals - s(1:5)) < 1e-6)
+
 % Test returning unconverged pairs
 
 l = primme_eigs(diag(1:100),5,'LA',struct('maxit',1,'tol',1e-15,'locking',1,'returnUnconverged',true));
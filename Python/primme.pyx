@@ -1,10 +1,14 @@
 # cython: language_level=2, c_string_type=bytes, c_string_encoding=ascii, embedsignature=True
 
 import numpy as np
+import threading
 cimport numpy as np
 from scipy.sparse.linalg.interface import aslinearoperator
 cimport cython
 from cython cimport view
+from libc.stdint cimport int64_t
+from libc.limits cimport INT_MAX
+from scipy.linalg.cython_blas cimport sgemm, dgemm, cgemm, zgemm, sgemv, dgemv, cgemv, zgemv
 try:
     from builtins import bytes as bytesp23 # bytes compatibility Py2/3
 except Exception as e:
@@ -20,9 +24,6 @@ ctypedef fused numerics_real:
     float
     double
 
-# Exception captured in user-defined functions
-cpdef Exception __user_function_exception = None
-
 cdef np.dtype get_np_type(numerics *p):
     if numerics == double: return np.dtype(np.double)
     elif numerics == float: return np.dtype(np.float32)
@@ -58,12 +59,13 @@ cdef extern from "../include/primme.h":
     ctypedef int primme_preset_method
     ctypedef enum primme_type:
         primme_int, primme_double, primme_pointer
-    ctypedef enum primme_params_label: PRIMME_invalid_label
+    ctypedef enum primme_params_label:
+        PRIMME_invalid_label, PRIMME_matrix, PRIMME_massMatrix, PRIMME_preconditioner
     ctypedef int primme_event
-    int sprimme(float *evals, void *evecs, float *resNorms, primme_params *primme)
-    int cprimme(float *evals, void *evecs, float *resNorms, primme_params *primme)
-    int dprimme(double *evals, void *evecs, double *resNorms, primme_params *primme)
-    int zprimme(double *evals, void *evecs, double *resNorms, primme_params *primme)
+    int sprimme(float *evals, void *evecs, float *resNorms, primme_params *primme) nogil
+    int cprimme(float *evals, void *evecs, float *resNorms, primme_params *primme) nogil
+    int dprimme(double *evals, void *evecs, double *resNorms, primme_params *primme) nogil
+    int zprimme(double *evals, void *evecs, double *resNorms, primme_params *primme) nogil
     int magma_sprimme(float *evals, void *evecs, void *resNorms, primme_params *primme)
     int magma_cprimme(float *evals, void *evecs, void *resNorms, primme_params *primme)
     int magma_dprimme(double *evals, void *evecs, double *resNorms, primme_params *primme)
@@ -74,30 +76,55 @@ cdef extern from "../include/primme.h":
     void primme_initialize(primme_params *primme)
     int  primme_set_method(primme_preset_method method, primme_params *params)
     void primme_free(primme_params *primme)
-    int primme_get_member(primme_params *primme, primme_params_label label, void *value)
+    int primme_get_member(primme_params *primme, primme_params_label label, void *value) nogil
     int primme_set_member(primme_params *primme, primme_params_label label, void *value)
     int primme_member_info(primme_params_label *label, const char** label_name, primme_type *t, int *arity)
     int primme_constant_info(const char* label_name, int *value)
-
-# Block size passed in a callback such as matrixMatvec, massMatrixMatvec, applyPreconditioner
-cpdef int __current_block_size  = -1
-# Current primme_params running
-__current_primme_params = None
+    ctypedef struct primme_csr:
+        pass
+    primme_csr *sprimme_csr_create(np.int64_t m, np.int64_t n, const int *rowptr, const int *colind, const void *values, int base)
+    primme_csr *cprimme_csr_create(np.int64_t m, np.int64_t n, const int *rowptr, const int *colind, const void *values, int base)
+    primme_csr *dprimme_csr_create(np.int64_t m, np.int64_t n, const int *rowptr, const int *colind, const void *values, int base)
+    primme_csr *zprimme_csr_create(np.int64_t m, np.int64_t n, const int *rowptr, const int *colind, const void *values, int base)
+    primme_csr *sprimme_csr_create64(np.int64_t m, np.int64_t n, const int64_t *rowptr, const int64_t *colind, const void *values, int base)
+    primme_csr *cprimme_csr_create64(np.int64_t m, np.int64_t n, const int64_t *rowptr, const int64_t *colind, const void *values, int base)
+    primme_csr *dprimme_csr_create64(np.int64_t m, np.int64_t n, const int64_t *rowptr, const int64_t *colind, const void *values, int base)
+    primme_csr *zprimme_csr_create64(np.int64_t m, np.int64_t n, const int64_t *rowptr, const int64_t *colind, const void *values, int base)
+    int primme_csr_apply(primme_csr *A, int transpose, int blockSize, void *x, np.int64_t ldx, void *y, np.int64_t ldy) nogil
+    int primme_csr_destroy(primme_csr *A)
+
+# Callback running in the current thread, as (PrimmeParams, primme_params
+# address, block size); used by get_eigsh_param
+__callback = threading.local()
 
 cdef class PrimmeParams:
     cpdef primme_params *pp
+    # Python objects of the fields that point to a native_operator
+    cdef dict objects
+    # Exception captured in user-defined functions
+    cdef object user_function_exception
     def __cinit__(self):
         self.pp = primme_params_create()
         if self.pp is NULL:
             raise MemoryError()
+        self.objects = {}
+        # The callbacks find this object through primme->commInfo, which is
+        # not used otherwise by the Python interface
+        primme_params_set_pointer(self.pp, "commInfo", <void*>self)
 
     def __dealloc__(self):
         if self.pp is not NULL:
             primme_params_destroy(self.pp)
 
 def __primme_params_get(PrimmeParams pp_, field_):
+    return primme_params_get_field(pp_, pp_.pp, -1, field_)
+
+cdef object primme_params_get_field(PrimmeParams pp_, primme_params *primme, int blockSize, field_):
+    """
+    Return the field of primme; blockSize is the one passed to the running
+    callback, or -1 if there is none.
+    """
     field_ = bytesp23(field_, 'ASCII')
-    cdef primme_params *primme = <primme_params*>(pp_.pp)
     cdef const char* field = <const char *>field_
     cdef primme_params_label l = PRIMME_invalid_label
     cdef primme_type t
@@ -108,11 +135,10 @@ def __primme_params_get(PrimmeParams pp_, field_):
     if field_ == bytesp23(b'ShiftsForPreconditioner'):
         if r != 0:
             raise ValueError("Invalid field '%s'" % field_)
-        global __current_block_size
-        if __current_block_size < 0: raise ValueError('Getting ShiftsForPreconditioner from an invalid callback')
-        if __current_block_size == 0: return []
+        if blockSize < 0: raise ValueError('Getting ShiftsForPreconditioner from an invalid callback')
+        if blockSize == 0: return []
         primme_get_member(primme, l, &v_pvoid)
-        return <double[:__current_block_size]> <double *>v_pvoid
+        return <double[:blockSize]> <double *>v_pvoid
 
     if r != 0 or arity != 1:
         raise ValueError("Invalid field '%s'" % field_)
@@ -125,6 +151,7 @@ def __primme_params_get(PrimmeParams pp_, field_):
         primme_get_member(primme, l, &v_double)
         return v_double
     elif t == primme_pointer:
+        if field_ in pp_.objects: return pp_.objects[field_]
         primme_get_member(primme, l, &v_pvoid)
         return <object>v_pvoid
     else:
@@ -210,46 +237,58 @@ cdef void primme_params_set_doubles(primme_params *primme, cython.p_char field,
     assert(r == 0, "Invalid field '%s'" % <bytes>field)
 
 
+cdef PrimmeParams primme_params_owner(primme_params *primme):
+    """Return the PrimmeParams whose solve is calling back with primme"""
+    return <PrimmeParams>primme_params_get_object(primme, "commInfo")
+
+cdef object callback_enter(primme_params *primme, int blockSize):
+    """
+    Make primme the parameters returned by get_eigsh_param in this thread,
+    and return the previous ones for callback_leave.
+    """
+    prev = getattr(__callback, 'current', None)
+    __callback.current = (primme_params_owner(primme), <size_t>primme, blockSize)
+    return prev
+
+cdef void callback_leave(prev):
+    __callback.current = prev
+
 cdef void c_matvec_gen_numpy(cython.p_char operator, numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr):
-    global __current_block_size
     if blockSize[0] <= 0:
         ierr[0] = 0
-        __current_block_size = -1
         return
     ierr[0] = 1
     cdef object matvec 
     cdef numerics[::1, :] x_view
-    global __user_function_exception
+    prev = callback_enter(primme, blockSize[0])
     try:
-        __current_block_size = blockSize[0]
         matvec = primme_params_get_object(primme, operator)
         if matvec is None: raise RuntimeError("Not defined function for %s" % <bytes>operator)
         n = primme_params_get_int(primme, "nLocal")
         x_view = <numerics[:ldx[0]:1, :blockSize[0]]> x
         (<numerics[:ldy[0]:1, :blockSize[0]]>y)[:n,:] = matvec(x_view[0:n,:]).astype(get_np_type(x), order='F', copy=False)
         ierr[0] = 0
-        __current_block_size = -1
     except Exception as e:
-        __user_function_exception = e
-        __current_block_size = -1
+        primme_params_owner(primme).user_function_exception = e
+    callback_leave(prev)
 
-cdef void c_matvec_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr):
+cdef void c_matvec_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr) with gil:
     c_matvec_gen_numpy("matrix", x, ldx, y, ldy, blockSize, primme, ierr)
 
-cdef void c_massmatvec_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr):
+cdef void c_massmatvec_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr) with gil:
     c_matvec_gen_numpy("massMatrix", x, ldx, y, ldy, blockSize, primme, ierr)
 
-cdef void c_precond_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr):
+cdef void c_precond_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr) with gil:
     c_matvec_gen_numpy("preconditioner", x, ldx, y, ldy, blockSize, primme, ierr)
 
-cdef void c_monitor(numerics_real *basisEvals, int *basisSize, int *basisFlags, int *iblock, int *blockSize, numerics_real *basisNorms, int *numConverged, numerics_real *lockedEvals, int *numLocked, int *lockedFlags, numerics_real *lockedNorms, int *inner_its, numerics_real *LSRes, const char *msg, double *time, primme_event *event, primme_params *primme, int *ierr):
+cdef void c_monitor(numerics_real *basisEvals, int *basisSize, int *basisFlags, int *iblock, int *blockSize, numerics_real *basisNorms, int *numConverged, numerics_real *lockedEvals, int *numLocked, int *lockedFlags, numerics_real *lockedNorms, int *inner_its, numerics_real *LSRes, const char *msg, double *time, primme_event *event, primme_params *primme, int *ierr) with gil:
     ierr[0] = 1
     cdef object monitor = primme_params_get_object(primme, 'monitor')
     if monitor is None: return
     cdef int bs = basisSize[0] if basisSize is not NULL else 0
     cdef int blks = blockSize[0] if blockSize is not NULL else 0
     cdef int nLocked = numLocked[0] if numLocked is not NULL else 0
-    global __user_function_exception
+    prev = callback_enter(primme, -1)
     try:
         monitor(
             <numerics_real[:bs]>basisEvals if basisEvals is not NULL and bs > 0 else None,
@@ -265,13 +304,14 @@ cdef void c_monitor(numerics_real *basisEvals, int *basisSize, int *basisFlags,
             event[0] if event is not NULL else None)
         ierr[0] = 0
     except Exception as e:
-        __user_function_exception = e
+        primme_params_owner(primme).user_function_exception = e
+    callback_leave(prev)
 
-cdef void c_convtest(double *eval, numerics *evec, double *resNorm, int *isconv, primme_params *primme, int *ierr):
+cdef void c_convtest(double *eval, numerics *evec, double *resNorm, int *isconv, primme_params *primme, int *ierr) with gil:
     ierr[0] = 1
     cdef object convtest = primme_params_get_object(primme, 'convtest')
     if convtest is None: return
-    global __user_function_exception
+    prev = callback_enter(primme, -1)
     try:
         n = primme_params_get_int(primme, "nLocal")
         isconv[0] = 1 if convtest(eval[0] if eval is not NULL else None,
@@ -279,14 +319,167 @@ cdef void c_convtest(double *eval, numerics *evec, double *resNorm, int *isconv,
             resNorm[0] if resNorm is not NULL else None) else 0
         ierr[0] = 0
     except Exception as e:
-        __user_function_exception = e
+        primme_params_owner(primme).user_function_exception = e
+    callback_leave(prev)
  
+# Operator given as a CSR/CSC matrix or an ndarray, applied without calling Python
+cdef struct native_operator:
+    primme_csr *csr   # sparse matrix, or NULL
+    int transpose     # if nonzero, csr holds the transpose of the operator
+    void *a           # dense matrix in column-major, or NULL
+    int m, n, lda     # dimensions of the operator and leading dimension of a
+    int ta            # if nonzero, a holds the transpose of the operator
+    char dtype        # type of the values: 'f', 'd', 'F' or 'D'
+
+cdef class NativeOperator:
+    cdef native_operator op
+    cdef object arrays # arrays referenced by op
+    def __dealloc__(self):
+        primme_csr_destroy(self.op.csr)
+
+cdef NativeOperator native_operator_create(A, dtype, bint hermitian):
+    """
+    Return a NativeOperator that multiplies by A with the values of A in
+    place, or None if A is not a CSR or CSC matrix or a contiguous ndarray
+    with type dtype. If hermitian, only products with A are supported.
+    """
+    cdef NativeOperator nop = NativeOperator()
+    cdef native_operator *op = &nop.op
+    cdef void *rowptr
+    cdef void *colind
+    cdef void *values
+    cdef np.int64_t m, n
+    dtype = np.dtype(dtype)
+    if (dtype.char not in 'fdFD' or getattr(A, 'dtype', None) != dtype
+            or len(getattr(A, 'shape', ())) != 2):
+        return None
+    op.dtype = ord(dtype.char)
+    fmt = getattr(A, 'format', None)
+    if fmt in ('csr', 'csc') and hasattr(A, 'indptr'):
+        # The CSC arrays of A are the CSR arrays of A.'; for a real
+        # symmetric matrix they are the ones of A
+        if fmt == 'csr':
+            m, n = A.shape
+        elif dtype.kind != 'c':
+            n, m = A.shape
+            op.transpose = 0 if hermitian else 1
+        else:
+            return None
+        arrays = (A.indptr, A.indices, A.data)
+        if (A.indptr.dtype != A.indices.dtype or A.indptr.shape[0] != m+1
+                or not all(x.flags.c_contiguous for x in arrays)):
+            return None
+        rowptr = <void*><size_t>A.indptr.ctypes.data
+        colind = <void*><size_t>A.indices.ctypes.data
+        values = <void*><size_t>A.data.ctypes.data
+        if A.indptr.dtype == np.int32:
+            if dtype.char == 'f': op.csr = sprimme_csr_create(m, n, <int*>rowptr, <int*>colind, values, 0)
+            elif dtype.char == 'd': op.csr = dprimme_csr_create(m, n, <int*>rowptr, <int*>colind, values, 0)
+            elif dtype.char == 'F': op.csr = cprimme_csr_create(m, n, <int*>rowptr, <int*>colind, values, 0)
+            else: op.csr = zprimme_csr_create(m, n, <int*>rowptr, <int*>colind, values, 0)
+        elif A.indptr.dtype == np.int64:
+            if dtype.char == 'f': op.csr = sprimme_csr_create64(m, n, <int64_t*>rowptr, <int64_t*>colind, values, 0)
+            elif dtype.char == 'd': op.csr = dprimme_csr_create64(m, n, <int64_t*>rowptr, <int64_t*>colind, values, 0)
+            elif dtype.char == 'F': op.csr = cprimme_csr_create64(m, n, <int64_t*>rowptr, <int64_t*>colind, values, 0)
+            else: op.csr = zprimme_csr_create64(m, n, <int64_t*>rowptr, <int64_t*>colind, values, 0)
+        if op.csr is NULL:
+            return None
+    elif isinstance(A, np.ndarray) and max(A.shape) <= INT_MAX:
+        # A C-ordered array is A.' in column-major; A' is not available
+        # for complex types
+        arrays = (A,)
+        if A.flags.f_contiguous:
+            op.lda = max(A.shape[0], 1)
+        elif A.flags.c_contiguous and (hermitian or dtype.kind != 'c'):
+            op.lda = max(A.shape[1], 1)
+            op.ta = 1
+        else:
+            return None
+        op.a = <void*><size_t>A.ctypes.data
+    else:
+        return None
+    op.m, op.n = A.shape
+    nop.arrays = arrays
+    return nop
+
+cdef int native_apply(native_operator *op, int transpose, int k, void *x, np.int64_t ldx, void *y, np.int64_t ldy) nogil:
+    """Compute y = A*x or, if transpose, y = A'*x"""
+    cdef char ta = b'N'
+    cdef char tb = b'N'
+    cdef int m = op.n if transpose else op.m
+    cdef int n = op.m if transpose else op.n
+    cdef int ldx_ = <int>ldx, ldy_ = <int>ldy, inc = 1
+    cdef int ma = op.n if op.ta else op.m # rows of a
+    cdef int na = op.m if op.ta else op.n # columns of a
+    cdef float one_s = 1, zero_s = 0
+    cdef double one_d = 1, zero_d = 0
+    cdef float complex one_c = 1, zero_c = 0
+    cdef double complex one_z = 1, zero_z = 0
+    if op.csr is not NULL:
+        return primme_csr_apply(op.csr, transpose != op.transpose, k, x, ldx, y, ldy)
+    if k <= 0 or m <= 0: return 0
+    if ldx > INT_MAX or ldy > INT_MAX: return -1
+    if op.ta:
+        ta = b'N' if transpose else b'T'
+    elif transpose:
+        ta = b'C'
+    if k == 1:
+        if op.dtype == b'f':
+            sgemv(&ta, &ma, &na, &one_s, <float*>op.a, &op.lda, <float*>x, &inc, &zero_s, <float*>y, &inc)
+        elif op.dtype == b'd':
+            dgemv(&ta, &ma, &na, &one_d, <double*>op.a, &op.lda, <double*>x, &inc, &zero_d, <double*>y, &inc)
+        elif op.dtype == b'F':
+            cgemv(&ta, &ma, &na, &one_c, <float complex*>op.a, &op.lda, <float complex*>x, &inc, &zero_c, <float complex*>y, &inc)
+        else:
+            zgemv(&ta, &ma, &na, &one_z, <double complex*>op.a, &op.lda, <double complex*>x, &inc, &zero_z, <double complex*>y, &inc)
+    elif op.dtype == b'f':
+        sgemm(&ta, &tb, &m, &k, &n, &one_s, <float*>op.a, &op.lda, <float*>x, &ldx_, &zero_s, <float*>y, &ldy_)
+    elif op.dtype == b'd':
+        dgemm(&ta, &tb, &m, &k, &n, &one_d, <double*>op.a, &op.lda, <double*>x, &ldx_, &zero_d, <double*>y, &ldy_)
+    elif op.dtype == b'F':
+        cgemm(&ta, &tb, &m, &k, &n, &one_c, <float complex*>op.a, &op.lda, <float complex*>x, &ldx_, &zero_c, <float complex*>y, &ldy_)
+    else:
+        zgemm(&ta, &tb, &m, &k, &n, &one_z, <double complex*>op.a, &op.lda, <double complex*>x, &ldx_, &zero_z, <double complex*>y, &ldy_)
+    return 0
+
+cdef void c_matvec_gen_native(primme_params_label label, void *x, np.int64_t *ldx, void *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr) nogil:
+    cdef void *op = NULL
+    if blockSize[0] <= 0:
+        ierr[0] = 0
+        return
+    if primme_get_member(primme, label, &op) != 0 or op is NULL:
+        ierr[0] = 1
+        return
+    ierr[0] = native_apply(<native_operator*>op, 0, blockSize[0], x, ldx[0], y, ldy[0])
+
+cdef void c_matvec_native(void *x, np.int64_t *ldx, void *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr) nogil:
+    c_matvec_gen_native(PRIMME_matrix, x, ldx, y, ldy, blockSize, primme, ierr)
+
+cdef void c_massmatvec_native(void *x, np.int64_t *ldx, void *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr) nogil:
+    c_matvec_gen_native(PRIMME_massMatrix, x, ldx, y, ldy, blockSize, primme, ierr)
+
+cdef void c_precond_native(void *x, np.int64_t *ldx, void *y, np.int64_t *ldy, int *blockSize, primme_params *primme, int *ierr) nogil:
+    c_matvec_gen_native(PRIMME_preconditioner, x, ldx, y, ldy, blockSize, primme, ierr)
+ 
+def __copy_to(dst, src):
+    """
+    Copy src into dst, unless src is already the array dst. Return the number
+    of bytes copied.
+    """
+    if (isinstance(src, np.ndarray) and src.dtype == dst.dtype
+            and src.shape == dst.shape and src.strides == dst.strides
+            and src.ctypes.data == dst.ctypes.data):
+        return 0
+    dst[...] = src
+    return dst.nbytes
+
 def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
           ncv=None, maxiter=None, tol=0, return_eigenvectors=True,
           Minv=None, OPinv=None, mode='normal', lock=None,
           return_stats=False, maxBlockSize=0, minRestartSize=0,
           maxPrevRetain=0, method=None, return_unconverged=False,
-          return_history=False, convtest=None, raise_for_unconverged=True, **kargs):
+          return_history=False, convtest=None, raise_for_unconverged=True,
+          out=None, **kargs):
     """
     Find k eigenvalues and eigenvectors of the real symmetric square matrix
     or complex Hermitian matrix A.
@@ -394,6 +587,12 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     return_history: bool, optional
         If True, the function returns performance information at every iteration
         (see hist in Returns).
+    out : N x (i+k), ndarray, optional
+        Fortran-ordered array with the type of the problem where the
+        eigenvectors are computed, being i the columns of lock; the
+        returned v is a view of it. If lock is out[:, :i] or v0 is
+        out[:, i:i+j], they are not copied. For instance, out=v0 with k
+        columns computes the eigenvectors in place of v0.
 
     Returns
     -------
@@ -414,6 +613,7 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
         - "estimateMaxEVal": the rightmost Ritz value seen
         - "estimateLargestSVal": the largest singular value seen
         - "rnorms" : ||A*x[i] - x[i]*w[i]||
+        - "copiedBytes" : bytes copied from v0 and lock
         - "hist" : (if return_history) report at every outer iteration of:
 
           - "elapsedTime": time spent up to now
@@ -440,6 +640,12 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     This function is a wrapper to PRIMME functions to find the eigenvalues and
     eigenvectors [1]_.
 
+    If A, M or OPinv is a CSR matrix, a real CSC matrix, or a contiguous
+    array with the type of the problem, the products with it are computed
+    in C without calling Python and without copying the matrix. The GIL is
+    released during the solve, so several solves may run concurrently in
+    threads; the Python callbacks, if any, take the GIL.
+
     References
     ----------
     .. [1] PRIMME Software, https://github.com/primme/primme
@@ -481,6 +687,9 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     array([99., 98., 97.])
     """
 
+    # Operators that may be applied without calling Python
+    A0, M0, OPinv0 = A, M, OPinv
+
     A = aslinearoperator(A)
     PP = PrimmeParams()
     cdef primme_params *pp = PP.pp
@@ -635,6 +844,23 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
         if return_history:
             primme_params_set_pointer(pp, "monitorFun", <void*>c_monitor[double])
 
+    # Multiply by CSR/CSC matrices and arrays directly from the C callbacks
+    cdef NativeOperator nA = native_operator_create(A0, dtype, True)
+    cdef NativeOperator nM = native_operator_create(M0, dtype, True)
+    cdef NativeOperator nOPinv = native_operator_create(OPinv0, dtype, False)
+    if nA is not None:
+        PP.objects[b"matrix"] = A
+        primme_params_set_pointer(pp, "matrix", &nA.op)
+        primme_params_set_pointer(pp, "matrixMatvec", <void*>c_matvec_native)
+    if nM is not None:
+        PP.objects[b"massMatrix"] = M
+        primme_params_set_pointer(pp, "massMatrix", &nM.op)
+        primme_params_set_pointer(pp, "massMatrixMatvec", <void*>c_massmatvec_native)
+    if nOPinv is not None:
+        PP.objects[b"preconditioner"] = OPinv
+        primme_params_set_pointer(pp, "preconditioner", &nOPinv.op)
+        primme_params_set_pointer(pp, "applyPreconditioner", <void*>c_precond_native)
+
     cdef double[::1] evals_d, norms_d
     cdef float[::1] evals_s, norms_s
     cdef float[::1, :] evecs_s
@@ -650,7 +876,14 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     else:
         evals_s, norms_s = evals, norms
     
-    evecs = np.zeros((n, numOrthoConst+k), dtype, order='F')
+    if out is None:
+        evecs = np.zeros((n, numOrthoConst+k), dtype, order='F')
+    elif (not isinstance(out, np.ndarray) or out.dtype != dtype
+            or len(out.shape) != 2 or out.shape[0] != n
+            or out.shape[1] < numOrthoConst+k or not out.flags.f_contiguous):
+        raise ValueError('out: expected Fortran-ordered array of type %s and shape (%d, %d)' % (dtype, n, numOrthoConst+k))
+    else:
+        evecs = out[:, 0:numOrthoConst+k]
     if dtype.type is np.float64:
         evecs_d = evecs
     elif dtype.type is np.float32:
@@ -660,13 +893,14 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
     elif dtype.type is np.complex128:
         evecs_z = evecs
 
+    copiedBytes = 0
     if lock is not None:
-        np.copyto(evecs[:, 0:numOrthoConst], lock[:, 0:numOrthoConst])
+        copiedBytes += __copy_to(evecs[:, 0:numOrthoConst], lock[:, 0:numOrthoConst])
 
     if v0 is not None:
         initSize = min(v0.shape[1], k)
         __primme_params_set(PP, "initSize", initSize)
-        np.copyto(evecs[:, numOrthoConst:numOrthoConst+initSize],
+        copiedBytes += __copy_to(evecs[:, numOrthoConst:numOrthoConst+initSize],
             v0[:, 0:initSize])
 
     if maxBlockSize:
@@ -686,23 +920,24 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
             raise ValueError('Not valid "method": %s' % method)
         primme_set_method(<primme_preset_method>method_int, pp)
  
-    global __user_function_exception
-    __user_function_exception = None
-    global __current_primme_params
-    __current_primme_params = PP
+    PP.user_function_exception = None
+    cdef int err
     if dtype.type is np.complex64:
-        err = cprimme(&evals_s[0], &evecs_c[0,0], &norms_s[0], pp)
+        with nogil:
+            err = cprimme(&evals_s[0], &evecs_c[0,0], &norms_s[0], pp)
     elif dtype.type is np.float32:
-        err = sprimme(&evals_s[0], &evecs_s[0,0], &norms_s[0], pp)
+        with nogil:
+            err = sprimme(&evals_s[0], &evecs_s[0,0], &norms_s[0], pp)
     elif dtype.type is np.float64:
-        err = dprimme(&evals_d[0], &evecs_d[0,0], &norms_d[0], pp)
+        with nogil:
+            err = dprimme(&evals_d[0], &evecs_d[0,0], &norms_d[0], pp)
     else:
-        err = zprimme(&evals_d[0], &evecs_z[0,0], &norms_d[0], pp)
-    __current_primme_params = None
+        with nogil:
+            err = zprimme(&evals_d[0], &evecs_z[0,0], &norms_d[0], pp)
 
     if err != 0:
-        if __user_function_exception is not None:
-            raise PrimmeError(err) from __user_function_exception
+        if PP.user_function_exception is not None:
+            raise PrimmeError(err) from PP.user_function_exception
         elif err == -3 and not return_unconverged and raise_for_unconverged:
             raise PrimmeError(err)
 
@@ -723,6 +958,7 @@ def eigsh(A, k=6, M=None, sigma=None, which='LM', v0=None,
             "numPreconds", "elapsedTime", "estimateMinEVal",
             "estimateMaxEVal", "estimateLargestSVal"])
         stats['rnorms'] = norms
+        stats['copiedBytes'] = copiedBytes
         if return_history:
             stats["hist"] = hist
         result.append(stats)
@@ -833,25 +1069,28 @@ def get_eigsh_param(field):
     >>> Pop = scipy.sparse.linalg.LinearOperator(A.shape, matvec=P, matmat=P)
     >>> evals, evecs = primme.eigsh(A, 3, OPinv=Pop, tol=1e-3, which='LA')
     """ 
-    if __current_primme_params is None:
+    current = getattr(__callback, 'current', None)
+    if current is None:
         raise RuntimeError("no eigsh running; call this function within a callback function while `eigsh` is running")
 
-    return __primme_params_get(__current_primme_params, field)
+    PP, primme, blockSize = current
+    return primme_params_get_field(PP, <primme_params*><size_t>primme, blockSize, field)
  
 cdef extern from "../include/primme.h":
     struct primme_svds_params:
         pass
     ctypedef int primme_svds_preset_method
-    ctypedef enum primme_svds_params_label: PRIMME_SVDS_invalid_label
+    ctypedef enum primme_svds_params_label:
+        PRIMME_SVDS_invalid_label, PRIMME_SVDS_matrix
     ctypedef enum primme_svds_operator:
         primme_svds_op_none,
         primme_svds_op_AtA,
         primme_svds_op_AAt,
         primme_svds_op_augmented
-    int sprimme_svds(float *svals, void *svecs, float *resNorms, primme_svds_params *primme_svds)
-    int cprimme_svds(float *svals, void *svecs, float *resNorms, primme_svds_params *primme_svds)
-    int dprimme_svds(double *svals, void *svecs, double *resNorms, primme_svds_params *primme_svds)
-    int zprimme_svds(double *svals, void *svecs, double *resNorms, primme_svds_params *primme_svds)
+    int sprimme_svds(float *svals, void *svecs, float *resNorms, primme_svds_params *primme_svds) nogil
+    int cprimme_svds(float *svals, void *svecs, float *resNorms, primme_svds_params *primme_svds) nogil
+    int dprimme_svds(double *svals, void *svecs, double *resNorms, primme_svds_params *primme_svds) nogil
+    int zprimme_svds(double *svals, void *svecs, double *resNorms, primme_svds_params *primme_svds) nogil
     int magma_sprimme_svds(float *svals, void *svecs, float *resNorms, primme_svds_params *primme_svds)
     int magma_cprimme_svds(float *svals,  void *svecs, float *resNorms, primme_svds_params *primme_svds)
     int magma_dprimme_svds(double *svals, void *svecs, double *resNorms, primme_svds_params *primme_svds)
@@ -861,7 +1100,7 @@ cdef extern from "../include/primme.h":
     void primme_svds_initialize(primme_svds_params *primme_svds)
     int primme_svds_set_method(primme_svds_preset_method method, primme_preset_method methodStage1, primme_preset_method methodStage2, primme_svds_params *primme_svds)
     void primme_svds_free(primme_svds_params *primme_svds)
-    int primme_svds_get_member(primme_svds_params *primme_svds, primme_svds_params_label label, void *value)
+    int primme_svds_get_member(primme_svds_params *primme_svds, primme_svds_params_label label, void *value) nogil
     int primme_svds_set_member(primme_svds_params *primme_svds, primme_svds_params_label label, void *value)
     int primme_svds_member_info(primme_svds_params_label *label, const char** label_name, primme_type *t, int *arity)
     int primme_svds_constant_info(const char* label_name, int *value)
@@ -869,10 +1108,18 @@ cdef extern from "../include/primme.h":
 
 cdef class PrimmeSvdsParams:
     cpdef primme_svds_params *pp
+    # Python objects of the fields that point to a native_operator
+    cdef dict objects
+    # Exception captured in user-defined functions
+    cdef object user_function_exception
     def __cinit__(self):
         self.pp = primme_svds_params_create()
         if self.pp is NULL:
             raise MemoryError()
+        self.objects = {}
+        # The callbacks find this object through primme_svds->commInfo, which
+        # is not used otherwise by the Python interface
+        primme_svds_params_set_pointer(self.pp, "commInfo", <void*>self)
 
     def __dealloc__(self):
         if self.pp is not NULL:
@@ -898,6 +1145,7 @@ def __primme_svds_params_get(PrimmeSvdsParams pp_, field_):
         primme_svds_get_member(primme_svds, l, &v_double)
         return v_double
     elif t == primme_pointer:
+        if field_ in pp_.objects: return pp_.objects[field_]
         primme_svds_get_member(primme_svds, l, &v_pvoid)
         return <object>v_pvoid
     else:
@@ -983,14 +1231,17 @@ cdef void primme_svds_params_set_doubles(primme_svds_params *primme_svds, cython
     assert(r == 0, "Invalid field '%s'" % <bytes>field)
 
 
-cdef void c_svds_matvec_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, int *transpose, primme_svds_params *primme_svds, int *ierr):
+cdef PrimmeSvdsParams primme_svds_params_owner(primme_svds_params *primme_svds):
+    """Return the PrimmeSvdsParams whose solve is calling back with primme_svds"""
+    return <PrimmeSvdsParams>primme_svds_params_get_object(primme_svds, "commInfo")
+
+cdef void c_svds_matvec_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, int *transpose, primme_svds_params *primme_svds, int *ierr) with gil:
     if blockSize[0] <= 0:
         ierr[0] = 0
         return
     ierr[0] = 1
     cdef object A 
     cdef numerics[:, :] x_view
-    global __user_function_exception
     try:
         A = primme_svds_params_get_object(primme_svds, 'matrix')
         if A is None: raise RuntimeError("Not defined function for the matrix problem")
@@ -1003,17 +1254,26 @@ cdef void c_svds_matvec_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int6
                 (<numerics[:ldy[0]:1, :blockSize[0]]> y)[:n,:] = A.H.matmat(x_view[:m,:]).astype(get_np_type(x), order='F', copy=False)
         ierr[0] = 0
     except Exception as e:
-        __user_function_exception = e
+        primme_svds_params_owner(primme_svds).user_function_exception = e
 
 
-cdef void c_svds_precond_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, primme_svds_operator *mode, primme_svds_params *primme_svds, int *ierr):
+cdef void c_svds_matvec_native(void *x, np.int64_t *ldx, void *y, np.int64_t *ldy, int *blockSize, int *transpose, primme_svds_params *primme_svds, int *ierr) nogil:
+    cdef void *op = NULL
+    if blockSize[0] <= 0:
+        ierr[0] = 0
+        return
+    if primme_svds_get_member(primme_svds, PRIMME_SVDS_matrix, &op) != 0 or op is NULL:
+        ierr[0] = 1
+        return
+    ierr[0] = native_apply(<native_operator*>op, transpose[0], blockSize[0], x, ldx[0], y, ldy[0])
+
+cdef void c_svds_precond_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int64_t *ldy, int *blockSize, primme_svds_operator *mode, primme_svds_params *primme_svds, int *ierr) with gil:
     if blockSize[0] <= 0:
         ierr[0] = 0
         return
     ierr[0] = 1
     cdef object precond 
     cdef numerics[::1, :] x_view
-    global __user_function_exception
     try:
         precond = primme_svds_params_get_object(primme_svds, 'preconditioner')
         if precond is None: raise RuntimeError("Not defined function for the preconditioner")
@@ -1030,11 +1290,11 @@ cdef void c_svds_precond_numpy(numerics *x, np.int64_t *ldx, numerics *y, np.int
             return
         ierr[0] = 0
     except Exception as e:
-        __user_function_exception = e
+        primme_svds_params_owner(primme_svds).user_function_exception = e
 
 cdef void c_svds_monitor(numerics_real *basisSvals, int *basisSize, int *basisFlags, int *iblock, int *blockSize,
       numerics_real *basisNorms, int *numConverged, numerics_real *lockedSvals, int *numLocked, int *lockedFlags, numerics_real *lockedNorms,
-      int *inner_its, numerics_real *LSRes, const char *msg, double *time, primme_event *event, int *stage, primme_svds_params *primme_svds, int *ierr):
+      int *inner_its, numerics_real *LSRes, const char *msg, double *time, primme_event *event, int *stage, primme_svds_params *primme_svds, int *ierr) with gil:
     ierr[0] = 1
     cdef object monitor = primme_svds_params_get_object(primme_svds, 'monitor')
     cdef int blks = blockSize[0] if blockSize is not NULL else 0
@@ -1055,11 +1315,10 @@ cdef void c_svds_monitor(numerics_real *basisSvals, int *basisSize, int *basisFl
         stage[0] if stage is not NULL else None)
     ierr[0] = 0
 
-cdef void c_svds_convtest(double *sval, numerics *svecleft, numerics *svecright, double *resNorm, int *method, int *isconv, primme_svds_params *primme_svds, int *ierr):
+cdef void c_svds_convtest(double *sval, numerics *svecleft, numerics *svecright, double *resNorm, int *method, int *isconv, primme_svds_params *primme_svds, int *ierr) with gil:
     ierr[0] = 1
     cdef object convtest = primme_svds_params_get_object(primme_svds, 'convtest')
     if convtest is None: return
-    global __user_function_exception
     try:
         m = primme_svds_params_get_int(primme_svds, "mLocal")
         n = primme_svds_params_get_int(primme_svds, "nLocal")
@@ -1069,7 +1328,7 @@ cdef void c_svds_convtest(double *sval, numerics *svecleft, numerics *svecright,
             resNorm[0] if resNorm is not NULL else None) else 0
         ierr[0] = 0
     except Exception as e:
-        __user_function_exception = e
+        primme_svds_params_owner(primme_svds).user_function_exception = e
  
 def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
          maxiter=None, return_singular_vectors=True,
@@ -1077,7 +1336,8 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
          u0=None, orthou0=None, orthov0=None,
          return_stats=False, maxBlockSize=0,
          method=None, methodStage1=None, methodStage2=None,
-         return_history=False, convtest=None, raise_for_unconverged=True, **kargs):
+         return_history=False, convtest=None, raise_for_unconverged=True,
+         out=None, **kargs):
     """
     Compute k singular values and vectors of the matrix A.
 
@@ -1148,6 +1408,12 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
         If True, the function returns extra information (see stats in Returns).
     return_history: bool, optional
         If True, the function returns performance information at every iteration
+    out : ndarray, shape=((M+N)*(i+k),), optional
+        Array with the type of the problem where the singular vectors are
+        computed, being i the columns of orthou0; u and vt.H are views of it.
+        Passing the u and vt.T returned by a previous call with the same out
+        as u0 and v0 (and orthou0 and orthov0) does not copy them. For complex
+        problems vt is a copy.
 
     Returns
     -------
@@ -1169,6 +1435,7 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
           and precAug
         - "elapsedTime": time that took 
         - "rnorms" : (||A*v[:,i] - sigma[i]*u[:,i]||**2 + ||A.H*u[:,i] - sigma[i]*v[:,i]||**2)**.5
+        - "copiedBytes" : bytes copied from u0, v0, orthou0 and orthov0, and into vt
         - "hist" : (if return_history) report at every outer iteration of:
 
           - "elapsedTime": time spent up to now
@@ -1189,6 +1456,12 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     This function is a wrapper to PRIMME functions to find singular values and
     vectors [1]_.
 
+    If A is a CSR matrix, a real CSC matrix, or a Fortran-ordered array (or
+    a real C-ordered one) with the type of the problem, the products with it
+    are computed in C without calling Python and without copying the matrix.
+    The GIL is released during the solve, so several solves may run
+    concurrently in threads; the Python callbacks, if any, take the GIL.
+
     References
     ----------
     .. [1] PRIMME Software, https://github.com/primme/primme
@@ -1239,6 +1512,9 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     PP = PrimmeSvdsParams()
     cdef primme_svds_params *pp = PP.pp
  
+    # Operator that may be applied without calling Python
+    A0 = A
+
     A = aslinearoperator(A)
 
     cdef int m, n
@@ -1395,6 +1671,13 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
         if return_history:
             primme_svds_params_set_pointer(pp, "monitorFun", <void*>c_svds_monitor[double])
 
+    # Multiply by CSR/CSC matrices and arrays directly from the C callbacks
+    cdef NativeOperator nA = native_operator_create(A0, dtype, False)
+    if nA is not None:
+        PP.objects[b"matrix"] = A
+        primme_svds_params_set_pointer(pp, "matrix", &nA.op)
+        primme_svds_params_set_pointer(pp, "matrixMatvec", <void*>c_svds_matvec_native)
+
     cdef double[::1] svals_d, norms_d
     cdef float[::1] svals_s, norms_s
     cdef float[::1] svecs_s
@@ -1410,7 +1693,14 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     else:
         svals_s, norms_s = svals, norms
  
-    svecs = np.empty(((m+n)*(numOrthoConst+k),), dtype)
+    if out is None:
+        svecs = np.empty(((m+n)*(numOrthoConst+k),), dtype)
+    elif (not isinstance(out, np.ndarray) or out.dtype != dtype
+            or len(out.shape) != 1 or out.shape[0] < (m+n)*(numOrthoConst+k)
+            or not out.flags.c_contiguous):
+        raise ValueError('out: expected contiguous array of type %s and shape (%d,)' % (dtype, (m+n)*(numOrthoConst+k)))
+    else:
+        svecs = out[0:(m+n)*(numOrthoConst+k)]
     if dtype.type is np.float64:
         svecs_d = svecs
     elif dtype.type is np.float32:
@@ -1437,30 +1727,35 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
         primme_svds_set_method(<primme_svds_preset_method>method_int, <primme_preset_method>methodStage1_int, <primme_preset_method>methodStage2_int, pp)
 
     cdef int initSize = 0
+    copiedBytes = 0
     if v0 is not None:
         initSize = min(v0.shape[1], k)
         __primme_svds_params_set(PP, "initSize", initSize)
-        svecs[m*numOrthoConst:m*(numOrthoConst+initSize)].reshape((m,initSize), order='F')[:,:] = u0[:,:initSize]
-        svecs[m*(numOrthoConst+initSize)+n*numOrthoConst:(m+n)*(numOrthoConst+initSize)].reshape((n,initSize), order='F')[:,:] = v0[:,:initSize]
+        copiedBytes += __copy_to(svecs[m*numOrthoConst:m*(numOrthoConst+initSize)].reshape((m,initSize), order='F'), u0[:,:initSize])
+        copiedBytes += __copy_to(svecs[m*(numOrthoConst+initSize)+n*numOrthoConst:(m+n)*(numOrthoConst+initSize)].reshape((n,initSize), order='F'), v0[:,:initSize])
 
     if orthou0 is not None:
-        svecs[0:m*numOrthoConst].reshape((m,numOrthoConst), order='F')[:,:] = orthou0[:,0:numOrthoConst]
-        svecs[m*(numOrthoConst+initSize):m*(numOrthoConst+initSize)+n*numOrthoConst].reshape((n,numOrthoConst), order='F')[:,:] = orthov0[:,:initSize]
+        copiedBytes += __copy_to(svecs[0:m*numOrthoConst].reshape((m,numOrthoConst), order='F'), orthou0[:,0:numOrthoConst])
+        copiedBytes += __copy_to(svecs[m*(numOrthoConst+initSize):m*(numOrthoConst+initSize)+n*numOrthoConst].reshape((n,numOrthoConst), order='F'), orthov0[:,0:numOrthoConst])
 
-    global __user_function_exception
-    __user_function_exception = None
+    PP.user_function_exception = None
+    cdef int err
     if dtype.type is np.complex64:
-        err = cprimme_svds(&svals_s[0], &svecs_c[0], &norms_s[0], pp)
+        with nogil:
+            err = cprimme_svds(&svals_s[0], &svecs_c[0], &norms_s[0], pp)
     elif dtype.type is np.float32:
-        err = sprimme_svds(&svals_s[0], &svecs_s[0], &norms_s[0], pp)
+        with nogil:
+            err = sprimme_svds(&svals_s[0], &svecs_s[0], &norms_s[0], pp)
     elif dtype.type is np.float64:
-        err = dprimme_svds(&svals_d[0], &svecs_d[0], &norms_d[0], pp)
+        with nogil:
+            err = dprimme_svds(&svals_d[0], &svecs_d[0], &norms_d[0], pp)
     else:
-        err = zprimme_svds(&svals_d[0], &svecs_z[0], &norms_d[0], pp)
+        with nogil:
+            err = zprimme_svds(&svals_d[0], &svecs_z[0], &norms_d[0], pp)
 
     if err != 0:
-        if __user_function_exception is not None:
-            raise PrimmeSvdsError(err) from __user_function_exception
+        if PP.user_function_exception is not None:
+            raise PrimmeSvdsError(err) from PP.user_function_exception
         elif err == -3 and raise_for_unconverged:
             raise PrimmeSvdsError(err)
 
@@ -1469,6 +1764,7 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
             "numOuterIterations", "numRestarts", "numMatvecs",
             "numPreconds", "elapsedTime"])
         stats["rnorms"] = norms
+        stats["copiedBytes"] = copiedBytes
         if return_history:
             stats["hist"] = hist
  
@@ -1480,9 +1776,14 @@ def svds(A, k=6, ncv=None, tol=0, which='LM', v0=None,
     numOrthoConst = __primme_svds_params_get(PP, "numOrthoConst")
     norms = norms[0:initSize]
 
-    # Make copies and transpose conjugate svecsr
-    svecsl = svecs[m*numOrthoConst:m*(numOrthoConst+initSize)].reshape((m,initSize), order='F').copy()
-    svecsr = svecs[m*(numOrthoConst+initSize)+n*numOrthoConst:(m+n)*(numOrthoConst+initSize)].reshape((n,initSize), order='F').T.conj().copy()
+    # Return views of svecs; transpose conjugate svecsr, which copies it
+    # only if complex
+    svecsl = svecs[m*numOrthoConst:m*(numOrthoConst+initSize)].reshape((m,initSize), order='F')
+    svecsr = svecs[m*(numOrthoConst+initSize)+n*numOrthoConst:(m+n)*(numOrthoConst+initSize)].reshape((n,initSize), order='F').T
+    if dtype.kind == 'c':
+        svecsr = svecsr.conj()
+        if return_stats:
+            stats["copiedBytes"] += svecsr.nbytes
 
     if not return_stats:
         return svecsl, svals, svecsr
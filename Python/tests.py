@@ -9,8 +9,8 @@ import warnings
 import numpy as np
 from numpy.testing import run_module_suite, assert_allclose
 from scipy import ones, r_, diag
-from scipy.sparse.linalg import aslinearoperator
-from scipy.sparse import csr_matrix
+from scipy.sparse.linalg import aslinearoperator, LinearOperator
+from scipy.sparse import csr_matrix, csc_matrix
 import math
 import primme
 from primme import eigsh, svds
@@ -254,7 +254,7 @@ def test_primme_eigsh_matrix_types():
       A = toStandardProblem(MikotaPair(n, dtype=dtype))
       evals, evecs = np.linalg.eigh(A)
       sigma0 = evals[0]*.51 + evals[-1]*.49
-      for op in ((lambda x : x), csr_matrix, aslinearoperator): 
+      for op in ((lambda x : x), np.asfortranarray, csr_matrix, csc_matrix, aslinearoperator): 
          which, sigma = 'SM', sigma0
          prec = jacobi_prec(A, sigma)
          k = 5
@@ -352,7 +352,7 @@ def test_primme_svds_matrix_types():
       A = Lauchli_like(n*2, n, dtype=dtype)
       svl, sva, svr = np.linalg.svd(A, full_matrices=False)
       sigma0 = sva[0]*.51 + sva[-1]*.49
-      for op in ((lambda x : x), csr_matrix, aslinearoperator): 
+      for op in ((lambda x : x), np.asfortranarray, csr_matrix, csc_matrix, aslinearoperator): 
          which, sigma = 'SM', 0
          prec = sqr_diagonal_prec(A, sigma)
          k = 2
@@ -360,6 +360,92 @@ def test_primme_svds_matrix_types():
                       ("Lauchli_like_vert", n, dtype, k, bool(prec), which))
          yield (svds_check, svds, op(A), k, prec, which, 1e-5, sva, dtype, case_desc, False)
 
+def test_threads():
+   """
+   Test several solves with csr matrices running concurrently.
+   """
+   from threading import Thread
+   A = csr_matrix(toStandardProblem(MikotaPair(200)))
+   evals0 = np.linalg.eigh(A.toarray())[0]
+   results = [None]*4
+   def solve(i):
+      results[i] = eigsh(A, 3, tol=1e-6, which='SA', return_eigenvectors=False)
+   threads = [Thread(target=solve, args=(i,)) for i in range(len(results))]
+   for t in threads: t.start()
+   for t in threads: t.join()
+   for evals in results:
+      assert_allclose(sorted(evals), evals0[:3], rtol=1e-4)
+
+def test_threads_callbacks():
+   """
+   Test concurrent solves with Python callbacks: each callback sees the
+   parameters of its own solve, and an exception only aborts its solve.
+   """
+   from threading import Thread
+   sizes = (100, 150, 200, 250)
+   results = [None]*len(sizes)
+   def solve(i):
+      n = sizes[i]
+      A = csr_matrix(toStandardProblem(MikotaPair(n)))
+      d = A.diagonal()
+      def P(x):
+         assert primme.get_eigsh_param('n') == n
+         shifts = primme.get_eigsh_param('ShiftsForPreconditioner')
+         assert len(shifts) == x.shape[1]
+         return x / (d - shifts[0]).reshape((n, 1))
+      def fail(x):
+         raise ValueError(n)
+      Pop = LinearOperator((n, n), matvec=fail if i == 1 else P,
+            matmat=fail if i == 1 else P, dtype=A.dtype)
+      try:
+         results[i] = eigsh(A, 3, tol=1e-6, which='SA', OPinv=Pop,
+               return_eigenvectors=False)
+      except primme.PrimmeError as e:
+         results[i] = e
+   threads = [Thread(target=solve, args=(i,)) for i in range(len(results))]
+   for t in threads: t.start()
+   for t in threads: t.join()
+   for n, evals in zip(sizes, results):
+      if n == sizes[1]:
+         assert isinstance(evals, primme.PrimmeError)
+         assert isinstance(evals.__cause__, ValueError) and evals.__cause__.args == (n,)
+         continue
+      evals0 = np.linalg.eigh(toStandardProblem(MikotaPair(n)))[0]
+      assert_allclose(sorted(evals), evals0[:3], rtol=1e-4)
+
+def test_nonsymmetric_preconditioner():
+   """
+   Test that a real CSC preconditioner is not taken as symmetric.
+   """
+   A, _ = diagonal(100)
+   P = np.diag(1.0/np.arange(1, 101)) + np.triu(np.ones((100, 100)), 1)*1e-3
+   stats = []
+   for op in (csc_matrix, aslinearoperator):
+      evals, _, s = eigsh(A, 3, tol=1e-8, which='SA', OPinv=op(P),
+            return_stats=True)
+      assert_allclose(sorted(evals), [1, 2, 3], rtol=1e-6)
+      stats.append(s['numMatvecs'])
+   assert stats[0] == stats[1]
+
+def test_out():
+   """
+   Test computing the vectors in place of the initial guesses.
+   """
+   A, _ = diagonal(100)
+   v0 = np.asfortranarray(np.random.rand(100, 3))
+   evals, evecs, stats = eigsh(A, 3, tol=1e-6, which='LA', v0=v0, out=v0,
+         return_stats=True)
+   assert stats["copiedBytes"] == 0 and np.shares_memory(evecs, v0)
+   assert_allclose(sorted(evals), [98, 99, 100], rtol=1e-4)
+
+   out = np.empty((200*3,))
+   u, s, vt, stats = svds(A, 3, tol=1e-6, out=out, return_stats=True)
+   assert np.shares_memory(u, out) and np.shares_memory(vt, out)
+   u, s, vt, stats = svds(A, 3, tol=1e-6, u0=u, v0=vt.T, out=out,
+         return_stats=True)
+   assert stats["copiedBytes"] == 0
+   assert_allclose(sorted(s), [98, 99, 100], rtol=1e-4)
+
 def test_examples_from_doc():
    import doctest
    doctest.testmod(primme, raise_on_error=True, optionflags=doctest.NORMALIZE_WHITESPACE)
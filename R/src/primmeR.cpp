@@ -134,6 +134,96 @@ void xgemm(const char *transa, const char *transb, int m, int n, int k,
 }
 
 
+// Sparse matrix in CHOLMOD format (dgCMatrix, zgCMatrix...) for
+// matrixMatvecEigs_CHM_SP and matrixMatvecSvds_CHM_SP.
+// Fields:
+// - A: input matrix
+// - Ah: auxiliary CSC matrix created by CHM_SP_Operator_init, or NULL
+// - native: if true, use CHM_SP_conjTransposeMatvec; otherwise cholmod_sdmult
+// - c: CHOLMOD workspace
+
+struct CHM_SP_Operator {
+   const_CHM_SP A;
+   CHM_SP Ah;
+   bool native;
+   cholmod_common c;
+};
+
+// Prepare op for products with A. If A is stored as symmetric/Hermitian
+// (dsCMatrix, zsCMatrix), op->Ah is the full matrix; otherwise if transpose is
+// true, op->Ah is the conjugate transpose of A. The native kernel is used when
+// A is a packed CSC with int indices and the same scalar type as the vectors.
+// Arguments:
+// - T: type of PRIMME vectors
+// - A: matrix
+// - transpose: whether products with A and with A' are needed (svds)
+// - op: operator to initialize
+
+template <typename T>
+static void CHM_SP_Operator_init(const_CHM_SP A, bool transpose,
+      CHM_SP_Operator *op) {
+   op->A = A;
+   op->Ah = NULL;
+   M_R_cholmod_start(&op->c);
+   op->native = A->itype == CHOLMOD_INT && A->dtype == CHOLMOD_DOUBLE &&
+                A->packed &&
+                A->xtype == (sizeof(T) == sizeof(double) ? CHOLMOD_REAL
+                                                         : CHOLMOD_COMPLEX);
+   if (!op->native) return;
+   if (A->stype != 0) {
+      op->Ah = M_cholmod_copy(A, 0 /* unsymmetric */, 1 /* values */, &op->c);
+   } else if (transpose) {
+      op->Ah = M_cholmod_transpose(A, 2 /* conjugate */, &op->c);
+   }
+   if ((A->stype != 0 || transpose) && !op->Ah) op->native = false;
+}
+
+static void CHM_SP_Operator_free(CHM_SP_Operator *op) {
+   if (op->Ah) M_cholmod_free_sparse(&op->Ah, &op->c);
+   M_cholmod_finish(&op->c);
+}
+
+// Auxiliary functions for CHM_SP_conjTransposeMatvec
+
+static inline void setZero(double &y) { y = 0.0; }
+static inline void setZero(Rcomplex &y) { y.r = y.i = 0.0; }
+static inline void conjMulAdd(double a, double x, double &y) { y += a*x; }
+static inline void conjMulAdd(const Rcomplex &a, const Rcomplex &x, Rcomplex &y) {
+   y.r += a.r*x.r + a.i*x.i;
+   y.i += a.r*x.i - a.i*x.r;
+}
+
+// Compute Y = A' * X, where A is a packed CSC matrix with int indices. Every
+// column of A produces a row of Y, so threads work on disjoint rows and
+// no reduction is needed. Thread-safe: it doesn't call the R API.
+// Arguments:
+// - TS: type of the elements of A, X and Y
+// - A: matrix
+// - blockSize: number of columns in X and Y
+// - x, ldx: input matrix X and its leading dimension
+// - y, ldy: output matrix Y and its leading dimension
+
+template <typename TS>
+static void CHM_SP_conjTransposeMatvec(const_CHM_SP A, int blockSize,
+      const TS *x, PRIMME_INT ldx, TS *y, PRIMME_INT ldy) {
+   const int *Ap = (const int*)A->p, *Ai = (const int*)A->i;
+   const TS *Ax = (const TS*)A->x;
+   const int ncol = (int)A->ncol;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(guided) if ((double)Ap[ncol] * blockSize > 1e5)
+#endif
+   for (int j = 0; j < ncol; j++) {
+      for (int b = 0; b < blockSize; b++) setZero(y[ldy*b + j]);
+      for (int k = Ap[j]; k < Ap[j+1]; k++) {
+         for (int b = 0; b < blockSize; b++) {
+            conjMulAdd(Ax[k], x[ldx*b + Ai[k]], y[ldy*b + j]);
+         }
+      }
+   }
+}
+
+
 // Create a new Rcpp Matrix of type S copying the content of a Fortran matrix of
 // type T.
 // Arguments:
@@ -537,8 +627,18 @@ void matrixMatvecEigs_CHM_SP(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
 {
    checkUserInterrupt(primme);
 
-   const_CHM_SP chm = (const_CHM_SP)((void**)F::get(primme))[0];
-   ASSERT(chm->nrow == chm->ncol && (PRIMME_INT)chm->nrow == primme->nLocal);
+   CHM_SP_Operator *op = (CHM_SP_Operator*)F::get(primme);
+   ASSERT(op->A->nrow == op->A->ncol && (PRIMME_INT)op->A->nrow == primme->nLocal);
+
+   // A is Hermitian, so A * X = A' * X; the latter is computed by the native
+   // kernel without write conflicts among threads
+
+   if (op->native) {
+      CHM_SP_conjTransposeMatvec(op->Ah ? (const_CHM_SP)op->Ah : op->A,
+            *blockSize, (const T*)x, *ldx, (T*)y, *ldy);
+      *ierr = 0;
+      return;
+   }
 
    cholmod_dense chx, chy;
    chx.nrow = primme->nLocal; 
@@ -558,9 +658,8 @@ void matrixMatvecEigs_CHM_SP(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
    chy.xtype = (sizeof(T) == sizeof(double) ? CHOLMOD_REAL : CHOLMOD_COMPLEX);
    chy.dtype = CHOLMOD_DOUBLE;
    const double ONEf[] = {1.0, 0.0}, ZEROf[] = {0.0, 0.0};
-   CHM_CM chol_c = (CHM_CM)((void**)F::get(primme))[1];
 
-   M_cholmod_sdmult(chm, 0, ONEf, ZEROf, (const_CHM_DN)&chx, &chy, chol_c);
+   M_cholmod_sdmult(op->A, 0, ONEf, ZEROf, (const_CHM_DN)&chx, &chy, &op->c);
 
    *ierr = 0;
 }
@@ -639,8 +738,7 @@ static List xprimme(Matrix<S> ortho, Matrix<S> init, SEXP A, SEXP B,
 
    // Set matvec
 
-   void *Aaux[2] = {NULL, NULL};
-   cholmod_common Achol_c;
+   CHM_SP_Operator Aop;
    NumericMatrix *An = NULL;
    ComplexMatrix *Ac = NULL;
    Function *Af = NULL;
@@ -654,11 +752,9 @@ static List xprimme(Matrix<S> ortho, Matrix<S> init, SEXP A, SEXP B,
       primme->matrix = AS_CHM_DN(A);
       primme->matrixMatvec = matrixMatvecEigs_CHM_DN<TS, getMatrixField>;
    } else if (Matrix_isclass_Csparse(A)) {
-      Aaux[0] = AS_CHM_SP(A);
-      Aaux[1] = &Achol_c;
-      M_R_cholmod_start(&Achol_c);
-      primme->matrix = Aaux;
-      primme->matrixMatvec = matrixMatvecEigs_CHM_SP<T, getMatrixField>;
+      CHM_SP_Operator_init<TS>(AS_CHM_SP(A), false, &Aop);
+      primme->matrix = &Aop;
+      primme->matrixMatvec = matrixMatvecEigs_CHM_SP<TS, getMatrixField>;
    } else if (is<Function>(A)) {
       primme->matrix = Af = new Function(A);
       primme->matrixMatvec = matrixMatvecEigs<T, S, TS, getMatrixField>;
@@ -668,8 +764,7 @@ static List xprimme(Matrix<S> ortho, Matrix<S> init, SEXP A, SEXP B,
 
    // Set mass matrix
 
-   void *Baux[2] = {NULL, NULL};
-   cholmod_common Bchol_c;
+   CHM_SP_Operator Bop;
    NumericMatrix *Bn = NULL;
    ComplexMatrix *Bc = NULL;
    Function *Bf = NULL;
@@ -685,11 +780,9 @@ static List xprimme(Matrix<S> ortho, Matrix<S> init, SEXP A, SEXP B,
       primme->massMatrix = AS_CHM_DN(B);
       primme->massMatrixMatvec = matrixMatvecEigs_CHM_DN<TS, getMassMatrixField>;
    } else if (Matrix_isclass_Csparse(B)) {
-      Baux[0] = AS_CHM_SP(B);
-      Baux[1] = &Bchol_c;
-      M_R_cholmod_start(&Bchol_c);
-      primme->massMatrix = Baux;
-      primme->massMatrixMatvec = matrixMatvecEigs_CHM_SP<T, getMassMatrixField>;
+      CHM_SP_Operator_init<TS>(AS_CHM_SP(B), false, &Bop);
+      primme->massMatrix = &Bop;
+      primme->massMatrixMatvec = matrixMatvecEigs_CHM_SP<TS, getMassMatrixField>;
    } else if (is<Function>(B)) {
       primme->massMatrix = Bf = new Function(B);
       primme->massMatrixMatvec = matrixMatvecEigs<T, S, TS, getMassMatrixField>;
@@ -722,13 +815,13 @@ static List xprimme(Matrix<S> ortho, Matrix<S> init, SEXP A, SEXP B,
    if (An) delete An;
    if (Af) delete Af;
    if (Matrix_isclass_Csparse(A)) {
-      M_cholmod_finish(&Achol_c);
+      CHM_SP_Operator_free(&Aop);
    }
    if (Bc) delete Bc;
    if (Bn) delete Bn;
    if (Bf) delete Bf;
    if (Matrix_isclass_Csparse(B)) {
-      M_cholmod_finish(&Bchol_c);
+      CHM_SP_Operator_free(&Bop);
    }
    if (fprec) delete fprec;
    if (fconvTest) delete fconvTest;
@@ -1101,9 +1194,21 @@ static void matrixMatvecSvds_CHM_SP(void *x, PRIMME_INT *ldx, void *y, PRIMME_IN
 {  
    checkUserInterrupt(primme_svds);
 
-   const_CHM_SP chm = (const_CHM_SP)((void**)primme_svds->matrix)[0];
+   CHM_SP_Operator *op = (CHM_SP_Operator*)primme_svds->matrix;
+   const_CHM_SP chm = op->A;
    ASSERT((PRIMME_INT)chm->nrow == primme_svds->mLocal && (PRIMME_INT)chm->ncol == primme_svds->nLocal);
 
+   // Y = A' * X uses A and Y = A * X uses the conjugate transpose of A, op->Ah;
+   // if A is stored as Hermitian, op->Ah is the full A for both
+
+   if (op->native) {
+      CHM_SP_conjTransposeMatvec(
+            *transpose && chm->stype == 0 ? chm : (const_CHM_SP)op->Ah,
+            *blockSize, (const T*)x, *ldx, (T*)y, *ldy);
+      *ierr = 0;
+      return;
+   }
+
    cholmod_dense chx, chy;
    chx.nrow = (*transpose ? primme_svds->mLocal : primme_svds->nLocal);
    chx.ncol = *blockSize;
@@ -1122,10 +1227,9 @@ static void matrixMatvecSvds_CHM_SP(void *x, PRIMME_INT *ldx, void *y, PRIMME_IN
    chy.xtype = (sizeof(T) == sizeof(double) ? CHOLMOD_REAL : CHOLMOD_COMPLEX);
    chy.dtype = CHOLMOD_DOUBLE;
    const double ONEf[] = {1.0, 0.0}, ZEROf[] = {0.0, 0.0};
-   CHM_CM chol_c = (CHM_CM)((void**)primme_svds->matrix)[1];
 
    M_cholmod_sdmult(chm, *transpose?1:0, ONEf, ZEROf, (const_CHM_DN)&chx, &chy,
-         chol_c);
+         &op->c);
 
    *ierr = 0;
 }
@@ -1185,8 +1289,7 @@ static List xprimme_svds(Matrix<S> orthol, Matrix<S> orthor, Matrix<S> initl,
 
    // Set matvec and preconditioner
 
-   void *aux[2] = {NULL, NULL};
-   cholmod_common chol_c;
+   CHM_SP_Operator Aop;
    Matrix<S> *Am = NULL;
    Function *Af = NULL;
    if (is<Matrix<S> >(A)) {
@@ -1196,11 +1299,9 @@ static List xprimme_svds(Matrix<S> orthol, Matrix<S> orthor, Matrix<S> initl,
       primme_svds->matrix = AS_CHM_DN(A);
       primme_svds->matrixMatvec = matrixMatvecSvds_CHM_DN<TS>;
    } else if (Matrix_isclass_Csparse(A)) {
-      aux[0] = AS_CHM_SP(A);
-      aux[1] = &chol_c;
-      M_R_cholmod_start(&chol_c);
-      primme_svds->matrix = aux;
-      primme_svds->matrixMatvec = matrixMatvecSvds_CHM_SP<T>;
+      CHM_SP_Operator_init<TS>(AS_CHM_SP(A), true, &Aop);
+      primme_svds->matrix = &Aop;
+      primme_svds->matrixMatvec = matrixMatvecSvds_CHM_SP<TS>;
    } else if (is<Function>(A)) {
       primme_svds->matrix = Af = new Function(as<Function>(A));
       primme_svds->matrixMatvec = matrixMatvecSvds<T, S, TS, getSvdsForMatrix>;
@@ -1224,7 +1325,7 @@ static List xprimme_svds(Matrix<S> orthol, Matrix<S> orthor, Matrix<S> initl,
    if (Am) delete Am;
    if (Af) delete Af;
    if (Matrix_isclass_Csparse(A)) {
-      M_cholmod_finish(&chol_c);
+      CHM_SP_Operator_free(&Aop);
    }
    if (fprec) delete fprec;
 
@@ -110,6 +110,8 @@
 
 #include "primme_eigs.h"
 #include "primme_svds.h"
+#include "primme_csr.h"
+#include "primme_profile.h"
 
 /* Error messages */
 
@@ -121,4 +123,5 @@
 #define PRIMME_ORTHO_CONST_FAILURE        -42
 #define PRIMME_PARALLEL_FAILURE           -43
 #define PRIMME_FUNCTION_UNAVAILABLE       -44
+#define PRIMME_CHECKPOINT_FAILURE         -45
 #endif /* PRIMME_H */
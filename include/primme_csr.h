@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ **********************************************************************
+ * File: primme_csr.h
+ *
+ * Purpose - Sparse matrix operator in CSR format ready to be used as
+ *           matrixMatvec.
+ *
+ ******************************************************************************/
+
+#ifndef PRIMME_CSR_H
+#define PRIMME_CSR_H
+
+#include <stdint.h>
+#include "primme_eigs.h"
+#include "primme_svds.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opaque handle; the arrays passed on creation are referenced, not copied */
+typedef struct primme_csr primme_csr;
+
+primme_csr *sprimme_csr_create(PRIMME_INT m, PRIMME_INT n, const int *rowptr,
+      const int *colind, const float *values, int base);
+primme_csr *cprimme_csr_create(PRIMME_INT m, PRIMME_INT n, const int *rowptr,
+      const int *colind, const PRIMME_COMPLEX_FLOAT *values, int base);
+primme_csr *dprimme_csr_create(PRIMME_INT m, PRIMME_INT n, const int *rowptr,
+      const int *colind, const double *values, int base);
+primme_csr *zprimme_csr_create(PRIMME_INT m, PRIMME_INT n, const int *rowptr,
+      const int *colind, const PRIMME_COMPLEX_DOUBLE *values, int base);
+primme_csr *sprimme_csr_create64(PRIMME_INT m, PRIMME_INT n,
+      const int64_t *rowptr, const int64_t *colind, const float *values,
+      int base);
+primme_csr *cprimme_csr_create64(PRIMME_INT m, PRIMME_INT n,
+      const int64_t *rowptr, const int64_t *colind,
+      const PRIMME_COMPLEX_FLOAT *values, int base);
+primme_csr *dprimme_csr_create64(PRIMME_INT m, PRIMME_INT n,
+      const int64_t *rowptr, const int64_t *colind, const double *values,
+      int base);
+primme_csr *zprimme_csr_create64(PRIMME_INT m, PRIMME_INT n,
+      const int64_t *rowptr, const int64_t *colind,
+      const PRIMME_COMPLEX_DOUBLE *values, int base);
+int primme_csr_sell(primme_csr *A, int C, int sigma);
+int primme_csr_apply(primme_csr *A, int transpose, int blockSize, void *x,
+      PRIMME_INT ldx, void *y, PRIMME_INT ldy);
+int primme_csr_apply_normal(primme_csr *A, int aat, int blockSize, void *x,
+      PRIMME_INT ldx, void *y, PRIMME_INT ldy);
+void primme_csr_matvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr);
+void primme_csr_svds_matvec(void *x, PRIMME_INT *ldx, void *y,
+      PRIMME_INT *ldy, int *blockSize, int *transpose,
+      primme_svds_params *primme_svds, int *ierr);
+void primme_csr_svds_normal_matvec(void *x, PRIMME_INT *ldx, void *y,
+      PRIMME_INT *ldy, int *blockSize, int *mode,
+      primme_svds_params *primme_svds, int *ierr);
+int primme_csr_destroy(primme_csr *A);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIMME_CSR_H */
@@ -65,7 +65,8 @@ typedef enum {         /* Initially fill up the search subspace with: */
    primme_init_default,
    primme_init_krylov, /* a) Krylov with the last vector provided by the user or random */
    primme_init_random, /* b) just random vectors */
-   primme_init_user    /* c) provided vectors or a single random vector */
+   primme_init_user,   /* c) provided vectors or a single random vector */
+   primme_init_checkpoint /* d) the state saved in checkpointFile */
 } primme_init;
 
 typedef enum {
@@ -92,7 +93,10 @@ typedef enum {
 typedef enum {
    primme_orth_default,
    primme_orth_implicit_I,          /* assume for search subspace V, V'*B*V = I */
-   primme_orth_explicit_I           /* explicitly compute V'*B*V */
+   primme_orth_explicit_I,          /* explicitly compute V'*B*V */
+   primme_orth_cholqr2,             /* V'*B*V = I, blocks by CholQR2 */
+   primme_orth_shifted_cholqr3,     /* V'*B*V = I, blocks by shifted CholQR3 */
+   primme_orth_dcgs2                /* V'*B*V = I, delayed reorthogonalization */
 } primme_orth;
 
 /* Datatype of vectors passed on matrixMatvec, applyPreconditioner,           */
@@ -132,6 +136,11 @@ typedef struct primme_stats {
    double maxConvTol;               /* largest norm residual of a locked eigenpair */
    double estimateResidualError;    /* accumulated error in V and W */
    PRIMME_INT lockingIssue;         /* Some converged with a weak criterion */
+   PRIMME_INT numOrthoGlobalSum;    /* times called globalSumReal by Ortho */
+   PRIMME_INT numOrthoVectors;      /* number of vectors orthogonalized by Ortho */
+   PRIMME_INT numAllocs;            /* number of buffers allocated */
+   PRIMME_INT numHeapAllocs;        /* times called malloc for the buffers */
+   PRIMME_INT lworkspaceNeeded;     /* workspace that holds all the buffers */
 } primme_stats;
 
 typedef struct JD_projectors {
@@ -154,6 +163,7 @@ typedef struct correction_params {
    struct JD_projectors projectors;
    primme_convergencetest convTest;
    double relTolBase;
+   int chebyshevDegree;    /* if > 0, max degree of the Chebyshev filter */
 } correction_params;
 
 
@@ -193,9 +203,18 @@ typedef struct primme_params {
       (void *sendBuf, void *recvBuf, int *count, struct primme_params *primme,
        int *ierr );
    primme_op_datatype globalSumReal_type; /* expected type of sendBuf and recvBuf */
+   void (*globalSumRealBegin)           /* start a non-blocking globalSumReal */
+      (void *sendBuf, void *recvBuf, int *count, struct primme_params *primme,
+       void **request, int *ierr);
+   void (*globalSumRealWait)            /* complete a globalSumRealBegin */
+      (void **request, struct primme_params *primme, int *ierr);
    void (*broadcastReal)(
          void *buffer, int *count, struct primme_params *primme, int *ierr);
    primme_op_datatype broadcastReal_type; /* expected type of buffer */
+   int commReduce;        /* if nonzero, fuse reductions and avoid broadcasts */
+   void (*splitComm)      /* split the processes in groups for the slicing */
+      (int *numGroups, int *group, struct primme_params *primme_group,
+       struct primme_params *primme, int *ierr);
 
    /*Though primme_initialize will assign defaults, most users will set these */
    int numEvals;          
@@ -231,6 +250,17 @@ typedef struct primme_params {
    primme_init initBasisMode;
    PRIMME_INT ldevecs;
    PRIMME_INT ldOPs;
+   void *workspace;              /* Memory owned by the caller for the solver */
+   size_t lworkspace;            /* Size of workspace in bytes */
+   int recycle;                  /* if nonzero, start from the previous V */
+   void (*matrixDeltaMatvec)     /* y = (A - A_previous)*x, used by recycle */
+      ( void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize,
+        struct primme_params *primme, int *ierr);
+   void *recycledBasis;          /* V and A*V kept by recycle; see primme_free */
+   const char *checkpointFile;   /* file where the solver state is saved */
+   int checkpointFrequency;      /* restarts between checkpoints */
+   const char *outOfCoreDir;     /* directory for V and W mapped in files */
+   int adaptivePrecision;        /* if nonzero, start in single precision */
 
    struct projection_params projectionParams; 
    struct restarting_params restartingParams;
@@ -250,9 +280,14 @@ typedef struct primme_params {
    void *monitor;
    void *queue;      /* magma device queue (magma_queue_t*) */
    const char *profile; /* regex expression with functions to monitor times */
+   struct primme_profiler *profiler; /* if not NULL, record the calls */
 } primme_params;
 /*---------------------------------------------------------------------------*/
 
+/* Handle that keeps the memory and the checked setup of the solver between */
+/* calls; opaque to the user                                                */
+typedef struct primme_solver primme_solver;
+
 typedef enum {
    PRIMME_DEFAULT_METHOD,
    PRIMME_DYNAMIC,
@@ -374,7 +409,26 @@ typedef enum {
    PRIMME_monitorFun_type                        = 86  ,
    PRIMME_monitor                                = 87  ,
    PRIMME_queue                                  = 88  ,
-   PRIMME_profile                                = 89  
+   PRIMME_profile                                = 89  ,
+   PRIMME_globalSumRealBegin                     = 90  ,
+   PRIMME_globalSumRealWait                      = 91  ,
+   PRIMME_commReduce                             = 92  ,
+   PRIMME_stats_numOrthoGlobalSum                = 93  ,
+   PRIMME_stats_numOrthoVectors                  = 94  ,
+   PRIMME_stats_numAllocs                        = 95  ,
+   PRIMME_stats_numHeapAllocs                    = 96  ,
+   PRIMME_workspace                              = 97  ,
+   PRIMME_lworkspace                             = 98  ,
+   PRIMME_recycle                                = 99  ,
+   PRIMME_matrixDeltaMatvec                      = 100 ,
+   PRIMME_checkpointFile                         = 101 ,
+   PRIMME_checkpointFrequency                    = 102 ,
+   PRIMME_outOfCoreDir                           = 103 ,
+   PRIMME_correctionParams_chebyshevDegree       = 104 ,
+   PRIMME_adaptivePrecision                      = 105 ,
+   PRIMME_profiler                               = 106 ,
+   PRIMME_stats_lworkspaceNeeded                 = 107 ,
+   PRIMME_splitComm                              = 108 
 } primme_params_label;
 
 /* Hermitian operator */
@@ -433,12 +487,105 @@ int kcprimme_normal(PRIMME_COMPLEX_FLOAT *evals, PRIMME_COMPLEX_HALF *evecs, flo
 int magma_kcprimme_normal(PRIMME_COMPLEX_FLOAT *evals, PRIMME_COMPLEX_HALF *evecs, float *resNorms, 
       primme_params *primme);
 
+/* Solve reusing the memory of a primme_solver */
+
+int hprimme_solve(PRIMME_HALF *evals, PRIMME_HALF *evecs, PRIMME_HALF *resNorms, 
+      primme_solver *solver);
+int kprimme_solve(PRIMME_HALF *evals, PRIMME_COMPLEX_HALF *evecs, PRIMME_HALF *resNorms, 
+      primme_solver *solver);
+int sprimme_solve(float *evals, float *evecs, float *resNorms, 
+      primme_solver *solver);
+int cprimme_solve(float *evals, PRIMME_COMPLEX_FLOAT *evecs, float *resNorms, 
+      primme_solver *solver);
+int dprimme_solve(double *evals, double *evecs, double *resNorms, 
+      primme_solver *solver);
+int zprimme_solve(double *evals, PRIMME_COMPLEX_DOUBLE *evecs, double *resNorms, 
+      primme_solver *solver);
+int magma_hprimme_solve(PRIMME_HALF *evals, PRIMME_HALF *evecs, PRIMME_HALF *resNorms, 
+      primme_solver *solver);
+int magma_kprimme_solve(PRIMME_HALF *evals, PRIMME_COMPLEX_HALF *evecs, PRIMME_HALF *resNorms, 
+      primme_solver *solver);
+int magma_sprimme_solve(float *evals, float *evecs, float *resNorms, 
+      primme_solver *solver);
+int magma_cprimme_solve(float *evals, PRIMME_COMPLEX_FLOAT *evecs, float *resNorms, 
+      primme_solver *solver);
+int magma_dprimme_solve(double *evals, double *evecs, double *resNorms, 
+      primme_solver *solver);
+int magma_zprimme_solve(double *evals, PRIMME_COMPLEX_DOUBLE *evecs, double *resNorms, 
+      primme_solver *solver);
+int kprimme_normal_solve(PRIMME_COMPLEX_HALF *evals, PRIMME_COMPLEX_HALF *evecs, PRIMME_HALF *resNorms, 
+      primme_solver *solver);
+int cprimme_normal_solve(PRIMME_COMPLEX_FLOAT *evals, PRIMME_COMPLEX_FLOAT *evecs, float *resNorms, 
+      primme_solver *solver);
+int zprimme_normal_solve(PRIMME_COMPLEX_DOUBLE *evals, PRIMME_COMPLEX_DOUBLE *evecs, double *resNorms, 
+      primme_solver *solver);
+int magma_kprimme_normal_solve(PRIMME_COMPLEX_HALF *evals, PRIMME_COMPLEX_HALF *evecs, PRIMME_HALF *resNorms, 
+      primme_solver *solver);
+int magma_cprimme_normal_solve(PRIMME_COMPLEX_FLOAT *evals, PRIMME_COMPLEX_FLOAT *evecs, float *resNorms, 
+      primme_solver *solver);
+int magma_zprimme_normal_solve(PRIMME_COMPLEX_DOUBLE *evals, PRIMME_COMPLEX_DOUBLE *evecs, double *resNorms, 
+      primme_solver *solver);
+
+/* Solve several independent problems */
+
+int hprimme_batch(int numProblems, PRIMME_HALF **evals, PRIMME_HALF **evecs, 
+      PRIMME_HALF **resNorms, primme_params *primme, int *ret);
+int kprimme_batch(int numProblems, PRIMME_HALF **evals, PRIMME_COMPLEX_HALF **evecs, 
+      PRIMME_HALF **resNorms, primme_params *primme, int *ret);
+int sprimme_batch(int numProblems, float **evals, float **evecs, 
+      float **resNorms, primme_params *primme, int *ret);
+int cprimme_batch(int numProblems, float **evals, PRIMME_COMPLEX_FLOAT **evecs, 
+      float **resNorms, primme_params *primme, int *ret);
+int dprimme_batch(int numProblems, double **evals, double **evecs, 
+      double **resNorms, primme_params *primme, int *ret);
+int zprimme_batch(int numProblems, double **evals, PRIMME_COMPLEX_DOUBLE **evecs, 
+      double **resNorms, primme_params *primme, int *ret);
+int magma_hprimme_batch(int numProblems, PRIMME_HALF **evals, PRIMME_HALF **evecs, 
+      PRIMME_HALF **resNorms, primme_params *primme, int *ret);
+int magma_kprimme_batch(int numProblems, PRIMME_HALF **evals, PRIMME_COMPLEX_HALF **evecs, 
+      PRIMME_HALF **resNorms, primme_params *primme, int *ret);
+int magma_sprimme_batch(int numProblems, float **evals, float **evecs, 
+      float **resNorms, primme_params *primme, int *ret);
+int magma_cprimme_batch(int numProblems, float **evals, PRIMME_COMPLEX_FLOAT **evecs, 
+      float **resNorms, primme_params *primme, int *ret);
+int magma_dprimme_batch(int numProblems, double **evals, double **evecs, 
+      double **resNorms, primme_params *primme, int *ret);
+int magma_zprimme_batch(int numProblems, double **evals, PRIMME_COMPLEX_DOUBLE **evecs, 
+      double **resNorms, primme_params *primme, int *ret);
+int kprimme_normal_batch(int numProblems, PRIMME_COMPLEX_HALF **evals, PRIMME_COMPLEX_HALF **evecs, 
+      PRIMME_HALF **resNorms, primme_params *primme, int *ret);
+int cprimme_normal_batch(int numProblems, PRIMME_COMPLEX_FLOAT **evals, PRIMME_COMPLEX_FLOAT **evecs, 
+      float **resNorms, primme_params *primme, int *ret);
+int zprimme_normal_batch(int numProblems, PRIMME_COMPLEX_DOUBLE **evals, PRIMME_COMPLEX_DOUBLE **evecs, 
+      double **resNorms, primme_params *primme, int *ret);
+int magma_kprimme_normal_batch(int numProblems, PRIMME_COMPLEX_HALF **evals, PRIMME_COMPLEX_HALF **evecs, 
+      PRIMME_HALF **resNorms, primme_params *primme, int *ret);
+int magma_cprimme_normal_batch(int numProblems, PRIMME_COMPLEX_FLOAT **evals, PRIMME_COMPLEX_FLOAT **evecs, 
+      float **resNorms, primme_params *primme, int *ret);
+int magma_zprimme_normal_batch(int numProblems, PRIMME_COMPLEX_DOUBLE **evals, PRIMME_COMPLEX_DOUBLE **evecs, 
+      double **resNorms, primme_params *primme, int *ret);
+
+/* Eigenpairs in an interval by solving slices of it */
+
+int sprimme_slicing(float lower, float upper, int sliceSize, float *evals,
+      float *evecs, float *resNorms, int *numEvals, primme_params *primme);
+int cprimme_slicing(float lower, float upper, int sliceSize, float *evals,
+      PRIMME_COMPLEX_FLOAT *evecs, float *resNorms, int *numEvals,
+      primme_params *primme);
+int dprimme_slicing(double lower, double upper, int sliceSize, double *evals,
+      double *evecs, double *resNorms, int *numEvals, primme_params *primme);
+int zprimme_slicing(double lower, double upper, int sliceSize, double *evals,
+      PRIMME_COMPLEX_DOUBLE *evecs, double *resNorms, int *numEvals,
+      primme_params *primme);
+
 primme_params* primme_params_create(void);
 int primme_params_destroy(primme_params *primme);
 void primme_initialize(primme_params *primme);
 int  primme_set_method(primme_preset_method method, primme_params *params);
 void primme_display_params(primme_params primme);
 void primme_free(primme_params *primme);
+int primme_get_workspace_size(primme_params *primme, primme_op_datatype type,
+      int isComplex, size_t *lworkspace);
 int primme_get_member(primme_params *primme, primme_params_label label,
       void *value);
 int primme_set_member(primme_params *primme, primme_params_label label,
@@ -448,6 +595,8 @@ int primme_member_info(primme_params_label *label, const char** label_name,
 int primme_constant_info(const char* label_name, int *value);
 int primme_enum_member_info(
       primme_params_label label, int *value, const char **value_name);
+primme_solver* primme_solver_create(primme_params *primme);
+int primme_solver_destroy(primme_solver *solver);
 
 
 #ifdef __cplusplus
@@ -167,7 +167,26 @@ C-------------------------------------------------------
      : PRIMME_monitorFun_type                        ,
      : PRIMME_monitor                                ,
      : PRIMME_queue                                  ,
-     : PRIMME_profile                                
+     : PRIMME_profile                                ,
+     : PRIMME_globalSumRealBegin                     ,
+     : PRIMME_globalSumRealWait                      ,
+     : PRIMME_commReduce                             ,
+     : PRIMME_stats_numOrthoGlobalSum                ,
+     : PRIMME_stats_numOrthoVectors                  ,
+     : PRIMME_stats_numAllocs                        ,
+     : PRIMME_stats_numHeapAllocs                    ,
+     : PRIMME_workspace                              ,
+     : PRIMME_lworkspace                             ,
+     : PRIMME_recycle                                ,
+     : PRIMME_matrixDeltaMatvec                      ,
+     : PRIMME_checkpointFile                         ,
+     : PRIMME_checkpointFrequency                    ,
+     : PRIMME_outOfCoreDir                           ,
+     : PRIMME_correctionParams_chebyshevDegree       ,
+     : PRIMME_adaptivePrecision                      ,
+     : PRIMME_profiler                               ,
+     : PRIMME_stats_lworkspaceNeeded                 ,
+     : PRIMME_splitComm                              
 
       parameter(
      : PRIMME_n                                      = 1  ,
@@ -258,7 +277,26 @@ C-------------------------------------------------------
      : PRIMME_monitorFun_type                        = 86  ,
      : PRIMME_monitor                                = 87  ,
      : PRIMME_queue                                  = 88  ,
-     : PRIMME_profile                                = 89  
+     : PRIMME_profile                                = 89  ,
+     : PRIMME_globalSumRealBegin                     = 90  ,
+     : PRIMME_globalSumRealWait                      = 91  ,
+     : PRIMME_commReduce                             = 92  ,
+     : PRIMME_stats_numOrthoGlobalSum                = 93  ,
+     : PRIMME_stats_numOrthoVectors                  = 94  ,
+     : PRIMME_stats_numAllocs                        = 95  ,
+     : PRIMME_stats_numHeapAllocs                    = 96  ,
+     : PRIMME_workspace                              = 97  ,
+     : PRIMME_lworkspace                             = 98  ,
+     : PRIMME_recycle                                = 99  ,
+     : PRIMME_matrixDeltaMatvec                      = 100 ,
+     : PRIMME_checkpointFile                         = 101 ,
+     : PRIMME_checkpointFrequency                    = 102 ,
+     : PRIMME_outOfCoreDir                           = 103 ,
+     : PRIMME_correctionParams_chebyshevDegree       = 104 ,
+     : PRIMME_adaptivePrecision                      = 105 ,
+     : PRIMME_profiler                               = 106 ,
+     : PRIMME_stats_lworkspaceNeeded                 = 107 ,
+     : PRIMME_splitComm                              = 108 
      : )
 
 C-------------------------------------------------------
@@ -281,6 +319,7 @@ C-------------------------------------------------------
      : primme_init_krylov,
      : primme_init_random,
      : primme_init_user,
+     : primme_init_checkpoint,
      : primme_full_LTolerance,
      : primme_decreasing_LTolerance,
      : primme_adaptive_ETolerance,
@@ -313,6 +352,7 @@ C-------------------------------------------------------
      : primme_init_krylov = 1,
      : primme_init_random = 2,
      : primme_init_user = 3,
+     : primme_init_checkpoint = 4,
      : primme_full_LTolerance = 0,
      : primme_decreasing_LTolerance = 1,
      : primme_adaptive_ETolerance = 2,
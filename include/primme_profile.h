@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ **********************************************************************
+ * File: primme_profile.h
+ *
+ * Purpose - Profiler that records the calls done inside PRIMME and exports
+ *           them as a Chrome trace, as folded stacks for flame graphs, or
+ *           as per call-site counters.
+ *
+ ******************************************************************************/
+
+#ifndef PRIMME_PROFILE_H
+#define PRIMME_PROFILE_H
+
+#include <stdio.h>
+#include "primme_eigs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Opaque handle; set it on primme_params.profiler or                     */
+/* primme_svds_params.profiler to record the calls of the next solves     */
+typedef struct primme_profiler primme_profiler;
+
+primme_profiler *primme_profiler_create(int maxNodes, int maxEvents);
+int primme_profiler_throttle(primme_profiler *prof, int calls, double time);
+int primme_profiler_reset(primme_profiler *prof);
+int primme_profiler_write_trace(primme_profiler *prof, FILE *f);
+int primme_profiler_write_folded(primme_profiler *prof, FILE *f);
+int primme_profiler_write_summary(primme_profiler *prof, FILE *f);
+int primme_profiler_num_sites(primme_profiler *prof);
+int primme_profiler_site_stats(primme_profiler *prof, int i, const char **call,
+      const char **file, int *line, PRIMME_INT *count, double *time,
+      double *selfTime);
+int primme_profiler_destroy(primme_profiler *prof);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIMME_PROFILE_H */
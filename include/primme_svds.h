@@ -101,6 +101,9 @@ typedef struct primme_svds_params {
       (void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize,
        int *transpose, struct primme_svds_params *primme_svds, int *ierr);
    primme_op_datatype applyPreconditioner_type;
+   void (*matrixNormalMatvec)  /* optional: A'*A*x or A*A'*x in one call */
+      (void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize,
+       int *mode, struct primme_svds_params *primme_svds, int *ierr);
 
    /* Input for the following is only required for parallel programs */
    int numProcs;
@@ -112,6 +115,11 @@ typedef struct primme_svds_params {
       (void *sendBuf, void *recvBuf, int *count,
        struct primme_svds_params *primme_svds, int *ierr);
    primme_op_datatype globalSumReal_type;
+   void (*globalSumRealBegin)
+      (void *sendBuf, void *recvBuf, int *count,
+       struct primme_svds_params *primme_svds, void **request, int *ierr);
+   void (*globalSumRealWait)
+      (void **request, struct primme_svds_params *primme_svds, int *ierr);
    void (*broadcastReal)(void *buffer, int *count,
          struct primme_svds_params *primme_svds, int *ierr);
    primme_op_datatype broadcastReal_type;
@@ -142,6 +150,8 @@ typedef struct primme_svds_params {
    PRIMME_INT iseed[4];
    int printLevel;
    primme_op_datatype internalPrecision; /* force primme to work in that precision */
+   void *workspace;              /* Memory owned by the caller for the solver */
+   size_t lworkspace;            /* Size of workspace in bytes */
    FILE *outputFile;
    struct primme_svds_stats stats;
 
@@ -160,6 +170,7 @@ typedef struct primme_svds_params {
    void *monitor;
    void *queue;   	/* magma device queue (magma_queue_t*) */
    const char *profile; /* regex expression with functions to monitor times */
+   struct primme_profiler *profiler; /* if not NULL, record the calls */
 } primme_svds_params;
 
 typedef enum {
@@ -226,7 +237,13 @@ typedef enum {
    PRIMME_SVDS_monitorFun_type              = 59,
    PRIMME_SVDS_monitor                      = 60,
    PRIMME_SVDS_queue                        = 61,
-   PRIMME_SVDS_profile                      = 62 
+   PRIMME_SVDS_profile                      = 62,
+   PRIMME_SVDS_globalSumRealBegin           = 63,
+   PRIMME_SVDS_globalSumRealWait            = 64,
+   PRIMME_SVDS_workspace                    = 65,
+   PRIMME_SVDS_lworkspace                   = 66,
+   PRIMME_SVDS_matrixNormalMatvec           = 67,
+   PRIMME_SVDS_profiler                     = 68
 } primme_svds_params_label;
 
 int hprimme_svds(PRIMME_HALF *svals, PRIMME_HALF *svecs, PRIMME_HALF *resNorms,
@@ -272,6 +289,8 @@ int primme_svds_set_method(primme_svds_preset_method method,
       primme_svds_params *primme_svds);
 void primme_svds_display_params(primme_svds_params primme_svds);
 void primme_svds_free(primme_svds_params *primme_svds);
+int primme_svds_get_workspace_size(primme_svds_params *primme_svds,
+      primme_op_datatype type, int isComplex, size_t *lworkspace);
 int primme_svds_get_member(primme_svds_params *primme_svds,
       primme_svds_params_label label, void *value);
 int primme_svds_set_member(primme_svds_params *primme_svds,
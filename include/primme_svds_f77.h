@@ -117,7 +117,13 @@ C-------------------------------------------------------
      : PRIMME_SVDS_monitorFun_type              ,
      : PRIMME_SVDS_monitor                      ,
      : PRIMME_SVDS_queue                        ,
-     : PRIMME_SVDS_profile                       
+     : PRIMME_SVDS_profile                       ,
+     : PRIMME_SVDS_globalSumRealBegin            ,
+     : PRIMME_SVDS_globalSumRealWait             ,
+     : PRIMME_SVDS_workspace                     ,
+     : PRIMME_SVDS_lworkspace                    ,
+     : PRIMME_SVDS_matrixNormalMatvec            ,
+     : PRIMME_SVDS_profiler                      
 
       parameter(
      : PRIMME_SVDS_primme                       = 1,
@@ -181,7 +187,13 @@ C-------------------------------------------------------
      : PRIMME_SVDS_monitorFun_type              = 59,
      : PRIMME_SVDS_monitor                      = 60,
      : PRIMME_SVDS_queue                        = 61,
-     : PRIMME_SVDS_profile                      = 62 
+     : PRIMME_SVDS_profile                      = 62,
+     : PRIMME_SVDS_globalSumRealBegin           = 63,
+     : PRIMME_SVDS_globalSumRealWait            = 64,
+     : PRIMME_SVDS_workspace                    = 65,
+     : PRIMME_SVDS_lworkspace                   = 66,
+     : PRIMME_SVDS_matrixNormalMatvec           = 67,
+     : PRIMME_SVDS_profiler                     = 68
      :)
 
 C-------------------------------------------------------
@@ -69,7 +69,7 @@ static int monitor_report(const char *fun, double time, primme_context ctx) {
 
 #ifdef PRIMME_PROFILE
       /* Avoid profiling this function. It will turn out in a recursive call */
-      ctx.path = NULL;
+      ctx.profiler = NULL;
 #endif
 
       CHKERRM((ctx.primme->monitorFun(NULL, NULL, NULL, NULL, NULL,
@@ -81,6 +81,19 @@ static int monitor_report(const char *fun, double time, primme_context ctx) {
    return 0;
 }
 
+#ifdef PRIMME_PROFILE
+
+/******************************************************************************
+ * Function profile_report - pass to ctx.report the time of a call stack
+ *
+ ******************************************************************************/
+
+static int profile_report(const char *path, double time, void *ctx) {
+   return ((primme_context *)ctx)->report(path, time, *(primme_context *)ctx);
+}
+
+#endif
+
 /******************************************************************************
  * Function primme_get_context - return a context from the primme_params
  *
@@ -103,28 +116,21 @@ primme_context primme_get_context(primme_params *primme) {
       ctx.mpicomm = primme->commInfo;
       ctx.globalSum = globalSum_Tprimme;
       ctx.bcast = broadcast_Tprimme; 
+      ctx.commReduce = primme->numProcs > 1 && primme->commReduce;
       ctx.queue = primme->queue;
       ctx.report = monitor_report;
 #ifdef PRIMME_PROFILE
-      if (primme->profile) {
-         /* Compile regex. If there is no errors, set path to a nonzero       */
-         /* value. Set ctx.report to the function that will channel the       */
-         /* reports to the monitor. Report errors if they are.                */
-
-         int ierr = regcomp(&ctx.profile, primme->profile, REG_NOSUB);
-         if (ierr || MALLOC_PRIMME(1, &ctx.timeoff)) {
-            char errmsg[100];
-            regerror(ierr, &ctx.profile, errmsg, 100);
-            if (ctx.report && ierr != 0) ctx.report(errmsg, -1, ctx);
-            regfree(&ctx.profile);
-            ctx.path = NULL;
-         } else {
-            *ctx.timeoff = 0.0;
-            ctx.path = "";
-         }
-      } else {
-         ctx.path = NULL;
+      ctx.profiler = primme->profiler;
+
+      /* Record the calls in a profiler owned by the context if none is    */
+      /* given, and report the ones matching the pattern when the context  */
+      /* is freed                                                          */
+
+      if (primme->profile && !ctx.profiler) {
+         ctx.profiler = primme_profiler_create(0, 1);
+         if (ctx.profiler) ctx.profile = primme->profile;
       }
+      ctx.profilerTag = primme_profiler_tag(ctx.profiler);
 #endif
    }
 
@@ -147,15 +153,35 @@ primme_context primme_get_context(primme_params *primme) {
 TEMPLATE_PLEASE
 void primme_free_context(primme_context ctx) {
 
+#ifdef PRIMME_PROFILE
+   /* Report the calls matching the pattern */
+
+   if (ctx.profile && ctx.report) {
+      primme_profiler *profiler = ctx.profiler;
+      ctx.profiler = NULL;
+      primme_profiler_report(profiler, ctx.profile, profile_report, &ctx);
+      ctx.profiler = profiler;
+   }
+#endif
+
    /* Pop frame pushed in primme_get_context */
 
    Mem_pop_frame(&ctx);
 
+   /* Report the allocations and free the arena */
+
+   if (ctx.primme && ctx.arena) {
+      ctx.primme->stats.numAllocs = ctx.arena->numAllocs;
+      ctx.primme->stats.numHeapAllocs = ctx.arena->numHeapAllocs;
+      ctx.primme->stats.lworkspaceNeeded =
+            (PRIMME_INT)Mem_workspace_size(ctx.arena->peak);
+   }
+   Mem_destroy_arena(&ctx);
+
    /* Free profiler */
 
 #ifdef PRIMME_PROFILE
-   if (ctx.path) regfree(&ctx.profile);
-   if (ctx.timeoff) free(ctx.timeoff);
+   if (ctx.profile) primme_profiler_destroy(ctx.profiler);
 #endif
 }
 
@@ -229,6 +255,90 @@ int matrixMatvec_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine matrixDeltaMatvec - Adds (A - A_previous)*V(:,nv+1:nv+blksze) to
+ *           W(:,nv+1:nv+blksze), updating the product by the previous matrix
+ *           into the product by the current one. The user's operator is
+ *           called on blocks of at most maxBlockSize columns.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * V          The orthonormal basis
+ * nLocal     Number of rows of each vector stored on this node
+ * ldV        The leading dimension of V
+ * ldW        The leading dimension of W
+ * basisSize  Number of vectors in V
+ * blockSize  The number of vectors to update
+ * 
+ * INPUT/OUTPUT ARRAYS
+ * -------------------
+ * W          A_previous*V on input, A*V on output
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int matrixDeltaMatvec_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      SCALAR *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   if (blockSize <= 0)
+      return 0;
+
+   assert(ldV >= nLocal && ldW >= nLocal);
+
+   double t0 = primme_wTimer();
+
+   int i, j, bs = max(1, primme->maxBlockSize);
+   SCALAR *D;
+   CHKERR(Num_malloc_Sprimme(nLocal * bs, &D, ctx));
+
+   for (i = basisSize; i < basisSize + blockSize; i += bs) {
+      int nb = min(bs, basisSize + blockSize - i);
+
+      /* Cast V and D */
+
+      SCALAR *Vb = &V[ldV * i];
+      void *V0, *D0;
+      PRIMME_INT ldV0, ldD0, ldD = nLocal;
+      CHKERR(Num_matrix_astype_Sprimme(Vb, nLocal, nb, ldV, PRIMME_OP_SCALAR,
+            &V0, &ldV0, primme->matrixMatvec_type, 1 /* alloc */,
+            1 /* copy */, ctx));
+      CHKERR(Num_matrix_astype_Sprimme(D, nLocal, nb, ldD, PRIMME_OP_SCALAR,
+            &D0, &ldD0, primme->matrixMatvec_type, 1 /* alloc */,
+            0 /* no copy */, ctx));
+
+      /* D = (A - A_previous)*V(:,i:i+nb-1) */
+
+      int ierr = 0;
+      CHKERRM((primme->matrixDeltaMatvec(
+                     V0, &ldV0, D0, &ldD0, &nb, primme, &ierr),
+                    ierr),
+            PRIMME_USER_FAILURE, "Error returned by 'matrixDeltaMatvec' %d",
+            ierr);
+
+      CHKERR(Num_matrix_astype_Sprimme(D0, nLocal, nb, ldD0,
+            primme->matrixMatvec_type, (void **)&D, &ldD, PRIMME_OP_SCALAR,
+            0 /* not alloc */, 1 /* copy */, ctx));
+
+      if (Vb != V0) CHKERR(Num_free_Sprimme((SCALAR*)V0, ctx));
+      if (D != D0) CHKERR(Num_free_Sprimme((SCALAR*)D0, ctx));
+
+      /* W(:,i:i+nb-1) += D */
+
+      for (j = 0; j < nb; j++) {
+         CHKERR(Num_axpy_Sprimme(nLocal, 1.0, &D[nLocal * j], 1,
+               &W[ldW * (i + j)], 1, ctx));
+      }
+   }
+
+   CHKERR(Num_free_Sprimme(D, ctx));
+
+   primme->stats.timeMatvec += primme_wTimer() - t0;
+
+   return 0;
+}
+
 /*******************************************************************************
  * Subroutine massMatrixMatvec - Computes B*V(:,nv+1:nv+blksze)
  *
@@ -324,7 +434,7 @@ int applyPreconditioner_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
 
    double t0 = primme_wTimer();
 
-   if (primme->correctionParams.precondition) {
+   if (primme->correctionParams.precondition && primme->applyPreconditioner) {
 
       /* Cast V and W */
 
@@ -363,6 +473,80 @@ int applyPreconditioner_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutines matrixMatvec_workspace, matrixDeltaMatvec_workspace,
+ *    massMatrixMatvec_workspace and applyPreconditioner_workspace - Take from
+ *    the dry arena of the context the same blocks that the functions without
+ *    the suffix take when they cast a block of blockSize vectors into the
+ *    type of the callback.
+ *
+ * NOTE: the functions with the suffix _workspace in PRIMME EIGS replay the
+ *       allocations of the function with the same name (see
+ *       main_iter_workspace); keep them in sync.
+ ******************************************************************************/
+
+STATIC int cast_workspace_Sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx) {
+
+   void *V0, *W0;
+   CHKERR(Num_matrix_astype_Sprimme(NULL, nLocal, blockSize, nLocal,
+         PRIMME_OP_SCALAR, &V0, NULL, t, 1 /* alloc */, 0 /* no copy */, ctx));
+   CHKERR(Num_matrix_astype_Sprimme(NULL, nLocal, blockSize, nLocal,
+         PRIMME_OP_SCALAR, &W0, NULL, t, 1 /* alloc */, 0 /* no copy */, ctx));
+   CHKERR(Num_free_Sprimme((SCALAR*)V0, ctx));
+   CHKERR(Num_free_Sprimme((SCALAR*)W0, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int matrixMatvec_workspace_Sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx) {
+
+   if (blockSize <= 0) return 0;
+   return cast_workspace_Sprimme(
+         nLocal, blockSize, ctx.primme->matrixMatvec_type, ctx);
+}
+
+TEMPLATE_PLEASE
+int matrixDeltaMatvec_workspace_Sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx) {
+
+   if (blockSize <= 0) return 0;
+
+   int bs = max(1, ctx.primme->maxBlockSize);
+   SCALAR *D;
+   CHKERR(Num_malloc_Sprimme(nLocal * bs, &D, ctx));
+   CHKERR(cast_workspace_Sprimme(nLocal, min(bs, blockSize),
+         ctx.primme->matrixMatvec_type, ctx));
+   CHKERR(Num_free_Sprimme(D, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int massMatrixMatvec_workspace_Sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx) {
+
+   if (blockSize <= 0 || !ctx.primme->massMatrixMatvec) return 0;
+   return cast_workspace_Sprimme(
+         nLocal, blockSize, ctx.primme->massMatrixMatvec_type, ctx);
+}
+
+TEMPLATE_PLEASE
+int applyPreconditioner_workspace_Sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   if (blockSize <= 0 || !primme->correctionParams.precondition ||
+         !primme->applyPreconditioner) {
+      return 0;
+   }
+   return cast_workspace_Sprimme(
+         nLocal, blockSize, primme->applyPreconditioner_type, ctx);
+}
+
 #ifdef USE_HOST
 
 TEMPLATE_PLEASE
@@ -375,6 +559,17 @@ int globalSum_Sprimme(SCALAR *buffer, int count, primme_context ctx) {
    return globalSum_Tprimme(buffer, PRIMME_OP_SCALAR, count, ctx);
 }
 
+TEMPLATE_PLEASE
+int globalSum_begin_Sprimme(SCALAR *buffer, int count,
+      primme_globalsum_request *req, primme_context ctx) {
+
+#ifdef USE_COMPLEX
+   count *= 2;
+#endif
+
+   return globalSum_begin_Tprimme(buffer, PRIMME_OP_SCALAR, count, req, ctx);
+}
+
 TEMPLATE_PLEASE
 int broadcast_Sprimme(SCALAR *buffer, int count, primme_context ctx) {
 
@@ -385,6 +580,37 @@ int broadcast_Sprimme(SCALAR *buffer, int count, primme_context ctx) {
    return broadcast_Tprimme(buffer, PRIMME_OP_SCALAR, count, ctx);
 }
 
+TEMPLATE_PLEASE
+int globalSum_workspace_Sprimme(int count, primme_context ctx) {
+
+#ifdef USE_COMPLEX
+   count *= 2;
+#endif
+
+   return globalSum_workspace_Tprimme(PRIMME_OP_SCALAR, count, ctx);
+}
+
+TEMPLATE_PLEASE
+int globalSum_begin_workspace_Sprimme(int count, primme_globalsum_request *req,
+      primme_context ctx) {
+
+#ifdef USE_COMPLEX
+   count *= 2;
+#endif
+
+   return globalSum_begin_workspace_Tprimme(PRIMME_OP_SCALAR, count, req, ctx);
+}
+
+TEMPLATE_PLEASE
+int broadcast_workspace_Sprimme(int count, primme_context ctx) {
+
+#ifdef USE_COMPLEX
+   count *= 2;
+#endif
+
+   return broadcast_workspace_Tprimme(PRIMME_OP_SCALAR, count, ctx);
+}
+
 #ifdef USE_DOUBLE
 
 TEMPLATE_PLEASE
@@ -426,6 +652,118 @@ int globalSum_Tprimme(
    return 0;
 }
 
+/*******************************************************************************
+ * Function globalSum_is_split - Return whether globalSum_begin may return
+ *    before the reduction is completed, that is, if the user provided
+ *    globalSumRealBegin and globalSumRealWait. Callers use it to decide whether
+ *    it pays to split the reductions in pieces and overlap them with local work.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int globalSum_is_split_Tprimme(primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   return primme && primme->numProcs > 1 && primme->globalSumReal &&
+          primme->globalSumRealBegin && primme->globalSumRealWait;
+}
+
+/*******************************************************************************
+ * Subroutine globalSum_begin - Start the global sum of buffer. The result is
+ *    only available in buffer after calling globalSum_wait with the same req;
+ *    buffer should not be accessed in the meantime.
+ *    If globalSumRealBegin is not provided, it does a blocking globalSumReal.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * buffer      Array to reduce
+ * buffert     Type of buffer
+ * count       Number of elements of buffer
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * req         Handle of the reduction to pass to globalSum_wait
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int globalSum_begin_Tprimme(void *buffer, primme_op_datatype buffert, int count,
+      primme_globalsum_request *req, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   req->buffer = buffer;
+   req->buffer0 = NULL;
+   req->buffert = buffert;
+   req->count = count;
+   req->request = NULL;
+
+   /* Do a blocking reduction if the split-phase callbacks are not set */
+
+   if (!globalSum_is_split_Tprimme(ctx)) {
+      CHKERR(globalSum_Tprimme(buffer, buffert, count, ctx));
+      return 0;
+   }
+
+   double t0 = primme_wTimer();
+
+   /* Cast buffer. If a new buffer is allocated, it is kept alive until */
+   /* globalSum_wait                                                    */
+
+   CHKERR(Num_matrix_astype_Rprimme(buffer, 1, count, 1, buffert,
+         &req->buffer0, NULL, primme->globalSumReal_type, 1 /* alloc */,
+         1 /* copy */, ctx));
+   Mem_keep_frame(ctx);
+
+   int ierr = 0;
+   CHKERRM((primme->globalSumRealBegin(req->buffer0, req->buffer0, &count,
+                  primme, &req->request, &ierr),
+                 ierr),
+         PRIMME_USER_FAILURE, "Error returned by 'globalSumRealBegin' %d",
+         ierr);
+
+   primme->stats.numGlobalSum++;
+   primme->stats.timeGlobalSum += primme_wTimer() - t0;
+   primme->stats.volumeGlobalSum += count;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine globalSum_wait - Complete a reduction started by globalSum_begin.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * req         Handle returned by globalSum_begin
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int globalSum_wait_Tprimme(primme_globalsum_request *req, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   /* Quick exit if the reduction was already completed */
+
+   if (!req->buffer0) return 0;
+
+   double t0 = primme_wTimer();
+
+   int ierr = 0;
+   CHKERRM((primme->globalSumRealWait(&req->request, primme, &ierr), ierr),
+         PRIMME_USER_FAILURE, "Error returned by 'globalSumRealWait' %d",
+         ierr);
+
+   /* Copy back buffer0 */
+
+   CHKERR(Num_matrix_astype_Rprimme(req->buffer0, 1, req->count, 1,
+         primme->globalSumReal_type, &req->buffer, NULL, req->buffert,
+         -1 /* dealloc */, 1 /* copy */, ctx));
+   req->buffer0 = NULL;
+
+   primme->stats.timeGlobalSum += primme_wTimer() - t0;
+
+   return 0;
+}
+
 TEMPLATE_PLEASE
 int broadcast_Tprimme(
       void *buffer, primme_op_datatype buffert, int count, primme_context ctx) {
@@ -433,9 +771,9 @@ int broadcast_Tprimme(
    primme_params *primme = ctx.primme;
    int ierr;
 
-   /* Quick exit */
+   /* Quick exit. With commReduce every process computed the same values */
 
-   if (!primme || primme->numProcs == 1) {
+   if (!primme || primme->numProcs == 1 || ctx.commReduce) {
       return 0;
    }
 
@@ -479,6 +817,98 @@ int broadcast_iprimme(int *buffer, int count, primme_context ctx) {
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutines globalSum_workspace, globalSum_begin_workspace,
+ *    globalSum_wait_workspace and broadcast_workspace - Take from the dry
+ *    arena of the context the same blocks that the functions without the
+ *    suffix take when they cast the buffer into the type of the callbacks.
+ *    The block taken by globalSum_begin_workspace is kept in req until
+ *    globalSum_wait_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int globalSum_workspace_Tprimme(
+      primme_op_datatype buffert, int count, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   if (!primme || primme->numProcs == 1 || !primme->globalSumReal) {
+      return 0;
+   }
+
+   void *buffer0 = NULL, *buffer = NULL;
+   CHKERR(Num_matrix_astype_Rprimme(NULL, 1, count, 1, buffert, &buffer0,
+         NULL, primme->globalSumReal_type, 1 /* alloc */, 0 /* no copy */,
+         ctx));
+   CHKERR(Num_matrix_astype_Rprimme(buffer0, 1, count, 1,
+         primme->globalSumReal_type, &buffer, NULL, buffert, -1 /* dealloc */,
+         0 /* no copy */, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int globalSum_begin_workspace_Tprimme(primme_op_datatype buffert, int count,
+      primme_globalsum_request *req, primme_context ctx) {
+
+   req->buffer = NULL;
+   req->buffer0 = NULL;
+   req->buffert = buffert;
+   req->count = count;
+   req->request = NULL;
+
+   if (!globalSum_is_split_Tprimme(ctx)) {
+      CHKERR(globalSum_workspace_Tprimme(buffert, count, ctx));
+      return 0;
+   }
+
+   CHKERR(Num_matrix_astype_Rprimme(NULL, 1, count, 1, buffert,
+         &req->buffer0, NULL, ctx.primme->globalSumReal_type, 1 /* alloc */,
+         0 /* no copy */, ctx));
+   Mem_keep_frame(ctx);
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int globalSum_wait_workspace_Tprimme(
+      primme_globalsum_request *req, primme_context ctx) {
+
+   if (!req->buffer0) return 0;
+
+   CHKERR(Num_matrix_astype_Rprimme(req->buffer0, 1, req->count, 1,
+         ctx.primme->globalSumReal_type, &req->buffer, NULL, req->buffert,
+         -1 /* dealloc */, 0 /* no copy */, ctx));
+   req->buffer0 = NULL;
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int broadcast_workspace_Tprimme(
+      primme_op_datatype buffert, int count, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   if (!primme || primme->numProcs == 1 || ctx.commReduce) {
+      return 0;
+   }
+
+   if (primme->broadcastReal) {
+      void *buffer0 = NULL, *buffer = NULL;
+      CHKERR(Num_matrix_astype_dprimme(NULL, 1, count, 1, buffert, &buffer0,
+            NULL, primme->broadcastReal_type, 1 /* alloc */, 0 /* no copy */,
+            ctx));
+      CHKERR(Num_matrix_astype_Sprimme(buffer0, 1, count, 1,
+            primme->broadcastReal_type, &buffer, NULL, buffert,
+            -1 /* dealloc */, 0 /* no copy */, ctx));
+   } else {
+      CHKERR(globalSum_workspace_Tprimme(buffert, count, ctx));
+   }
+
+   return 0;
+}
+
 #endif /* USE_DOUBLE */
 
 #endif /* USE_HOST */
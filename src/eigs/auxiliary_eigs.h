@@ -308,6 +308,99 @@ void primme_free_context(primme_context ctx);
 int matrixMatvec_dprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_dprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Sprimme)
+#  define matrixDeltaMatvec_Sprimme CONCAT(matrixDeltaMatvec_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Rprimme)
+#  define matrixDeltaMatvec_Rprimme CONCAT(matrixDeltaMatvec_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SHprimme)
+#  define matrixDeltaMatvec_SHprimme CONCAT(matrixDeltaMatvec_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RHprimme)
+#  define matrixDeltaMatvec_RHprimme CONCAT(matrixDeltaMatvec_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SXprimme)
+#  define matrixDeltaMatvec_SXprimme CONCAT(matrixDeltaMatvec_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RXprimme)
+#  define matrixDeltaMatvec_RXprimme CONCAT(matrixDeltaMatvec_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Shprimme)
+#  define matrixDeltaMatvec_Shprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Rhprimme)
+#  define matrixDeltaMatvec_Rhprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Ssprimme)
+#  define matrixDeltaMatvec_Ssprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Rsprimme)
+#  define matrixDeltaMatvec_Rsprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Sdprimme)
+#  define matrixDeltaMatvec_Sdprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Rdprimme)
+#  define matrixDeltaMatvec_Rdprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Sqprimme)
+#  define matrixDeltaMatvec_Sqprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_Rqprimme)
+#  define matrixDeltaMatvec_Rqprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SXhprimme)
+#  define matrixDeltaMatvec_SXhprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RXhprimme)
+#  define matrixDeltaMatvec_RXhprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SXsprimme)
+#  define matrixDeltaMatvec_SXsprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RXsprimme)
+#  define matrixDeltaMatvec_RXsprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SXdprimme)
+#  define matrixDeltaMatvec_SXdprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RXdprimme)
+#  define matrixDeltaMatvec_RXdprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SXqprimme)
+#  define matrixDeltaMatvec_SXqprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RXqprimme)
+#  define matrixDeltaMatvec_RXqprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SHhprimme)
+#  define matrixDeltaMatvec_SHhprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RHhprimme)
+#  define matrixDeltaMatvec_RHhprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SHsprimme)
+#  define matrixDeltaMatvec_SHsprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RHsprimme)
+#  define matrixDeltaMatvec_RHsprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SHdprimme)
+#  define matrixDeltaMatvec_SHdprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RHdprimme)
+#  define matrixDeltaMatvec_RHdprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_SHqprimme)
+#  define matrixDeltaMatvec_SHqprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_RHqprimme)
+#  define matrixDeltaMatvec_RHqprimme CONCAT(matrixDeltaMatvec_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int matrixDeltaMatvec_dprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_Sprimme)
 #  define massMatrixMatvec_Sprimme CONCAT(massMatrixMatvec_,SCALAR_SUF)
 #endif
@@ -493,6 +586,379 @@ int massMatrixMatvec_dprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME_IN
 #endif
 int applyPreconditioner_dprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_dprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(cast_workspace_Sprimme)
+#  define cast_workspace_Sprimme CONCAT(cast_workspace_Sprimme,SCALAR_SUF)
+#endif
+int cast_workspace_Sprimmedprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Sprimme)
+#  define matrixMatvec_workspace_Sprimme CONCAT(matrixMatvec_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Rprimme)
+#  define matrixMatvec_workspace_Rprimme CONCAT(matrixMatvec_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SHprimme)
+#  define matrixMatvec_workspace_SHprimme CONCAT(matrixMatvec_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RHprimme)
+#  define matrixMatvec_workspace_RHprimme CONCAT(matrixMatvec_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SXprimme)
+#  define matrixMatvec_workspace_SXprimme CONCAT(matrixMatvec_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RXprimme)
+#  define matrixMatvec_workspace_RXprimme CONCAT(matrixMatvec_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Shprimme)
+#  define matrixMatvec_workspace_Shprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Rhprimme)
+#  define matrixMatvec_workspace_Rhprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Ssprimme)
+#  define matrixMatvec_workspace_Ssprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Rsprimme)
+#  define matrixMatvec_workspace_Rsprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Sdprimme)
+#  define matrixMatvec_workspace_Sdprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Rdprimme)
+#  define matrixMatvec_workspace_Rdprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Sqprimme)
+#  define matrixMatvec_workspace_Sqprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_Rqprimme)
+#  define matrixMatvec_workspace_Rqprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SXhprimme)
+#  define matrixMatvec_workspace_SXhprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RXhprimme)
+#  define matrixMatvec_workspace_RXhprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SXsprimme)
+#  define matrixMatvec_workspace_SXsprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RXsprimme)
+#  define matrixMatvec_workspace_RXsprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SXdprimme)
+#  define matrixMatvec_workspace_SXdprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RXdprimme)
+#  define matrixMatvec_workspace_RXdprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SXqprimme)
+#  define matrixMatvec_workspace_SXqprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RXqprimme)
+#  define matrixMatvec_workspace_RXqprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SHhprimme)
+#  define matrixMatvec_workspace_SHhprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RHhprimme)
+#  define matrixMatvec_workspace_RHhprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SHsprimme)
+#  define matrixMatvec_workspace_SHsprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RHsprimme)
+#  define matrixMatvec_workspace_RHsprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SHdprimme)
+#  define matrixMatvec_workspace_SHdprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RHdprimme)
+#  define matrixMatvec_workspace_RHdprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_SHqprimme)
+#  define matrixMatvec_workspace_SHqprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvec_workspace_RHqprimme)
+#  define matrixMatvec_workspace_RHqprimme CONCAT(matrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int matrixMatvec_workspace_dprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Sprimme)
+#  define matrixDeltaMatvec_workspace_Sprimme CONCAT(matrixDeltaMatvec_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Rprimme)
+#  define matrixDeltaMatvec_workspace_Rprimme CONCAT(matrixDeltaMatvec_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SHprimme)
+#  define matrixDeltaMatvec_workspace_SHprimme CONCAT(matrixDeltaMatvec_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RHprimme)
+#  define matrixDeltaMatvec_workspace_RHprimme CONCAT(matrixDeltaMatvec_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SXprimme)
+#  define matrixDeltaMatvec_workspace_SXprimme CONCAT(matrixDeltaMatvec_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RXprimme)
+#  define matrixDeltaMatvec_workspace_RXprimme CONCAT(matrixDeltaMatvec_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Shprimme)
+#  define matrixDeltaMatvec_workspace_Shprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Rhprimme)
+#  define matrixDeltaMatvec_workspace_Rhprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Ssprimme)
+#  define matrixDeltaMatvec_workspace_Ssprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Rsprimme)
+#  define matrixDeltaMatvec_workspace_Rsprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Sdprimme)
+#  define matrixDeltaMatvec_workspace_Sdprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Rdprimme)
+#  define matrixDeltaMatvec_workspace_Rdprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Sqprimme)
+#  define matrixDeltaMatvec_workspace_Sqprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_Rqprimme)
+#  define matrixDeltaMatvec_workspace_Rqprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SXhprimme)
+#  define matrixDeltaMatvec_workspace_SXhprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RXhprimme)
+#  define matrixDeltaMatvec_workspace_RXhprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SXsprimme)
+#  define matrixDeltaMatvec_workspace_SXsprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RXsprimme)
+#  define matrixDeltaMatvec_workspace_RXsprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SXdprimme)
+#  define matrixDeltaMatvec_workspace_SXdprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RXdprimme)
+#  define matrixDeltaMatvec_workspace_RXdprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SXqprimme)
+#  define matrixDeltaMatvec_workspace_SXqprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RXqprimme)
+#  define matrixDeltaMatvec_workspace_RXqprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SHhprimme)
+#  define matrixDeltaMatvec_workspace_SHhprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RHhprimme)
+#  define matrixDeltaMatvec_workspace_RHhprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SHsprimme)
+#  define matrixDeltaMatvec_workspace_SHsprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RHsprimme)
+#  define matrixDeltaMatvec_workspace_RHsprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SHdprimme)
+#  define matrixDeltaMatvec_workspace_SHdprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RHdprimme)
+#  define matrixDeltaMatvec_workspace_RHdprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_SHqprimme)
+#  define matrixDeltaMatvec_workspace_SHqprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixDeltaMatvec_workspace_RHqprimme)
+#  define matrixDeltaMatvec_workspace_RHqprimme CONCAT(matrixDeltaMatvec_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int matrixDeltaMatvec_workspace_dprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Sprimme)
+#  define massMatrixMatvec_workspace_Sprimme CONCAT(massMatrixMatvec_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Rprimme)
+#  define massMatrixMatvec_workspace_Rprimme CONCAT(massMatrixMatvec_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SHprimme)
+#  define massMatrixMatvec_workspace_SHprimme CONCAT(massMatrixMatvec_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RHprimme)
+#  define massMatrixMatvec_workspace_RHprimme CONCAT(massMatrixMatvec_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SXprimme)
+#  define massMatrixMatvec_workspace_SXprimme CONCAT(massMatrixMatvec_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RXprimme)
+#  define massMatrixMatvec_workspace_RXprimme CONCAT(massMatrixMatvec_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Shprimme)
+#  define massMatrixMatvec_workspace_Shprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Rhprimme)
+#  define massMatrixMatvec_workspace_Rhprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Ssprimme)
+#  define massMatrixMatvec_workspace_Ssprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Rsprimme)
+#  define massMatrixMatvec_workspace_Rsprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Sdprimme)
+#  define massMatrixMatvec_workspace_Sdprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Rdprimme)
+#  define massMatrixMatvec_workspace_Rdprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Sqprimme)
+#  define massMatrixMatvec_workspace_Sqprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_Rqprimme)
+#  define massMatrixMatvec_workspace_Rqprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SXhprimme)
+#  define massMatrixMatvec_workspace_SXhprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RXhprimme)
+#  define massMatrixMatvec_workspace_RXhprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SXsprimme)
+#  define massMatrixMatvec_workspace_SXsprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RXsprimme)
+#  define massMatrixMatvec_workspace_RXsprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SXdprimme)
+#  define massMatrixMatvec_workspace_SXdprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RXdprimme)
+#  define massMatrixMatvec_workspace_RXdprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SXqprimme)
+#  define massMatrixMatvec_workspace_SXqprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RXqprimme)
+#  define massMatrixMatvec_workspace_RXqprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SHhprimme)
+#  define massMatrixMatvec_workspace_SHhprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RHhprimme)
+#  define massMatrixMatvec_workspace_RHhprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SHsprimme)
+#  define massMatrixMatvec_workspace_SHsprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RHsprimme)
+#  define massMatrixMatvec_workspace_RHsprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SHdprimme)
+#  define massMatrixMatvec_workspace_SHdprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RHdprimme)
+#  define massMatrixMatvec_workspace_RHdprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_SHqprimme)
+#  define massMatrixMatvec_workspace_SHqprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(massMatrixMatvec_workspace_RHqprimme)
+#  define massMatrixMatvec_workspace_RHqprimme CONCAT(massMatrixMatvec_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int massMatrixMatvec_workspace_dprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Sprimme)
+#  define applyPreconditioner_workspace_Sprimme CONCAT(applyPreconditioner_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Rprimme)
+#  define applyPreconditioner_workspace_Rprimme CONCAT(applyPreconditioner_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SHprimme)
+#  define applyPreconditioner_workspace_SHprimme CONCAT(applyPreconditioner_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RHprimme)
+#  define applyPreconditioner_workspace_RHprimme CONCAT(applyPreconditioner_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SXprimme)
+#  define applyPreconditioner_workspace_SXprimme CONCAT(applyPreconditioner_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RXprimme)
+#  define applyPreconditioner_workspace_RXprimme CONCAT(applyPreconditioner_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Shprimme)
+#  define applyPreconditioner_workspace_Shprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Rhprimme)
+#  define applyPreconditioner_workspace_Rhprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Ssprimme)
+#  define applyPreconditioner_workspace_Ssprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Rsprimme)
+#  define applyPreconditioner_workspace_Rsprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Sdprimme)
+#  define applyPreconditioner_workspace_Sdprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Rdprimme)
+#  define applyPreconditioner_workspace_Rdprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Sqprimme)
+#  define applyPreconditioner_workspace_Sqprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_Rqprimme)
+#  define applyPreconditioner_workspace_Rqprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SXhprimme)
+#  define applyPreconditioner_workspace_SXhprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RXhprimme)
+#  define applyPreconditioner_workspace_RXhprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SXsprimme)
+#  define applyPreconditioner_workspace_SXsprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RXsprimme)
+#  define applyPreconditioner_workspace_RXsprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SXdprimme)
+#  define applyPreconditioner_workspace_SXdprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RXdprimme)
+#  define applyPreconditioner_workspace_RXdprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SXqprimme)
+#  define applyPreconditioner_workspace_SXqprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RXqprimme)
+#  define applyPreconditioner_workspace_RXqprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SHhprimme)
+#  define applyPreconditioner_workspace_SHhprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RHhprimme)
+#  define applyPreconditioner_workspace_RHhprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SHsprimme)
+#  define applyPreconditioner_workspace_SHsprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RHsprimme)
+#  define applyPreconditioner_workspace_RHsprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SHdprimme)
+#  define applyPreconditioner_workspace_SHdprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RHdprimme)
+#  define applyPreconditioner_workspace_RHdprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_SHqprimme)
+#  define applyPreconditioner_workspace_SHqprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(applyPreconditioner_workspace_RHqprimme)
+#  define applyPreconditioner_workspace_RHqprimme CONCAT(applyPreconditioner_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int applyPreconditioner_workspace_dprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(globalSum_Sprimme)
 #  define globalSum_Sprimme CONCAT(globalSum_,SCALAR_SUF)
 #endif
@@ -584,6 +1050,98 @@ int applyPreconditioner_dprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME
 #  define globalSum_RHqprimme CONCAT(globalSum_,CONCAT(CONCAT(CONCAT(,q),primme),))
 #endif
 int globalSum_dprimme(dummy_type_dprimme *buffer, int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Sprimme)
+#  define globalSum_begin_Sprimme CONCAT(globalSum_begin_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Rprimme)
+#  define globalSum_begin_Rprimme CONCAT(globalSum_begin_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SHprimme)
+#  define globalSum_begin_SHprimme CONCAT(globalSum_begin_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RHprimme)
+#  define globalSum_begin_RHprimme CONCAT(globalSum_begin_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SXprimme)
+#  define globalSum_begin_SXprimme CONCAT(globalSum_begin_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RXprimme)
+#  define globalSum_begin_RXprimme CONCAT(globalSum_begin_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Shprimme)
+#  define globalSum_begin_Shprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Rhprimme)
+#  define globalSum_begin_Rhprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Ssprimme)
+#  define globalSum_begin_Ssprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Rsprimme)
+#  define globalSum_begin_Rsprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Sdprimme)
+#  define globalSum_begin_Sdprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Rdprimme)
+#  define globalSum_begin_Rdprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Sqprimme)
+#  define globalSum_begin_Sqprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_Rqprimme)
+#  define globalSum_begin_Rqprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SXhprimme)
+#  define globalSum_begin_SXhprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RXhprimme)
+#  define globalSum_begin_RXhprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SXsprimme)
+#  define globalSum_begin_SXsprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RXsprimme)
+#  define globalSum_begin_RXsprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SXdprimme)
+#  define globalSum_begin_SXdprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RXdprimme)
+#  define globalSum_begin_RXdprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SXqprimme)
+#  define globalSum_begin_SXqprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RXqprimme)
+#  define globalSum_begin_RXqprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SHhprimme)
+#  define globalSum_begin_SHhprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RHhprimme)
+#  define globalSum_begin_RHhprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SHsprimme)
+#  define globalSum_begin_SHsprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RHsprimme)
+#  define globalSum_begin_RHsprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SHdprimme)
+#  define globalSum_begin_SHdprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RHdprimme)
+#  define globalSum_begin_RHdprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_SHqprimme)
+#  define globalSum_begin_SHqprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_RHqprimme)
+#  define globalSum_begin_RHqprimme CONCAT(globalSum_begin_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSum_begin_dprimme(dummy_type_dprimme *buffer, int count,
+      primme_globalsum_request *req, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(broadcast_Sprimme)
 #  define broadcast_Sprimme CONCAT(broadcast_,SCALAR_SUF)
 #endif
@@ -671,102 +1229,650 @@ int globalSum_dprimme(dummy_type_dprimme *buffer, int count, primme_context ctx)
 #if !defined(CHECK_TEMPLATE) && !defined(broadcast_SHqprimme)
 #  define broadcast_SHqprimme CONCAT(broadcast_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(broadcast_RHqprimme)
-#  define broadcast_RHqprimme CONCAT(broadcast_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_RHqprimme)
+#  define broadcast_RHqprimme CONCAT(broadcast_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int broadcast_dprimme(dummy_type_dprimme *buffer, int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Sprimme)
+#  define globalSum_workspace_Sprimme CONCAT(globalSum_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Rprimme)
+#  define globalSum_workspace_Rprimme CONCAT(globalSum_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SHprimme)
+#  define globalSum_workspace_SHprimme CONCAT(globalSum_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RHprimme)
+#  define globalSum_workspace_RHprimme CONCAT(globalSum_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SXprimme)
+#  define globalSum_workspace_SXprimme CONCAT(globalSum_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RXprimme)
+#  define globalSum_workspace_RXprimme CONCAT(globalSum_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Shprimme)
+#  define globalSum_workspace_Shprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Rhprimme)
+#  define globalSum_workspace_Rhprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Ssprimme)
+#  define globalSum_workspace_Ssprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Rsprimme)
+#  define globalSum_workspace_Rsprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Sdprimme)
+#  define globalSum_workspace_Sdprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Rdprimme)
+#  define globalSum_workspace_Rdprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Sqprimme)
+#  define globalSum_workspace_Sqprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_Rqprimme)
+#  define globalSum_workspace_Rqprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SXhprimme)
+#  define globalSum_workspace_SXhprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RXhprimme)
+#  define globalSum_workspace_RXhprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SXsprimme)
+#  define globalSum_workspace_SXsprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RXsprimme)
+#  define globalSum_workspace_RXsprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SXdprimme)
+#  define globalSum_workspace_SXdprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RXdprimme)
+#  define globalSum_workspace_RXdprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SXqprimme)
+#  define globalSum_workspace_SXqprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RXqprimme)
+#  define globalSum_workspace_RXqprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SHhprimme)
+#  define globalSum_workspace_SHhprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RHhprimme)
+#  define globalSum_workspace_RHhprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SHsprimme)
+#  define globalSum_workspace_SHsprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RHsprimme)
+#  define globalSum_workspace_RHsprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SHdprimme)
+#  define globalSum_workspace_SHdprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RHdprimme)
+#  define globalSum_workspace_RHdprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_SHqprimme)
+#  define globalSum_workspace_SHqprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_RHqprimme)
+#  define globalSum_workspace_RHqprimme CONCAT(globalSum_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSum_workspace_dprimme(int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Sprimme)
+#  define globalSum_begin_workspace_Sprimme CONCAT(globalSum_begin_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Rprimme)
+#  define globalSum_begin_workspace_Rprimme CONCAT(globalSum_begin_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SHprimme)
+#  define globalSum_begin_workspace_SHprimme CONCAT(globalSum_begin_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RHprimme)
+#  define globalSum_begin_workspace_RHprimme CONCAT(globalSum_begin_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SXprimme)
+#  define globalSum_begin_workspace_SXprimme CONCAT(globalSum_begin_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RXprimme)
+#  define globalSum_begin_workspace_RXprimme CONCAT(globalSum_begin_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Shprimme)
+#  define globalSum_begin_workspace_Shprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Rhprimme)
+#  define globalSum_begin_workspace_Rhprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Ssprimme)
+#  define globalSum_begin_workspace_Ssprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Rsprimme)
+#  define globalSum_begin_workspace_Rsprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Sdprimme)
+#  define globalSum_begin_workspace_Sdprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Rdprimme)
+#  define globalSum_begin_workspace_Rdprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Sqprimme)
+#  define globalSum_begin_workspace_Sqprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_Rqprimme)
+#  define globalSum_begin_workspace_Rqprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SXhprimme)
+#  define globalSum_begin_workspace_SXhprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RXhprimme)
+#  define globalSum_begin_workspace_RXhprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SXsprimme)
+#  define globalSum_begin_workspace_SXsprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RXsprimme)
+#  define globalSum_begin_workspace_RXsprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SXdprimme)
+#  define globalSum_begin_workspace_SXdprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RXdprimme)
+#  define globalSum_begin_workspace_RXdprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SXqprimme)
+#  define globalSum_begin_workspace_SXqprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RXqprimme)
+#  define globalSum_begin_workspace_RXqprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SHhprimme)
+#  define globalSum_begin_workspace_SHhprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RHhprimme)
+#  define globalSum_begin_workspace_RHhprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SHsprimme)
+#  define globalSum_begin_workspace_SHsprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RHsprimme)
+#  define globalSum_begin_workspace_RHsprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SHdprimme)
+#  define globalSum_begin_workspace_SHdprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RHdprimme)
+#  define globalSum_begin_workspace_RHdprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_SHqprimme)
+#  define globalSum_begin_workspace_SHqprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_RHqprimme)
+#  define globalSum_begin_workspace_RHqprimme CONCAT(globalSum_begin_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSum_begin_workspace_dprimme(int count, primme_globalsum_request *req,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Sprimme)
+#  define broadcast_workspace_Sprimme CONCAT(broadcast_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Rprimme)
+#  define broadcast_workspace_Rprimme CONCAT(broadcast_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SHprimme)
+#  define broadcast_workspace_SHprimme CONCAT(broadcast_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RHprimme)
+#  define broadcast_workspace_RHprimme CONCAT(broadcast_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SXprimme)
+#  define broadcast_workspace_SXprimme CONCAT(broadcast_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RXprimme)
+#  define broadcast_workspace_RXprimme CONCAT(broadcast_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Shprimme)
+#  define broadcast_workspace_Shprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Rhprimme)
+#  define broadcast_workspace_Rhprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Ssprimme)
+#  define broadcast_workspace_Ssprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Rsprimme)
+#  define broadcast_workspace_Rsprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Sdprimme)
+#  define broadcast_workspace_Sdprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Rdprimme)
+#  define broadcast_workspace_Rdprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Sqprimme)
+#  define broadcast_workspace_Sqprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_Rqprimme)
+#  define broadcast_workspace_Rqprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SXhprimme)
+#  define broadcast_workspace_SXhprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RXhprimme)
+#  define broadcast_workspace_RXhprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SXsprimme)
+#  define broadcast_workspace_SXsprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RXsprimme)
+#  define broadcast_workspace_RXsprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SXdprimme)
+#  define broadcast_workspace_SXdprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RXdprimme)
+#  define broadcast_workspace_RXdprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SXqprimme)
+#  define broadcast_workspace_SXqprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RXqprimme)
+#  define broadcast_workspace_RXqprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SHhprimme)
+#  define broadcast_workspace_SHhprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RHhprimme)
+#  define broadcast_workspace_RHhprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SHsprimme)
+#  define broadcast_workspace_SHsprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RHsprimme)
+#  define broadcast_workspace_RHsprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SHdprimme)
+#  define broadcast_workspace_SHdprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RHdprimme)
+#  define broadcast_workspace_RHdprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_SHqprimme)
+#  define broadcast_workspace_SHqprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_RHqprimme)
+#  define broadcast_workspace_RHqprimme CONCAT(broadcast_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int broadcast_workspace_dprimme(int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSprimme)
+#  define globalSum_TprimmeSprimme CONCAT(globalSum_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRprimme)
+#  define globalSum_TprimmeRprimme CONCAT(globalSum_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHprimme)
+#  define globalSum_TprimmeSHprimme CONCAT(globalSum_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHprimme)
+#  define globalSum_TprimmeRHprimme CONCAT(globalSum_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXprimme)
+#  define globalSum_TprimmeSXprimme CONCAT(globalSum_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXprimme)
+#  define globalSum_TprimmeRXprimme CONCAT(globalSum_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeShprimme)
+#  define globalSum_TprimmeShprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRhprimme)
+#  define globalSum_TprimmeRhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSsprimme)
+#  define globalSum_TprimmeSsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRsprimme)
+#  define globalSum_TprimmeRsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSdprimme)
+#  define globalSum_TprimmeSdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRdprimme)
+#  define globalSum_TprimmeRdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSqprimme)
+#  define globalSum_TprimmeSqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRqprimme)
+#  define globalSum_TprimmeRqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXhprimme)
+#  define globalSum_TprimmeSXhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXhprimme)
+#  define globalSum_TprimmeRXhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXsprimme)
+#  define globalSum_TprimmeSXsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXsprimme)
+#  define globalSum_TprimmeRXsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXdprimme)
+#  define globalSum_TprimmeSXdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXdprimme)
+#  define globalSum_TprimmeRXdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXqprimme)
+#  define globalSum_TprimmeSXqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXqprimme)
+#  define globalSum_TprimmeRXqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHhprimme)
+#  define globalSum_TprimmeSHhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHhprimme)
+#  define globalSum_TprimmeRHhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHsprimme)
+#  define globalSum_TprimmeSHsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHsprimme)
+#  define globalSum_TprimmeRHsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHdprimme)
+#  define globalSum_TprimmeSHdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHdprimme)
+#  define globalSum_TprimmeRHdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHqprimme)
+#  define globalSum_TprimmeSHqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHqprimme)
+#  define globalSum_TprimmeRHqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSum_Tprimme(
+      void *buffer, primme_op_datatype buffert, int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSprimme)
+#  define globalSum_is_split_TprimmeSprimme CONCAT(globalSum_is_split_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRprimme)
+#  define globalSum_is_split_TprimmeRprimme CONCAT(globalSum_is_split_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSHprimme)
+#  define globalSum_is_split_TprimmeSHprimme CONCAT(globalSum_is_split_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRHprimme)
+#  define globalSum_is_split_TprimmeRHprimme CONCAT(globalSum_is_split_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSXprimme)
+#  define globalSum_is_split_TprimmeSXprimme CONCAT(globalSum_is_split_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRXprimme)
+#  define globalSum_is_split_TprimmeRXprimme CONCAT(globalSum_is_split_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeShprimme)
+#  define globalSum_is_split_TprimmeShprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRhprimme)
+#  define globalSum_is_split_TprimmeRhprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSsprimme)
+#  define globalSum_is_split_TprimmeSsprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRsprimme)
+#  define globalSum_is_split_TprimmeRsprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSdprimme)
+#  define globalSum_is_split_TprimmeSdprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRdprimme)
+#  define globalSum_is_split_TprimmeRdprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSqprimme)
+#  define globalSum_is_split_TprimmeSqprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRqprimme)
+#  define globalSum_is_split_TprimmeRqprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSXhprimme)
+#  define globalSum_is_split_TprimmeSXhprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRXhprimme)
+#  define globalSum_is_split_TprimmeRXhprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSXsprimme)
+#  define globalSum_is_split_TprimmeSXsprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRXsprimme)
+#  define globalSum_is_split_TprimmeRXsprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSXdprimme)
+#  define globalSum_is_split_TprimmeSXdprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRXdprimme)
+#  define globalSum_is_split_TprimmeRXdprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSXqprimme)
+#  define globalSum_is_split_TprimmeSXqprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRXqprimme)
+#  define globalSum_is_split_TprimmeRXqprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSHhprimme)
+#  define globalSum_is_split_TprimmeSHhprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRHhprimme)
+#  define globalSum_is_split_TprimmeRHhprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSHsprimme)
+#  define globalSum_is_split_TprimmeSHsprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRHsprimme)
+#  define globalSum_is_split_TprimmeRHsprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSHdprimme)
+#  define globalSum_is_split_TprimmeSHdprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRHdprimme)
+#  define globalSum_is_split_TprimmeRHdprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeSHqprimme)
+#  define globalSum_is_split_TprimmeSHqprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_is_split_TprimmeRHqprimme)
+#  define globalSum_is_split_TprimmeRHqprimme CONCAT(globalSum_is_split_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSum_is_split_Tprimme(primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSprimme)
+#  define globalSum_begin_TprimmeSprimme CONCAT(globalSum_begin_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRprimme)
+#  define globalSum_begin_TprimmeRprimme CONCAT(globalSum_begin_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSHprimme)
+#  define globalSum_begin_TprimmeSHprimme CONCAT(globalSum_begin_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRHprimme)
+#  define globalSum_begin_TprimmeRHprimme CONCAT(globalSum_begin_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSXprimme)
+#  define globalSum_begin_TprimmeSXprimme CONCAT(globalSum_begin_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRXprimme)
+#  define globalSum_begin_TprimmeRXprimme CONCAT(globalSum_begin_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeShprimme)
+#  define globalSum_begin_TprimmeShprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRhprimme)
+#  define globalSum_begin_TprimmeRhprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSsprimme)
+#  define globalSum_begin_TprimmeSsprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRsprimme)
+#  define globalSum_begin_TprimmeRsprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSdprimme)
+#  define globalSum_begin_TprimmeSdprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRdprimme)
+#  define globalSum_begin_TprimmeRdprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSqprimme)
+#  define globalSum_begin_TprimmeSqprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRqprimme)
+#  define globalSum_begin_TprimmeRqprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSXhprimme)
+#  define globalSum_begin_TprimmeSXhprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRXhprimme)
+#  define globalSum_begin_TprimmeRXhprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSXsprimme)
+#  define globalSum_begin_TprimmeSXsprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRXsprimme)
+#  define globalSum_begin_TprimmeRXsprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSXdprimme)
+#  define globalSum_begin_TprimmeSXdprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRXdprimme)
+#  define globalSum_begin_TprimmeRXdprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSXqprimme)
+#  define globalSum_begin_TprimmeSXqprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRXqprimme)
+#  define globalSum_begin_TprimmeRXqprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSHhprimme)
+#  define globalSum_begin_TprimmeSHhprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRHhprimme)
+#  define globalSum_begin_TprimmeRHhprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSHsprimme)
+#  define globalSum_begin_TprimmeSHsprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRHsprimme)
+#  define globalSum_begin_TprimmeRHsprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSHdprimme)
+#  define globalSum_begin_TprimmeSHdprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRHdprimme)
+#  define globalSum_begin_TprimmeRHdprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeSHqprimme)
+#  define globalSum_begin_TprimmeSHqprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_TprimmeRHqprimme)
+#  define globalSum_begin_TprimmeRHqprimme CONCAT(globalSum_begin_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
 #endif
-int broadcast_dprimme(dummy_type_dprimme *buffer, int count, primme_context ctx);
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSprimme)
-#  define globalSum_TprimmeSprimme CONCAT(globalSum_Tprimme,SCALAR_SUF)
+int globalSum_begin_Tprimme(void *buffer, primme_op_datatype buffert, int count,
+      primme_globalsum_request *req, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSprimme)
+#  define globalSum_wait_TprimmeSprimme CONCAT(globalSum_wait_Tprimme,SCALAR_SUF)
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRprimme)
-#  define globalSum_TprimmeRprimme CONCAT(globalSum_Tprimme,REAL_SUF)
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRprimme)
+#  define globalSum_wait_TprimmeRprimme CONCAT(globalSum_wait_Tprimme,REAL_SUF)
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHprimme)
-#  define globalSum_TprimmeSHprimme CONCAT(globalSum_Tprimme,HOST_SCALAR_SUF)
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSHprimme)
+#  define globalSum_wait_TprimmeSHprimme CONCAT(globalSum_wait_Tprimme,HOST_SCALAR_SUF)
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHprimme)
-#  define globalSum_TprimmeRHprimme CONCAT(globalSum_Tprimme,HOST_REAL_SUF)
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRHprimme)
+#  define globalSum_wait_TprimmeRHprimme CONCAT(globalSum_wait_Tprimme,HOST_REAL_SUF)
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXprimme)
-#  define globalSum_TprimmeSXprimme CONCAT(globalSum_Tprimme,XSCALAR_SUF)
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSXprimme)
+#  define globalSum_wait_TprimmeSXprimme CONCAT(globalSum_wait_Tprimme,XSCALAR_SUF)
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXprimme)
-#  define globalSum_TprimmeRXprimme CONCAT(globalSum_Tprimme,XREAL_SUF)
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRXprimme)
+#  define globalSum_wait_TprimmeRXprimme CONCAT(globalSum_wait_Tprimme,XREAL_SUF)
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeShprimme)
-#  define globalSum_TprimmeShprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeShprimme)
+#  define globalSum_wait_TprimmeShprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRhprimme)
-#  define globalSum_TprimmeRhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRhprimme)
+#  define globalSum_wait_TprimmeRhprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSsprimme)
-#  define globalSum_TprimmeSsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSsprimme)
+#  define globalSum_wait_TprimmeSsprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRsprimme)
-#  define globalSum_TprimmeRsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRsprimme)
+#  define globalSum_wait_TprimmeRsprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSdprimme)
-#  define globalSum_TprimmeSdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSdprimme)
+#  define globalSum_wait_TprimmeSdprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRdprimme)
-#  define globalSum_TprimmeRdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRdprimme)
+#  define globalSum_wait_TprimmeRdprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSqprimme)
-#  define globalSum_TprimmeSqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSqprimme)
+#  define globalSum_wait_TprimmeSqprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRqprimme)
-#  define globalSum_TprimmeRqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRqprimme)
+#  define globalSum_wait_TprimmeRqprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXhprimme)
-#  define globalSum_TprimmeSXhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSXhprimme)
+#  define globalSum_wait_TprimmeSXhprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXhprimme)
-#  define globalSum_TprimmeRXhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRXhprimme)
+#  define globalSum_wait_TprimmeRXhprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXsprimme)
-#  define globalSum_TprimmeSXsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSXsprimme)
+#  define globalSum_wait_TprimmeSXsprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXsprimme)
-#  define globalSum_TprimmeRXsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRXsprimme)
+#  define globalSum_wait_TprimmeRXsprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXdprimme)
-#  define globalSum_TprimmeSXdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSXdprimme)
+#  define globalSum_wait_TprimmeSXdprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXdprimme)
-#  define globalSum_TprimmeRXdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRXdprimme)
+#  define globalSum_wait_TprimmeRXdprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSXqprimme)
-#  define globalSum_TprimmeSXqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSXqprimme)
+#  define globalSum_wait_TprimmeSXqprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRXqprimme)
-#  define globalSum_TprimmeRXqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRXqprimme)
+#  define globalSum_wait_TprimmeRXqprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHhprimme)
-#  define globalSum_TprimmeSHhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSHhprimme)
+#  define globalSum_wait_TprimmeSHhprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHhprimme)
-#  define globalSum_TprimmeRHhprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRHhprimme)
+#  define globalSum_wait_TprimmeRHhprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHsprimme)
-#  define globalSum_TprimmeSHsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSHsprimme)
+#  define globalSum_wait_TprimmeSHsprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHsprimme)
-#  define globalSum_TprimmeRHsprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRHsprimme)
+#  define globalSum_wait_TprimmeRHsprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHdprimme)
-#  define globalSum_TprimmeSHdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSHdprimme)
+#  define globalSum_wait_TprimmeSHdprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHdprimme)
-#  define globalSum_TprimmeRHdprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRHdprimme)
+#  define globalSum_wait_TprimmeRHdprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeSHqprimme)
-#  define globalSum_TprimmeSHqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeSHqprimme)
+#  define globalSum_wait_TprimmeSHqprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
 #endif
-#if !defined(CHECK_TEMPLATE) && !defined(globalSum_TprimmeRHqprimme)
-#  define globalSum_TprimmeRHqprimme CONCAT(globalSum_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_TprimmeRHqprimme)
+#  define globalSum_wait_TprimmeRHqprimme CONCAT(globalSum_wait_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
 #endif
-int globalSum_Tprimme(
-      void *buffer, primme_op_datatype buffert, int count, primme_context ctx);
+int globalSum_wait_Tprimme(primme_globalsum_request *req, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(broadcast_TprimmeSprimme)
 #  define broadcast_TprimmeSprimme CONCAT(broadcast_Tprimme,SCALAR_SUF)
 #endif
@@ -950,6 +2056,374 @@ int broadcast_Tprimme(
 #  define broadcast_iprimmeRHqprimme CONCAT(broadcast_iprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
 #endif
 int broadcast_iprimme(int *buffer, int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSprimme)
+#  define globalSum_workspace_TprimmeSprimme CONCAT(globalSum_workspace_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRprimme)
+#  define globalSum_workspace_TprimmeRprimme CONCAT(globalSum_workspace_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSHprimme)
+#  define globalSum_workspace_TprimmeSHprimme CONCAT(globalSum_workspace_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRHprimme)
+#  define globalSum_workspace_TprimmeRHprimme CONCAT(globalSum_workspace_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSXprimme)
+#  define globalSum_workspace_TprimmeSXprimme CONCAT(globalSum_workspace_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRXprimme)
+#  define globalSum_workspace_TprimmeRXprimme CONCAT(globalSum_workspace_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeShprimme)
+#  define globalSum_workspace_TprimmeShprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRhprimme)
+#  define globalSum_workspace_TprimmeRhprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSsprimme)
+#  define globalSum_workspace_TprimmeSsprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRsprimme)
+#  define globalSum_workspace_TprimmeRsprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSdprimme)
+#  define globalSum_workspace_TprimmeSdprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRdprimme)
+#  define globalSum_workspace_TprimmeRdprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSqprimme)
+#  define globalSum_workspace_TprimmeSqprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRqprimme)
+#  define globalSum_workspace_TprimmeRqprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSXhprimme)
+#  define globalSum_workspace_TprimmeSXhprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRXhprimme)
+#  define globalSum_workspace_TprimmeRXhprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSXsprimme)
+#  define globalSum_workspace_TprimmeSXsprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRXsprimme)
+#  define globalSum_workspace_TprimmeRXsprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSXdprimme)
+#  define globalSum_workspace_TprimmeSXdprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRXdprimme)
+#  define globalSum_workspace_TprimmeRXdprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSXqprimme)
+#  define globalSum_workspace_TprimmeSXqprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRXqprimme)
+#  define globalSum_workspace_TprimmeRXqprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSHhprimme)
+#  define globalSum_workspace_TprimmeSHhprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRHhprimme)
+#  define globalSum_workspace_TprimmeRHhprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSHsprimme)
+#  define globalSum_workspace_TprimmeSHsprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRHsprimme)
+#  define globalSum_workspace_TprimmeRHsprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSHdprimme)
+#  define globalSum_workspace_TprimmeSHdprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRHdprimme)
+#  define globalSum_workspace_TprimmeRHdprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeSHqprimme)
+#  define globalSum_workspace_TprimmeSHqprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_workspace_TprimmeRHqprimme)
+#  define globalSum_workspace_TprimmeRHqprimme CONCAT(globalSum_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSum_workspace_Tprimme(
+      primme_op_datatype buffert, int count, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSprimme)
+#  define globalSum_begin_workspace_TprimmeSprimme CONCAT(globalSum_begin_workspace_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRprimme)
+#  define globalSum_begin_workspace_TprimmeRprimme CONCAT(globalSum_begin_workspace_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSHprimme)
+#  define globalSum_begin_workspace_TprimmeSHprimme CONCAT(globalSum_begin_workspace_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRHprimme)
+#  define globalSum_begin_workspace_TprimmeRHprimme CONCAT(globalSum_begin_workspace_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSXprimme)
+#  define globalSum_begin_workspace_TprimmeSXprimme CONCAT(globalSum_begin_workspace_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRXprimme)
+#  define globalSum_begin_workspace_TprimmeRXprimme CONCAT(globalSum_begin_workspace_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeShprimme)
+#  define globalSum_begin_workspace_TprimmeShprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRhprimme)
+#  define globalSum_begin_workspace_TprimmeRhprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSsprimme)
+#  define globalSum_begin_workspace_TprimmeSsprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRsprimme)
+#  define globalSum_begin_workspace_TprimmeRsprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSdprimme)
+#  define globalSum_begin_workspace_TprimmeSdprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRdprimme)
+#  define globalSum_begin_workspace_TprimmeRdprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSqprimme)
+#  define globalSum_begin_workspace_TprimmeSqprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRqprimme)
+#  define globalSum_begin_workspace_TprimmeRqprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSXhprimme)
+#  define globalSum_begin_workspace_TprimmeSXhprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRXhprimme)
+#  define globalSum_begin_workspace_TprimmeRXhprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSXsprimme)
+#  define globalSum_begin_workspace_TprimmeSXsprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRXsprimme)
+#  define globalSum_begin_workspace_TprimmeRXsprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSXdprimme)
+#  define globalSum_begin_workspace_TprimmeSXdprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRXdprimme)
+#  define globalSum_begin_workspace_TprimmeRXdprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSXqprimme)
+#  define globalSum_begin_workspace_TprimmeSXqprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRXqprimme)
+#  define globalSum_begin_workspace_TprimmeRXqprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSHhprimme)
+#  define globalSum_begin_workspace_TprimmeSHhprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRHhprimme)
+#  define globalSum_begin_workspace_TprimmeRHhprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSHsprimme)
+#  define globalSum_begin_workspace_TprimmeSHsprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRHsprimme)
+#  define globalSum_begin_workspace_TprimmeRHsprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSHdprimme)
+#  define globalSum_begin_workspace_TprimmeSHdprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRHdprimme)
+#  define globalSum_begin_workspace_TprimmeRHdprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeSHqprimme)
+#  define globalSum_begin_workspace_TprimmeSHqprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_begin_workspace_TprimmeRHqprimme)
+#  define globalSum_begin_workspace_TprimmeRHqprimme CONCAT(globalSum_begin_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSum_begin_workspace_Tprimme(primme_op_datatype buffert, int count,
+      primme_globalsum_request *req, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSprimme)
+#  define globalSum_wait_workspace_TprimmeSprimme CONCAT(globalSum_wait_workspace_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRprimme)
+#  define globalSum_wait_workspace_TprimmeRprimme CONCAT(globalSum_wait_workspace_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSHprimme)
+#  define globalSum_wait_workspace_TprimmeSHprimme CONCAT(globalSum_wait_workspace_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRHprimme)
+#  define globalSum_wait_workspace_TprimmeRHprimme CONCAT(globalSum_wait_workspace_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSXprimme)
+#  define globalSum_wait_workspace_TprimmeSXprimme CONCAT(globalSum_wait_workspace_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRXprimme)
+#  define globalSum_wait_workspace_TprimmeRXprimme CONCAT(globalSum_wait_workspace_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeShprimme)
+#  define globalSum_wait_workspace_TprimmeShprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRhprimme)
+#  define globalSum_wait_workspace_TprimmeRhprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSsprimme)
+#  define globalSum_wait_workspace_TprimmeSsprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRsprimme)
+#  define globalSum_wait_workspace_TprimmeRsprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSdprimme)
+#  define globalSum_wait_workspace_TprimmeSdprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRdprimme)
+#  define globalSum_wait_workspace_TprimmeRdprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSqprimme)
+#  define globalSum_wait_workspace_TprimmeSqprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRqprimme)
+#  define globalSum_wait_workspace_TprimmeRqprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSXhprimme)
+#  define globalSum_wait_workspace_TprimmeSXhprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRXhprimme)
+#  define globalSum_wait_workspace_TprimmeRXhprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSXsprimme)
+#  define globalSum_wait_workspace_TprimmeSXsprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRXsprimme)
+#  define globalSum_wait_workspace_TprimmeRXsprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSXdprimme)
+#  define globalSum_wait_workspace_TprimmeSXdprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRXdprimme)
+#  define globalSum_wait_workspace_TprimmeRXdprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSXqprimme)
+#  define globalSum_wait_workspace_TprimmeSXqprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRXqprimme)
+#  define globalSum_wait_workspace_TprimmeRXqprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSHhprimme)
+#  define globalSum_wait_workspace_TprimmeSHhprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRHhprimme)
+#  define globalSum_wait_workspace_TprimmeRHhprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSHsprimme)
+#  define globalSum_wait_workspace_TprimmeSHsprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRHsprimme)
+#  define globalSum_wait_workspace_TprimmeRHsprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSHdprimme)
+#  define globalSum_wait_workspace_TprimmeSHdprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRHdprimme)
+#  define globalSum_wait_workspace_TprimmeRHdprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeSHqprimme)
+#  define globalSum_wait_workspace_TprimmeSHqprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_wait_workspace_TprimmeRHqprimme)
+#  define globalSum_wait_workspace_TprimmeRHqprimme CONCAT(globalSum_wait_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int globalSum_wait_workspace_Tprimme(
+      primme_globalsum_request *req, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSprimme)
+#  define broadcast_workspace_TprimmeSprimme CONCAT(broadcast_workspace_Tprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRprimme)
+#  define broadcast_workspace_TprimmeRprimme CONCAT(broadcast_workspace_Tprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSHprimme)
+#  define broadcast_workspace_TprimmeSHprimme CONCAT(broadcast_workspace_Tprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRHprimme)
+#  define broadcast_workspace_TprimmeRHprimme CONCAT(broadcast_workspace_Tprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSXprimme)
+#  define broadcast_workspace_TprimmeSXprimme CONCAT(broadcast_workspace_Tprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRXprimme)
+#  define broadcast_workspace_TprimmeRXprimme CONCAT(broadcast_workspace_Tprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeShprimme)
+#  define broadcast_workspace_TprimmeShprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRhprimme)
+#  define broadcast_workspace_TprimmeRhprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSsprimme)
+#  define broadcast_workspace_TprimmeSsprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRsprimme)
+#  define broadcast_workspace_TprimmeRsprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSdprimme)
+#  define broadcast_workspace_TprimmeSdprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRdprimme)
+#  define broadcast_workspace_TprimmeRdprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSqprimme)
+#  define broadcast_workspace_TprimmeSqprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRqprimme)
+#  define broadcast_workspace_TprimmeRqprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSXhprimme)
+#  define broadcast_workspace_TprimmeSXhprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRXhprimme)
+#  define broadcast_workspace_TprimmeRXhprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSXsprimme)
+#  define broadcast_workspace_TprimmeSXsprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRXsprimme)
+#  define broadcast_workspace_TprimmeRXsprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSXdprimme)
+#  define broadcast_workspace_TprimmeSXdprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRXdprimme)
+#  define broadcast_workspace_TprimmeRXdprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSXqprimme)
+#  define broadcast_workspace_TprimmeSXqprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRXqprimme)
+#  define broadcast_workspace_TprimmeRXqprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSHhprimme)
+#  define broadcast_workspace_TprimmeSHhprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRHhprimme)
+#  define broadcast_workspace_TprimmeRHhprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSHsprimme)
+#  define broadcast_workspace_TprimmeSHsprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRHsprimme)
+#  define broadcast_workspace_TprimmeRHsprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSHdprimme)
+#  define broadcast_workspace_TprimmeSHdprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRHdprimme)
+#  define broadcast_workspace_TprimmeRHdprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeSHqprimme)
+#  define broadcast_workspace_TprimmeSHqprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(broadcast_workspace_TprimmeRHqprimme)
+#  define broadcast_workspace_TprimmeRHqprimme CONCAT(broadcast_workspace_Tprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int broadcast_workspace_Tprimme(
+      primme_op_datatype buffert, int count, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(machineEpsMatrix_Sprimme)
 #  define machineEpsMatrix_Sprimme CONCAT(machineEpsMatrix_,SCALAR_SUF)
 #endif
@@ -1503,13 +2977,32 @@ int Num_dist_dots_real_dprimme(dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type
 int matrixMatvec_hprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_hprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_hprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_hprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_hprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_hprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_hprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_hprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmehprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_hprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_hprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_hprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_hprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int globalSum_hprimme(dummy_type_hprimme *buffer, int count, primme_context ctx);
+int globalSum_begin_hprimme(dummy_type_hprimme *buffer, int count,
+      primme_globalsum_request *req, primme_context ctx);
 int broadcast_hprimme(dummy_type_hprimme *buffer, int count, primme_context ctx);
+int globalSum_workspace_hprimme(int count, primme_context ctx);
+int globalSum_begin_workspace_hprimme(int count, primme_globalsum_request *req,
+      primme_context ctx);
+int broadcast_workspace_hprimme(int count, primme_context ctx);
 int machineEpsMatrix_hprimme(double *eps, primme_context ctx);
 int machineEpsOrth_hprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_hprimme(
@@ -1523,13 +3016,32 @@ int Num_dist_dots_real_hprimme(dummy_type_hprimme *x, PRIMME_INT ldx, dummy_type
 int matrixMatvec_kprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_kprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_kprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_kprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_kprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_kprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_kprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_kprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmekprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_kprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_kprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_kprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_kprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int globalSum_kprimme(dummy_type_kprimme *buffer, int count, primme_context ctx);
+int globalSum_begin_kprimme(dummy_type_kprimme *buffer, int count,
+      primme_globalsum_request *req, primme_context ctx);
 int broadcast_kprimme(dummy_type_kprimme *buffer, int count, primme_context ctx);
+int globalSum_workspace_kprimme(int count, primme_context ctx);
+int globalSum_begin_workspace_kprimme(int count, primme_globalsum_request *req,
+      primme_context ctx);
+int broadcast_workspace_kprimme(int count, primme_context ctx);
 int machineEpsMatrix_kprimme(double *eps, primme_context ctx);
 int machineEpsOrth_kprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_kprimme(
@@ -1543,13 +3055,32 @@ int Num_dist_dots_real_kprimme(dummy_type_kprimme *x, PRIMME_INT ldx, dummy_type
 int matrixMatvec_sprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_sprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_sprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_sprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_sprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_sprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_sprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_sprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmesprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int globalSum_sprimme(dummy_type_sprimme *buffer, int count, primme_context ctx);
+int globalSum_begin_sprimme(dummy_type_sprimme *buffer, int count,
+      primme_globalsum_request *req, primme_context ctx);
 int broadcast_sprimme(dummy_type_sprimme *buffer, int count, primme_context ctx);
+int globalSum_workspace_sprimme(int count, primme_context ctx);
+int globalSum_begin_workspace_sprimme(int count, primme_globalsum_request *req,
+      primme_context ctx);
+int broadcast_workspace_sprimme(int count, primme_context ctx);
 int machineEpsMatrix_sprimme(double *eps, primme_context ctx);
 int machineEpsOrth_sprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_sprimme(
@@ -1563,13 +3094,32 @@ int Num_dist_dots_real_sprimme(dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type
 int matrixMatvec_cprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_cprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_cprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_cprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_cprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_cprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_cprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_cprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmecprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_cprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_cprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_cprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_cprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int globalSum_cprimme(dummy_type_cprimme *buffer, int count, primme_context ctx);
+int globalSum_begin_cprimme(dummy_type_cprimme *buffer, int count,
+      primme_globalsum_request *req, primme_context ctx);
 int broadcast_cprimme(dummy_type_cprimme *buffer, int count, primme_context ctx);
+int globalSum_workspace_cprimme(int count, primme_context ctx);
+int globalSum_begin_workspace_cprimme(int count, primme_globalsum_request *req,
+      primme_context ctx);
+int broadcast_workspace_cprimme(int count, primme_context ctx);
 int machineEpsMatrix_cprimme(double *eps, primme_context ctx);
 int machineEpsOrth_cprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_cprimme(
@@ -1583,13 +3133,32 @@ int Num_dist_dots_real_cprimme(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type
 int matrixMatvec_zprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_zprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_zprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_zprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_zprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_zprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_zprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_zprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmezprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_zprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_zprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_zprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_zprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int globalSum_zprimme(dummy_type_zprimme *buffer, int count, primme_context ctx);
+int globalSum_begin_zprimme(dummy_type_zprimme *buffer, int count,
+      primme_globalsum_request *req, primme_context ctx);
 int broadcast_zprimme(dummy_type_zprimme *buffer, int count, primme_context ctx);
+int globalSum_workspace_zprimme(int count, primme_context ctx);
+int globalSum_begin_workspace_zprimme(int count, primme_globalsum_request *req,
+      primme_context ctx);
+int broadcast_workspace_zprimme(int count, primme_context ctx);
 int machineEpsMatrix_zprimme(double *eps, primme_context ctx);
 int machineEpsOrth_zprimme(double *eps, primme_context ctx);
 dummy_type_dprimme problemNorm_zprimme(
@@ -1603,11 +3172,24 @@ int Num_dist_dots_real_zprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type
 int matrixMatvec_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_hprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_hprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_hprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmemagma_hprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_magma_hprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_magma_hprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_magma_hprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_magma_hprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int machineEpsMatrix_magma_hprimme(double *eps, primme_context ctx);
 int machineEpsOrth_magma_hprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_magma_hprimme(
@@ -1621,11 +3203,24 @@ int Num_dist_dots_real_magma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT ldx
 int matrixMatvec_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_kprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_kprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_kprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmemagma_kprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_magma_kprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_magma_kprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_magma_kprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_magma_kprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int machineEpsMatrix_magma_kprimme(double *eps, primme_context ctx);
 int machineEpsOrth_magma_kprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_magma_kprimme(
@@ -1639,11 +3234,24 @@ int Num_dist_dots_real_magma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT ldx
 int matrixMatvec_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_sprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_sprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_sprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmemagma_sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_magma_sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_magma_sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_magma_sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_magma_sprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int machineEpsMatrix_magma_sprimme(double *eps, primme_context ctx);
 int machineEpsOrth_magma_sprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_magma_sprimme(
@@ -1657,11 +3265,24 @@ int Num_dist_dots_real_magma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT ldx
 int matrixMatvec_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_cprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_cprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_cprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmemagma_cprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_magma_cprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_magma_cprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_magma_cprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_magma_cprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int machineEpsMatrix_magma_cprimme(double *eps, primme_context ctx);
 int machineEpsOrth_magma_cprimme(double *eps, primme_context ctx);
 dummy_type_sprimme problemNorm_magma_cprimme(
@@ -1675,11 +3296,24 @@ int Num_dist_dots_real_magma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT ldx
 int matrixMatvec_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_dprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_dprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_dprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmemagma_dprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_magma_dprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_magma_dprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_magma_dprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_magma_dprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int machineEpsMatrix_magma_dprimme(double *eps, primme_context ctx);
 int machineEpsOrth_magma_dprimme(double *eps, primme_context ctx);
 dummy_type_dprimme problemNorm_magma_dprimme(
@@ -1693,11 +3327,24 @@ int Num_dist_dots_real_magma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT ldx
 int matrixMatvec_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_zprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
       primme_context ctx);
+int matrixDeltaMatvec_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_zprimme *W, PRIMME_INT ldW, int basisSize, int blockSize,
+      primme_context ctx);
 int massMatrixMatvec_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int basisSize, int blockSize,
       primme_context ctx);
 int applyPreconditioner_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_zprimme *W, PRIMME_INT ldW, int blockSize, primme_context ctx);
+int cast_workspace_Sprimmemagma_zprimme(PRIMME_INT nLocal, int blockSize,
+      primme_op_datatype t, primme_context ctx);
+int matrixMatvec_workspace_magma_zprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int matrixDeltaMatvec_workspace_magma_zprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int massMatrixMatvec_workspace_magma_zprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
+int applyPreconditioner_workspace_magma_zprimme(PRIMME_INT nLocal, int blockSize,
+      primme_context ctx);
 int machineEpsMatrix_magma_zprimme(double *eps, primme_context ctx);
 int machineEpsOrth_magma_zprimme(double *eps, primme_context ctx);
 dummy_type_dprimme problemNorm_magma_zprimme(
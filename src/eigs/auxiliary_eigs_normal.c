@@ -225,8 +225,10 @@ int Num_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV, PRIMME_INT mV,
    CHKERR(Num_zero_matrix_Sprimme(BX, m, nBXe - nBXb, ldBX, ctx));
 
    int nGH = (G ? nG * nG : 0) + (H ? nH * nH : 0);
+   int nNorms = (Rnorms ? nRe - nRb : 0) + (rnorms ? nre - nrb : 0) +
+                (xnorms ? nxe - nxb : 0);
    if (ctx.numProcs > 1) {
-      CHKERR(Num_malloc_SHprimme(nGH, &workGH, ctx));
+      CHKERR(Num_malloc_SHprimme(nGH + nNorms, &workGH, ctx));
       if (G) {
          G0 = workGH;
          ldG0 = nG;
@@ -248,6 +250,17 @@ int Num_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV, PRIMME_INT mV,
    if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = 0.0;
 
    for (i=0; i < mV; i+=m, m=min(m,mV-i)) {
+      /* Read ahead the next rows of the arrays that are out of core */
+      Mem_stream_rows(V, sizeof(SCALAR), ldV, mV, nV, i, m, ctx);
+      if (nYb < nYe) Mem_stream_rows(W, sizeof(SCALAR), ldV, mV, nV, i, m, ctx);
+      if (BV) Mem_stream_rows(BV, sizeof(SCALAR), ldV, mV, nV, i, m, ctx);
+      if (X0) Mem_stream_rows(X0, sizeof(SCALAR), ldX0, mV, nX0e-nX0b, i, m,
+            ctx);
+      if (X1) Mem_stream_rows(X1, sizeof(SCALAR), ldX1, mV, nX1e-nX1b, i, m,
+            ctx);
+      if (Wo) Mem_stream_rows(Wo, sizeof(SCALAR), ldWo, mV, nWoe-nWob, i, m,
+            ctx);
+
       /* X = V*h(nXb:nXe-1) */
       CHKERR(Num_gemm_dhd_Sprimme("N", "N", m, nXe-nXb, nV, 1.0,
          &V[i], ldV, &h[nXb*ldh], ldh, 0.0, X, ldX, ctx));
@@ -339,35 +352,49 @@ int Num_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV, PRIMME_INT mV,
       }
    }
 
-   /* Reduce and copy back G0 and H0 */
-
-   if (ctx.numProcs > 1) {
-      CHKERR(globalSum_SHprimme(workGH, nGH, ctx));
-   }
-   if (G) CHKERR(Num_copy_matrix_SHprimme(G0, nG, nG, ldG0, G, ldG, ctx));
-   if (H) CHKERR(Num_copy_matrix_SHprimme(H0, nH, nH, ldH0, H, ldH, ctx));
-
-   /* Reduce Rnorms, rnorms and xnorms and sqrt the results */
+   /* Reduce G0, H0, Rnorms, rnorms and xnorms, then copy back G0 and H0 */
+   /* and sqrt the norms. With split-phase reductions, the reduction of   */
+   /* the norms overlaps with copying back G0 and H0; otherwise all is    */
+   /* reduced in a single call.                                           */
 
    if (ctx.numProcs > 1) {
-      HREAL *tmp;
-      CHKERR(Num_malloc_RHprimme(nRe - nRb + nre - nrb + nxe - nxb, &tmp, ctx));
+      HSCALAR *norms = workGH + nGH;
       j = 0;
-      if (Rnorms) for (i=nRb; i<nRe; i++) tmp[j++] = Rnorms[i-nRb];
-      if (rnorms) for (i=nrb; i<nre; i++) tmp[j++] = rnorms[i-nrb];
-      if (xnorms) for (i=nxb; i<nxe; i++) tmp[j++] = xnorms[i-nxb];
-      if (j) CHKERR(globalSum_RHprimme(tmp, j, ctx));
+      if (Rnorms) for (i=nRb; i<nRe; i++) norms[j++] = Rnorms[i-nRb];
+      if (rnorms) for (i=nrb; i<nre; i++) norms[j++] = rnorms[i-nrb];
+      if (xnorms) for (i=nxb; i<nxe; i++) norms[j++] = xnorms[i-nxb];
+      if (globalSum_is_split_Tprimme(ctx)) {
+         primme_globalsum_request reqGH, reqNorms;
+         if (nGH > 0) {
+            CHKERR(globalSum_begin_SHprimme(workGH, nGH, &reqGH, ctx));
+         }
+         if (nNorms > 0) {
+            CHKERR(globalSum_begin_SHprimme(norms, nNorms, &reqNorms, ctx));
+         }
+         if (nGH > 0) CHKERR(globalSum_wait_Tprimme(&reqGH, ctx));
+         if (G) CHKERR(Num_copy_matrix_SHprimme(G0, nG, nG, ldG0, G, ldG, ctx));
+         if (H) CHKERR(Num_copy_matrix_SHprimme(H0, nH, nH, ldH0, H, ldH, ctx));
+         if (nNorms > 0) CHKERR(globalSum_wait_Tprimme(&reqNorms, ctx));
+      }
+      else {
+         if (nGH + nNorms > 0) {
+            CHKERR(globalSum_SHprimme(workGH, nGH + nNorms, ctx));
+         }
+         if (G) CHKERR(Num_copy_matrix_SHprimme(G0, nG, nG, ldG0, G, ldG, ctx));
+         if (H) CHKERR(Num_copy_matrix_SHprimme(H0, nH, nH, ldH0, H, ldH, ctx));
+      }
       j = 0;
-      if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = sqrt(tmp[j++]);
-      if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = sqrt(tmp[j++]);
-      if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = sqrt(tmp[j++]);
-      CHKERR(Num_free_RHprimme(tmp, ctx));
+      if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = REAL_PART(norms[j++]);
+      if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = REAL_PART(norms[j++]);
+      if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = REAL_PART(norms[j++]);
    }
    else {
-      if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = sqrt(Rnorms[i-nRb]);
-      if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = sqrt(rnorms[i-nrb]);
-      if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = sqrt(xnorms[i-nxb]);
+      if (G) CHKERR(Num_copy_matrix_SHprimme(G0, nG, nG, ldG0, G, ldG, ctx));
+      if (H) CHKERR(Num_copy_matrix_SHprimme(H0, nH, nH, ldH0, H, ldH, ctx));
    }
+   if (Rnorms) for (i=nRb; i<nRe; i++) Rnorms[i-nRb] = sqrt(Rnorms[i-nRb]);
+   if (rnorms) for (i=nrb; i<nre; i++) rnorms[i-nrb] = sqrt(rnorms[i-nrb]);
+   if (xnorms) for (i=nxb; i<nxe; i++) xnorms[i-nxb] = sqrt(xnorms[i-nxb]);
 
    CHKERR(Num_free_Sprimme(X, ctx));
    CHKERR(Num_free_Sprimme(Y, ctx));
@@ -499,6 +526,109 @@ int monitorFun_Sprimme(HEVAL *basisEvals, int basisSize, int *basisFlags,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutines *_workspace - Take from the dry arena of the context the same
+ *    blocks that the function without the suffix takes with the given sizes.
+ *    See main_iter_workspace.
+ *
+ *    Num_update_VWXR_workspace takes the number of columns of V*h, W*h and
+ *    BV*h that Num_update_VWXR computes (nX, nY and nBX), the number of
+ *    entries of G and H (nGH), and the number of norms requested (nNorms).
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int Num_update_VWXR_workspace_Sprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx) {
+
+   int m = min(PRIMME_BLOCK_SIZE, mV);
+   SCALAR *X, *Y, *BX;
+   HSCALAR *workGH = NULL;
+   CHKERR(Num_malloc_Sprimme(m * nX, &X, ctx));
+   CHKERR(Num_malloc_Sprimme(m * nY, &Y, ctx));
+   CHKERR(Num_malloc_Sprimme(m * nBX, &BX, ctx));
+   if (ctx.numProcs > 1) {
+      CHKERR(Num_malloc_SHprimme(nGH + nNorms, &workGH, ctx));
+      if (globalSum_is_split_Tprimme(ctx)) {
+         primme_globalsum_request reqGH, reqNorms;
+         if (nGH > 0) {
+            CHKERR(globalSum_begin_workspace_SHprimme(nGH, &reqGH, ctx));
+         }
+         if (nNorms > 0) {
+            CHKERR(globalSum_begin_workspace_SHprimme(nNorms, &reqNorms, ctx));
+         }
+         if (nGH > 0) CHKERR(globalSum_wait_workspace_Tprimme(&reqGH, ctx));
+         if (nNorms > 0) {
+            CHKERR(globalSum_wait_workspace_Tprimme(&reqNorms, ctx));
+         }
+      } else if (nGH + nNorms > 0) {
+         CHKERR(globalSum_workspace_SHprimme(nGH + nNorms, ctx));
+      }
+   }
+   CHKERR(Num_free_Sprimme(X, ctx));
+   CHKERR(Num_free_Sprimme(Y, ctx));
+   CHKERR(Num_free_Sprimme(BX, ctx));
+   CHKERR(Num_free_SHprimme(workGH, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int convTestFun_workspace_Sprimme(int givenEvec, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   if (!givenEvec) return 0;
+
+   void *evec0 = NULL;
+   CHKERR(Num_matrix_astype_Sprimme(NULL, primme->nLocal, 1, primme->nLocal,
+         PRIMME_OP_SCALAR, &evec0, NULL, primme->convTestFun_type,
+         1 /* alloc */, 0 /* no copy */, ctx));
+   if (primme->nLocal > 0 && evec0) {
+      CHKERR(Num_free_Sprimme((SCALAR*)evec0, ctx));
+   }
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int monitorFun_workspace_Sprimme(
+      int basisSize, int numLocked, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   if (!primme->monitorFun) return 0;
+
+   void *basisEvals0, *basisNorms0, *lockedEvals0, *lockedNorms0, *LSRes0;
+   CHKERR(KIND(Num_matrix_astype_RHprimme, Num_matrix_astype_SHprimme)(NULL,
+         1, basisSize, 1, PRIMME_OP_HREAL, (void **)&basisEvals0, NULL,
+         primme->monitorFun_type, 1 /* alloc */, 0 /* no copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, basisSize, 1, PRIMME_OP_HREAL,
+         (void **)&basisNorms0, NULL, primme->monitorFun_type, 1 /* alloc */,
+         0 /* no copy */, ctx));
+   CHKERR(KIND(Num_matrix_astype_RHprimme, Num_matrix_astype_SHprimme)(NULL,
+         1, numLocked, 1, PRIMME_OP_HREAL, (void **)&lockedEvals0, NULL,
+         primme->monitorFun_type, 1 /* alloc */, 0 /* no copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, numLocked, 1, PRIMME_OP_HREAL,
+         (void **)&lockedNorms0, NULL, primme->monitorFun_type, 1 /* alloc */,
+         0 /* no copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, 1, 1, PRIMME_OP_HREAL,
+         (void **)&LSRes0, NULL, primme->monitorFun_type, 1 /* alloc */,
+         0 /* no copy */, ctx));
+
+   if (basisEvals0) {
+      CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(
+            (HEVAL *)basisEvals0, ctx));
+   }
+   if (basisNorms0) CHKERR(Num_free_RHprimme((HREAL *)basisNorms0, ctx));
+   if (lockedEvals0) {
+      CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(
+            (HEVAL *)lockedEvals0, ctx));
+   }
+   if (lockedNorms0) CHKERR(Num_free_RHprimme((HREAL *)lockedNorms0, ctx));
+   if (LSRes0) CHKERR(Num_free_RHprimme((HREAL *)LSRes0, ctx));
+
+   return 0;
+}
+
 /******************************************************************************
  * Subroutine insertionSort -- This subroutine locks a converged Ritz value
  *   by insertion sorting it into the evals array.  A permutation array, perm,
@@ -418,6 +418,281 @@ int monitorFun_dprimme(dummy_type_dprimme *basisEvals, int basisSize, int *basis
       dummy_type_dprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_dprimme *lockedNorms,
       int inner_its, dummy_type_dprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Sprimme)
+#  define Num_update_VWXR_workspace_Sprimme CONCAT(Num_update_VWXR_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Rprimme)
+#  define Num_update_VWXR_workspace_Rprimme CONCAT(Num_update_VWXR_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SHprimme)
+#  define Num_update_VWXR_workspace_SHprimme CONCAT(Num_update_VWXR_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RHprimme)
+#  define Num_update_VWXR_workspace_RHprimme CONCAT(Num_update_VWXR_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SXprimme)
+#  define Num_update_VWXR_workspace_SXprimme CONCAT(Num_update_VWXR_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RXprimme)
+#  define Num_update_VWXR_workspace_RXprimme CONCAT(Num_update_VWXR_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Shprimme)
+#  define Num_update_VWXR_workspace_Shprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Rhprimme)
+#  define Num_update_VWXR_workspace_Rhprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Ssprimme)
+#  define Num_update_VWXR_workspace_Ssprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Rsprimme)
+#  define Num_update_VWXR_workspace_Rsprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Sdprimme)
+#  define Num_update_VWXR_workspace_Sdprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Rdprimme)
+#  define Num_update_VWXR_workspace_Rdprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Sqprimme)
+#  define Num_update_VWXR_workspace_Sqprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_Rqprimme)
+#  define Num_update_VWXR_workspace_Rqprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SXhprimme)
+#  define Num_update_VWXR_workspace_SXhprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RXhprimme)
+#  define Num_update_VWXR_workspace_RXhprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SXsprimme)
+#  define Num_update_VWXR_workspace_SXsprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RXsprimme)
+#  define Num_update_VWXR_workspace_RXsprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SXdprimme)
+#  define Num_update_VWXR_workspace_SXdprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RXdprimme)
+#  define Num_update_VWXR_workspace_RXdprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SXqprimme)
+#  define Num_update_VWXR_workspace_SXqprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RXqprimme)
+#  define Num_update_VWXR_workspace_RXqprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SHhprimme)
+#  define Num_update_VWXR_workspace_SHhprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RHhprimme)
+#  define Num_update_VWXR_workspace_RHhprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SHsprimme)
+#  define Num_update_VWXR_workspace_SHsprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RHsprimme)
+#  define Num_update_VWXR_workspace_RHsprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SHdprimme)
+#  define Num_update_VWXR_workspace_SHdprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RHdprimme)
+#  define Num_update_VWXR_workspace_RHdprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_SHqprimme)
+#  define Num_update_VWXR_workspace_SHqprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Num_update_VWXR_workspace_RHqprimme)
+#  define Num_update_VWXR_workspace_RHqprimme CONCAT(Num_update_VWXR_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int Num_update_VWXR_workspace_dprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Sprimme)
+#  define convTestFun_workspace_Sprimme CONCAT(convTestFun_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Rprimme)
+#  define convTestFun_workspace_Rprimme CONCAT(convTestFun_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SHprimme)
+#  define convTestFun_workspace_SHprimme CONCAT(convTestFun_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RHprimme)
+#  define convTestFun_workspace_RHprimme CONCAT(convTestFun_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SXprimme)
+#  define convTestFun_workspace_SXprimme CONCAT(convTestFun_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RXprimme)
+#  define convTestFun_workspace_RXprimme CONCAT(convTestFun_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Shprimme)
+#  define convTestFun_workspace_Shprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Rhprimme)
+#  define convTestFun_workspace_Rhprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Ssprimme)
+#  define convTestFun_workspace_Ssprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Rsprimme)
+#  define convTestFun_workspace_Rsprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Sdprimme)
+#  define convTestFun_workspace_Sdprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Rdprimme)
+#  define convTestFun_workspace_Rdprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Sqprimme)
+#  define convTestFun_workspace_Sqprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_Rqprimme)
+#  define convTestFun_workspace_Rqprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SXhprimme)
+#  define convTestFun_workspace_SXhprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RXhprimme)
+#  define convTestFun_workspace_RXhprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SXsprimme)
+#  define convTestFun_workspace_SXsprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RXsprimme)
+#  define convTestFun_workspace_RXsprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SXdprimme)
+#  define convTestFun_workspace_SXdprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RXdprimme)
+#  define convTestFun_workspace_RXdprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SXqprimme)
+#  define convTestFun_workspace_SXqprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RXqprimme)
+#  define convTestFun_workspace_RXqprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SHhprimme)
+#  define convTestFun_workspace_SHhprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RHhprimme)
+#  define convTestFun_workspace_RHhprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SHsprimme)
+#  define convTestFun_workspace_SHsprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RHsprimme)
+#  define convTestFun_workspace_RHsprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SHdprimme)
+#  define convTestFun_workspace_SHdprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RHdprimme)
+#  define convTestFun_workspace_RHdprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_SHqprimme)
+#  define convTestFun_workspace_SHqprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFun_workspace_RHqprimme)
+#  define convTestFun_workspace_RHqprimme CONCAT(convTestFun_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int convTestFun_workspace_dprimme(int givenEvec, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Sprimme)
+#  define monitorFun_workspace_Sprimme CONCAT(monitorFun_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Rprimme)
+#  define monitorFun_workspace_Rprimme CONCAT(monitorFun_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SHprimme)
+#  define monitorFun_workspace_SHprimme CONCAT(monitorFun_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RHprimme)
+#  define monitorFun_workspace_RHprimme CONCAT(monitorFun_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SXprimme)
+#  define monitorFun_workspace_SXprimme CONCAT(monitorFun_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RXprimme)
+#  define monitorFun_workspace_RXprimme CONCAT(monitorFun_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Shprimme)
+#  define monitorFun_workspace_Shprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Rhprimme)
+#  define monitorFun_workspace_Rhprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Ssprimme)
+#  define monitorFun_workspace_Ssprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Rsprimme)
+#  define monitorFun_workspace_Rsprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Sdprimme)
+#  define monitorFun_workspace_Sdprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Rdprimme)
+#  define monitorFun_workspace_Rdprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Sqprimme)
+#  define monitorFun_workspace_Sqprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_Rqprimme)
+#  define monitorFun_workspace_Rqprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SXhprimme)
+#  define monitorFun_workspace_SXhprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RXhprimme)
+#  define monitorFun_workspace_RXhprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SXsprimme)
+#  define monitorFun_workspace_SXsprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RXsprimme)
+#  define monitorFun_workspace_RXsprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SXdprimme)
+#  define monitorFun_workspace_SXdprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RXdprimme)
+#  define monitorFun_workspace_RXdprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SXqprimme)
+#  define monitorFun_workspace_SXqprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RXqprimme)
+#  define monitorFun_workspace_RXqprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SHhprimme)
+#  define monitorFun_workspace_SHhprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RHhprimme)
+#  define monitorFun_workspace_RHhprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SHsprimme)
+#  define monitorFun_workspace_SHsprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RHsprimme)
+#  define monitorFun_workspace_RHsprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SHdprimme)
+#  define monitorFun_workspace_SHdprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RHdprimme)
+#  define monitorFun_workspace_RHdprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_SHqprimme)
+#  define monitorFun_workspace_SHqprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFun_workspace_RHqprimme)
+#  define monitorFun_workspace_RHqprimme CONCAT(monitorFun_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int monitorFun_workspace_dprimme(
+      int basisSize, int numLocked, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(insertionSort_Sprimme)
 #  define insertionSort_Sprimme CONCAT(insertionSort_,WITH_KIND(SCALAR_SUF))
 #endif
@@ -536,6 +811,11 @@ int monitorFun_hprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basis
       dummy_type_sprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_hprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_hprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_hprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_hprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -564,6 +844,11 @@ int monitorFun_kprimme_normal(dummy_type_cprimme *basisEvals, int basisSize, int
       dummy_type_cprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_kprimme_normal(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_kprimme_normal(int givenEvec, primme_context ctx);
+int monitorFun_workspace_kprimme_normal(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_kprimme_normal(dummy_type_cprimme newVal, dummy_type_cprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -592,6 +877,11 @@ int monitorFun_kprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basis
       dummy_type_sprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_kprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_kprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_kprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_kprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -620,6 +910,11 @@ int monitorFun_sprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basis
       dummy_type_sprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_sprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_sprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_sprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_sprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -648,6 +943,11 @@ int monitorFun_cprimme_normal(dummy_type_cprimme *basisEvals, int basisSize, int
       dummy_type_cprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_cprimme_normal(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_cprimme_normal(int givenEvec, primme_context ctx);
+int monitorFun_workspace_cprimme_normal(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_cprimme_normal(dummy_type_cprimme newVal, dummy_type_cprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -676,6 +976,11 @@ int monitorFun_cprimme(dummy_type_sprimme *basisEvals, int basisSize, int *basis
       dummy_type_sprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_cprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_cprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_cprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_cprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -704,6 +1009,11 @@ int monitorFun_zprimme_normal(dummy_type_zprimme *basisEvals, int basisSize, int
       dummy_type_zprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_dprimme *lockedNorms,
       int inner_its, dummy_type_dprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_zprimme_normal(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_zprimme_normal(int givenEvec, primme_context ctx);
+int monitorFun_workspace_zprimme_normal(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_zprimme_normal(dummy_type_zprimme newVal, dummy_type_zprimme *evals,
       dummy_type_dprimme newNorm, dummy_type_dprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -732,6 +1042,11 @@ int monitorFun_zprimme(dummy_type_dprimme *basisEvals, int basisSize, int *basis
       dummy_type_dprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_dprimme *lockedNorms,
       int inner_its, dummy_type_dprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_zprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_zprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_zprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_zprimme(dummy_type_dprimme newVal, dummy_type_dprimme *evals,
       dummy_type_dprimme newNorm, dummy_type_dprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -760,6 +1075,11 @@ int monitorFun_magma_hprimme(dummy_type_sprimme *basisEvals, int basisSize, int
       dummy_type_sprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_magma_hprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_magma_hprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_magma_hprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_magma_hprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -788,6 +1108,11 @@ int monitorFun_magma_kprimme_normal(dummy_type_cprimme *basisEvals, int basisSiz
       dummy_type_cprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_magma_kprimme_normal(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_magma_kprimme_normal(int givenEvec, primme_context ctx);
+int monitorFun_workspace_magma_kprimme_normal(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_magma_kprimme_normal(dummy_type_cprimme newVal, dummy_type_cprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -816,6 +1141,11 @@ int monitorFun_magma_kprimme(dummy_type_sprimme *basisEvals, int basisSize, int
       dummy_type_sprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_magma_kprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_magma_kprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_magma_kprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_magma_kprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -844,6 +1174,11 @@ int monitorFun_magma_sprimme(dummy_type_sprimme *basisEvals, int basisSize, int
       dummy_type_sprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_magma_sprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_magma_sprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_magma_sprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_magma_sprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -872,6 +1207,11 @@ int monitorFun_magma_cprimme_normal(dummy_type_cprimme *basisEvals, int basisSiz
       dummy_type_cprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_magma_cprimme_normal(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_magma_cprimme_normal(int givenEvec, primme_context ctx);
+int monitorFun_workspace_magma_cprimme_normal(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_magma_cprimme_normal(dummy_type_cprimme newVal, dummy_type_cprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -900,6 +1240,11 @@ int monitorFun_magma_cprimme(dummy_type_sprimme *basisEvals, int basisSize, int
       dummy_type_sprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_sprimme *lockedNorms,
       int inner_its, dummy_type_sprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_magma_cprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_magma_cprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_magma_cprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_magma_cprimme(dummy_type_sprimme newVal, dummy_type_sprimme *evals,
       dummy_type_sprimme newNorm, dummy_type_sprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -928,6 +1273,11 @@ int monitorFun_magma_dprimme(dummy_type_dprimme *basisEvals, int basisSize, int
       dummy_type_dprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_dprimme *lockedNorms,
       int inner_its, dummy_type_dprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_magma_dprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_magma_dprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_magma_dprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_magma_dprimme(dummy_type_dprimme newVal, dummy_type_dprimme *evals,
       dummy_type_dprimme newNorm, dummy_type_dprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -956,6 +1306,11 @@ int monitorFun_magma_zprimme_normal(dummy_type_zprimme *basisEvals, int basisSiz
       dummy_type_zprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_dprimme *lockedNorms,
       int inner_its, dummy_type_dprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_magma_zprimme_normal(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_magma_zprimme_normal(int givenEvec, primme_context ctx);
+int monitorFun_workspace_magma_zprimme_normal(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_magma_zprimme_normal(dummy_type_zprimme newVal, dummy_type_zprimme *evals,
       dummy_type_dprimme newNorm, dummy_type_dprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
@@ -984,6 +1339,11 @@ int monitorFun_magma_zprimme(dummy_type_dprimme *basisEvals, int basisSize, int
       dummy_type_dprimme *lockedEvals, int numLocked, int *lockedFlags, dummy_type_dprimme *lockedNorms,
       int inner_its, dummy_type_dprimme LSRes, const char *msg, double time,
       primme_event event, double startTime, primme_context ctx);
+int Num_update_VWXR_workspace_magma_zprimme(PRIMME_INT mV, int nX, int nY, int nBX,
+      int nGH, int nNorms, primme_context ctx);
+int convTestFun_workspace_magma_zprimme(int givenEvec, primme_context ctx);
+int monitorFun_workspace_magma_zprimme(
+      int basisSize, int numLocked, primme_context ctx);
 int insertionSort_magma_zprimme(dummy_type_dprimme newVal, dummy_type_dprimme *evals,
       dummy_type_dprimme newNorm, dummy_type_dprimme *resNorms, int newFlag, int *flags, int *perm, int n,
       int initialShift, primme_params *primme);
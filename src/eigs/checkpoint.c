@@ -0,0 +1,655 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ * File: checkpoint.c
+ *
+ * Purpose - Save the state of the solver at a restart into a file, and load
+ *           it to resume the solve.
+ *
+ * The file starts with a header with the sizes of the problem, followed by
+ * chunks. Every chunk has a small header (id, element size, rows, columns)
+ * followed by the elements column by column. The columns are written and read
+ * directly from the solver arrays, so no copy of V or W is made. Unknown
+ * chunks are skipped when loading. In parallel every process saves its rows
+ * in its own file, named as primme->checkpointFile followed by the process ID.
+ *
+ ******************************************************************************/
+
+#ifndef THIS_FILE
+#define THIS_FILE "../eigs/checkpoint.c"
+#endif
+
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include "numerical.h"
+#include "template_normal.h"
+#include "common_eigs.h"
+/* Keep automatically generated headers under this section  */
+#ifndef CHECK_TEMPLATE
+#include "checkpoint.h"
+#include "auxiliary_eigs.h"
+#endif
+
+#ifndef CHECKPOINT_PRIVATE_H
+#define CHECKPOINT_PRIVATE_H
+
+#define CHECKPOINT_MAGIC "PRIMMECK"
+#define CHECKPOINT_VERSION 1
+
+typedef struct {
+   char magic[8];          /* CHECKPOINT_MAGIC */
+   int version;            /* CHECKPOINT_VERSION */
+   int type;               /* primme_op_datatype of V */
+   int sizeofScalar;       /* sizeof(SCALAR) */
+   int numEvals;           /* primme->numEvals */
+   PRIMME_INT n;           /* primme->n */
+   PRIMME_INT nLocal;      /* primme->nLocal */
+   int numOrthoConst;      /* primme->numOrthoConst */
+   int maxBasisSize;       /* primme->maxBasisSize */
+   int locking;            /* primme->locking */
+   int basisSize;          /* Columns in V, W and BV */
+   int numLocked;          /* Number of locked pairs */
+   int nextGuess;          /* Index in evecs of the next initial guess */
+   int numGuesses;         /* Number of initial guesses not used yet */
+   PRIMME_INT iseed[4];    /* primme->iseed */
+} checkpoint_header;
+
+typedef struct {
+   int id;                 /* One of the checkpoint_chunk_id */
+   int elemSize;           /* Size in bytes of every element */
+   PRIMME_INT m;           /* Number of rows */
+   PRIMME_INT n;           /* Number of columns */
+} checkpoint_chunk;
+
+enum checkpoint_chunk_id {
+   CHECKPOINT_END,         /* Last chunk, without data */
+   CHECKPOINT_V,           /* Basis V */
+   CHECKPOINT_W,           /* A*V */
+   CHECKPOINT_BV,          /* B*V */
+   CHECKPOINT_EVECS,       /* Orthogonal constraints and locked vectors */
+   CHECKPOINT_GUESSES,     /* Initial guesses not used yet */
+   CHECKPOINT_EVALS,       /* Locked values */
+   CHECKPOINT_RESNORMS,    /* Residual norms of the locked pairs */
+   CHECKPOINT_LOCKEDFLAGS, /* Flags of the locked pairs */
+   CHECKPOINT_PERM,        /* Permutation of the locked pairs */
+   CHECKPOINT_BEVECS,      /* B*evecs */
+   CHECKPOINT_EVECSHAT,    /* K^{-1}*B*evecs */
+   CHECKPOINT_M,           /* evecs'*B*evecsHat */
+   CHECKPOINT_MFACT,       /* Factorization of M */
+   CHECKPOINT_IPIVOT,      /* Pivots of Mfact */
+   CHECKPOINT_VTBV,        /* [evecs V]'*B*[evecs V] */
+   CHECKPOINT_FVTBV,       /* Cholesky factor of VtBV */
+   CHECKPOINT_STATS        /* Fields of primme->stats as doubles */
+};
+
+/* Fields of primme_stats saved in the CHECKPOINT_STATS chunk. Add new fields */
+/* at the end, so files from older versions are still loaded                 */
+
+static const struct {
+   size_t offset;          /* offsetof the field in primme_stats */
+   int isInt;              /* whether the field is PRIMME_INT or double */
+} checkpoint_stats_fields[] = {
+      {offsetof(primme_stats, numOuterIterations), 1},
+      {offsetof(primme_stats, numRestarts), 1},
+      {offsetof(primme_stats, numMatvecs), 1},
+      {offsetof(primme_stats, numPreconds), 1},
+      {offsetof(primme_stats, numGlobalSum), 1},
+      {offsetof(primme_stats, numBroadcast), 1},
+      {offsetof(primme_stats, volumeGlobalSum), 1},
+      {offsetof(primme_stats, volumeBroadcast), 1},
+      {offsetof(primme_stats, flopsDense), 0},
+      {offsetof(primme_stats, numOrthoInnerProds), 0},
+      {offsetof(primme_stats, elapsedTime), 0},
+      {offsetof(primme_stats, timeMatvec), 0},
+      {offsetof(primme_stats, timePrecond), 0},
+      {offsetof(primme_stats, timeOrtho), 0},
+      {offsetof(primme_stats, timeGlobalSum), 0},
+      {offsetof(primme_stats, timeBroadcast), 0},
+      {offsetof(primme_stats, timeDense), 0},
+      {offsetof(primme_stats, estimateMinEVal), 0},
+      {offsetof(primme_stats, estimateMaxEVal), 0},
+      {offsetof(primme_stats, estimateLargestSVal), 0},
+      {offsetof(primme_stats, estimateBNorm), 0},
+      {offsetof(primme_stats, estimateInvBNorm), 0},
+      {offsetof(primme_stats, maxConvTol), 0},
+      {offsetof(primme_stats, estimateResidualError), 0},
+      {offsetof(primme_stats, lockingIssue), 1},
+      {offsetof(primme_stats, numOrthoGlobalSum), 1},
+      {offsetof(primme_stats, numOrthoVectors), 1}};
+
+#define CHECKPOINT_NUM_STATS                                                   \
+   ((int)(sizeof(checkpoint_stats_fields) / sizeof(checkpoint_stats_fields[0])))
+
+#endif /* CHECKPOINT_PRIVATE_H */
+
+#ifdef SUPPORTED_TYPE
+
+/*******************************************************************************
+ * Subroutine write_chunk - Write a chunk with the matrix A into the file.
+ *    Nothing is written if A is NULL or has no elements.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * f          The file
+ * id         The chunk id
+ * elemSize   Size of every element of A in bytes
+ * m, n       The rows and columns of A
+ * A          The matrix
+ * ldA        The leading dimension of A
+ *
+ * Return value
+ * ------------
+ * int  nonzero if an error happened
+ ******************************************************************************/
+
+STATIC int write_chunk(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA) {
+
+   if (A == NULL || m <= 0 || n <= 0) return 0;
+
+   checkpoint_chunk c = {id, (int)elemSize, m, n};
+   if (fwrite(&c, sizeof(c), 1, f) != 1) return -1;
+   PRIMME_INT j;
+   for (j = 0; j < n; j++) {
+      if (fwrite((const char *)A + elemSize * ldA * j, elemSize, (size_t)m,
+                f) != (size_t)m)
+         return -1;
+   }
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine read_chunk - Read the data of a chunk into the matrix A.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * f          The file, positioned after the chunk header
+ * c_         The chunk header (checkpoint_chunk)
+ * elemSize   Size of every element of A in bytes
+ * maxm, maxn Maximum rows and columns of A
+ * ldA        The leading dimension of A
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * A          The matrix
+ *
+ * Return value
+ * ------------
+ * int  nonzero if an error happened or if the chunk does not fit in A
+ ******************************************************************************/
+
+STATIC int read_chunk(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA) {
+
+   checkpoint_chunk *c = (checkpoint_chunk *)c_;
+   if (A == NULL || (size_t)c->elemSize != elemSize || c->m > maxm ||
+         c->n > maxn)
+      return -1;
+
+   PRIMME_INT j;
+   for (j = 0; j < c->n; j++) {
+      if (fread((char *)A + elemSize * ldA * j, elemSize, (size_t)c->m, f) !=
+            (size_t)c->m)
+         return -1;
+   }
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine read_stats - Read the fields of primme->stats in a chunk written
+ *    by write_checkpoint. Fields unknown to this version are skipped, and so
+ *    is the whole chunk if it is from a version that saved primme_stats as is.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * f          The file, positioned after the chunk header
+ * c_         The chunk header (checkpoint_chunk)
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * stats      The statistics
+ *
+ * Return value
+ * ------------
+ * int  nonzero if an error happened
+ ******************************************************************************/
+
+STATIC int read_stats(FILE *f, void *c_, primme_stats *stats) {
+
+   checkpoint_chunk *c = (checkpoint_chunk *)c_;
+   if ((size_t)c->elemSize != sizeof(double) || c->n != 1) {
+      return fseek(f, (long)(c->elemSize * c->m * c->n), SEEK_CUR);
+   }
+
+   PRIMME_INT i;
+   for (i = 0; i < c->m; i++) {
+      double val;
+      if (fread(&val, sizeof(val), 1, f) != 1) return -1;
+      if (i >= CHECKPOINT_NUM_STATS) continue;
+      char *field = (char *)stats + checkpoint_stats_fields[i].offset;
+      if (checkpoint_stats_fields[i].isInt) {
+         *(PRIMME_INT *)field = (PRIMME_INT)val;
+      } else {
+         *(double *)field = val;
+      }
+   }
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine checkpoint_file_name - Return the name of the checkpoint file of
+ *    this process followed by suffix. In parallel the name has the process ID,
+ *    so that the processes don't write the same file.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * suffix     String appended to the name
+ * size       Size of name
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * name       The file name
+ *
+ * Return value
+ * ------------
+ * int  nonzero if the name does not fit in size characters
+ ******************************************************************************/
+
+STATIC int checkpoint_file_name(
+      char *name, size_t size, const char *suffix, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int n = ctx.numProcs > 1
+                 ? snprintf(name, size, "%s.%d%s", primme->checkpointFile,
+                         ctx.procID, suffix)
+                 : snprintf(name, size, "%s%s", primme->checkpointFile, suffix);
+   return n < 0 || (size_t)n >= size;
+}
+
+/*******************************************************************************
+ * Subroutine all_processes_ok - Return whether err is zero on all processes.
+ *    All processes should call it, so that they all fail if one fails.
+ *
+ * Return value
+ * ------------
+ * int  nonzero if err is nonzero on some process or the reduction failed
+ ******************************************************************************/
+
+STATIC int all_processes_ok(int err, primme_context ctx) {
+
+   if (ctx.numProcs <= 1) return err == 0;
+
+   HREAL errs = err != 0 ? 1.0 : 0.0;
+   if (globalSum_RHprimme(&errs, 1, ctx) != 0) return 0;
+   return errs == 0.0;
+}
+
+/*******************************************************************************
+ * Subroutine write_checkpoint - Write the header and all chunks.
+ *
+ * Return value
+ * ------------
+ * int  nonzero if an error happened
+ ******************************************************************************/
+
+STATIC int write_checkpoint(FILE *f, SCALAR *V, PRIMME_INT ldV, SCALAR *W,
+      PRIMME_INT ldW, SCALAR *BV, PRIMME_INT ldBV, int basisSize,
+      SCALAR *evecs, PRIMME_INT ldevecs, HEVAL *evals, HREAL *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, SCALAR *Bevecs, PRIMME_INT ldBevecs, SCALAR *evecsHat,
+      PRIMME_INT ldevecsHat, HSCALAR *M, HSCALAR *Mfact, int *ipivot, int ldM,
+      HSCALAR *VtBV, HSCALAR *fVtBV, int ldVtBV, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   int numEvecs = primme->numOrthoConst + numLocked;
+
+   checkpoint_header h;
+   memset(&h, 0, sizeof(h));
+   memcpy(h.magic, CHECKPOINT_MAGIC, sizeof(h.magic));
+   h.version = CHECKPOINT_VERSION;
+   h.type = PRIMME_OP_SCALAR;
+   h.sizeofScalar = sizeof(SCALAR);
+   h.numEvals = primme->numEvals;
+   h.n = primme->n;
+   h.nLocal = nLocal;
+   h.numOrthoConst = primme->numOrthoConst;
+   h.maxBasisSize = primme->maxBasisSize;
+   h.locking = primme->locking;
+   h.basisSize = basisSize;
+   h.numLocked = numLocked;
+   h.nextGuess = nextGuess;
+   h.numGuesses = numGuesses;
+   memcpy(h.iseed, primme->iseed, sizeof(h.iseed));
+   if (fwrite(&h, sizeof(h), 1, f) != 1) return -1;
+
+   if (write_chunk(f, CHECKPOINT_V, sizeof(SCALAR), nLocal, basisSize, V, ldV) ||
+         write_chunk(f, CHECKPOINT_W, sizeof(SCALAR), nLocal, basisSize, W,
+               ldW) ||
+         write_chunk(f, CHECKPOINT_BV, sizeof(SCALAR), nLocal, basisSize, BV,
+               ldBV) ||
+         write_chunk(f, CHECKPOINT_EVECS, sizeof(SCALAR), nLocal, numEvecs,
+               evecs, ldevecs) ||
+         write_chunk(f, CHECKPOINT_GUESSES, sizeof(SCALAR), nLocal, numGuesses,
+               &evecs[ldevecs * nextGuess], ldevecs) ||
+         write_chunk(f, CHECKPOINT_EVALS, sizeof(HEVAL), numLocked, 1, evals,
+               numLocked) ||
+         write_chunk(f, CHECKPOINT_RESNORMS, sizeof(HREAL), numLocked, 1,
+               resNorms, numLocked) ||
+         write_chunk(f, CHECKPOINT_LOCKEDFLAGS, sizeof(int), numLocked, 1,
+               lockedFlags, numLocked) ||
+         write_chunk(f, CHECKPOINT_PERM, sizeof(int), primme->numEvals, 1,
+               perm, primme->numEvals) ||
+         write_chunk(f, CHECKPOINT_BEVECS, sizeof(SCALAR), nLocal, numEvecs,
+               Bevecs, ldBevecs) ||
+         write_chunk(f, CHECKPOINT_EVECSHAT, sizeof(SCALAR), nLocal, numEvecs,
+               evecsHat, ldevecsHat) ||
+         write_chunk(f, CHECKPOINT_M, sizeof(HSCALAR), numEvecs, numEvecs, M,
+               ldM) ||
+         write_chunk(f, CHECKPOINT_MFACT, sizeof(HSCALAR), numEvecs, numEvecs,
+               Mfact, ldM) ||
+         write_chunk(f, CHECKPOINT_IPIVOT, sizeof(int), numEvecs,
+               Mfact ? 1 : 0, ipivot, numEvecs) ||
+         write_chunk(f, CHECKPOINT_VTBV, sizeof(HSCALAR), numEvecs + basisSize,
+               numEvecs + basisSize, VtBV, ldVtBV) ||
+         write_chunk(f, CHECKPOINT_FVTBV, sizeof(HSCALAR),
+               numEvecs + basisSize, numEvecs + basisSize, fVtBV, ldVtBV)) {
+      return -1;
+   }
+
+   double stats[CHECKPOINT_NUM_STATS];
+   int i;
+   for (i = 0; i < CHECKPOINT_NUM_STATS; i++) {
+      const char *field =
+            (const char *)&primme->stats + checkpoint_stats_fields[i].offset;
+      stats[i] = checkpoint_stats_fields[i].isInt ? (double)*(PRIMME_INT *)field
+                                                  : *(double *)field;
+   }
+   if (write_chunk(f, CHECKPOINT_STATS, sizeof(double), CHECKPOINT_NUM_STATS,
+             1, stats, CHECKPOINT_NUM_STATS))
+      return -1;
+
+   checkpoint_chunk end = {CHECKPOINT_END, 0, 0, 0};
+   if (fwrite(&end, sizeof(end), 1, f) != 1) return -1;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine checkpoint_save - Save the state of the solver after a restart
+ *    into primme->checkpointFile. The file is written first with the suffix
+ *    ".tmp" and then renamed, so an interrupted write does not destroy the
+ *    previous checkpoint. In parallel the files are renamed only after all
+ *    processes wrote theirs.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * V, W, BV     The basis, A*V and B*V
+ * basisSize    The number of columns in V, W and BV
+ * evecs        The orthogonal constraints, locked vectors and initial guesses
+ * evals, resNorms, lockedFlags  The values, residual norms and flags of the
+ *              locked pairs
+ * perm         The permutation of the locked pairs
+ * numLocked    The number of locked pairs
+ * nextGuess, numGuesses  Position in evecs and number of initial guesses
+ *              not used yet
+ * Bevecs, evecsHat, M, Mfact, ipivot  Arrays used by the projectors with
+ *              evecs; they may be NULL
+ * VtBV, fVtBV  V'*B*V and its Cholesky factor; they may be NULL
+ *
+ * Return value
+ * ------------
+ * error code
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int checkpoint_save_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
+      PRIMME_INT ldW, SCALAR *BV, PRIMME_INT ldBV, int basisSize,
+      SCALAR *evecs, PRIMME_INT ldevecs, HEVAL *evals, HREAL *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, SCALAR *Bevecs, PRIMME_INT ldBevecs, SCALAR *evecsHat,
+      PRIMME_INT ldevecsHat, HSCALAR *M, HSCALAR *Mfact, int *ipivot, int ldM,
+      HSCALAR *VtBV, HSCALAR *fVtBV, int ldVtBV, primme_context ctx) {
+
+   /* The arrays are written directly, so they should be on the CPU */
+
+   CHKERRM(!IMPL(1, 0), PRIMME_FUNCTION_UNAVAILABLE,
+         "Checkpoints are not supported on GPUs");
+
+   /* Errors don't return until all processes know about them, so that no */
+   /* process is left waiting in a reduction                               */
+
+   char file[FILENAME_MAX], tmpFile[FILENAME_MAX];
+   int err = checkpoint_file_name(file, sizeof(file), "", ctx) ||
+             checkpoint_file_name(tmpFile, sizeof(tmpFile), ".tmp", ctx);
+
+   double t0 = primme_wTimer();
+
+   FILE *f = err ? NULL : fopen(tmpFile, "wb");
+   if (f) {
+      err = write_checkpoint(f, V, ldV, W, ldW, BV, ldBV, basisSize, evecs,
+            ldevecs, evals, resNorms, lockedFlags, perm, numLocked, nextGuess,
+            numGuesses, Bevecs, ldBevecs, evecsHat, ldevecsHat, M, Mfact,
+            ipivot, ldM, VtBV, fVtBV, ldVtBV, ctx);
+      if (fclose(f) != 0) err = -1;
+   } else {
+      err = -1;
+   }
+   if (all_processes_ok(err, ctx)) {
+      err = rename(tmpFile, file);
+   } else {
+      if (f) remove(tmpFile);
+      err = -1;
+   }
+   CHKERRM(!all_processes_ok(err, ctx), PRIMME_CHECKPOINT_FAILURE,
+         "Could not write the checkpoint file '%s'", file);
+
+   PRINTF(5, "Checkpoint saved in %f seconds: basisSize %d numLocked %d",
+         primme_wTimer() - t0, basisSize, numLocked);
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine read_checkpoint - Read the header and all chunks.
+ *
+ * Return value
+ * ------------
+ * int  nonzero if an error happened or the file is not from this problem
+ ******************************************************************************/
+
+STATIC int read_checkpoint(FILE *f, SCALAR *V, PRIMME_INT ldV, SCALAR *W,
+      PRIMME_INT ldW, SCALAR *BV, PRIMME_INT ldBV, int *basisSize,
+      SCALAR *evecs, PRIMME_INT ldevecs, HEVAL *evals, HREAL *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, SCALAR *Bevecs, PRIMME_INT ldBevecs, SCALAR *evecsHat,
+      PRIMME_INT ldevecsHat, HSCALAR *M, HSCALAR *Mfact, int *ipivot, int ldM,
+      HSCALAR *VtBV, HSCALAR *fVtBV, int ldVtBV, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+
+   /* Check that the file is from the same problem */
+
+   checkpoint_header h;
+   if (fread(&h, sizeof(h), 1, f) != 1 ||
+         memcmp(h.magic, CHECKPOINT_MAGIC, sizeof(h.magic)) != 0 ||
+         h.version != CHECKPOINT_VERSION || h.type != PRIMME_OP_SCALAR ||
+         h.sizeofScalar != sizeof(SCALAR) || h.numEvals != primme->numEvals ||
+         h.n != primme->n || h.nLocal != nLocal ||
+         h.numOrthoConst != primme->numOrthoConst ||
+         h.locking != primme->locking || h.basisSize <= 0 ||
+         h.basisSize > primme->maxBasisSize || h.numLocked < 0 ||
+         h.numLocked > primme->numEvals || h.numGuesses < 0 ||
+         (h.numGuesses > 0 &&
+               (h.nextGuess < primme->numOrthoConst + h.numLocked ||
+                     h.nextGuess + h.numGuesses >
+                           primme->numOrthoConst + primme->numEvals)))
+      return -1;
+
+   int numEvecs = primme->numOrthoConst + h.numLocked;
+   int maxVtBV = numEvecs + h.basisSize;
+   int hasV = 0, hasW = 0;
+
+   checkpoint_chunk c;
+   while (fread(&c, sizeof(c), 1, f) == 1 && c.id != CHECKPOINT_END) {
+      int err = 0;
+      switch (c.id) {
+      case CHECKPOINT_V:
+         err = read_chunk(f, &c, sizeof(SCALAR), nLocal, h.basisSize, V, ldV);
+         hasV = (c.n == h.basisSize);
+         break;
+      case CHECKPOINT_W:
+         err = read_chunk(f, &c, sizeof(SCALAR), nLocal, h.basisSize, W, ldW);
+         hasW = (c.n == h.basisSize);
+         break;
+      case CHECKPOINT_BV:
+         err = read_chunk(f, &c, sizeof(SCALAR), nLocal, h.basisSize, BV, ldBV);
+         break;
+      case CHECKPOINT_EVECS:
+         err = read_chunk(
+               f, &c, sizeof(SCALAR), nLocal, numEvecs, evecs, ldevecs);
+         break;
+      case CHECKPOINT_GUESSES:
+         err = read_chunk(f, &c, sizeof(SCALAR), nLocal, h.numGuesses,
+               &evecs[ldevecs * h.nextGuess], ldevecs);
+         break;
+      case CHECKPOINT_EVALS:
+         err = read_chunk(f, &c, sizeof(HEVAL), h.numLocked, 1, evals, 0);
+         break;
+      case CHECKPOINT_RESNORMS:
+         err = read_chunk(f, &c, sizeof(HREAL), h.numLocked, 1, resNorms, 0);
+         break;
+      case CHECKPOINT_LOCKEDFLAGS:
+         err = read_chunk(f, &c, sizeof(int), h.numLocked, 1, lockedFlags, 0);
+         break;
+      case CHECKPOINT_PERM:
+         err = read_chunk(f, &c, sizeof(int), primme->numEvals, 1, perm, 0);
+         break;
+      case CHECKPOINT_BEVECS:
+         err = read_chunk(
+               f, &c, sizeof(SCALAR), nLocal, numEvecs, Bevecs, ldBevecs);
+         break;
+      case CHECKPOINT_EVECSHAT:
+         err = read_chunk(
+               f, &c, sizeof(SCALAR), nLocal, numEvecs, evecsHat, ldevecsHat);
+         break;
+      case CHECKPOINT_M:
+         err = read_chunk(f, &c, sizeof(HSCALAR), numEvecs, numEvecs, M, ldM);
+         break;
+      case CHECKPOINT_MFACT:
+         err = read_chunk(
+               f, &c, sizeof(HSCALAR), numEvecs, numEvecs, Mfact, ldM);
+         break;
+      case CHECKPOINT_IPIVOT:
+         err = read_chunk(f, &c, sizeof(int), numEvecs, 1, ipivot, 0);
+         break;
+      case CHECKPOINT_VTBV:
+         err = read_chunk(
+               f, &c, sizeof(HSCALAR), maxVtBV, maxVtBV, VtBV, ldVtBV);
+         break;
+      case CHECKPOINT_FVTBV:
+         err = read_chunk(
+               f, &c, sizeof(HSCALAR), maxVtBV, maxVtBV, fVtBV, ldVtBV);
+         break;
+      case CHECKPOINT_STATS:
+         err = read_stats(f, &c, &primme->stats);
+         break;
+      default:
+         /* Skip chunks from newer versions */
+         err = fseek(f, (long)(c.elemSize * c.m * c.n), SEEK_CUR);
+      }
+      if (err) return -1;
+   }
+   if (ferror(f) || !hasV || !hasW) return -1;
+
+   *basisSize = h.basisSize;
+   *numLocked = h.numLocked;
+   *nextGuess = h.nextGuess;
+   *numGuesses = h.numGuesses;
+   memcpy(primme->iseed, h.iseed, sizeof(h.iseed));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine checkpoint_load - Load the state of the solver saved by
+ *    checkpoint_save from primme->checkpointFile. The arguments are as in
+ *    checkpoint_save. The projected problem is not saved; the solver computes
+ *    it again from V and W as after a reset.
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * basisSize, numLocked, nextGuess, numGuesses  The sizes of the saved state
+ *
+ * Return value
+ * ------------
+ * error code
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int checkpoint_load_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
+      PRIMME_INT ldW, SCALAR *BV, PRIMME_INT ldBV, int *basisSize,
+      SCALAR *evecs, PRIMME_INT ldevecs, HEVAL *evals, HREAL *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, SCALAR *Bevecs, PRIMME_INT ldBevecs, SCALAR *evecsHat,
+      PRIMME_INT ldevecsHat, HSCALAR *M, HSCALAR *Mfact, int *ipivot, int ldM,
+      HSCALAR *VtBV, HSCALAR *fVtBV, int ldVtBV, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   CHKERRM(!IMPL(1, 0), PRIMME_FUNCTION_UNAVAILABLE,
+         "Checkpoints are not supported on GPUs");
+
+   /* All processes should load their files, or none resumes */
+
+   char file[FILENAME_MAX];
+   int err = checkpoint_file_name(file, sizeof(file), "", ctx);
+   FILE *f = err ? NULL : fopen(file, "rb");
+   if (f) {
+      err = read_checkpoint(f, V, ldV, W, ldW, BV, ldBV, basisSize, evecs,
+            ldevecs, evals, resNorms, lockedFlags, perm, numLocked, nextGuess,
+            numGuesses, Bevecs, ldBevecs, evecsHat, ldevecsHat, M, Mfact,
+            ipivot, ldM, VtBV, fVtBV, ldVtBV, ctx);
+      fclose(f);
+   } else {
+      err = -1;
+   }
+   CHKERRM(!all_processes_ok(err, ctx), PRIMME_CHECKPOINT_FAILURE,
+         "The checkpoint file '%s' could not be loaded for this problem",
+         file);
+
+   PRINTF(5, "Checkpoint loaded: basisSize %d numLocked %d matvecs %" PRIMME_INT_P,
+         *basisSize, *numLocked, primme->stats.numMatvecs);
+
+   return 0;
+}
+
+#endif /* SUPPORTED_TYPE */
@@ -0,0 +1,885 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ *   NOTE: THIS FILE IS AUTOMATICALLY GENERATED. PLEASE DON'T MODIFY
+ ******************************************************************************/
+
+
+#ifndef checkpoint_H
+#define checkpoint_H
+#if !defined(CHECK_TEMPLATE) && !defined(write_chunk)
+#  define write_chunk CONCAT(write_chunk,WITH_KIND(SCALAR_SUF))
+#endif
+int write_chunkdprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+#if !defined(CHECK_TEMPLATE) && !defined(read_chunk)
+#  define read_chunk CONCAT(read_chunk,WITH_KIND(SCALAR_SUF))
+#endif
+int read_chunkdprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+#if !defined(CHECK_TEMPLATE) && !defined(read_stats)
+#  define read_stats CONCAT(read_stats,WITH_KIND(SCALAR_SUF))
+#endif
+int read_statsdprimme(FILE *f, void *c_, primme_stats *stats);
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_file_name)
+#  define checkpoint_file_name CONCAT(checkpoint_file_name,WITH_KIND(SCALAR_SUF))
+#endif
+int checkpoint_file_namedprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(all_processes_ok)
+#  define all_processes_ok CONCAT(all_processes_ok,WITH_KIND(SCALAR_SUF))
+#endif
+int all_processes_okdprimme(int err, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(write_checkpoint)
+#  define write_checkpoint CONCAT(write_checkpoint,WITH_KIND(SCALAR_SUF))
+#endif
+int write_checkpointdprimme(FILE *f, dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *W,
+      PRIMME_INT ldW, dummy_type_dprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, dummy_type_dprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_dprimme *VtBV, dummy_type_dprimme *fVtBV, int ldVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Sprimme)
+#  define checkpoint_save_Sprimme CONCAT(checkpoint_save_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Rprimme)
+#  define checkpoint_save_Rprimme CONCAT(checkpoint_save_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SHprimme)
+#  define checkpoint_save_SHprimme CONCAT(checkpoint_save_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RHprimme)
+#  define checkpoint_save_RHprimme CONCAT(checkpoint_save_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SXprimme)
+#  define checkpoint_save_SXprimme CONCAT(checkpoint_save_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RXprimme)
+#  define checkpoint_save_RXprimme CONCAT(checkpoint_save_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Shprimme)
+#  define checkpoint_save_Shprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Rhprimme)
+#  define checkpoint_save_Rhprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Ssprimme)
+#  define checkpoint_save_Ssprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Rsprimme)
+#  define checkpoint_save_Rsprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Sdprimme)
+#  define checkpoint_save_Sdprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Rdprimme)
+#  define checkpoint_save_Rdprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Sqprimme)
+#  define checkpoint_save_Sqprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_Rqprimme)
+#  define checkpoint_save_Rqprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SXhprimme)
+#  define checkpoint_save_SXhprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RXhprimme)
+#  define checkpoint_save_RXhprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SXsprimme)
+#  define checkpoint_save_SXsprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RXsprimme)
+#  define checkpoint_save_RXsprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SXdprimme)
+#  define checkpoint_save_SXdprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RXdprimme)
+#  define checkpoint_save_RXdprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SXqprimme)
+#  define checkpoint_save_SXqprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RXqprimme)
+#  define checkpoint_save_RXqprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SHhprimme)
+#  define checkpoint_save_SHhprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RHhprimme)
+#  define checkpoint_save_RHhprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SHsprimme)
+#  define checkpoint_save_SHsprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RHsprimme)
+#  define checkpoint_save_RHsprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SHdprimme)
+#  define checkpoint_save_SHdprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RHdprimme)
+#  define checkpoint_save_RHdprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_SHqprimme)
+#  define checkpoint_save_SHqprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_save_RHqprimme)
+#  define checkpoint_save_RHqprimme CONCAT(checkpoint_save_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int checkpoint_save_dprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *W,
+      PRIMME_INT ldW, dummy_type_dprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, dummy_type_dprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_dprimme *VtBV, dummy_type_dprimme *fVtBV, int ldVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(read_checkpoint)
+#  define read_checkpoint CONCAT(read_checkpoint,WITH_KIND(SCALAR_SUF))
+#endif
+int read_checkpointdprimme(FILE *f, dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *W,
+      PRIMME_INT ldW, dummy_type_dprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, dummy_type_dprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_dprimme *VtBV, dummy_type_dprimme *fVtBV, int ldVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Sprimme)
+#  define checkpoint_load_Sprimme CONCAT(checkpoint_load_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Rprimme)
+#  define checkpoint_load_Rprimme CONCAT(checkpoint_load_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SHprimme)
+#  define checkpoint_load_SHprimme CONCAT(checkpoint_load_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RHprimme)
+#  define checkpoint_load_RHprimme CONCAT(checkpoint_load_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SXprimme)
+#  define checkpoint_load_SXprimme CONCAT(checkpoint_load_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RXprimme)
+#  define checkpoint_load_RXprimme CONCAT(checkpoint_load_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Shprimme)
+#  define checkpoint_load_Shprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Rhprimme)
+#  define checkpoint_load_Rhprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Ssprimme)
+#  define checkpoint_load_Ssprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Rsprimme)
+#  define checkpoint_load_Rsprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Sdprimme)
+#  define checkpoint_load_Sdprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Rdprimme)
+#  define checkpoint_load_Rdprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Sqprimme)
+#  define checkpoint_load_Sqprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_Rqprimme)
+#  define checkpoint_load_Rqprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SXhprimme)
+#  define checkpoint_load_SXhprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RXhprimme)
+#  define checkpoint_load_RXhprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SXsprimme)
+#  define checkpoint_load_SXsprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RXsprimme)
+#  define checkpoint_load_RXsprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SXdprimme)
+#  define checkpoint_load_SXdprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RXdprimme)
+#  define checkpoint_load_RXdprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SXqprimme)
+#  define checkpoint_load_SXqprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RXqprimme)
+#  define checkpoint_load_RXqprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SHhprimme)
+#  define checkpoint_load_SHhprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RHhprimme)
+#  define checkpoint_load_RHhprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SHsprimme)
+#  define checkpoint_load_SHsprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RHsprimme)
+#  define checkpoint_load_RHsprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SHdprimme)
+#  define checkpoint_load_SHdprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RHdprimme)
+#  define checkpoint_load_RHdprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_SHqprimme)
+#  define checkpoint_load_SHqprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(checkpoint_load_RHqprimme)
+#  define checkpoint_load_RHqprimme CONCAT(checkpoint_load_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int checkpoint_load_dprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *W,
+      PRIMME_INT ldW, dummy_type_dprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, dummy_type_dprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_dprimme *VtBV, dummy_type_dprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkhprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkhprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statshprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namehprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okhprimme(int err, primme_context ctx);
+int write_checkpointhprimme(FILE *f, dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
+      PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_hprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
+      PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_hprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointhprimme(FILE *f, dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
+      PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_hprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
+      PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_hprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkkprimme_normal(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkkprimme_normal(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statskprimme_normal(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namekprimme_normal(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okkprimme_normal(int err, primme_context ctx);
+int write_checkpointkprimme_normal(FILE *f, dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_kprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointkprimme_normal(FILE *f, dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_kprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkkprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkkprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statskprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namekprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okkprimme(int err, primme_context ctx);
+int write_checkpointkprimme(FILE *f, dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointkprimme(FILE *f, dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunksprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunksprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statssprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namesprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_oksprimme(int err, primme_context ctx);
+int write_checkpointsprimme(FILE *f, dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointsprimme(FILE *f, dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkcprimme_normal(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkcprimme_normal(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statscprimme_normal(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namecprimme_normal(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okcprimme_normal(int err, primme_context ctx);
+int write_checkpointcprimme_normal(FILE *f, dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_cprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointcprimme_normal(FILE *f, dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_cprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkcprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkcprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statscprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namecprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okcprimme(int err, primme_context ctx);
+int write_checkpointcprimme(FILE *f, dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointcprimme(FILE *f, dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkzprimme_normal(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkzprimme_normal(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statszprimme_normal(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namezprimme_normal(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okzprimme_normal(int err, primme_context ctx);
+int write_checkpointzprimme_normal(FILE *f, dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_zprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointzprimme_normal(FILE *f, dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_zprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkzprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkzprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statszprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namezprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okzprimme(int err, primme_context ctx);
+int write_checkpointzprimme(FILE *f, dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointzprimme(FILE *f, dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkmagma_hprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkmagma_hprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statsmagma_hprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namemagma_hprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okmagma_hprimme(int err, primme_context ctx);
+int write_checkpointmagma_hprimme(FILE *f, dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_hprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_hprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointmagma_hprimme(FILE *f, dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_hprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_hprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_hprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkmagma_kprimme_normal(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkmagma_kprimme_normal(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statsmagma_kprimme_normal(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namemagma_kprimme_normal(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okmagma_kprimme_normal(int err, primme_context ctx);
+int write_checkpointmagma_kprimme_normal(FILE *f, dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_magma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointmagma_kprimme_normal(FILE *f, dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_magma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkmagma_kprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkmagma_kprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statsmagma_kprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namemagma_kprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okmagma_kprimme(int err, primme_context ctx);
+int write_checkpointmagma_kprimme(FILE *f, dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointmagma_kprimme(FILE *f, dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkmagma_sprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkmagma_sprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statsmagma_sprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namemagma_sprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okmagma_sprimme(int err, primme_context ctx);
+int write_checkpointmagma_sprimme(FILE *f, dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointmagma_sprimme(FILE *f, dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_sprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_sprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_sprimme *M, dummy_type_sprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_sprimme *VtBV, dummy_type_sprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkmagma_cprimme_normal(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkmagma_cprimme_normal(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statsmagma_cprimme_normal(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namemagma_cprimme_normal(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okmagma_cprimme_normal(int err, primme_context ctx);
+int write_checkpointmagma_cprimme_normal(FILE *f, dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_magma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointmagma_cprimme_normal(FILE *f, dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_magma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_cprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkmagma_cprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkmagma_cprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statsmagma_cprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namemagma_cprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okmagma_cprimme(int err, primme_context ctx);
+int write_checkpointmagma_cprimme(FILE *f, dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointmagma_cprimme(FILE *f, dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs, dummy_type_sprimme *evals, dummy_type_sprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_cprimme *M, dummy_type_cprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_cprimme *VtBV, dummy_type_cprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkmagma_dprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkmagma_dprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statsmagma_dprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namemagma_dprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okmagma_dprimme(int err, primme_context ctx);
+int write_checkpointmagma_dprimme(FILE *f, dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_dprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, dummy_type_dprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_dprimme *VtBV, dummy_type_dprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_dprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, dummy_type_dprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_dprimme *VtBV, dummy_type_dprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointmagma_dprimme(FILE *f, dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_dprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, dummy_type_dprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_dprimme *VtBV, dummy_type_dprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_dprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_dprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_dprimme *M, dummy_type_dprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_dprimme *VtBV, dummy_type_dprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkmagma_zprimme_normal(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkmagma_zprimme_normal(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statsmagma_zprimme_normal(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namemagma_zprimme_normal(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okmagma_zprimme_normal(int err, primme_context ctx);
+int write_checkpointmagma_zprimme_normal(FILE *f, dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_magma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointmagma_zprimme_normal(FILE *f, dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_magma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_zprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int write_chunkmagma_zprimme(FILE *f, int id, size_t elemSize, PRIMME_INT m,
+      PRIMME_INT n, const void *A, PRIMME_INT ldA);
+int read_chunkmagma_zprimme(FILE *f, void *c_, size_t elemSize, PRIMME_INT maxm,
+      PRIMME_INT maxn, void *A, PRIMME_INT ldA);
+int read_statsmagma_zprimme(FILE *f, void *c_, primme_stats *stats);
+int checkpoint_file_namemagma_zprimme(
+      char *name, size_t size, const char *suffix, primme_context ctx);
+int all_processes_okmagma_zprimme(int err, primme_context ctx);
+int write_checkpointmagma_zprimme(FILE *f, dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_save_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int basisSize,
+      dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int numLocked, int nextGuess,
+      int numGuesses, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int read_checkpointmagma_zprimme(FILE *f, dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+int checkpoint_load_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int *basisSize,
+      dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs, dummy_type_dprimme *evals, dummy_type_dprimme *resNorms,
+      int *lockedFlags, int *perm, int *numLocked, int *nextGuess,
+      int *numGuesses, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
+      PRIMME_INT ldevecsHat, dummy_type_zprimme *M, dummy_type_zprimme *Mfact, int *ipivot, int ldM,
+      dummy_type_zprimme *VtBV, dummy_type_zprimme *fVtBV, int ldVtBV, primme_context ctx);
+#endif
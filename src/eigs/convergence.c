@@ -280,4 +280,34 @@ STATIC int check_practical_convergence(SCALAR *R, PRIMME_INT ldR, SCALAR *evecs,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine check_convergence_workspace - Take from the dry arena of the
+ *    context the same blocks that check_convergence takes for n = right-left
+ *    pairs. The flags givenX, givenR and withVtBV tell whether X, R and VtBV
+ *    are given. See main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int check_convergence_workspace_Sprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   int *toProject;
+   CHKERR(Num_malloc_iprimme(n, &toProject, ctx));
+   CHKERR(convTestFun_workspace_Sprimme(givenX, ctx));
+   if (primme->locking && numLocked > 0 && practConvCheck >= 0 && givenR &&
+         n > 0) {
+      HREAL *norms;
+      CHKERR(Num_malloc_RHprimme(n, &norms, ctx));
+      CHKERR(ortho_single_iteration_workspace_Sprimme(
+            primme->numOrthoConst + numLocked, withVtBV, 1 /* inX */, n,
+            1 /* norms */, ctx));
+      CHKERR(Num_free_RHprimme(norms, ctx));
+   }
+   CHKERR(Num_free_iprimme(toProject, ctx));
+
+   return 0;
+}
+
 #endif /* SUPPORTED_TYPE */
@@ -135,6 +135,98 @@ int check_practical_convergencedprimme(dummy_type_dprimme *R, PRIMME_INT ldR, du
       int evecsSize, PRIMME_INT ldevecs, dummy_type_dprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
       double tol, dummy_type_dprimme *VtBV, int ldVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Sprimme)
+#  define check_convergence_workspace_Sprimme CONCAT(check_convergence_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Rprimme)
+#  define check_convergence_workspace_Rprimme CONCAT(check_convergence_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SHprimme)
+#  define check_convergence_workspace_SHprimme CONCAT(check_convergence_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RHprimme)
+#  define check_convergence_workspace_RHprimme CONCAT(check_convergence_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SXprimme)
+#  define check_convergence_workspace_SXprimme CONCAT(check_convergence_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RXprimme)
+#  define check_convergence_workspace_RXprimme CONCAT(check_convergence_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Shprimme)
+#  define check_convergence_workspace_Shprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Rhprimme)
+#  define check_convergence_workspace_Rhprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Ssprimme)
+#  define check_convergence_workspace_Ssprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Rsprimme)
+#  define check_convergence_workspace_Rsprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Sdprimme)
+#  define check_convergence_workspace_Sdprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Rdprimme)
+#  define check_convergence_workspace_Rdprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Sqprimme)
+#  define check_convergence_workspace_Sqprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_Rqprimme)
+#  define check_convergence_workspace_Rqprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SXhprimme)
+#  define check_convergence_workspace_SXhprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RXhprimme)
+#  define check_convergence_workspace_RXhprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SXsprimme)
+#  define check_convergence_workspace_SXsprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RXsprimme)
+#  define check_convergence_workspace_RXsprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SXdprimme)
+#  define check_convergence_workspace_SXdprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RXdprimme)
+#  define check_convergence_workspace_RXdprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SXqprimme)
+#  define check_convergence_workspace_SXqprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RXqprimme)
+#  define check_convergence_workspace_RXqprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SHhprimme)
+#  define check_convergence_workspace_SHhprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RHhprimme)
+#  define check_convergence_workspace_RHhprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SHsprimme)
+#  define check_convergence_workspace_SHsprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RHsprimme)
+#  define check_convergence_workspace_RHsprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SHdprimme)
+#  define check_convergence_workspace_SHdprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RHdprimme)
+#  define check_convergence_workspace_RHdprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_SHqprimme)
+#  define check_convergence_workspace_SHqprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(check_convergence_workspace_RHqprimme)
+#  define check_convergence_workspace_RHqprimme CONCAT(check_convergence_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int check_convergence_workspace_dprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_hprimme(dummy_type_hprimme *X, PRIMME_INT ldX, int givenX, dummy_type_hprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_hprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *VtBV,
@@ -144,6 +236,8 @@ int check_practical_convergencehprimme(dummy_type_hprimme *R, PRIMME_INT ldR, du
       int evecsSize, PRIMME_INT ldevecs, dummy_type_hprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_sprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_hprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_kprimme_normal(dummy_type_kprimme *X, PRIMME_INT ldX, int givenX, dummy_type_kprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_kprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *VtBV,
@@ -153,6 +247,8 @@ int check_practical_convergencekprimme_normal(dummy_type_kprimme *R, PRIMME_INT
       int evecsSize, PRIMME_INT ldevecs, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_cprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_kprimme_normal(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_kprimme(dummy_type_kprimme *X, PRIMME_INT ldX, int givenX, dummy_type_kprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_kprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *VtBV,
@@ -162,6 +258,8 @@ int check_practical_convergencekprimme(dummy_type_kprimme *R, PRIMME_INT ldR, du
       int evecsSize, PRIMME_INT ldevecs, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_cprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_kprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_sprimme(dummy_type_sprimme *X, PRIMME_INT ldX, int givenX, dummy_type_sprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_sprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *VtBV,
@@ -171,6 +269,8 @@ int check_practical_convergencesprimme(dummy_type_sprimme *R, PRIMME_INT ldR, du
       int evecsSize, PRIMME_INT ldevecs, dummy_type_sprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_sprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_sprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_cprimme_normal(dummy_type_cprimme *X, PRIMME_INT ldX, int givenX, dummy_type_cprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_cprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *VtBV,
@@ -180,6 +280,8 @@ int check_practical_convergencecprimme_normal(dummy_type_cprimme *R, PRIMME_INT
       int evecsSize, PRIMME_INT ldevecs, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_cprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_cprimme_normal(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_cprimme(dummy_type_cprimme *X, PRIMME_INT ldX, int givenX, dummy_type_cprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_cprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *VtBV,
@@ -189,6 +291,8 @@ int check_practical_convergencecprimme(dummy_type_cprimme *R, PRIMME_INT ldR, du
       int evecsSize, PRIMME_INT ldevecs, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_cprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_cprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_zprimme_normal(dummy_type_zprimme *X, PRIMME_INT ldX, int givenX, dummy_type_zprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_zprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *VtBV,
@@ -198,6 +302,8 @@ int check_practical_convergencezprimme_normal(dummy_type_zprimme *R, PRIMME_INT
       int evecsSize, PRIMME_INT ldevecs, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
       double tol, dummy_type_zprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_zprimme_normal(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_zprimme(dummy_type_zprimme *X, PRIMME_INT ldX, int givenX, dummy_type_zprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_zprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *VtBV,
@@ -207,6 +313,8 @@ int check_practical_convergencezprimme(dummy_type_zprimme *R, PRIMME_INT ldR, du
       int evecsSize, PRIMME_INT ldevecs, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
       double tol, dummy_type_zprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_zprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_magma_hprimme(dummy_type_magma_hprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_hprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_hprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *VtBV,
@@ -216,6 +324,8 @@ int check_practical_convergencemagma_hprimme(dummy_type_magma_hprimme *R, PRIMME
       int evecsSize, PRIMME_INT ldevecs, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_sprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_magma_hprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_magma_kprimme_normal(dummy_type_magma_kprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_kprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_kprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *VtBV,
@@ -225,6 +335,8 @@ int check_practical_convergencemagma_kprimme_normal(dummy_type_magma_kprimme *R,
       int evecsSize, PRIMME_INT ldevecs, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_cprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_magma_kprimme_normal(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_magma_kprimme(dummy_type_magma_kprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_kprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_kprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *VtBV,
@@ -234,6 +346,8 @@ int check_practical_convergencemagma_kprimme(dummy_type_magma_kprimme *R, PRIMME
       int evecsSize, PRIMME_INT ldevecs, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_cprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_magma_kprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_magma_sprimme(dummy_type_magma_sprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_sprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_sprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *VtBV,
@@ -243,6 +357,8 @@ int check_practical_convergencemagma_sprimme(dummy_type_magma_sprimme *R, PRIMME
       int evecsSize, PRIMME_INT ldevecs, dummy_type_magma_sprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_sprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_magma_sprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_magma_cprimme_normal(dummy_type_magma_cprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_cprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_cprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *VtBV,
@@ -252,6 +368,8 @@ int check_practical_convergencemagma_cprimme_normal(dummy_type_magma_cprimme *R,
       int evecsSize, PRIMME_INT ldevecs, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_cprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_magma_cprimme_normal(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_magma_cprimme(dummy_type_magma_cprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_cprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_cprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *VtBV,
@@ -261,6 +379,8 @@ int check_practical_convergencemagma_cprimme(dummy_type_magma_cprimme *R, PRIMME
       int evecsSize, PRIMME_INT ldevecs, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_sprimme *blockNorms,
       double tol, dummy_type_cprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_magma_cprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_magma_dprimme(dummy_type_magma_dprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_dprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_dprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_dprimme *VtBV,
@@ -270,6 +390,8 @@ int check_practical_convergencemagma_dprimme(dummy_type_magma_dprimme *R, PRIMME
       int evecsSize, PRIMME_INT ldevecs, dummy_type_magma_dprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
       double tol, dummy_type_dprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_magma_dprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_magma_zprimme_normal(dummy_type_magma_zprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_zprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_zprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *VtBV,
@@ -279,6 +401,8 @@ int check_practical_convergencemagma_zprimme_normal(dummy_type_magma_zprimme *R,
       int evecsSize, PRIMME_INT ldevecs, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
       double tol, dummy_type_zprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_magma_zprimme_normal(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 int check_convergence_magma_zprimme(dummy_type_magma_zprimme *X, PRIMME_INT ldX, int givenX, dummy_type_magma_zprimme *R,
       PRIMME_INT ldR, int givenR, dummy_type_magma_zprimme *evecs, int numLocked,
       PRIMME_INT ldevecs, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *VtBV,
@@ -288,4 +412,6 @@ int check_practical_convergencemagma_zprimme(dummy_type_magma_zprimme *R, PRIMME
       int evecsSize, PRIMME_INT ldevecs, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs,
       int left, int *iev, int numToProject, int *flags, dummy_type_dprimme *blockNorms,
       double tol, dummy_type_zprimme *VtBV, int ldVtBV, primme_context ctx);
+int check_convergence_workspace_magma_zprimme(int givenX, int givenR, int withVtBV,
+      int numLocked, int n, int practConvCheck, primme_context ctx);
 #endif
@@ -339,8 +339,24 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
       SCALAR *r = &W[ldW*basisSize];    /* All the block residuals    */
       SCALAR *x = &V[ldV*basisSize];    /* All the block Ritz vectors */
       SCALAR *Bx = &BV[ldBV*basisSize]; /* B*x                        */
-      
-      if ( primme->correctionParams.projectors.RightX &&
+      int filtered = 0;
+
+#ifdef USE_HERMITIAN
+      /* Without a preconditioner, Chebyshev-Davidson expands the basis */
+      /* with p(A)x instead of r if there is an interval to damp        */
+
+      if (primme->correctionParams.precondition &&
+            primme->applyPreconditioner == NULL &&
+            primme->correctionParams.chebyshevDegree > 0) {
+         CHKERR(chebyshev_filter(x, ldV, ritzVals, basisSize, iev, blockSize,
+               &filtered, ctx));
+      }
+#endif
+
+      if (filtered) {
+         /* x has been replaced by p(A)x */
+      }
+      else if ( primme->correctionParams.projectors.RightX &&
            primme->correctionParams.projectors.SkewX    ) {    
            /* Compute exact Olsen's projected preconditioner. This is */
           /* expensive and rarely improves anything! Included for completeness*/
@@ -358,7 +374,7 @@ int solve_correction_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
                       primme->applyPreconditioner) ||
                      Bx != x ||
                      (primme->locking &&
-                           primme->orth == primme_orth_implicit_I))) {
+                           primme->orth != primme_orth_explicit_I))) {
 #ifdef USE_HERMITIAN
             /*Compute a cheap approximation to OLSENS, where (x'Kinvr)/xKinvx */
             /*is approximated by e: Kinvr-e*KinvBx=Kinv(r-e*x)=Kinv(I-ct*x*x')r*/
@@ -696,6 +712,145 @@ STATIC void mergeSort(HREAL *lockedEvals, int numLocked, HREAL *ritzVals,
 
 }
 
+#ifdef USE_HERMITIAN
+/*******************************************************************************
+ * Subroutine chebyshev_filter - Replaces the Ritz vectors x by p(A)x, where p
+ *    is the Chebyshev polynomial that damps the unwanted end of the spectrum
+ *    and is one at the wanted end. All matrixMatvec calls are on the whole
+ *    block, and nothing is orthogonalized.
+ *
+ *    For primme_smallest the damped interval goes from the median Ritz value
+ *    of the basis, or above the Ritz values of the block, up to an upper
+ *    bound of the spectrum: aNorm or estimateMaxEVal plus a margin. For
+ *    primme_largest it is mirrored. The degree is the smallest one for which
+ *    p amplifies the wanted end 1e4 times over the damped interval, up to
+ *    chebyshevDegree. So the interval and the degree follow the estimates
+ *    in primme->stats as they improve.
+ *
+ *    The three-term recurrence is scaled as in Y. Zhou and Y. Saad, A
+ *    Chebyshev-Davidson algorithm for large symmetric eigenproblems, SIAM J.
+ *    Matrix Anal. Appl. 29 (2007).
+ *
+ * Input Parameters
+ * ----------------
+ * ldx        The leading dimension of x
+ *
+ * ritzVals   The Ritz values of the current basis
+ *
+ * basisSize  The size of the basis
+ *
+ * iev        The index of each block Ritz value in ritzVals
+ *
+ * blockSize  The number of vectors in x
+ *
+ * Input/Output parameters
+ * -----------------------
+ * x          The Ritz vectors; on output p(A)x if filtered
+ *
+ * Output parameters
+ * -----------------
+ * filtered   Zero if there is no interval to damp (targets other than
+ *            primme_smallest and primme_largest, generalized problems or
+ *            estimates not available yet) and x is unchanged; one otherwise
+ *
+ ******************************************************************************/
+
+STATIC int chebyshev_filter(SCALAR *x, PRIMME_INT ldx, HEVAL *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   const double gain = 1e4;   /* amplification of the wanted end */
+   const double margin = .1;  /* relative room added to the estimates */
+   PRIMME_INT nLocal = primme->nLocal;
+   int i, k;
+
+   /* Quick exit if there is no interval to damp */
+
+   int smallest = (primme->target == primme_smallest);
+   double lmin = primme->stats.estimateMinEVal;
+   double lmax = primme->stats.estimateMaxEVal;
+   *filtered = 0;
+   if ((!smallest && primme->target != primme_largest) ||
+         primme->massMatrixMatvec || basisSize <= 0 || lmin == HUGE_VAL ||
+         lmax == -HUGE_VAL || lmax <= lmin) {
+      return 0;
+   }
+
+   /* Damp [a,b] and keep a0; the cut is the median Ritz value unless the */
+   /* block is beyond that                                                */
+
+   double a, b, a0, cut = ritzVals[basisSize / 2];
+   for (i = 0; i < blockSize; i++) {
+      cut = smallest ? max(cut, ritzVals[iev[i]]) : min(cut, ritzVals[iev[i]]);
+   }
+   if (smallest) {
+      a0 = lmin;
+      b = primme->aNorm > 0.0 ? primme->aNorm : lmax + margin * (lmax - lmin);
+      a = cut;
+      if (a <= a0 || a >= b) a = a0 + margin * (b - a0);
+   } else {
+      a0 = lmax;
+      a = primme->aNorm > 0.0 ? -primme->aNorm : lmin - margin * (lmax - lmin);
+      b = cut;
+      if (b >= a0 || b <= a) b = a0 - margin * (a0 - a);
+   }
+   double e = (b - a) / 2.0, c = (b + a) / 2.0, x0 = fabs((a0 - c) / e);
+
+   /* The polynomial of degree m grows as cosh(m*acosh(x0)) at a0 */
+
+   int degree = (int)ceil(log(gain + sqrt(gain * gain - 1.0)) /
+                          log(x0 + sqrt(x0 * x0 - 1.0)));
+   degree = min(max(degree, 1), primme->correctionParams.chebyshevDegree);
+
+   double t0 = primme_wTimer();
+
+   /* Y = (A - c*I)*X * sigma1/e, with X = x */
+
+   PRIMME_INT ldY = primme->ldOPs, n = ldY * blockSize;
+   SCALAR *buf, *X = x, *Y, *T, *spare;
+   PRIMME_INT ldX = ldx;
+   CHKERR(Num_malloc_Sprimme(n * 3, &buf, ctx));
+   Y = buf;
+   T = buf + n;
+   spare = buf + n * 2;
+   double sigma1 = e / (a0 - c), sigma = sigma1;
+   CHKERR(matrixMatvec_Sprimme(X, nLocal, ldX, Y, ldY, 0, blockSize, ctx));
+   for (i = 0; i < blockSize; i++) {
+      Num_axpy_Sprimme(nLocal, -c, &X[ldX * i], 1, &Y[ldY * i], 1, ctx);
+      Num_scal_Sprimme(nLocal, sigma1 / e, &Y[ldY * i], 1, ctx);
+   }
+
+   /* T = (A - c*I)*Y * 2*sigman/e - sigma*sigman*X; X = Y; Y = T */
+
+   for (k = 2; k <= degree; k++) {
+      double sigman = 1.0 / (2.0 / sigma1 - sigma);
+      CHKERR(matrixMatvec_Sprimme(Y, nLocal, ldY, T, ldY, 0, blockSize, ctx));
+      for (i = 0; i < blockSize; i++) {
+         Num_axpy_Sprimme(nLocal, -c, &Y[ldY * i], 1, &T[ldY * i], 1, ctx);
+         Num_scal_Sprimme(nLocal, 2.0 * sigman / e, &T[ldY * i], 1, ctx);
+         Num_axpy_Sprimme(nLocal, -sigma * sigman, &X[ldX * i], 1,
+               &T[ldY * i], 1, ctx);
+      }
+      SCALAR *X0 = (X == x ? spare : X);
+      X = Y;
+      ldX = ldY;
+      Y = T;
+      T = X0;
+      sigma = sigman;
+   }
+
+   CHKERR(Num_copy_matrix_Sprimme(Y, nLocal, blockSize, ldY, x, ldx, ctx));
+   CHKERR(Num_free_Sprimme(buf, ctx));
+
+   primme->stats.numPreconds += blockSize;
+   primme->stats.timePrecond += primme_wTimer() - t0;
+   *filtered = 1;
+
+   return 0;
+}
+#endif /* USE_HERMITIAN */
+
 /*******************************************************************************
  * Subroutine Olsen_preconditioner_block - This subroutine applies the projected
  *    preconditioner to a block of blockSize vectors r by computing:
@@ -996,4 +1151,124 @@ STATIC int setup_JD_projectors(SCALAR *x, PRIMME_INT ldx, SCALAR *Bx,
 
 } /* setup_JD_projectors */
 
+/*******************************************************************************
+ * Subroutine solve_correction_workspace - Take from the dry arena of the
+ *    context the same blocks that solve_correction takes with the given sizes.
+ *    numLocked is the number of locked pairs, or the converged pairs stored
+ *    in evecs without locking. The flag withMfact tells whether Mfact is
+ *    given. See main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int solve_correction_workspace_Sprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   KIND(double, PRIMME_COMPLEX_DOUBLE) *blockOfShifts;
+   HREAL *approxOlsenEps, *sortedRitzVals = NULL;
+   int *ilev = NULL;
+
+   CHKERR(KIND(Num_malloc_dprimme, Num_malloc_zprimme)(
+         blockSize, &blockOfShifts, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &approxOlsenEps, ctx));
+#ifdef USE_HERMITIAN
+   if (primme->locking && (primme->target == primme_smallest ||
+                                primme->target == primme_largest)) {
+      CHKERR(Num_malloc_RHprimme(numLocked + basisSize, &sortedRitzVals, ctx));
+      CHKERR(Num_malloc_iprimme(blockSize, &ilev, ctx));
+   }
+#endif /* USE_HERMITIAN */
+
+   if (primme->correctionParams.maxInnerIterations == 0) {
+#ifdef USE_HERMITIAN
+      /* The filter may not be applied, and then the next ones follow */
+
+      if (primme->correctionParams.precondition &&
+            primme->applyPreconditioner == NULL &&
+            primme->correctionParams.chebyshevDegree > 0 &&
+            (primme->target == primme_smallest ||
+                  primme->target == primme_largest) &&
+            !primme->massMatrixMatvec && basisSize > 0) {
+         SCALAR *buf;
+         CHKERR(Num_malloc_Sprimme(primme->ldOPs * blockSize * 3, &buf, ctx));
+         CHKERR(matrixMatvec_workspace_Sprimme(nLocal, blockSize, ctx));
+         CHKERR(Num_free_Sprimme(buf, ctx));
+      }
+#endif
+      if (primme->correctionParams.projectors.RightX &&
+            primme->correctionParams.projectors.SkewX) {
+         SCALAR *KinvBxr;
+         HSCALAR *xKinvBx;
+         CHKERR(Num_malloc_Sprimme(
+               primme->ldOPs * blockSize * 2, &KinvBxr, ctx));
+         CHKERR(Num_malloc_SHprimme(blockSize * 2, &xKinvBx, ctx));
+         CHKERR(applyPreconditioner_workspace_Sprimme(nLocal, blockSize, ctx));
+         CHKERR(applyPreconditioner_workspace_Sprimme(nLocal, blockSize, ctx));
+         CHKERR(globalSum_workspace_SHprimme(blockSize, ctx));
+         CHKERR(globalSum_workspace_SHprimme(blockSize, ctx));
+         CHKERR(Num_free_Sprimme(KinvBxr, ctx));
+         CHKERR(Num_free_SHprimme(xKinvBx, ctx));
+      } else {
+         CHKERR(applyPreconditioner_workspace_Sprimme(nLocal, blockSize, ctx));
+      }
+   }
+#ifdef USE_HERMITIAN
+   else {
+      SCALAR *sol, *KinvBx;
+      HSCALAR *xKinvBx;
+      HEVAL *blockRitzVals;
+      CHKERR(Num_malloc_Sprimme(primme->ldOPs * blockSize, &sol, ctx));
+      CHKERR(Num_malloc_Sprimme(primme->ldOPs * blockSize, &KinvBx, ctx));
+      CHKERR(Num_malloc_SHprimme(blockSize, &xKinvBx, ctx));
+
+      /* Sizes of the projectors, as in setup_JD_projectors */
+
+      int sizeEvecs = primme->numOrthoConst + numLocked;
+      int sizeLprojectorQ = 0, sizeLprojectorX = 0, sizeRprojectorQ = 0,
+          sizeRprojectorX = 0;
+      if (primme->correctionParams.projectors.LeftQ) {
+         sizeLprojectorQ = sizeEvecs;
+         if (primme->correctionParams.projectors.LeftX) {
+            if (blockSize <= 1) sizeLprojectorQ += blockSize;
+            else sizeLprojectorX = blockSize;
+         }
+      } else if (primme->correctionParams.projectors.LeftX) {
+         sizeLprojectorX = blockSize;
+      }
+      if (primme->correctionParams.projectors.RightQ) {
+         sizeRprojectorQ = sizeEvecs;
+      }
+      if (primme->correctionParams.projectors.RightX) {
+         if (primme->correctionParams.precondition &&
+               primme->correctionParams.projectors.SkewX) {
+            CHKERR(applyPreconditioner_workspace_Sprimme(
+                  nLocal, blockSize, ctx));
+            CHKERR(globalSum_workspace_SHprimme(blockSize, ctx));
+         }
+         sizeRprojectorX = blockSize;
+      }
+
+      CHKERR(KIND(Num_malloc_RHprimme, Num_malloc_SHprimme)(
+            blockSize, &blockRitzVals, ctx));
+      CHKERR(inner_solve_workspace_Sprimme(blockSize, sizeLprojectorQ,
+            sizeLprojectorX, sizeRprojectorQ, sizeRprojectorX, withMfact,
+            ctx));
+      CHKERR(Num_free_SHprimme(xKinvBx, ctx));
+      CHKERR(Num_free_Sprimme(sol, ctx));
+      CHKERR(Num_free_Sprimme(KinvBx, ctx));
+      CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(blockRitzVals, ctx));
+   }
+#else
+   (void)withMfact;
+#endif /* USE_HERMITIAN */
+
+   CHKERR(Num_free_RHprimme(sortedRitzVals, ctx));
+   CHKERR(KIND(Num_free_dprimme, Num_free_zprimme)(blockOfShifts, ctx));
+   CHKERR(Num_free_RHprimme(approxOlsenEps, ctx));
+   CHKERR(Num_free_iprimme(ilev, ctx));
+
+   return 0;
+}
+
 #endif /* SUPPORTED_TYPE */
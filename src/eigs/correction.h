@@ -143,6 +143,12 @@ dummy_type_dprimme computeRobustShiftdprimme(int blockIndex, double resNorm,
 void mergeSortdprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+#if !defined(CHECK_TEMPLATE) && !defined(chebyshev_filter)
+#  define chebyshev_filter CONCAT(chebyshev_filter,WITH_KIND(SCALAR_SUF))
+#endif
+int chebyshev_filterdprimme(dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(Olsen_preconditioner_block)
 #  define Olsen_preconditioner_block CONCAT(Olsen_preconditioner_block,WITH_KIND(SCALAR_SUF))
 #endif
@@ -164,6 +170,98 @@ int setup_JD_projectorsdprimme(dummy_type_dprimme *x, PRIMME_INT ldx, dummy_type
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Sprimme)
+#  define solve_correction_workspace_Sprimme CONCAT(solve_correction_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Rprimme)
+#  define solve_correction_workspace_Rprimme CONCAT(solve_correction_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SHprimme)
+#  define solve_correction_workspace_SHprimme CONCAT(solve_correction_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RHprimme)
+#  define solve_correction_workspace_RHprimme CONCAT(solve_correction_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SXprimme)
+#  define solve_correction_workspace_SXprimme CONCAT(solve_correction_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RXprimme)
+#  define solve_correction_workspace_RXprimme CONCAT(solve_correction_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Shprimme)
+#  define solve_correction_workspace_Shprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Rhprimme)
+#  define solve_correction_workspace_Rhprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Ssprimme)
+#  define solve_correction_workspace_Ssprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Rsprimme)
+#  define solve_correction_workspace_Rsprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Sdprimme)
+#  define solve_correction_workspace_Sdprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Rdprimme)
+#  define solve_correction_workspace_Rdprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Sqprimme)
+#  define solve_correction_workspace_Sqprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_Rqprimme)
+#  define solve_correction_workspace_Rqprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SXhprimme)
+#  define solve_correction_workspace_SXhprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RXhprimme)
+#  define solve_correction_workspace_RXhprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SXsprimme)
+#  define solve_correction_workspace_SXsprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RXsprimme)
+#  define solve_correction_workspace_RXsprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SXdprimme)
+#  define solve_correction_workspace_SXdprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RXdprimme)
+#  define solve_correction_workspace_RXdprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SXqprimme)
+#  define solve_correction_workspace_SXqprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RXqprimme)
+#  define solve_correction_workspace_RXqprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SHhprimme)
+#  define solve_correction_workspace_SHhprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RHhprimme)
+#  define solve_correction_workspace_RHhprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SHsprimme)
+#  define solve_correction_workspace_SHsprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RHsprimme)
+#  define solve_correction_workspace_RHsprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SHdprimme)
+#  define solve_correction_workspace_SHdprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RHdprimme)
+#  define solve_correction_workspace_RHdprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_SHqprimme)
+#  define solve_correction_workspace_SHqprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_correction_workspace_RHqprimme)
+#  define solve_correction_workspace_RHqprimme CONCAT(solve_correction_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int solve_correction_workspace_dprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
       PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, dummy_type_hprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_hprimme *evecsHat,
@@ -178,6 +276,9 @@ dummy_type_sprimme computeRobustShifthprimme(int blockIndex, double resNorm,
 void mergeSorthprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filterhprimme(dummy_type_hprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockhprimme(dummy_type_hprimme *r, PRIMME_INT ldr, dummy_type_hprimme *x,
       PRIMME_INT ldx, dummy_type_hprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -193,6 +294,8 @@ int setup_JD_projectorshprimme(dummy_type_hprimme *x, PRIMME_INT ldx, dummy_type
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_hprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_kprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, dummy_type_kprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
@@ -222,6 +325,8 @@ int setup_JD_projectorskprimme_normal(dummy_type_kprimme *x, PRIMME_INT ldx, dum
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_kprimme_normal(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, dummy_type_kprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
@@ -236,6 +341,9 @@ dummy_type_sprimme computeRobustShiftkprimme(int blockIndex, double resNorm,
 void mergeSortkprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filterkprimme(dummy_type_kprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockkprimme(dummy_type_kprimme *r, PRIMME_INT ldr, dummy_type_kprimme *x,
       PRIMME_INT ldx, dummy_type_kprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -251,6 +359,8 @@ int setup_JD_projectorskprimme(dummy_type_kprimme *x, PRIMME_INT ldx, dummy_type
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_kprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
       PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evecsHat,
@@ -265,6 +375,9 @@ dummy_type_sprimme computeRobustShiftsprimme(int blockIndex, double resNorm,
 void mergeSortsprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filtersprimme(dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blocksprimme(dummy_type_sprimme *r, PRIMME_INT ldr, dummy_type_sprimme *x,
       PRIMME_INT ldx, dummy_type_sprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -280,6 +393,8 @@ int setup_JD_projectorssprimme(dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_sprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_cprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
@@ -309,6 +424,8 @@ int setup_JD_projectorscprimme_normal(dummy_type_cprimme *x, PRIMME_INT ldx, dum
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_cprimme_normal(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
@@ -323,6 +440,9 @@ dummy_type_sprimme computeRobustShiftcprimme(int blockIndex, double resNorm,
 void mergeSortcprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filtercprimme(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockcprimme(dummy_type_cprimme *r, PRIMME_INT ldr, dummy_type_cprimme *x,
       PRIMME_INT ldx, dummy_type_cprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -338,6 +458,8 @@ int setup_JD_projectorscprimme(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_cprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_zprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
@@ -367,6 +489,8 @@ int setup_JD_projectorszprimme_normal(dummy_type_zprimme *x, PRIMME_INT ldx, dum
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_zprimme_normal(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
@@ -381,6 +505,9 @@ dummy_type_dprimme computeRobustShiftzprimme(int blockIndex, double resNorm,
 void mergeSortzprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filterzprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockzprimme(dummy_type_zprimme *r, PRIMME_INT ldr, dummy_type_zprimme *x,
       PRIMME_INT ldx, dummy_type_zprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -396,6 +523,8 @@ int setup_JD_projectorszprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_zprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
       PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, dummy_type_magma_hprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_hprimme *evecsHat,
@@ -410,6 +539,9 @@ dummy_type_sprimme computeRobustShiftmagma_hprimme(int blockIndex, double resNor
 void mergeSortmagma_hprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filtermagma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockmagma_hprimme(dummy_type_magma_hprimme *r, PRIMME_INT ldr, dummy_type_magma_hprimme *x,
       PRIMME_INT ldx, dummy_type_magma_hprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -425,6 +557,8 @@ int setup_JD_projectorsmagma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT ldx
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_magma_hprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_magma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, dummy_type_magma_kprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
@@ -454,6 +588,8 @@ int setup_JD_projectorsmagma_kprimme_normal(dummy_type_magma_kprimme *x, PRIMME_
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_magma_kprimme_normal(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, dummy_type_magma_kprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
@@ -468,6 +604,9 @@ dummy_type_sprimme computeRobustShiftmagma_kprimme(int blockIndex, double resNor
 void mergeSortmagma_kprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filtermagma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockmagma_kprimme(dummy_type_magma_kprimme *r, PRIMME_INT ldr, dummy_type_magma_kprimme *x,
       PRIMME_INT ldx, dummy_type_magma_kprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -483,6 +622,8 @@ int setup_JD_projectorsmagma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT ldx
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_magma_kprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
       PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, dummy_type_magma_sprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_sprimme *evecsHat,
@@ -497,6 +638,9 @@ dummy_type_sprimme computeRobustShiftmagma_sprimme(int blockIndex, double resNor
 void mergeSortmagma_sprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filtermagma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockmagma_sprimme(dummy_type_magma_sprimme *r, PRIMME_INT ldr, dummy_type_magma_sprimme *x,
       PRIMME_INT ldx, dummy_type_magma_sprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -512,6 +656,8 @@ int setup_JD_projectorsmagma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT ldx
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_magma_sprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_magma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, dummy_type_magma_cprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
@@ -541,6 +687,8 @@ int setup_JD_projectorsmagma_cprimme_normal(dummy_type_magma_cprimme *x, PRIMME_
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_magma_cprimme_normal(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, dummy_type_magma_cprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
@@ -555,6 +703,9 @@ dummy_type_sprimme computeRobustShiftmagma_cprimme(int blockIndex, double resNor
 void mergeSortmagma_cprimme(dummy_type_sprimme *lockedEvals, int numLocked, dummy_type_sprimme *ritzVals,
    int *flags, int basisSize, dummy_type_sprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filtermagma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT ldx, dummy_type_sprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockmagma_cprimme(dummy_type_magma_cprimme *r, PRIMME_INT ldr, dummy_type_magma_cprimme *x,
       PRIMME_INT ldx, dummy_type_magma_cprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -570,6 +721,8 @@ int setup_JD_projectorsmagma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT ldx
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_magma_cprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
       PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, dummy_type_magma_dprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_dprimme *evecsHat,
@@ -584,6 +737,9 @@ dummy_type_dprimme computeRobustShiftmagma_dprimme(int blockIndex, double resNor
 void mergeSortmagma_dprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filtermagma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockmagma_dprimme(dummy_type_magma_dprimme *r, PRIMME_INT ldr, dummy_type_magma_dprimme *x,
       PRIMME_INT ldx, dummy_type_magma_dprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -599,6 +755,8 @@ int setup_JD_projectorsmagma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT ldx
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_magma_dprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_magma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, dummy_type_magma_zprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
@@ -628,6 +786,8 @@ int setup_JD_projectorsmagma_zprimme_normal(dummy_type_magma_zprimme *x, PRIMME_
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_magma_zprimme_normal(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 int solve_correction_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, dummy_type_magma_zprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
@@ -642,6 +802,9 @@ dummy_type_dprimme computeRobustShiftmagma_zprimme(int blockIndex, double resNor
 void mergeSortmagma_zprimme(dummy_type_dprimme *lockedEvals, int numLocked, dummy_type_dprimme *ritzVals,
    int *flags, int basisSize, dummy_type_dprimme *sortedRitzVals, int *ilev, int blockSize,
    primme_params *primme);
+int chebyshev_filtermagma_zprimme(dummy_type_magma_zprimme *x, PRIMME_INT ldx, dummy_type_dprimme *ritzVals,
+      int basisSize, int *iev, int blockSize, int *filtered,
+      primme_context ctx);
 int Olsen_preconditioner_blockmagma_zprimme(dummy_type_magma_zprimme *r, PRIMME_INT ldr, dummy_type_magma_zprimme *x,
       PRIMME_INT ldx, dummy_type_magma_zprimme *Bx, PRIMME_INT ldBx, int blockSize,
       primme_context ctx);
@@ -657,4 +820,6 @@ int setup_JD_projectorsmagma_zprimme(dummy_type_magma_zprimme *x, PRIMME_INT ldx
       PRIMME_INT *ldRprojectorX, int *sizeLprojectorQ, int *sizeLprojectorX,
       int *sizeRprojectorQ, int *sizeRprojectorX, int numLocked,
       int numConverged, int blockSize, primme_context ctx);
+int solve_correction_workspace_magma_zprimme(int basisSize, int numLocked,
+      int blockSize, int withMfact, primme_context ctx);
 #endif
@@ -234,6 +234,31 @@ int update_XKinvBX_Sprimme(SCALAR *X, PRIMME_INT ldX, SCALAR *KinvBX,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine update_XKinvBX_workspace - Take from the dry arena of the context
+ *    the same blocks that update_XKinvBX takes with the given sizes. See
+ *    main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int update_XKinvBX_workspace_Sprimme(
+      int numCols, int blockSize, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   CHKERR(update_projection_workspace_Sprimme(numCols, blockSize,
+         primme->massMatrixMatvec ? 0 /* no Hermitian */ : 1 /* Hermitian */,
+         ctx));
+
+   int nM = numCols + blockSize;
+   if (nM > 1 && primme->massMatrixMatvec == NULL) {
+      int dummyi;
+      CHKERR(Num_hetrf_SHprimme("U", nM, NULL, nM, &dummyi, ctx));
+   }
+
+   return 0;
+}
+
 #if defined(USE_HOST) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF))
 
 /******************************************************************************
@@ -299,6 +324,24 @@ int MSolve_Sprimme(SCALAR *Mfact, int *ipivot, int dim, SCALAR *rhs, int nrhs,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine MSolve_workspace - Take from the dry arena of the context the
+ *    same blocks that MSolve takes with the given sizes. See
+ *    main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int MSolve_workspace_Sprimme(int dim, int nrhs, primme_context ctx) {
+
+   if (dim <= 1 || ctx.primme->massMatrixMatvec) return 0;
+
+   int dummyi;
+   CHKERR(Num_hetrs_Sprimme(
+         "U", dim, nrhs, NULL, dim, &dummyi, NULL, dim, ctx));
+
+   return 0;
+}
+
 #endif /* defined(USE_HOST) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)) */
 
 #endif /* SUPPORTED_TYPE */
@@ -311,6 +311,98 @@ int update_XKinvBX_dprimme(dummy_type_dprimme *X, PRIMME_INT ldX, dummy_type_dpr
       PRIMME_INT ldKinvBX, dummy_type_dprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_dprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Sprimme)
+#  define update_XKinvBX_workspace_Sprimme CONCAT(update_XKinvBX_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Rprimme)
+#  define update_XKinvBX_workspace_Rprimme CONCAT(update_XKinvBX_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SHprimme)
+#  define update_XKinvBX_workspace_SHprimme CONCAT(update_XKinvBX_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RHprimme)
+#  define update_XKinvBX_workspace_RHprimme CONCAT(update_XKinvBX_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SXprimme)
+#  define update_XKinvBX_workspace_SXprimme CONCAT(update_XKinvBX_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RXprimme)
+#  define update_XKinvBX_workspace_RXprimme CONCAT(update_XKinvBX_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Shprimme)
+#  define update_XKinvBX_workspace_Shprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Rhprimme)
+#  define update_XKinvBX_workspace_Rhprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Ssprimme)
+#  define update_XKinvBX_workspace_Ssprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Rsprimme)
+#  define update_XKinvBX_workspace_Rsprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Sdprimme)
+#  define update_XKinvBX_workspace_Sdprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Rdprimme)
+#  define update_XKinvBX_workspace_Rdprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Sqprimme)
+#  define update_XKinvBX_workspace_Sqprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_Rqprimme)
+#  define update_XKinvBX_workspace_Rqprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SXhprimme)
+#  define update_XKinvBX_workspace_SXhprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RXhprimme)
+#  define update_XKinvBX_workspace_RXhprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SXsprimme)
+#  define update_XKinvBX_workspace_SXsprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RXsprimme)
+#  define update_XKinvBX_workspace_RXsprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SXdprimme)
+#  define update_XKinvBX_workspace_SXdprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RXdprimme)
+#  define update_XKinvBX_workspace_RXdprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SXqprimme)
+#  define update_XKinvBX_workspace_SXqprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RXqprimme)
+#  define update_XKinvBX_workspace_RXqprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SHhprimme)
+#  define update_XKinvBX_workspace_SHhprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RHhprimme)
+#  define update_XKinvBX_workspace_RHhprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SHsprimme)
+#  define update_XKinvBX_workspace_SHsprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RHsprimme)
+#  define update_XKinvBX_workspace_RHsprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SHdprimme)
+#  define update_XKinvBX_workspace_SHdprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RHdprimme)
+#  define update_XKinvBX_workspace_RHdprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_SHqprimme)
+#  define update_XKinvBX_workspace_SHqprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_XKinvBX_workspace_RHqprimme)
+#  define update_XKinvBX_workspace_RHqprimme CONCAT(update_XKinvBX_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int update_XKinvBX_workspace_dprimme(
+      int numCols, int blockSize, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(MSolve_Sprimme)
 #  define MSolve_Sprimme CONCAT(MSolve_,SCALAR_SUF)
 #endif
@@ -403,14 +495,109 @@ int update_XKinvBX_dprimme(dummy_type_dprimme *X, PRIMME_INT ldX, dummy_type_dpr
 #endif
 int MSolve_dprimme(dummy_type_dprimme *Mfact, int *ipivot, int dim, dummy_type_dprimme *rhs, int nrhs,
       int ldrhs, dummy_type_dprimme *sol, int ldsol, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Sprimme)
+#  define MSolve_workspace_Sprimme CONCAT(MSolve_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Rprimme)
+#  define MSolve_workspace_Rprimme CONCAT(MSolve_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SHprimme)
+#  define MSolve_workspace_SHprimme CONCAT(MSolve_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RHprimme)
+#  define MSolve_workspace_RHprimme CONCAT(MSolve_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SXprimme)
+#  define MSolve_workspace_SXprimme CONCAT(MSolve_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RXprimme)
+#  define MSolve_workspace_RXprimme CONCAT(MSolve_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Shprimme)
+#  define MSolve_workspace_Shprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Rhprimme)
+#  define MSolve_workspace_Rhprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Ssprimme)
+#  define MSolve_workspace_Ssprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Rsprimme)
+#  define MSolve_workspace_Rsprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Sdprimme)
+#  define MSolve_workspace_Sdprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Rdprimme)
+#  define MSolve_workspace_Rdprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Sqprimme)
+#  define MSolve_workspace_Sqprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_Rqprimme)
+#  define MSolve_workspace_Rqprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SXhprimme)
+#  define MSolve_workspace_SXhprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RXhprimme)
+#  define MSolve_workspace_RXhprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SXsprimme)
+#  define MSolve_workspace_SXsprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RXsprimme)
+#  define MSolve_workspace_RXsprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SXdprimme)
+#  define MSolve_workspace_SXdprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RXdprimme)
+#  define MSolve_workspace_RXdprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SXqprimme)
+#  define MSolve_workspace_SXqprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RXqprimme)
+#  define MSolve_workspace_RXqprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SHhprimme)
+#  define MSolve_workspace_SHhprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RHhprimme)
+#  define MSolve_workspace_RHhprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SHsprimme)
+#  define MSolve_workspace_SHsprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RHsprimme)
+#  define MSolve_workspace_RHsprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SHdprimme)
+#  define MSolve_workspace_SHdprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RHdprimme)
+#  define MSolve_workspace_RHdprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_SHqprimme)
+#  define MSolve_workspace_SHqprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(MSolve_workspace_RHqprimme)
+#  define MSolve_workspace_RHqprimme CONCAT(MSolve_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int MSolve_workspace_dprimme(int dim, int nrhs, primme_context ctx);
 int update_XKinvBX_hprimme(dummy_type_hprimme *X, PRIMME_INT ldX, dummy_type_hprimme *KinvBX,
       PRIMME_INT ldKinvBX, dummy_type_sprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_sprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_hprimme(
+      int numCols, int blockSize, primme_context ctx);
 int update_XKinvBX_kprimme(dummy_type_kprimme *X, PRIMME_INT ldX, dummy_type_kprimme *KinvBX,
       PRIMME_INT ldKinvBX, dummy_type_cprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_cprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_kprimme(
+      int numCols, int blockSize, primme_context ctx);
 int UDUDecompose_sprimme(dummy_type_sprimme *M, int ldM, dummy_type_sprimme *UDU, int ldUDU,
       int *ipivot, int dimM, primme_context ctx);
 int UDUSolve_sprimme(dummy_type_sprimme *UDU, int *ipivot, int dim, dummy_type_sprimme *rhs, int nrhs,
@@ -419,8 +606,11 @@ int update_XKinvBX_sprimme(dummy_type_sprimme *X, PRIMME_INT ldX, dummy_type_spr
       PRIMME_INT ldKinvBX, dummy_type_sprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_sprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_sprimme(
+      int numCols, int blockSize, primme_context ctx);
 int MSolve_sprimme(dummy_type_sprimme *Mfact, int *ipivot, int dim, dummy_type_sprimme *rhs, int nrhs,
       int ldrhs, dummy_type_sprimme *sol, int ldsol, primme_context ctx);
+int MSolve_workspace_sprimme(int dim, int nrhs, primme_context ctx);
 int UDUDecompose_cprimme(dummy_type_cprimme *M, int ldM, dummy_type_cprimme *UDU, int ldUDU,
       int *ipivot, int dimM, primme_context ctx);
 int UDUSolve_cprimme(dummy_type_cprimme *UDU, int *ipivot, int dim, dummy_type_cprimme *rhs, int nrhs,
@@ -429,8 +619,11 @@ int update_XKinvBX_cprimme(dummy_type_cprimme *X, PRIMME_INT ldX, dummy_type_cpr
       PRIMME_INT ldKinvBX, dummy_type_cprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_cprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_cprimme(
+      int numCols, int blockSize, primme_context ctx);
 int MSolve_cprimme(dummy_type_cprimme *Mfact, int *ipivot, int dim, dummy_type_cprimme *rhs, int nrhs,
       int ldrhs, dummy_type_cprimme *sol, int ldsol, primme_context ctx);
+int MSolve_workspace_cprimme(int dim, int nrhs, primme_context ctx);
 int UDUDecompose_zprimme(dummy_type_zprimme *M, int ldM, dummy_type_zprimme *UDU, int ldUDU,
       int *ipivot, int dimM, primme_context ctx);
 int UDUSolve_zprimme(dummy_type_zprimme *UDU, int *ipivot, int dim, dummy_type_zprimme *rhs, int nrhs,
@@ -439,30 +632,45 @@ int update_XKinvBX_zprimme(dummy_type_zprimme *X, PRIMME_INT ldX, dummy_type_zpr
       PRIMME_INT ldKinvBX, dummy_type_zprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_zprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_zprimme(
+      int numCols, int blockSize, primme_context ctx);
 int MSolve_zprimme(dummy_type_zprimme *Mfact, int *ipivot, int dim, dummy_type_zprimme *rhs, int nrhs,
       int ldrhs, dummy_type_zprimme *sol, int ldsol, primme_context ctx);
+int MSolve_workspace_zprimme(int dim, int nrhs, primme_context ctx);
 int update_XKinvBX_magma_hprimme(dummy_type_magma_hprimme *X, PRIMME_INT ldX, dummy_type_magma_hprimme *KinvBX,
       PRIMME_INT ldKinvBX, dummy_type_sprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_sprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_magma_hprimme(
+      int numCols, int blockSize, primme_context ctx);
 int update_XKinvBX_magma_kprimme(dummy_type_magma_kprimme *X, PRIMME_INT ldX, dummy_type_magma_kprimme *KinvBX,
       PRIMME_INT ldKinvBX, dummy_type_cprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_cprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_magma_kprimme(
+      int numCols, int blockSize, primme_context ctx);
 int update_XKinvBX_magma_sprimme(dummy_type_magma_sprimme *X, PRIMME_INT ldX, dummy_type_magma_sprimme *KinvBX,
       PRIMME_INT ldKinvBX, dummy_type_sprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_sprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_magma_sprimme(
+      int numCols, int blockSize, primme_context ctx);
 int update_XKinvBX_magma_cprimme(dummy_type_magma_cprimme *X, PRIMME_INT ldX, dummy_type_magma_cprimme *KinvBX,
       PRIMME_INT ldKinvBX, dummy_type_cprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_cprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_magma_cprimme(
+      int numCols, int blockSize, primme_context ctx);
 int update_XKinvBX_magma_dprimme(dummy_type_magma_dprimme *X, PRIMME_INT ldX, dummy_type_magma_dprimme *KinvBX,
       PRIMME_INT ldKinvBX, dummy_type_dprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_dprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_magma_dprimme(
+      int numCols, int blockSize, primme_context ctx);
 int update_XKinvBX_magma_zprimme(dummy_type_magma_zprimme *X, PRIMME_INT ldX, dummy_type_magma_zprimme *KinvBX,
       PRIMME_INT ldKinvBX, dummy_type_zprimme *M, int ldM, int numCols,
       int blockSize, dummy_type_zprimme *Mfact, int ldMfact, int *ipivot,
       primme_context ctx);
+int update_XKinvBX_workspace_magma_zprimme(
+      int numCols, int blockSize, primme_context ctx);
 #endif
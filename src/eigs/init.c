@@ -95,6 +95,10 @@
  * *nextGuess   The index of the next initial guess stored in the evecs array
  *
  * *numGuesses  When locking is enabled, the number of remaining initial guesses
+ *
+ * *errW        Bound of the norm of the error in the columns of W, if W was
+ *              cast from the single-precision basis of adaptivePrecision;
+ *              zero otherwise
  * 
  *
  * INPUT/OUTPUT ARRAYS AND PARAMETERS
@@ -128,7 +132,7 @@ int init_basis_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV, SCALAR *W,
       PRIMME_INT ldevecsHat, HSCALAR *M, int ldM, HSCALAR *Mfact, int ldMfact,
       int *ipivot, HSCALAR *VtBV, int ldVtBV, HSCALAR *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx) {
+      double *errW, primme_context ctx) {
 
    primme_params *primme = ctx.primme;
    int i;
@@ -178,12 +182,27 @@ int init_basis_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV, SCALAR *W,
       initSize = min(primme->minRestartSize, primme->initSize);
    }
    initSize = max(0, min(primme->n - primme->numOrthoConst, initSize));
-   *numGuesses = primme->initSize - initSize;
+
+   /* Start from the search space kept by the previous solve, if any. */
+   /* Without locking, that space has the returned eigenvectors, and  */
+   /* the initial guesses are not used.                               */
+
+   int numRecycled = 0;
+   CHKERR(restore_basis(V, nLocal, ldV, W, ldW, evecs, ldevecs, VtBV, ldVtBV,
+         fVtBV, ldfVtBV, maxRank,
+         primme->maxBasisSize - (primme->locking ? initSize : 0),
+         &numRecycled, errW, ctx));
+   if (numRecycled > 0 && !primme->locking) {
+      initSize = 0;
+      *numGuesses = 0;
+   } else {
+      *numGuesses = primme->initSize - initSize;
+   }
    *nextGuess = primme->numOrthoConst + initSize;
 
    /* Copy over the initial guesses provided by the user */
    CHKERR(Num_copy_matrix_Sprimme(&evecs[primme->numOrthoConst * ldevecs],
-         nLocal, initSize, ldevecs, V, ldV, ctx));
+         nLocal, initSize, ldevecs, &V[ldV * numRecycled], ldV, ctx));
 
    switch (primme->initBasisMode) {
    case primme_init_krylov: random = 0; break;
@@ -195,21 +214,24 @@ int init_basis_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV, SCALAR *W,
       break;
    default: assert(0);
    }
+   if (numRecycled > 0) random = 0;
    random = max(0, min(primme->n - primme->numOrthoConst - initSize, random));
    for (i = 0; i < random; i++) {
       Num_larnv_Sprimme(
-            2, primme->iseed, nLocal, &V[ldV * (initSize + i)], ctx);
+            2, primme->iseed, nLocal, &V[ldV * (numRecycled + initSize + i)],
+            ctx);
    }
-   *basisSize = initSize + random;
+   *basisSize = numRecycled + initSize + random;
 
    /* Orthonormalize the guesses provided by the user */
-   CHKERR(Bortho_block_Sprimme(V, ldV, VtBV, ldVtBV, fVtBV, ldfVtBV, NULL, 0, 0,
-         *basisSize - 1, evecs, ldevecs, primme->numOrthoConst, BV, ldBV, NULL,
-         0, nLocal, maxRank, basisSize, ctx));
+   CHKERR(Bortho_block_Sprimme(V, ldV, VtBV, ldVtBV, fVtBV, ldfVtBV, NULL, 0,
+         numRecycled, *basisSize - 1, evecs, ldevecs, primme->numOrthoConst, BV,
+         ldBV, NULL, 0, nLocal, maxRank, basisSize, ctx));
 
-   CHKERR(matrixMatvec_Sprimme(V, nLocal, ldV, W, ldW, 0, *basisSize, ctx));
+   CHKERR(matrixMatvec_Sprimme(V, nLocal, ldV, W, ldW, numRecycled,
+         *basisSize - numRecycled, ctx));
 
-   if (primme->initBasisMode == primme_init_krylov) {
+   if (primme->initBasisMode == primme_init_krylov && numRecycled == 0) {
       int minRestartSize =
             min(primme->minRestartSize, primme->n - primme->numOrthoConst);
       CHKERR(init_block_krylov(V, nLocal, ldV, W, ldW, BV, ldBV, *basisSize,
@@ -223,6 +245,171 @@ int init_basis_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV, SCALAR *W,
 }
 
 
+/*******************************************************************************
+ * Subroutine recycle_basis - Keep V and W=A*V at the end of the solve, so that
+ *    the next solve starts from them (see primme->recycle). The memory is
+ *    allocated on the first call and freed by primme_free. It belongs to
+ *    primme, so copies of the struct neither reuse it nor free it.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * V          The orthonormal basis
+ * nLocal     Number of rows of each vector stored on this node
+ * ldV        The leading dimension of V
+ * W          A*V
+ * ldW        The leading dimension of W
+ * basisSize  Number of vectors in V
+ *
+ * Return value
+ * ------------
+ *  error code
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int recycle_basis_Sprimme(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      SCALAR *W, PRIMME_INT ldW, int basisSize, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   /* Only supported on the CPU and for standard problems */
+
+   if (!primme->recycle || primme->massMatrixMatvec || basisSize <= 0 ||
+         !IMPL(1, 0))
+      return 0;
+
+   /* A basis allocated by another primme_params, which was copied into */
+   /* this one, is not overwritten                                       */
+
+   primme_recycled_basis *r = (primme_recycled_basis *)primme->recycledBasis;
+   if (r == NULL || r->owner != (void *)primme) {
+      CHKERR(MALLOC_PRIMME(1, &r));
+      r->V = r->W = NULL;
+      r->maxBasisSize = 0;
+      r->owner = primme;
+      primme->recycledBasis = r;
+   }
+
+   /* Allocate room for maxBasisSize columns, so that the next solves with */
+   /* the same sizes reuse the memory                                      */
+
+   if (r->V == NULL || r->type != PRIMME_OP_SCALAR ||
+         r->sizeofScalar != sizeof(SCALAR) || r->nLocal != nLocal ||
+         r->maxBasisSize < basisSize) {
+      SCALAR *VW;
+      free(r->V);
+      r->V = r->W = NULL;
+      r->basisSize = 0;
+      CHKERR(MALLOC_PRIMME(nLocal * primme->maxBasisSize * 2, &VW));
+      r->V = VW;
+      r->W = &VW[nLocal * primme->maxBasisSize];
+      r->maxBasisSize = primme->maxBasisSize;
+   }
+
+   r->type = PRIMME_OP_SCALAR;
+   r->sizeofScalar = sizeof(SCALAR);
+   r->nLocal = nLocal;
+   r->numOrthoConst = primme->numOrthoConst;
+   r->basisSize = basisSize;
+   r->normA = problemNorm_Sprimme(1, primme);
+   CHKERR(Num_copy_matrix_Sprimme(
+         V, nLocal, basisSize, ldV, (SCALAR *)r->V, nLocal, ctx));
+   CHKERR(Num_copy_matrix_Sprimme(
+         W, nLocal, basisSize, ldW, (SCALAR *)r->W, nLocal, ctx));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine restore_basis - Copy into V the basis kept by the previous solve
+ *    and update W=A*V. If matrixDeltaMatvec is set, W is updated with the
+ *    difference between the current and the previous matrix; otherwise W is
+ *    computed with matrixMatvec. A basis kept in single precision by the
+ *    first solve of primme->adaptivePrecision is cast, W included; W keeps
+ *    the rounding errors of single precision, and main_iter computes it
+ *    again at the first restart or reset (see errW).
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * nLocal     Number of rows of each vector stored on this node
+ * evecs      Array with the orthogonalization constraints
+ * maxRank    Maximum size of the space being orthonormalized
+ * maxSize    Maximum number of vectors to restore
+ *
+ * OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------
+ * V            The orthonormal basis
+ * W            A*V
+ * VtBV         V'*B*V (used by Bortho_block)
+ * fVtBV        The Cholesky factor of VtBV (used by Bortho_block)
+ * numRecycled  The number of vectors restored
+ * errW         Bound of the norm of the error in the columns of the cast W;
+ *              zero if W = A*V is computed
+ *
+ * Return value
+ * ------------
+ *  error code
+ ******************************************************************************/
+
+STATIC int restore_basis(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      SCALAR *W, PRIMME_INT ldW, SCALAR *evecs, PRIMME_INT ldevecs,
+      HSCALAR *VtBV, int ldVtBV, HSCALAR *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   primme_recycled_basis *r = (primme_recycled_basis *)primme->recycledBasis;
+
+   *numRecycled = 0;
+   *errW = 0.0;
+
+   /* Quick exit if there is nothing to restore, the problem has changed */
+   /* or the basis belongs to another primme_params                       */
+
+   size_t sizeofScalar = 0;
+   if (!primme->recycle || primme->massMatrixMatvec || r == NULL ||
+         r->owner != (void *)primme ||
+         Num_sizeof_Sprimme(r->type, &sizeofScalar) != 0 ||
+         r->sizeofScalar != sizeofScalar || r->nLocal != nLocal ||
+         r->numOrthoConst != primme->numOrthoConst)
+      return 0;
+
+   int k = max(0, min(r->basisSize, maxSize));
+   if (k == 0) return 0;
+
+   /* V is orthonormal already; this cleans the rounding errors and  */
+   /* sets VtBV. If the columns lose rank, the basis is discarded.    */
+
+   int nV;
+   CHKERR(Num_copy_Tmatrix_Sprimme(r->V, r->type, nLocal, k, nLocal, V, ldV,
+         ctx));
+   CHKERR(Bortho_block_Sprimme(V, ldV, VtBV, ldVtBV, fVtBV, ldfVtBV, NULL, 0,
+         0, k - 1, evecs, ldevecs, primme->numOrthoConst, NULL, 0, NULL, 0,
+         nLocal, maxRank, &nV, ctx));
+   if (nV != k) return 0;
+
+   /* W = A*V. A W computed in single precision is cast instead, as its */
+   /* error is below the residual norms at which that solve stopped. It */
+   /* is done only if no residual norm can pass the convergence test    */
+   /* with that error.                                                  */
+
+   if (r->type == primme_op_float && PRIMME_OP_SCALAR != primme_op_float &&
+         !primme->matrixDeltaMatvec && r->normA > 0.0 &&
+         sqrt((double)k) * FLT_EPSILON >= primme->eps) {
+      CHKERR(Num_copy_Tmatrix_Sprimme(r->W, r->type, nLocal, k, nLocal, W, ldW,
+            ctx));
+      *errW = sqrt((double)k) * FLT_EPSILON *
+              max(r->normA, problemNorm_Sprimme(1, primme));
+   } else if (primme->matrixDeltaMatvec && r->type == PRIMME_OP_SCALAR) {
+      CHKERR(Num_copy_matrix_Sprimme(
+            (SCALAR *)r->W, nLocal, k, nLocal, W, ldW, ctx));
+      CHKERR(matrixDeltaMatvec_Sprimme(V, nLocal, ldV, W, ldW, 0, k, ctx));
+   } else {
+      CHKERR(matrixMatvec_Sprimme(V, nLocal, ldV, W, ldW, 0, k, ctx));
+   }
+
+   *numRecycled = k;
+   return 0;
+}
+
 /*******************************************************************************
  * Subroutine init_block_krylov - Initializes the basis as an orthonormal 
  *    block Krylov subspace.  
@@ -322,4 +509,86 @@ STATIC int init_block_krylov(SCALAR *V, PRIMME_INT nLocal, PRIMME_INT ldV,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine init_basis_workspace - Take from the dry arena of the context the
+ *    same blocks that init_basis takes. The flags withVtBV and withEvecsHat
+ *    tell whether VtBV and evecsHat are given. The size of the basis kept by
+ *    a previous solve is replaced by its largest value. See
+ *    main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int init_basis_workspace_Sprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   int mb = primme->maxBasisSize;
+   int nOC = primme->numOrthoConst;
+   int withBV = primme->massMatrixMatvec ? 1 : 0;
+
+   if (nOC > 0) {
+      CHKERR(Bortho_block_workspace_Sprimme(withVtBV, 0, 0, nOC - 1, 0,
+            withBV && primme->locking, 0, nLocal, ctx));
+      if (withEvecsHat) {
+         CHKERR(applyPreconditioner_workspace_Sprimme(nLocal, nOC, ctx));
+         CHKERR(update_XKinvBX_workspace_Sprimme(0, nOC, ctx));
+      }
+   }
+
+   int initSize = primme->locking ? primme->minRestartSize : mb;
+   initSize = max(0, min(primme->n - nOC, min(initSize, primme->initSize)));
+
+   /* restore_basis and the guesses after the restored basis */
+
+   if (primme->recycle && !primme->massMatrixMatvec) {
+      int k = mb - (primme->locking ? initSize : 0);
+      CHKERR(Bortho_block_workspace_Sprimme(
+            withVtBV, 0, 0, k - 1, nOC, 0, 0, nLocal, ctx));
+      if (primme->matrixDeltaMatvec) {
+         CHKERR(matrixDeltaMatvec_workspace_Sprimme(nLocal, k, ctx));
+      }
+      CHKERR(matrixMatvec_workspace_Sprimme(nLocal, k, ctx));
+      if (primme->locking) {
+         CHKERR(Bortho_block_workspace_Sprimme(withVtBV, 0, k,
+               k + initSize - 1, nOC, 0, 0, nLocal, ctx));
+         CHKERR(matrixMatvec_workspace_Sprimme(nLocal, initSize, ctx));
+      }
+   }
+
+   int random = 0;
+   switch (primme->initBasisMode) {
+   case primme_init_krylov: random = 0; break;
+   case primme_init_random:
+      random = max(0, primme->minRestartSize - initSize);
+      break;
+   case primme_init_user:
+      random = max(primme->maxBlockSize - initSize, 0);
+      break;
+   default: assert(0);
+   }
+   random = max(0, min(primme->n - nOC - initSize, random));
+   int basisSize = initSize + random;
+
+   CHKERR(Bortho_block_workspace_Sprimme(withVtBV, 0, 0, basisSize - 1, nOC,
+         withBV, 0, nLocal, ctx));
+   CHKERR(matrixMatvec_workspace_Sprimme(nLocal, basisSize, ctx));
+
+   /* init_block_krylov */
+
+   int dv2 = min(primme->minRestartSize, primme->n - nOC) - 1;
+   if (primme->initBasisMode == primme_init_krylov && dv2 >= basisSize) {
+      int blockSize =
+            dv2 - basisSize + 1 <= primme->maxBlockSize ? 1
+                                                         : primme->maxBlockSize;
+      CHKERR(Bortho_block_workspace_Sprimme(withVtBV, 0, basisSize,
+            basisSize + blockSize - 1, nOC, withBV, 0, nLocal, ctx));
+      CHKERR(matrixMatvec_workspace_Sprimme(nLocal, blockSize, ctx));
+      CHKERR(Bortho_block_range_workspace_Sprimme(
+            withVtBV, dv2 + 1, blockSize, nOC, withBV, 0, nLocal, ctx));
+   }
+
+   return 0;
+}
+
 #endif /* SUPPORTED_TYPE */
@@ -129,7 +129,106 @@ int init_basis_dprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       PRIMME_INT ldevecsHat, dummy_type_dprimme *M, int ldM, dummy_type_dprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Sprimme)
+#  define recycle_basis_Sprimme CONCAT(recycle_basis_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Rprimme)
+#  define recycle_basis_Rprimme CONCAT(recycle_basis_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SHprimme)
+#  define recycle_basis_SHprimme CONCAT(recycle_basis_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RHprimme)
+#  define recycle_basis_RHprimme CONCAT(recycle_basis_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SXprimme)
+#  define recycle_basis_SXprimme CONCAT(recycle_basis_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RXprimme)
+#  define recycle_basis_RXprimme CONCAT(recycle_basis_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Shprimme)
+#  define recycle_basis_Shprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Rhprimme)
+#  define recycle_basis_Rhprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Ssprimme)
+#  define recycle_basis_Ssprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Rsprimme)
+#  define recycle_basis_Rsprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Sdprimme)
+#  define recycle_basis_Sdprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Rdprimme)
+#  define recycle_basis_Rdprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Sqprimme)
+#  define recycle_basis_Sqprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_Rqprimme)
+#  define recycle_basis_Rqprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SXhprimme)
+#  define recycle_basis_SXhprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RXhprimme)
+#  define recycle_basis_RXhprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SXsprimme)
+#  define recycle_basis_SXsprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RXsprimme)
+#  define recycle_basis_RXsprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SXdprimme)
+#  define recycle_basis_SXdprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RXdprimme)
+#  define recycle_basis_RXdprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SXqprimme)
+#  define recycle_basis_SXqprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RXqprimme)
+#  define recycle_basis_RXqprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SHhprimme)
+#  define recycle_basis_SHhprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RHhprimme)
+#  define recycle_basis_RHhprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SHsprimme)
+#  define recycle_basis_SHsprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RHsprimme)
+#  define recycle_basis_RHsprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SHdprimme)
+#  define recycle_basis_SHdprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RHdprimme)
+#  define recycle_basis_RHdprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_SHqprimme)
+#  define recycle_basis_SHqprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(recycle_basis_RHqprimme)
+#  define recycle_basis_RHqprimme CONCAT(recycle_basis_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int recycle_basis_dprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(restore_basis)
+#  define restore_basis CONCAT(restore_basis,SCALAR_SUF)
+#endif
+int restore_basisdprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_dprimme *W, PRIMME_INT ldW, dummy_type_dprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(init_block_krylov)
 #  define init_block_krylov CONCAT(init_block_krylov,SCALAR_SUF)
 #endif
@@ -137,125 +236,305 @@ int init_block_krylovdprimme(dummy_type_dprimme *V, PRIMME_INT nLocal, PRIMME_IN
       dummy_type_dprimme *W, PRIMME_INT ldW, dummy_type_dprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_dprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_dprimme *VtBV,
       int ldVtBV, dummy_type_dprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Sprimme)
+#  define init_basis_workspace_Sprimme CONCAT(init_basis_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Rprimme)
+#  define init_basis_workspace_Rprimme CONCAT(init_basis_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SHprimme)
+#  define init_basis_workspace_SHprimme CONCAT(init_basis_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RHprimme)
+#  define init_basis_workspace_RHprimme CONCAT(init_basis_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SXprimme)
+#  define init_basis_workspace_SXprimme CONCAT(init_basis_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RXprimme)
+#  define init_basis_workspace_RXprimme CONCAT(init_basis_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Shprimme)
+#  define init_basis_workspace_Shprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Rhprimme)
+#  define init_basis_workspace_Rhprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Ssprimme)
+#  define init_basis_workspace_Ssprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Rsprimme)
+#  define init_basis_workspace_Rsprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Sdprimme)
+#  define init_basis_workspace_Sdprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Rdprimme)
+#  define init_basis_workspace_Rdprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Sqprimme)
+#  define init_basis_workspace_Sqprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_Rqprimme)
+#  define init_basis_workspace_Rqprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SXhprimme)
+#  define init_basis_workspace_SXhprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RXhprimme)
+#  define init_basis_workspace_RXhprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SXsprimme)
+#  define init_basis_workspace_SXsprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RXsprimme)
+#  define init_basis_workspace_RXsprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SXdprimme)
+#  define init_basis_workspace_SXdprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RXdprimme)
+#  define init_basis_workspace_RXdprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SXqprimme)
+#  define init_basis_workspace_SXqprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RXqprimme)
+#  define init_basis_workspace_RXqprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SHhprimme)
+#  define init_basis_workspace_SHhprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RHhprimme)
+#  define init_basis_workspace_RHhprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SHsprimme)
+#  define init_basis_workspace_SHsprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RHsprimme)
+#  define init_basis_workspace_RHsprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SHdprimme)
+#  define init_basis_workspace_SHdprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RHdprimme)
+#  define init_basis_workspace_RHdprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_SHqprimme)
+#  define init_basis_workspace_SHqprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(init_basis_workspace_RHqprimme)
+#  define init_basis_workspace_RHqprimme CONCAT(init_basis_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int init_basis_workspace_dprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_hprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_hprimme *W,
       PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, dummy_type_hprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_hprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_sprimme *M, int ldM, dummy_type_sprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_hprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_hprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basishprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_hprimme *W, PRIMME_INT ldW, dummy_type_hprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovhprimme(dummy_type_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_hprimme *W, PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_hprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_sprimme *VtBV,
       int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_hprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_kprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, dummy_type_kprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_kprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_cprimme *M, int ldM, dummy_type_cprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_kprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_kprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basiskprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_kprimme *W, PRIMME_INT ldW, dummy_type_kprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovkprimme(dummy_type_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_kprimme *W, PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_kprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_cprimme *VtBV,
       int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_kprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_sprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_sprimme *W,
       PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_sprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_sprimme *M, int ldM, dummy_type_sprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_sprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_sprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basissprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_sprimme *W, PRIMME_INT ldW, dummy_type_sprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovsprimme(dummy_type_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_sprimme *W, PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_sprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_sprimme *VtBV,
       int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_sprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_cprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_cprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_cprimme *M, int ldM, dummy_type_cprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_cprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_cprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basiscprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_cprimme *W, PRIMME_INT ldW, dummy_type_cprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovcprimme(dummy_type_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_cprimme *W, PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_cprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_cprimme *VtBV,
       int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_cprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_zprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_zprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_zprimme *M, int ldM, dummy_type_zprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_zprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_zprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basiszprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_zprimme *W, PRIMME_INT ldW, dummy_type_zprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovzprimme(dummy_type_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_zprimme *W, PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_zprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_zprimme *VtBV,
       int ldVtBV, dummy_type_zprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_zprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
       PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, dummy_type_magma_hprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_hprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_hprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_sprimme *M, int ldM, dummy_type_sprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_hprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basismagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_hprimme *W, PRIMME_INT ldW, dummy_type_magma_hprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_hprimme *W, PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_magma_hprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_sprimme *VtBV,
       int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_magma_hprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, dummy_type_magma_kprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_kprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_kprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_cprimme *M, int ldM, dummy_type_cprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_kprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basismagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_kprimme *W, PRIMME_INT ldW, dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_kprimme *W, PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_magma_kprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_cprimme *VtBV,
       int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_magma_kprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
       PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, dummy_type_magma_sprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_sprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_sprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_sprimme *M, int ldM, dummy_type_sprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_sprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basismagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_sprimme *W, PRIMME_INT ldW, dummy_type_magma_sprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_sprimme *W, PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_magma_sprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_sprimme *VtBV,
       int ldVtBV, dummy_type_sprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_magma_sprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, dummy_type_magma_cprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_cprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_cprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_cprimme *M, int ldM, dummy_type_cprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_cprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basismagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_cprimme *W, PRIMME_INT ldW, dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_cprimme *W, PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_magma_cprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_cprimme *VtBV,
       int ldVtBV, dummy_type_cprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_magma_cprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
       PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, dummy_type_magma_dprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_dprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_dprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_dprimme *M, int ldM, dummy_type_dprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_dprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basismagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_dprimme *W, PRIMME_INT ldW, dummy_type_magma_dprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_dprimme *W, PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_magma_dprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_dprimme *VtBV,
       int ldVtBV, dummy_type_dprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_magma_dprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 int init_basis_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, dummy_type_magma_zprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_magma_zprimme *Bevecs, PRIMME_INT ldBevecs, dummy_type_magma_zprimme *evecsHat,
       PRIMME_INT ldevecsHat, dummy_type_zprimme *M, int ldM, dummy_type_zprimme *Mfact, int ldMfact,
       int *ipivot, dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *fVtBV, int ldfVtBV,
       int maxRank, int *basisSize, int *nextGuess, int *numGuesses,
-      primme_context ctx);
+      double *errW, primme_context ctx);
+int recycle_basis_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_zprimme *W, PRIMME_INT ldW, int basisSize, primme_context ctx);
+int restore_basismagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
+      dummy_type_magma_zprimme *W, PRIMME_INT ldW, dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs,
+      dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *fVtBV, int ldfVtBV, int maxRank,
+      int maxSize, int *numRecycled, double *errW, primme_context ctx);
 int init_block_krylovmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT nLocal, PRIMME_INT ldV,
       dummy_type_magma_zprimme *W, PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, int dv1, int dv2,
       dummy_type_magma_zprimme *locked, PRIMME_INT ldlocked, int numLocked, dummy_type_zprimme *VtBV,
       int ldVtBV, dummy_type_zprimme *fVtBV, int ldfVtBV, int maxRank, primme_context ctx);
+int init_basis_workspace_magma_zprimme(
+      int withVtBV, int withEvecsHat, primme_context ctx);
 #endif
@@ -924,6 +924,169 @@ STATIC int perm_set_value_on_pos(int *p, int val, int pos, int n) {
    return -1;
 }
 
+/*******************************************************************************
+ * Subroutines *_workspace - Take from the dry arena of the context the same
+ *    blocks that the function without the suffix takes with the given sizes.
+ *    The flag withMfact tells whether Mfact is given. See
+ *    main_iter_workspace.
+ ******************************************************************************/
+
+STATIC int apply_skew_projector_workspace(
+      int withMfact, int numCols, int blockSize, primme_context ctx) {
+
+   if (numCols <= 0 || blockSize <= 0) return 0;
+
+   HSCALAR *overlaps;
+   CHKERR(Num_malloc_SHprimme(numCols * blockSize, &overlaps, ctx));
+   CHKERR(globalSum_workspace_SHprimme(numCols * blockSize, ctx));
+   if (withMfact) CHKERR(MSolve_workspace_SHprimme(numCols, blockSize, ctx));
+   CHKERR(Num_free_SHprimme(overlaps, ctx));
+
+   return 0;
+}
+
+STATIC int apply_projected_preconditioner_workspace(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx) {
+
+   CHKERR(applyPreconditioner_workspace_Sprimme(
+         ctx.primme->nLocal, blockSize, ctx));
+   CHKERR(apply_skew_projector_workspace(
+         withMfact, sizeRprojectorQ, blockSize, ctx));
+   if (sizeRprojectorX > 0) {
+      CHKERR(apply_skew_projector_workspace(1 /* xKinvBx */, 1, 1, ctx));
+   }
+
+   return 0;
+}
+
+STATIC int apply_projected_matrix_workspace(
+      int nQ, int nX, int blockSize, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   CHKERR(matrixMatvec_workspace_Sprimme(primme->nLocal, blockSize, ctx));
+   if (primme->massMatrixMatvec) {
+      SCALAR *Bv;
+      CHKERR(Num_malloc_Sprimme(primme->ldOPs * blockSize, &Bv, ctx));
+      CHKERR(massMatrixMatvec_workspace_Sprimme(
+            primme->nLocal, blockSize, ctx));
+      CHKERR(Num_free_Sprimme(Bv, ctx));
+   }
+   CHKERR(apply_skew_projector_workspace(0, nQ, blockSize, ctx));
+   if (nX > 0) CHKERR(apply_skew_projector_workspace(0, 1, 1, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int inner_solve_workspace_Sprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   SCALAR *g, *d, *delta, *w;
+   HREAL *sigma_prev, *rho_prev, *rho, *Theta_prev, *Theta, *tau_init,
+         *tau_prev, *tau, *normBx, *dot_sol = NULL, *Bnormsol = NULL;
+   double *alpha_prev, *Beta_prev, *Delta_prev, *Psi_prev, *eta, *eval_prev,
+         *eres_updated, *Gamma_prev, *Phi_prev, *gamma;
+   int *p, *p0;
+   int adaptive =
+         primme->correctionParams.convTest == primme_adaptive ||
+         primme->correctionParams.convTest == primme_adaptive_ETolerance;
+
+   CHKERR(Num_malloc_Sprimme(nLocal * blockSize, &g, ctx));
+   CHKERR(Num_malloc_Sprimme(nLocal * blockSize, &d, ctx));
+   CHKERR(Num_malloc_Sprimme(nLocal * blockSize, &delta, ctx));
+   CHKERR(Num_malloc_Sprimme(nLocal * blockSize, &w, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &sigma_prev, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &rho_prev, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &rho, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &alpha_prev, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &Theta_prev, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &Theta, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &tau_init, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &tau_prev, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &tau, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &Beta_prev, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &Delta_prev, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &Psi_prev, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &eta, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &eval_prev, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &eres_updated, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &Gamma_prev, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &Phi_prev, ctx));
+   CHKERR(Num_malloc_dprimme(blockSize, &gamma, ctx));
+   CHKERR(Num_malloc_RHprimme(blockSize, &normBx, ctx));
+   if (adaptive) {
+      if (primme->massMatrixMatvec) {
+         CHKERR(Num_malloc_RHprimme(blockSize, &Bnormsol, ctx));
+      } else {
+         CHKERR(Num_malloc_RHprimme(blockSize, &dot_sol, ctx));
+      }
+   }
+   CHKERR(Num_malloc_iprimme(blockSize, &p, ctx));
+   CHKERR(Num_malloc_iprimme(blockSize, &p0, ctx));
+
+   CHKERR(apply_projected_preconditioner_workspace(
+         sizeRprojectorQ, sizeRprojectorX, withMfact, blockSize, ctx));
+   CHKERR(globalSum_workspace_RHprimme(blockSize, ctx));
+   if (Bnormsol) CHKERR(globalSum_workspace_RHprimme(blockSize, ctx));
+
+   /* An inner iteration; the block only shrinks in later iterations */
+
+   if (blockSize > 0) {
+      CHKERR(apply_projected_matrix_workspace(
+            sizeLprojectorQ, sizeLprojectorX, blockSize, ctx));
+      CHKERR(globalSum_workspace_RHprimme(blockSize, ctx));
+      CHKERR(permute_vecs_workspace_iprimme(blockSize, ctx));
+      CHKERR(permute_vecs_workspace_dprimme(1, blockSize, ctx));
+      CHKERR(permute_vecs_workspace_SHprimme(1, blockSize, ctx));
+      CHKERR(permute_vecs_workspace_Sprimme(nLocal, blockSize, ctx));
+      CHKERR(globalSum_workspace_RHprimme(blockSize, ctx));
+      if (dot_sol) CHKERR(globalSum_workspace_RHprimme(blockSize, ctx));
+      if (Bnormsol) {
+         CHKERR(massMatrixMatvec_workspace_Sprimme(nLocal, blockSize, ctx));
+         CHKERR(globalSum_workspace_RHprimme(blockSize, ctx));
+      }
+      CHKERR(convTestFun_workspace_Sprimme(0 /* evec not given */, ctx));
+      CHKERR(monitorFun_workspace_Sprimme(1, 0, ctx));
+      CHKERR(apply_projected_preconditioner_workspace(
+            sizeRprojectorQ, sizeRprojectorX, withMfact, blockSize, ctx));
+      CHKERR(globalSum_workspace_RHprimme(blockSize, ctx));
+   }
+
+   CHKERR(Num_free_Sprimme(g, ctx));
+   CHKERR(Num_free_Sprimme(d, ctx));
+   CHKERR(Num_free_Sprimme(delta, ctx));
+   CHKERR(Num_free_Sprimme(w, ctx));
+   CHKERR(Num_free_RHprimme(sigma_prev, ctx));
+   CHKERR(Num_free_RHprimme(rho_prev, ctx));
+   CHKERR(Num_free_RHprimme(rho, ctx));
+   CHKERR(Num_free_dprimme(alpha_prev, ctx));
+   CHKERR(Num_free_RHprimme(Theta_prev, ctx));
+   CHKERR(Num_free_RHprimme(Theta, ctx));
+   CHKERR(Num_free_RHprimme(tau_init, ctx));
+   CHKERR(Num_free_RHprimme(tau_prev, ctx));
+   CHKERR(Num_free_RHprimme(tau, ctx));
+   CHKERR(Num_free_dprimme(Beta_prev, ctx));
+   CHKERR(Num_free_dprimme(Delta_prev, ctx));
+   CHKERR(Num_free_dprimme(Psi_prev, ctx));
+   CHKERR(Num_free_dprimme(eta, ctx));
+   CHKERR(Num_free_dprimme(eval_prev, ctx));
+   CHKERR(Num_free_dprimme(eres_updated, ctx));
+   CHKERR(Num_free_dprimme(Gamma_prev, ctx));
+   CHKERR(Num_free_dprimme(Phi_prev, ctx));
+   CHKERR(Num_free_dprimme(gamma, ctx));
+   CHKERR(Num_free_RHprimme(normBx, ctx));
+   CHKERR(Num_free_RHprimme(Bnormsol, ctx));
+   CHKERR(Num_free_RHprimme(dot_sol, ctx));
+   CHKERR(Num_free_iprimme(p, ctx));
+   CHKERR(Num_free_iprimme(p0, ctx));
+
+   return 0;
+}
+
 #endif /* USE_HERMITIAN */
 
 #endif /* SUPPORTED_TYPE */
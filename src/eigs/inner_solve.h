@@ -160,6 +160,114 @@ int apply_projected_matrixdprimme(dummy_type_dprimme *v, PRIMME_INT ldv, double
 #  define perm_set_value_on_pos CONCAT(perm_set_value_on_pos,WITH_KIND(SCALAR_SUF))
 #endif
 int perm_set_value_on_posdprimme(int *p, int val, int pos, int n);
+#if !defined(CHECK_TEMPLATE) && !defined(apply_skew_projector_workspace)
+#  define apply_skew_projector_workspace CONCAT(apply_skew_projector_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int apply_skew_projector_workspacedprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(apply_projected_preconditioner_workspace)
+#  define apply_projected_preconditioner_workspace CONCAT(apply_projected_preconditioner_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int apply_projected_preconditioner_workspacedprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(apply_projected_matrix_workspace)
+#  define apply_projected_matrix_workspace CONCAT(apply_projected_matrix_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int apply_projected_matrix_workspacedprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Sprimme)
+#  define inner_solve_workspace_Sprimme CONCAT(inner_solve_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Rprimme)
+#  define inner_solve_workspace_Rprimme CONCAT(inner_solve_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SHprimme)
+#  define inner_solve_workspace_SHprimme CONCAT(inner_solve_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RHprimme)
+#  define inner_solve_workspace_RHprimme CONCAT(inner_solve_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SXprimme)
+#  define inner_solve_workspace_SXprimme CONCAT(inner_solve_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RXprimme)
+#  define inner_solve_workspace_RXprimme CONCAT(inner_solve_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Shprimme)
+#  define inner_solve_workspace_Shprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Rhprimme)
+#  define inner_solve_workspace_Rhprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Ssprimme)
+#  define inner_solve_workspace_Ssprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Rsprimme)
+#  define inner_solve_workspace_Rsprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Sdprimme)
+#  define inner_solve_workspace_Sdprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Rdprimme)
+#  define inner_solve_workspace_Rdprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Sqprimme)
+#  define inner_solve_workspace_Sqprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_Rqprimme)
+#  define inner_solve_workspace_Rqprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SXhprimme)
+#  define inner_solve_workspace_SXhprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RXhprimme)
+#  define inner_solve_workspace_RXhprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SXsprimme)
+#  define inner_solve_workspace_SXsprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RXsprimme)
+#  define inner_solve_workspace_RXsprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SXdprimme)
+#  define inner_solve_workspace_SXdprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RXdprimme)
+#  define inner_solve_workspace_RXdprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SXqprimme)
+#  define inner_solve_workspace_SXqprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RXqprimme)
+#  define inner_solve_workspace_RXqprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SHhprimme)
+#  define inner_solve_workspace_SHhprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RHhprimme)
+#  define inner_solve_workspace_RHhprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SHsprimme)
+#  define inner_solve_workspace_SHsprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RHsprimme)
+#  define inner_solve_workspace_RHsprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SHdprimme)
+#  define inner_solve_workspace_SHdprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RHdprimme)
+#  define inner_solve_workspace_RHdprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_SHqprimme)
+#  define inner_solve_workspace_SHqprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(inner_solve_workspace_RHqprimme)
+#  define inner_solve_workspace_RHqprimme CONCAT(inner_solve_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int inner_solve_workspace_dprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_hprimme(int blockSize, dummy_type_hprimme *x, PRIMME_INT ldx, dummy_type_hprimme *Bx,
       PRIMME_INT ldBx, dummy_type_hprimme *r, PRIMME_INT ldr, dummy_type_sprimme *rnorm, dummy_type_hprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_sprimme *Mfact, int *ipivot, dummy_type_sprimme *xKinvBx,
@@ -185,6 +293,15 @@ int apply_projected_matrixhprimme(dummy_type_hprimme *v, PRIMME_INT ldv, double
       PRIMME_INT ldX, dummy_type_hprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_hprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_poshprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacehprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacehprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacehprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_hprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_kprimme(int blockSize, dummy_type_kprimme *x, PRIMME_INT ldx, dummy_type_kprimme *Bx,
       PRIMME_INT ldBx, dummy_type_kprimme *r, PRIMME_INT ldr, dummy_type_sprimme *rnorm, dummy_type_kprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_cprimme *xKinvBx,
@@ -210,6 +327,15 @@ int apply_projected_matrixkprimme(dummy_type_kprimme *v, PRIMME_INT ldv, double
       PRIMME_INT ldX, dummy_type_kprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_kprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_poskprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacekprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacekprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacekprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_kprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_sprimme(int blockSize, dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *Bx,
       PRIMME_INT ldBx, dummy_type_sprimme *r, PRIMME_INT ldr, dummy_type_sprimme *rnorm, dummy_type_sprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_sprimme *Mfact, int *ipivot, dummy_type_sprimme *xKinvBx,
@@ -235,6 +361,15 @@ int apply_projected_matrixsprimme(dummy_type_sprimme *v, PRIMME_INT ldv, double
       PRIMME_INT ldX, dummy_type_sprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_sprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_possprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacesprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacesprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacesprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_sprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_cprimme(int blockSize, dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_cprimme *Bx,
       PRIMME_INT ldBx, dummy_type_cprimme *r, PRIMME_INT ldr, dummy_type_sprimme *rnorm, dummy_type_cprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_cprimme *xKinvBx,
@@ -260,6 +395,15 @@ int apply_projected_matrixcprimme(dummy_type_cprimme *v, PRIMME_INT ldv, double
       PRIMME_INT ldX, dummy_type_cprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_cprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_poscprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacecprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacecprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacecprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_cprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_zprimme(int blockSize, dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_zprimme *Bx,
       PRIMME_INT ldBx, dummy_type_zprimme *r, PRIMME_INT ldr, dummy_type_dprimme *rnorm, dummy_type_zprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_zprimme *Mfact, int *ipivot, dummy_type_zprimme *xKinvBx,
@@ -285,6 +429,15 @@ int apply_projected_matrixzprimme(dummy_type_zprimme *v, PRIMME_INT ldv, double
       PRIMME_INT ldX, dummy_type_zprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_zprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_poszprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacezprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacezprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacezprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_zprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_magma_hprimme(int blockSize, dummy_type_magma_hprimme *x, PRIMME_INT ldx, dummy_type_magma_hprimme *Bx,
       PRIMME_INT ldBx, dummy_type_magma_hprimme *r, PRIMME_INT ldr, dummy_type_sprimme *rnorm, dummy_type_magma_hprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_sprimme *Mfact, int *ipivot, dummy_type_sprimme *xKinvBx,
@@ -310,6 +463,15 @@ int apply_projected_matrixmagma_hprimme(dummy_type_magma_hprimme *v, PRIMME_INT
       PRIMME_INT ldX, dummy_type_magma_hprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_magma_hprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_posmagma_hprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacemagma_hprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacemagma_hprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacemagma_hprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_magma_hprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_magma_kprimme(int blockSize, dummy_type_magma_kprimme *x, PRIMME_INT ldx, dummy_type_magma_kprimme *Bx,
       PRIMME_INT ldBx, dummy_type_magma_kprimme *r, PRIMME_INT ldr, dummy_type_sprimme *rnorm, dummy_type_magma_kprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_cprimme *xKinvBx,
@@ -335,6 +497,15 @@ int apply_projected_matrixmagma_kprimme(dummy_type_magma_kprimme *v, PRIMME_INT
       PRIMME_INT ldX, dummy_type_magma_kprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_magma_kprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_posmagma_kprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacemagma_kprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacemagma_kprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacemagma_kprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_magma_kprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_magma_sprimme(int blockSize, dummy_type_magma_sprimme *x, PRIMME_INT ldx, dummy_type_magma_sprimme *Bx,
       PRIMME_INT ldBx, dummy_type_magma_sprimme *r, PRIMME_INT ldr, dummy_type_sprimme *rnorm, dummy_type_magma_sprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_sprimme *Mfact, int *ipivot, dummy_type_sprimme *xKinvBx,
@@ -360,6 +531,15 @@ int apply_projected_matrixmagma_sprimme(dummy_type_magma_sprimme *v, PRIMME_INT
       PRIMME_INT ldX, dummy_type_magma_sprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_magma_sprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_posmagma_sprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacemagma_sprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacemagma_sprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacemagma_sprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_magma_sprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_magma_cprimme(int blockSize, dummy_type_magma_cprimme *x, PRIMME_INT ldx, dummy_type_magma_cprimme *Bx,
       PRIMME_INT ldBx, dummy_type_magma_cprimme *r, PRIMME_INT ldr, dummy_type_sprimme *rnorm, dummy_type_magma_cprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_cprimme *Mfact, int *ipivot, dummy_type_cprimme *xKinvBx,
@@ -385,6 +565,15 @@ int apply_projected_matrixmagma_cprimme(dummy_type_magma_cprimme *v, PRIMME_INT
       PRIMME_INT ldX, dummy_type_magma_cprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_magma_cprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_posmagma_cprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacemagma_cprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacemagma_cprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacemagma_cprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_magma_cprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_magma_dprimme(int blockSize, dummy_type_magma_dprimme *x, PRIMME_INT ldx, dummy_type_magma_dprimme *Bx,
       PRIMME_INT ldBx, dummy_type_magma_dprimme *r, PRIMME_INT ldr, dummy_type_dprimme *rnorm, dummy_type_magma_dprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_dprimme *Mfact, int *ipivot, dummy_type_dprimme *xKinvBx,
@@ -410,6 +599,15 @@ int apply_projected_matrixmagma_dprimme(dummy_type_magma_dprimme *v, PRIMME_INT
       PRIMME_INT ldX, dummy_type_magma_dprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_magma_dprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_posmagma_dprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacemagma_dprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacemagma_dprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacemagma_dprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_magma_dprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 int inner_solve_magma_zprimme(int blockSize, dummy_type_magma_zprimme *x, PRIMME_INT ldx, dummy_type_magma_zprimme *Bx,
       PRIMME_INT ldBx, dummy_type_magma_zprimme *r, PRIMME_INT ldr, dummy_type_dprimme *rnorm, dummy_type_magma_zprimme *evecs,
       PRIMME_INT ldevecs, dummy_type_zprimme *Mfact, int *ipivot, dummy_type_zprimme *xKinvBx,
@@ -435,4 +633,13 @@ int apply_projected_matrixmagma_zprimme(dummy_type_magma_zprimme *v, PRIMME_INT
       PRIMME_INT ldX, dummy_type_magma_zprimme *BX, PRIMME_INT ldBX, int nX, int blockSize,
       dummy_type_magma_zprimme *result, PRIMME_INT ldresult, primme_context ctx);
 int perm_set_value_on_posmagma_zprimme(int *p, int val, int pos, int n);
+int apply_skew_projector_workspacemagma_zprimme(
+      int withMfact, int numCols, int blockSize, primme_context ctx);
+int apply_projected_preconditioner_workspacemagma_zprimme(int sizeRprojectorQ,
+      int sizeRprojectorX, int withMfact, int blockSize, primme_context ctx);
+int apply_projected_matrix_workspacemagma_zprimme(
+      int nQ, int nX, int blockSize, primme_context ctx);
+int inner_solve_workspace_magma_zprimme(int blockSize, int sizeLprojectorQ,
+      int sizeLprojectorX, int sizeRprojectorQ, int sizeRprojectorX,
+      int withMfact, primme_context ctx);
 #endif
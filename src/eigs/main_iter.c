@@ -54,6 +54,7 @@
 #include "update_W.h"
 #include "auxiliary_eigs.h"
 #include "auxiliary_eigs_normal.h"
+#include "checkpoint.h"
 #endif
 
 #ifdef SUPPORTED_TYPE
@@ -198,6 +199,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                             /*    to allow for skew projectors w/o locking   */
    int LockingProblem;      /* Flag==1 if practically converged pairs locked */
    int restartLimitReached; /* True when maximum restarts performed          */
+   int numVerified;         /* Number of residual vectors left in W          */
    int nprevhVecs;          /* Number of vectors stored in prevhVecs         */
    int numArbitraryVecs;    /* Columns in hVecs computed with RR instead of  */
                             /* the current extraction method.                */
@@ -234,6 +236,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    HSCALAR *hVecs;          /* Eigenvectors of H                             */
    HSCALAR *hU = NULL;      /* Left singular vectors of R                    */
    HSCALAR *prevhVecs=NULL; /* hVecs from previous iteration                 */
+   HSCALAR *WtW = NULL;     /* Upper triangular portion of W'*W              */
+   int nWtW = 0;            /* Number of columns of W in WtW                 */
 
    int numQR;               /* Maximum number of QR factorizations           */
    SCALAR *Q = NULL;        /* QR decompositions for harmonic or refined     */
@@ -252,6 +256,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    double smallestResNorm;  /* the smallest residual norm in the block       */
    int reset=0;             /* Flag to reset V and W                         */
    int restartsSinceReset=0;/* Restart since last reset of V and W           */
+   double errW = 0.0;       /* Error in W if cast from single precision      */
    int wholeSpace=0;        /* search subspace reach max size                */
 
    /* Runtime measurement variables for dynamic method switching             */
@@ -277,12 +282,12 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    ldV = ldW = ldBV = ldQ = primme->ldOPs;
    ldBevecs = primme->massMatrixMatvec ? primme->ldOPs : ldevecs;
    if (primme->massMatrixMatvec) {
-      CHKERR(Num_malloc_Sprimme(ldBV*primme->maxBasisSize, &BV, ctx));
+      CHKERR(malloc_basis(ldBV*primme->maxBasisSize, &BV, ctx));
    }
-   CHKERR(Num_malloc_Sprimme(primme->ldOPs*primme->maxBasisSize, &V, ctx));
-   CHKERR(Num_malloc_Sprimme(primme->ldOPs*primme->maxBasisSize, &W, ctx));
+   CHKERR(malloc_basis(primme->ldOPs*primme->maxBasisSize, &V, ctx));
+   CHKERR(malloc_basis(primme->ldOPs*primme->maxBasisSize, &W, ctx));
    if (numQR > 0) {
-      CHKERR(Num_malloc_Sprimme(primme->ldOPs*primme->maxBasisSize*numQR, &Q, ctx));
+      CHKERR(malloc_basis(primme->ldOPs*primme->maxBasisSize*numQR, &Q, ctx));
       CHKERR(Num_malloc_SHprimme(
           primme->maxBasisSize * primme->maxBasisSize * numQR, &R, ctx));
       CHKERR(Num_malloc_SHprimme(
@@ -296,6 +301,17 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                               ctx));
    CHKERR(Num_malloc_SHprimme(primme->maxBasisSize * primme->maxBasisSize,
                               &hVecs, ctx));
+
+   /* With commReduce, W'*W is updated with H in a single reduction, and the */
+   /* residual norms of the Ritz pairs are estimated from it; that saves a   */
+   /* reduction per iteration. This is only possible with Rayleigh-Ritz on   */
+   /* standard Hermitian problems.                                           */
+
+   if (ctx.commReduce && numQR == 0 && !primme->massMatrixMatvec &&
+         KIND(1, 0)) {
+      CHKERR(Num_malloc_SHprimme(
+            primme->maxBasisSize * primme->maxBasisSize, &WtW, ctx));
+   }
    int maxRank; /* maximum size of the main space being orthonormalize */
    if (primme->locking) {
       maxRank = primme->numOrthoConst + primme->numEvals + primme->maxBasisSize;
@@ -327,12 +343,12 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
          primme->correctionParams.projectors.RightQ &&
          primme->correctionParams.projectors.SkewQ           ) {
       ldevecsHat = primme->nLocal;
-      CHKERR(Num_malloc_Sprimme(ldevecsHat * maxEvecsSize, &evecsHat, ctx));
+      CHKERR(malloc_basis(ldevecsHat * maxEvecsSize, &evecsHat, ctx));
       CHKERR(Num_malloc_SHprimme(maxEvecsSize * maxEvecsSize, &M, ctx));
       CHKERR(Num_malloc_SHprimme(maxEvecsSize * maxEvecsSize, &Mfact, ctx));
    }
    if (primme->massMatrixMatvec && primme->locking) {
-      CHKERR(Num_malloc_Sprimme(ldBevecs * maxEvecsSize, &Bevecs, ctx));
+      CHKERR(malloc_basis(ldBevecs * maxEvecsSize, &Bevecs, ctx));
    }
    CHKERR(Num_malloc_SHprimme(
          primme->maxBasisSize * primme->maxBasisSize, &prevhVecs, ctx));
@@ -389,6 +405,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    primme->stats.maxConvTol                    = 0.0;
    primme->stats.estimateResidualError         = 0.0;
    primme->stats.lockingIssue                  = 0;
+   primme->stats.numOrthoGlobalSum             = 0;
+   primme->stats.numOrthoVectors               = 0;
 
    numLocked = 0;
    LockingProblem = 0;
@@ -412,10 +430,19 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    /* Initialize the basis */
    /* -------------------- */
 
-   CHKERR(init_basis_Sprimme(V, primme->nLocal, ldV, W, ldW, BV, ldBV, evecs,
-         ldevecs, Bevecs, ldBevecs, evecsHat, primme->nLocal, M, maxEvecsSize,
-         Mfact, 0, ipivot, VtBV, ldVtBV, fVtBV, ldfVtBV, maxRank, &basisSize,
-         &nextGuess, &numGuesses, ctx));
+   if (primme->initBasisMode == primme_init_checkpoint) {
+      /* Resume from the state saved in the checkpoint file */
+
+      CHKERR(checkpoint_load_Sprimme(V, ldV, W, ldW, BV, ldBV, &basisSize,
+            evecs, ldevecs, evals, resNorms, lockedFlags, perm, &numLocked,
+            &nextGuess, &numGuesses, Bevecs, ldBevecs, evecsHat, ldevecsHat, M,
+            Mfact, ipivot, maxEvecsSize, VtBV, fVtBV, ldVtBV, ctx));
+   } else {
+      CHKERR(init_basis_Sprimme(V, primme->nLocal, ldV, W, ldW, BV, ldBV,
+            evecs, ldevecs, Bevecs, ldBevecs, evecsHat, primme->nLocal, M,
+            maxEvecsSize, Mfact, 0, ipivot, VtBV, ldVtBV, fVtBV, ldfVtBV,
+            maxRank, &basisSize, &nextGuess, &numGuesses, &errW, ctx));
+   }
 
    /* Now initSize will store the number of converged pairs */
    primme->initSize = 0;
@@ -426,7 +453,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
    /* ----------------------------------------------------------- */
    if (primme->dynamicMethodSwitch > 0) {
       initializeModel(&CostModel, primme);
-      CostModel.MV = primme->stats.timeMatvec/primme->stats.numMatvecs;
+      if (primme->stats.numMatvecs > 0)
+         CostModel.MV = primme->stats.timeMatvec/primme->stats.numMatvecs;
       if (primme->numEvals < 5 ||
             primme->maxBasisSize + (primme->locking ? primme->numEvals : 0) >=
                   primme->n)
@@ -448,6 +476,15 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
 
       if (reset > 0) PRINTF(5, "Resetting V, W and QR");
 
+      /* A W cast from the single-precision solve of adaptivePrecision */
+      /* (see init_basis) is computed again at the first reset         */
+
+      if (reset > 0 && errW > 0.0) {
+         CHKERR(matrixMatvec_Sprimme(V, primme->nLocal, ldV, W, ldW, 0,
+               basisSize, ctx));
+         errW = 0.0;
+      }
+
       /* Reset convergence flags. This may only reoccur without locking */
 
       primme->initSize = numConverged = numConvergedStored = numLocked;
@@ -466,7 +503,14 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
          CHKERRM(numQR && basisSize != nQ, -1, "Not supported deficient QR");
       }
 
-      if (H)
+      nWtW = 0;
+      if (WtW) {
+         CHKERR(update_projection_WtW_Sprimme(V, ldV, W, ldW, H,
+               primme->maxBasisSize, WtW, primme->maxBasisSize,
+               primme->nLocal, 0, basisSize, nWtW, ctx));
+         nWtW = basisSize;
+      }
+      else if (H)
          CHKERR(update_projection_Sprimme(V, ldV, W, ldW, H,
                primme->maxBasisSize, primme->nLocal, 0, basisSize,
                KIND(1 /*symmetric*/, 0 /* unsymmetric */), ctx));
@@ -489,7 +533,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
       numArbitraryVecs = 0;
       maxRecentlyConverged = availableBlockSize = blockSize = 0;
       smallestResNorm = HUGE_VAL;
-      primme->stats.estimateResidualError = 0.0;
+      primme->stats.estimateResidualError = errW;
       if (!primme->locking) primme->stats.maxConvTol = 0.0;
       blockSize = 0;
       restartsSinceReset = 0;
@@ -555,8 +599,9 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                   practConvCheck = -1;
                }
                CHKERR(prepare_candidates(V, ldV, W, ldW, BV, ldBV,
-                     primme->nLocal, H, primme->maxBasisSize, basisSize,
-                     &V[basisSize * ldV], &W[basisSize * ldW],
+                     primme->nLocal, H, primme->maxBasisSize,
+                     nWtW == basisSize ? WtW : NULL, primme->maxBasisSize,
+                     basisSize, &V[basisSize * ldV], &W[basisSize * ldW],
                      BV ? &BV[basisSize * ldBV] : NULL,
                      1 /* compute approx vectors and residuals */, hVecs,
                      basisSize, hVals, hSVals, flags, maxRecentlyConverged,
@@ -686,11 +731,27 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                      Num_malloc_SHprimme(ldRlocked * blockSize, &Rlocked, ctx));
             }
 
+            /* With primme_orth_dcgs2, or commReduce and primme_orth_implicit_I,*/
+            /* a single correction is only orthogonalized once here, and the  */
+            /* second pass is delayed to update_projection_dcgs2, which does  */
+            /* it with the reduction of H. That is possible only when W = A*V,*/
+            /* V'*V = I, and H and W can be corrected without other vectors.  */
+
+            int delayed = 0;
+            if ((primme->orth == primme_orth_dcgs2 ||
+                      (ctx.commReduce &&
+                            primme->orth == primme_orth_implicit_I)) &&
+                  blockSize == 1 && numQR == 0 && !BV && !QtV &&
+                  primme->numOrthoConst + numLocked == 0 && KIND(1, 0)) {
+               CHKERR(ortho_dcgs2_Sprimme(
+                     V, ldV, basisSize, primme->nLocal, &delayed, ctx));
+            }
+
             /* Orthogonalize the corrections with respect to each other and   */
             /* the current basis. If basis hasn't expanded with any new       */
             /* vector, try a random vector                                    */
 
-            for (i=0; i < maxNumRandoms; i++) {
+            for (i=0; i < maxNumRandoms && !delayed; i++) {
                int basisSizeOut;
                CHKERR(Bortho_block_Sprimme(V, ldV, VtBV, ldVtBV, fVtBV, ldfVtBV,
                      NULL, 0, basisSize, basisSize + blockSize - 1, evecs,
@@ -818,7 +879,33 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
             /* Extend H by blockSize columns and rows and solve the */
             /* eigenproblem for the new H.                          */
 
-            if (H)
+            if (delayed) {
+               CHKERR(update_projection_dcgs2_Sprimme(V, ldV, W, ldW, H,
+                     primme->maxBasisSize, WtW, primme->maxBasisSize,
+                     primme->nLocal, basisSize, nWtW, &delayed, ctx));
+
+               /* If the second pass was not enough, which is rare because */
+               /* ortho_dcgs2 doesn't delay vectors that lost many digits, */
+               /* orthogonalize the vector again and recompute W.          */
+
+               if (!delayed) {
+                  CHKERR(ortho_Sprimme(V, ldV, NULL, 0, basisSize, basisSize,
+                        NULL, 0, 0, primme->nLocal, primme->iseed, ctx));
+                  CHKERR(matrixMatvec_Sprimme(V, primme->nLocal, ldV, W, ldW,
+                        basisSize, blockSize, ctx));
+               }
+            }
+
+            if (delayed) {
+               if (WtW) nWtW = basisSize + blockSize;
+            }
+            else if (WtW) {
+               CHKERR(update_projection_WtW_Sprimme(V, ldV, W, ldW, H,
+                     primme->maxBasisSize, WtW, primme->maxBasisSize,
+                     primme->nLocal, basisSize, blockSize, nWtW, ctx));
+               nWtW = basisSize + blockSize;
+            }
+            else if (H)
                CHKERR(update_projection_Sprimme(V, ldV, W, ldW, H,
                      primme->maxBasisSize, primme->nLocal, basisSize, blockSize,
                      KIND(1 /*symmetric*/, 0 /* unsymmetric */), ctx));
@@ -981,8 +1068,8 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                }
 
                CHKERR(prepare_candidates(V, ldV, W, ldW, BV, ldBV,
-                     primme->nLocal, H, primme->maxBasisSize, basisSize, NULL,
-                     NULL, NULL,
+                     primme->nLocal, H, primme->maxBasisSize, NULL, 0,
+                     basisSize, NULL, NULL, NULL,
                      0 /* Not compute approx vectors and residuals */, hVecs,
                      basisSize, hVals, hSVals, flags, maxRecentlyConverged,
                      blockNorms, blockSize, availableBlockSize, evecs,
@@ -1062,7 +1149,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                blockSize = availableBlockSize;
                i = 0;
                for (i = 0; i < blockSize; i++) iev[i] = i;
-               if (ctx.procID == 0) {
+               if (ctx.procID == 0 || ctx.commReduce) {
                   CHKERR(map_vecs_SHprimme(prevhVecs, basisSize, nprevhVecs,
                         primme->maxBasisSize, hVecs, 0, basisSize, basisSize,
                         map, ctx));
@@ -1096,6 +1183,15 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                &numArbitraryVecs, hVecsRot, primme->maxBasisSize,
                &restartsSinceReset, startTime, ctx));
          restartsSinceReset++;
+         nWtW = 0; /* W has changed */
+
+         /* Reset after the first restart if W was cast from single */
+         /* precision, when recomputing W is cheapest               */
+
+         if (errW > 0.0) {
+            reset = 2;
+            break;
+         }
 
          /* If there are any initial guesses remaining, then copy it */
          /* into the basis.                                          */
@@ -1151,7 +1247,13 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
             /* Extend H by numNew columns and rows and solve the */
             /* eigenproblem for the new H.                       */
 
-            if (H)
+            if (WtW) {
+               CHKERR(update_projection_WtW_Sprimme(V, ldV, W, ldW, H,
+                     primme->maxBasisSize, WtW, primme->maxBasisSize,
+                     primme->nLocal, basisSize, numNew, nWtW, ctx));
+               nWtW = basisSize + numNew;
+            }
+            else if (H)
                CHKERR(update_projection_Sprimme(V, ldV, W, ldW, H,
                      primme->maxBasisSize, primme->nLocal, basisSize, numNew,
                      KIND(1 /*symmetric*/, 0 /*unsymmetric */), ctx));
@@ -1173,6 +1275,17 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
 
          primme->initSize = numConverged;
 
+         /* Save the state every checkpointFrequency restarts */
+
+         if (primme->checkpointFile && primme->checkpointFrequency > 0 &&
+               primme->stats.numRestarts % primme->checkpointFrequency == 0) {
+            CHKERR(checkpoint_save_Sprimme(V, ldV, W, ldW, BV, ldBV,
+                  basisSize, evecs, ldevecs, evals, resNorms, lockedFlags,
+                  perm, numLocked, nextGuess, numGuesses, Bevecs, ldBevecs,
+                  evecsHat, ldevecsHat, M, Mfact, ipivot, maxEvecsSize, VtBV,
+                  fVtBV, ldVtBV, ctx));
+         }
+
          /* ------------------------------------------------------------- */
          /* If dynamic method switching == 1, update model parameters and */
          /* evaluate whether to switch from GD+k to JDQMR. This is after  */
@@ -1239,6 +1352,11 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
          else {
             *ret = PRIMME_MAIN_ITER_FAILURE;
          }
+
+         /* Keep the search space for the next solve */
+
+         CHKERR(recycle_basis_Sprimme(
+               V, primme->nLocal, ldV, W, ldW, basisSize, ctx));
          goto clean;
 
       }
@@ -1264,9 +1382,9 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
          /* converged state.                                           */
          /* ---------------------------------------------------------- */
 
-         CHKERR(verify_norms(V, ldV, W, ldW, BV, ldBV, hVals,
-               restartLimitReached ? primme->numEvals : numConverged, resNorms,
-               flags, &numConverged, ctx));
+         numVerified = restartLimitReached ? primme->numEvals : numConverged;
+         CHKERR(verify_norms(V, ldV, W, ldW, BV, ldBV, hVals, numVerified,
+               resNorms, flags, &numConverged, ctx));
 
          /* ---------------------------------------------------------- */
          /* If the convergence limit is reached or the target vectors  */
@@ -1308,6 +1426,18 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
             else {
                *ret = PRIMME_MAIN_ITER_FAILURE;
             }
+
+            /* Keep the search space for the next solve. verify_norms */
+            /* left the residual vectors in W; restore W = A*V first.  */
+
+            if (primme->recycle) {
+               for (i = 0; i < numVerified; i++) {
+                  Num_axpy_Sprimme(primme->nLocal, hVals[i], &V[ldV * i], 1,
+                        &W[ldW * i], 1, ctx);
+               }
+            }
+            CHKERR(recycle_basis_Sprimme(
+                  V, primme->nLocal, ldV, W, ldW, basisSize, ctx));
             goto clean;
 
          } else {
@@ -1321,6 +1451,7 @@ int main_iter_Sprimme(HEVAL *evals, SCALAR *evecs, PRIMME_INT ldevecs,
                   maxRank, &basisSize, ctx));
             CHKERR(matrixMatvec_Sprimme(V, primme->nLocal, ldV, W, ldW, 0,
                      basisSize, ctx));
+            errW = 0.0;
 
             PRINTF(2,
                   "Verifying before return: Some vectors are unconverged");
@@ -1394,6 +1525,7 @@ clean:
       CHKERR(Num_free_Sprimme(Bevecs, ctx));
    }
    CHKERR(Num_free_SHprimme(prevhVecs, ctx));
+   if (WtW) CHKERR(Num_free_SHprimme(WtW, ctx));
 
    CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(hVals, ctx));
    if (numQR > 0) { CHKERR(Num_free_RHprimme(hSVals, ctx)); }
@@ -1413,6 +1545,324 @@ clean:
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine main_iter_workspace - Take from the dry arena of the context (see
+ *    Mem_create_dry_arena) the same blocks that main_iter takes from the arena.
+ *    The peak of the arena is then the size of the workspace that main_iter
+ *    needs to not allocate memory.
+ *
+ *    The arrays allocated at the beginning of main_iter are taken in the same
+ *    order. Then the phases of main_iter are replayed one after another with
+ *    the functions *_workspace, which take and release the same blocks as the
+ *    functions they are named after. The sizes that depend on the convergence,
+ *    as the basis size, the block size or the number of locked pairs, are
+ *    replaced by their largest values; where the blocks depend on several of
+ *    them, like in Bortho_block, every case is replayed. The phases that run
+ *    only sometimes, like the reset of the basis or the switch between GD+k
+ *    and JDQMR, are replayed too. The peak is the largest among them.
+ *
+ * NOTE: keep it in sync with main_iter.
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int main_iter_workspace_Sprimme(primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   const PRIMME_INT nLocal = primme->nLocal;
+   const int mb = primme->maxBasisSize;
+   const int maxBlockSize = primme->maxBlockSize;
+   const int nOC = primme->numOrthoConst;
+   const int maxEvecsSize = nOC + primme->numEvals;
+   const int numQR =
+         primme->projectionParams.projection != primme_proj_RR ? 1 : 0;
+   const int withQtV =
+         primme->projectionParams.projection == primme_proj_harmonic;
+   const int withVtBV = primme->orth == primme_orth_explicit_I;
+   const int withQtQ = withVtBV && numQR;
+   const int withBV = primme->massMatrixMatvec ? 1 : 0;
+   const int withWtW = ctx.commReduce && numQR == 0 &&
+                       !primme->massMatrixMatvec && KIND(1, 0);
+   const int withEvecsHat = primme->correctionParams.precondition &&
+                            primme->correctionParams.maxInnerIterations != 0 &&
+                            primme->correctionParams.projectors.RightQ &&
+                            primme->correctionParams.projectors.SkewQ;
+   const int maxLocked = primme->locking ? primme->numEvals : 0;
+
+   /* Arrays allocated at the beginning of main_iter */
+
+   SCALAR *V, *W, *BV = NULL, *Q = NULL, *evecsHat = NULL, *Bevecs = NULL;
+   HSCALAR *R = NULL, *hU = NULL, *QtV = NULL, *H, *hVecs, *WtW = NULL;
+   HSCALAR *VtBV = NULL, *fVtBV = NULL, *QtQ = NULL, *fQtQ = NULL;
+   HSCALAR *hVecsRot = NULL, *M = NULL, *Mfact = NULL, *prevhVecs;
+   HEVAL *hVals, *prevRitzVals;
+   HREAL *hSVals = NULL, *blockNorms, *basisNorms;
+   int *perm, *lockedFlags = NULL, *flags, *map, *iev, *ipivot;
+
+   if (primme->massMatrixMatvec) {
+      CHKERR(malloc_basis_workspace(primme->ldOPs * mb, &BV, ctx));
+   }
+   CHKERR(malloc_basis_workspace(primme->ldOPs * mb, &V, ctx));
+   CHKERR(malloc_basis_workspace(primme->ldOPs * mb, &W, ctx));
+   if (numQR > 0) {
+      CHKERR(malloc_basis_workspace(primme->ldOPs * mb * numQR, &Q, ctx));
+      CHKERR(Num_malloc_SHprimme(mb * mb * numQR, &R, ctx));
+      CHKERR(Num_malloc_SHprimme(mb * mb * numQR, &hU, ctx));
+   }
+   if (withQtV) CHKERR(Num_malloc_SHprimme(mb * mb * numQR, &QtV, ctx));
+   CHKERR(Num_malloc_SHprimme(mb * mb, &H, ctx));
+   CHKERR(Num_malloc_SHprimme(mb * mb, &hVecs, ctx));
+   if (withWtW) CHKERR(Num_malloc_SHprimme(mb * mb, &WtW, ctx));
+   int maxRank = nOC + maxLocked + mb;
+   if (withVtBV) {
+      CHKERR(Num_malloc_SHprimme(maxRank * maxRank, &VtBV, ctx));
+      CHKERR(Num_malloc_SHprimme(maxRank * maxRank, &fVtBV, ctx));
+   }
+   if (withQtQ) {
+      CHKERR(Num_malloc_SHprimme(mb * mb * numQR, &QtQ, ctx));
+      CHKERR(Num_malloc_SHprimme(mb * mb * numQR, &fQtQ, ctx));
+   }
+   if (primme->projectionParams.projection == primme_proj_refined ||
+         primme->projectionParams.projection == primme_proj_harmonic) {
+      CHKERR(Num_malloc_SHprimme(mb * mb * numQR, &hVecsRot, ctx));
+   }
+   if (withEvecsHat) {
+      CHKERR(malloc_basis_workspace(nLocal * maxEvecsSize, &evecsHat, ctx));
+      CHKERR(Num_malloc_SHprimme(maxEvecsSize * maxEvecsSize, &M, ctx));
+      CHKERR(Num_malloc_SHprimme(maxEvecsSize * maxEvecsSize, &Mfact, ctx));
+   }
+   if (primme->massMatrixMatvec && primme->locking) {
+      CHKERR(malloc_basis_workspace(
+            primme->ldOPs * maxEvecsSize, &Bevecs, ctx));
+   }
+   CHKERR(Num_malloc_SHprimme(mb * mb, &prevhVecs, ctx));
+   CHKERR(KIND(Num_malloc_RHprimme, Num_malloc_SHprimme)(mb, &hVals, ctx));
+   if (numQR > 0) CHKERR(Num_malloc_RHprimme(mb, &hSVals, ctx));
+   CHKERR(KIND(Num_malloc_RHprimme, Num_malloc_SHprimme)(
+         mb + primme->numEvals, &prevRitzVals, ctx));
+   CHKERR(Num_malloc_RHprimme(maxBlockSize, &blockNorms, ctx));
+   CHKERR(Num_malloc_RHprimme(mb, &basisNorms, ctx));
+   CHKERR(Num_malloc_iprimme(primme->numEvals, &perm, ctx));
+   if (primme->locking) {
+      CHKERR(Num_malloc_iprimme(primme->numEvals, &lockedFlags, ctx));
+   }
+   CHKERR(Num_malloc_iprimme(mb, &flags, ctx));
+   CHKERR(Num_malloc_iprimme(mb, &map, ctx));
+   CHKERR(Num_malloc_iprimme(maxBlockSize, &iev, ctx));
+   CHKERR(Num_malloc_iprimme(maxEvecsSize, &ipivot, ctx));
+
+   /* Initialize the basis */
+
+   if (primme->initBasisMode == primme_init_checkpoint) {
+      CHKERR(globalSum_workspace_RHprimme(1, ctx));
+   } else {
+      CHKERR(init_basis_workspace_Sprimme(withVtBV, withEvecsHat, ctx));
+   }
+
+   /* With dynamic method switch, the correction alternates between GD+k */
+   /* and JDQMR; replay the iterations with both                         */
+
+   primme_params primme0 = *primme;
+   primme_context ctx0 = ctx;
+   ctx0.primme = &primme0;
+   int jdqmr;
+   for (jdqmr = 0; jdqmr < 2; jdqmr++) {
+      if (primme->dynamicMethodSwitch > 0) {
+         primme0.correctionParams.maxInnerIterations = jdqmr ? -1 : 0;
+      } else if (jdqmr) {
+         break;
+      }
+
+      /* Reset: W = A*V, and compute H and its eigenpairs */
+
+      CHKERR(matrixMatvec_workspace_Sprimme(nLocal, mb, ctx0));
+      CHKERR(update_Q_range_workspace(numQR, withQtQ, mb, mb, ctx0));
+      if (withWtW) {
+         CHKERR(update_projection_WtW_workspace_Sprimme(0, mb, 0, ctx0));
+      } else {
+         CHKERR(update_projection_workspace_Sprimme(0, mb, KIND(1, 0), ctx0));
+      }
+      if (withQtV) {
+         CHKERR(update_projection_workspace_Sprimme(0, mb, 0, ctx0));
+      }
+      CHKERR(solve_H_workspace_SHprimme(mb, withVtBV, withQtQ, ctx0));
+
+      /* An iteration: candidates, correction, expansion of the basis */
+
+      CHKERR(prepare_candidates_workspace(mb, maxBlockSize, 1 /* X, R */,
+            withWtW, withVtBV, maxLocked, ctx0));
+      CHKERR(monitorFun_workspace_Sprimme(mb, maxLocked, ctx0));
+      CHKERR(solve_correction_workspace_Sprimme(
+            mb, maxLocked, maxBlockSize, withEvecsHat, ctx0));
+
+      HSCALAR *Rlocked = NULL;
+      int withRlocked = primme->locking && !primme->massMatrixMatvec &&
+                        !primme->correctionParams.precondition &&
+                        primme0.correctionParams.maxInnerIterations == 0;
+      if (withRlocked) {
+         CHKERR(Num_malloc_SHprimme(
+               (nOC + maxLocked) * maxBlockSize, &Rlocked, ctx0));
+      }
+
+      int withDelayed = (primme->orth == primme_orth_dcgs2 ||
+                               (ctx.commReduce &&
+                                     primme->orth == primme_orth_implicit_I)) &&
+                        numQR == 0 && !withBV && nOC == 0 && KIND(1, 0);
+      if (withDelayed) CHKERR(ortho_dcgs2_workspace_Sprimme(mb - 1, ctx0));
+
+      CHKERR(Bortho_block_range_workspace_Sprimme(withVtBV, mb, maxBlockSize,
+            nOC + maxLocked, withBV, withRlocked, nLocal, ctx0));
+
+      if (withRlocked) {
+         if (withVtBV) {
+            HSCALAR *Xx;
+            CHKERR(Num_malloc_SHprimme(maxLocked, &Xx, ctx0));
+            CHKERR(Num_free_SHprimme(Xx, ctx0));
+         }
+         CHKERR(check_convergence_workspace_Sprimme(
+               1 /* X */, 0 /* no R */, withVtBV, maxLocked, 1, -1, ctx0));
+         CHKERR(monitorFun_workspace_Sprimme(mb, 0, ctx0));
+         CHKERR(Num_free_SHprimme(Rlocked, ctx0));
+      }
+
+      CHKERR(matrixMatvec_workspace_Sprimme(nLocal, maxBlockSize, ctx0));
+      CHKERR(update_Q_range_workspace(numQR, withQtQ, mb, maxBlockSize, ctx0));
+      if (withDelayed) {
+         CHKERR(update_projection_dcgs2_workspace_Sprimme(
+               mb - 1, withWtW, 0, ctx0));
+         CHKERR(Bortho_gen_workspace_Sprimme(mb - 1, 0, nLocal, 0, 0, ctx0));
+         CHKERR(matrixMatvec_workspace_Sprimme(nLocal, 1, ctx0));
+      }
+      if (withWtW) {
+         CHKERR(update_projection_WtW_workspace_Sprimme(0, mb, 0, ctx0));
+      } else {
+         CHKERR(update_projection_workspace_Sprimme(0, mb, KIND(1, 0), ctx0));
+      }
+      if (withQtV) {
+         CHKERR(update_projection_workspace_Sprimme(0, mb, 0, ctx0));
+      }
+      CHKERR(solve_H_workspace_SHprimme(mb, withVtBV, withQtQ, ctx0));
+
+      /* Before restarting: candidates without X and R, or just the map */
+
+      CHKERR(prepare_candidates_workspace(
+            mb, maxBlockSize, 0 /* no X, R */, 0, withVtBV, maxLocked, ctx0));
+      int *iwork;
+      CHKERR(Num_malloc_iprimme(mb, &iwork, ctx0));
+      CHKERR(KIND(permute_vecs_workspace_RHprimme,
+            permute_vecs_workspace_SHprimme)(1, mb, ctx0));
+      CHKERR(permute_vecs_workspace_SHprimme(mb, mb, ctx0));
+      CHKERR(permute_vecs_workspace_iprimme(mb, ctx0));
+      if (hVecsRot) CHKERR(permute_vecs_workspace_SHprimme(mb, mb, ctx0));
+      CHKERR(Num_free_iprimme(iwork, ctx0));
+      CHKERR(map_vecs_workspace_SHprimme(mb, 0, mb, ctx0));
+      CHKERR(broadcast_workspace_Tprimme(primme_op_int, mb, ctx0));
+      CHKERR(permute_vecs_workspace_SHprimme(mb, mb, ctx0));
+
+      /* Restart, and add the initial guesses not in the basis yet */
+
+      CHKERR(restart_workspace_Sprimme(
+            mb, withVtBV, withQtQ, withEvecsHat, ctx0));
+      if (primme->locking && primme->initSize > primme->minRestartSize) {
+         CHKERR(Bortho_block_range_workspace_Sprimme(withVtBV, mb, mb,
+               nOC + maxLocked, withBV, 0, nLocal, ctx0));
+         CHKERR(matrixMatvec_workspace_Sprimme(nLocal, mb, ctx0));
+         CHKERR(update_Q_range_workspace(numQR, withQtQ, mb, mb, ctx0));
+         if (withWtW) {
+            CHKERR(update_projection_WtW_workspace_Sprimme(0, mb, 0, ctx0));
+         } else {
+            CHKERR(update_projection_workspace_Sprimme(
+                  0, mb, KIND(1, 0), ctx0));
+         }
+         if (withQtV) {
+            CHKERR(update_projection_workspace_Sprimme(0, mb, 0, ctx0));
+         }
+         CHKERR(solve_H_workspace_SHprimme(mb, withVtBV, withQtQ, ctx0));
+      }
+      if (primme->checkpointFile && primme->checkpointFrequency > 0) {
+         CHKERR(globalSum_workspace_RHprimme(1, ctx0));
+      }
+   }
+
+   /* Return the pairs */
+
+   if (primme->locking) {
+      CHKERR(copy_back_candidates_workspace(mb, withVtBV, ctx));
+   } else {
+      CHKERR(verify_norms_workspace(primme->numEvals, ctx));
+      CHKERR(Bortho_block_workspace_Sprimme(
+            withVtBV, 0, 0, mb - 1, nOC, withBV, 0, nLocal, ctx));
+      CHKERR(matrixMatvec_workspace_Sprimme(nLocal, mb, ctx));
+   }
+   CHKERR(permute_vecs_workspace_Sprimme(nLocal, primme->numEvals, ctx));
+
+   CHKERR(Num_free_Sprimme(BV, ctx));
+   CHKERR(Num_free_Sprimme(V, ctx));
+   CHKERR(Num_free_Sprimme(W, ctx));
+   CHKERR(Num_free_Sprimme(Q, ctx));
+   CHKERR(Num_free_SHprimme(R, ctx));
+   CHKERR(Num_free_SHprimme(hU, ctx));
+   CHKERR(Num_free_SHprimme(QtV, ctx));
+   CHKERR(Num_free_SHprimme(H, ctx));
+   CHKERR(Num_free_SHprimme(hVecs, ctx));
+   CHKERR(Num_free_SHprimme(VtBV, ctx));
+   CHKERR(Num_free_SHprimme(fVtBV, ctx));
+   CHKERR(Num_free_SHprimme(QtQ, ctx));
+   CHKERR(Num_free_SHprimme(fQtQ, ctx));
+   CHKERR(Num_free_SHprimme(hVecsRot, ctx));
+   CHKERR(Num_free_Sprimme(evecsHat, ctx));
+   CHKERR(Num_free_SHprimme(M, ctx));
+   CHKERR(Num_free_SHprimme(Mfact, ctx));
+   CHKERR(Num_free_Sprimme(Bevecs, ctx));
+   CHKERR(Num_free_SHprimme(prevhVecs, ctx));
+   CHKERR(Num_free_SHprimme(WtW, ctx));
+   CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(hVals, ctx));
+   CHKERR(Num_free_RHprimme(hSVals, ctx));
+   CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(prevRitzVals, ctx));
+   CHKERR(Num_free_RHprimme(blockNorms, ctx));
+   CHKERR(Num_free_RHprimme(basisNorms, ctx));
+   CHKERR(Num_free_iprimme(perm, ctx));
+   CHKERR(Num_free_iprimme(lockedFlags, ctx));
+   CHKERR(Num_free_iprimme(flags, ctx));
+   CHKERR(Num_free_iprimme(map, ctx));
+   CHKERR(Num_free_iprimme(iev, ctx));
+   CHKERR(Num_free_iprimme(ipivot, ctx));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine malloc_basis - Allocate a tall array, like V or W. If
+ *    outOfCoreDir is set, the array is a file mapped in memory; the kernels
+ *    that stream the rows of the array read ahead and write back the rows
+ *    with Mem_stream_rows.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * n        Number of elements
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * x        Allocated array; free it with Num_free_Sprimme
+ *
+ ******************************************************************************/
+
+STATIC int malloc_basis(PRIMME_INT n, SCALAR **x, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   if (!primme->outOfCoreDir) return Num_malloc_Sprimme(n, x, ctx);
+
+   CHKERRM(!IMPL(1, 0), PRIMME_FUNCTION_UNAVAILABLE,
+         "Out-of-core arrays are not supported on GPUs");
+
+   /* Allocate memory and register the allocation, as Num_malloc_Sprimme */
+
+   Mem_keep_frame(ctx);
+   return Mem_map(
+         sizeof(SCALAR) * (size_t)n, primme->outOfCoreDir, (void **)x, ctx);
+}
+
 /******************************************************************************
           Some basic functions within the scope of main_iter
 *******************************************************************************/
@@ -1428,6 +1878,10 @@ clean:
  * W              A*V
  * BV             B*V
  * nLocal         Local length of vectors in the basis
+ * H              The projection V'*A*V
+ * ldH            The leading dimension of H
+ * WtW            If not NULL, W'*W used to estimate the residual norms
+ * ldWtW          The leading dimension of WtW
  * basisSize      Size of the basis V and W
  * ldV            The leading dimension of V and X
  * ldW            The leading dimension of W and R
@@ -1469,7 +1923,7 @@ clean:
 
 STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
       PRIMME_INT ldW, SCALAR *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      HSCALAR *H, int ldH, int basisSize, SCALAR *X, SCALAR *R, SCALAR *BX,
+      HSCALAR *H, int ldH, HSCALAR *WtW, int ldWtW, int basisSize, SCALAR *X, SCALAR *R, SCALAR *BX,
       int computeXR, HSCALAR *hVecs, int ldhVecs, HEVAL *hVals, HREAL *hSVals,
       int *flags, int remainedEvals, HREAL *blockNorms, int blockNormsSize,
       int maxBlockSize, SCALAR *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -1520,7 +1974,7 @@ STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
    /* Assign to each eigenpair a pair from previous iteration that is close in
     * angle */
 
-   if (ctx.procID == 0) {
+   if (ctx.procID == 0 || ctx.commReduce) {
       CHKERR(map_vecs_SHprimme(prevhVecs, basisSize, nprevhVecs, ldprevhVecs,
             hVecs, 0, basisSize, ldhVecs, map, ctx));
    }
@@ -1671,7 +2125,7 @@ STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
                NULL, 0, 0, 0,
                NULL, 0, 0, 0,
                NULL, 0, 0, 0,
-               R?&R[(*blockSize)*ldV]:NULL, 0, computeXR?blockNormsSize:0, ldV, computeXR?&blockNorms[*blockSize]:NULL,
+               R?&R[(*blockSize)*ldV]:NULL, 0, computeXR?blockNormsSize:0, ldV, computeXR&&!WtW?&blockNorms[*blockSize]:NULL,
                BX?&BX[(*blockSize)*ldV]:NULL, 0, BX?blockNormsSize:0, ldV,
                NULL, 0, 0, 0,
                NULL, 0, 0, 0,
@@ -1681,6 +2135,14 @@ STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
                XNorms?&XNorms[*blockSize]:NULL, 0, primme->massMatrixMatvec?blockNormsSize:0,
                ctx));
 
+      /* Estimate the residual norms from WtW, if given */
+
+      if (computeXR && WtW) {
+         CHKERR(estimate_residual_norms(&R[(*blockSize) * ldV], ldV, nLocal,
+               WtW, ldWtW, basisSize, hVecsBlock, ldhVecs, hValsBlock,
+               blockNormsSize, &blockNorms[*blockSize], ctx));
+      }
+
       /* Don't trust residual norm smaller than the error in the residual norm */
 
       for (i = *blockSize; i < blockNormsSize; i++) {
@@ -1708,6 +2170,82 @@ STATIC int prepare_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine estimate_residual_norms - Compute the residual norms of the Ritz
+ *    pairs (hVals(i), V*hVecs(:,i)) from W'*W without communications, as
+ *
+ *       |W*h - hVal*V*h|^2 = h'*W'*W*h - hVal^2,
+ *
+ *    which holds if V'*V = I, H*h = hVal*h and |h| = 1. The expression
+ *    suffers from cancellation for small residual norms; in that case the norm
+ *    is computed from R instead. All processes take the same decisions because
+ *    WtW, hVecs and hVals are the same in all of them.
+ * 
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * R              The residual vectors
+ * ldR            The leading dimension of R
+ * nLocal         Local length of the vectors in R
+ * WtW            The upper triangular portion of W'*W
+ * ldWtW          The leading dimension of WtW
+ * basisSize      The number of rows in hVecs
+ * hVecs          The coefficient vectors of the Ritz vectors
+ * ldhVecs        The leading dimension of hVecs
+ * hVals          The Ritz values
+ * n              The number of pairs
+ *
+ * OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------
+ * norms          The residual norms
+ * 
+ ******************************************************************************/
+
+STATIC int estimate_residual_norms(SCALAR *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, HSCALAR *WtW, int ldWtW, int basisSize,
+      HSCALAR *hVecs, int ldhVecs, HEVAL *hVals, int n, HREAL *norms,
+      primme_context ctx) {
+
+   int i, k;
+
+   if (n <= 0) return 0;
+
+   /* WtWh = WtW*hVecs */
+
+   HSCALAR *WtWh;
+   CHKERR(Num_malloc_SHprimme(basisSize * n, &WtWh, ctx));
+   CHKERR(Num_hemm_SHprimme("L", "U", basisSize, n, 1.0, WtW, ldWtW, hVecs,
+         ldhVecs, 0.0, WtWh, basisSize, ctx));
+
+   /* norms(i)^2 = hVecs(:,i)'*WtWh(:,i) - hVals(i)^2; if the cancellation */
+   /* may have ruined the result, compute R(:,i)'*R(:,i) instead           */
+
+   int *iexp;        /* indices of the norms computed explicitly */
+   HREAL *nexp;      /* squared norms computed explicitly */
+   CHKERR(Num_malloc_iprimme(n, &iexp, ctx));
+   CHKERR(Num_malloc_RHprimme(n, &nexp, ctx));
+   for (i = k = 0; i < n; i++) {
+      HREAL hWtWh = REAL_PART(Num_dot_SHprimme(
+            basisSize, &hVecs[ldhVecs * i], 1, &WtWh[basisSize * i], 1, ctx));
+      HREAL hVal = EVAL_ABS(hVals[i]);
+      HREAL r2 = hWtWh - hVal * hVal;
+      if (r2 > hWtWh * MACHINE_EPSILON * 1e4) {
+         norms[i] = sqrt(r2);
+      } else {
+         iexp[k] = i;
+         nexp[k++] = REAL_PART(
+               Num_dot_Sprimme(nLocal, &R[ldR * i], 1, &R[ldR * i], 1, ctx));
+      }
+   }
+   if (k > 0) CHKERR(globalSum_RHprimme(nexp, k, ctx));
+   for (i = 0; i < k; i++) norms[iexp[i]] = sqrt(nexp[i]);
+
+   CHKERR(Num_free_SHprimme(WtWh, ctx));
+   CHKERR(Num_free_iprimme(iexp, ctx));
+   CHKERR(Num_free_RHprimme(nexp, ctx));
+
+   return 0;
+}
+
 /*******************************************************************************
  * Subroutine copy_back_candidates - This subroutine copy into evecs, evals
  *    and resNorms unconverged Ritz pairs, up to numEvals. The uninitalized
@@ -1754,9 +2292,10 @@ STATIC int copy_back_candidates(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
 
    primme_params *primme = ctx.primme;
 
-   // Quick exit
+   // Quick exit; the locked pairs are already in evecs
 
    if (numConverged >= primme->numEvals || basisSize <= 0) {
+      *numRet = numConverged;
       return 0;
    }
 
@@ -1894,6 +2433,130 @@ STATIC int verify_norms(SCALAR *V, PRIMME_INT ldV, SCALAR *W, PRIMME_INT ldW,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutines *_workspace - Take from the dry arena of the context the same
+ *    blocks that the function without the suffix takes with the given sizes.
+ *    The flags withX tell whether the optional array X of the function is
+ *    given. See main_iter_workspace.
+ ******************************************************************************/
+
+STATIC int malloc_basis_workspace(PRIMME_INT n, SCALAR **x,
+      primme_context ctx) {
+
+   /* The out-of-core arrays are not in the arena */
+
+   if (ctx.primme->outOfCoreDir) {
+      *x = NULL;
+      return 0;
+   }
+   return Num_malloc_Sprimme(n, x, ctx);
+}
+
+/* update_Q_workspace for any block of columns b1:b2 of Q with b2 < n and */
+/* at most maxnX columns. For a number of columns, the blocks taken grow  */
+/* with b1.                                                               */
+
+STATIC int update_Q_range_workspace(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx) {
+
+   int nX;
+   for (nX = 1; nX <= min(n, maxnX); nX++) {
+      CHKERR(update_Q_workspace_Sprimme(withR, withQtQ, nX, n - nX, ctx));
+   }
+
+   return 0;
+}
+
+STATIC int prepare_candidates_workspace(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   HEVAL *hValsBlock0;
+   HSCALAR *hVecsBlock0;
+   int *flagsBlock;
+   HREAL *XNorms = NULL;
+   CHKERR(KIND(Num_malloc_RHprimme, Num_malloc_SHprimme)(
+         maxBlockSize, &hValsBlock0, ctx));
+   CHKERR(Num_malloc_SHprimme(basisSize * maxBlockSize, &hVecsBlock0, ctx));
+   CHKERR(Num_malloc_iprimme(maxBlockSize, &flagsBlock, ctx));
+   if (primme->massMatrixMatvec) {
+      CHKERR(Num_malloc_RHprimme(maxBlockSize, &XNorms, ctx));
+   }
+
+   if (ctx.procID == 0 || ctx.commReduce) {
+      CHKERR(map_vecs_workspace_SHprimme(basisSize, 0, basisSize, ctx));
+   }
+   CHKERR(broadcast_workspace_Tprimme(primme_op_int, basisSize, ctx));
+   CHKERR(permute_vecs_workspace_iprimme(basisSize, ctx));
+
+   CHKERR(check_convergence_workspace_Sprimme(computeXR, computeXR, withVtBV,
+         numLocked, maxBlockSize, 0, ctx));
+   CHKERR(monitorFun_workspace_Sprimme(basisSize, 0, ctx));
+   CHKERR(prepare_vecs_workspace_SHprimme(basisSize, maxBlockSize, ctx));
+   CHKERR(Num_update_VWXR_workspace_Sprimme(primme->nLocal, maxBlockSize,
+         maxBlockSize, primme->massMatrixMatvec ? maxBlockSize : 0, 0,
+         maxBlockSize * (primme->massMatrixMatvec ? 2 : 1), ctx));
+   if (computeXR && withWtW) {
+      CHKERR(estimate_residual_norms_workspace(
+            basisSize, maxBlockSize, ctx));
+   }
+
+   CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(hValsBlock0, ctx));
+   CHKERR(Num_free_SHprimme(hVecsBlock0, ctx));
+   CHKERR(Num_free_iprimme(flagsBlock, ctx));
+   CHKERR(Num_free_RHprimme(XNorms, ctx));
+
+   return 0;
+}
+
+STATIC int estimate_residual_norms_workspace(
+      int basisSize, int n, primme_context ctx) {
+
+   if (n <= 0) return 0;
+
+   HSCALAR *WtWh;
+   int *iexp;
+   HREAL *nexp;
+   CHKERR(Num_malloc_SHprimme(basisSize * n, &WtWh, ctx));
+   CHKERR(Num_malloc_iprimme(n, &iexp, ctx));
+   CHKERR(Num_malloc_RHprimme(n, &nexp, ctx));
+   CHKERR(globalSum_workspace_RHprimme(n, ctx));
+   CHKERR(Num_free_SHprimme(WtWh, ctx));
+   CHKERR(Num_free_iprimme(iexp, ctx));
+   CHKERR(Num_free_RHprimme(nexp, ctx));
+
+   return 0;
+}
+
+STATIC int copy_back_candidates_workspace(
+      int basisSize, int withVtBV, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   if (primme->projectionParams.projection != primme_proj_RR &&
+         primme->numTargetShifts > 0) {
+      CHKERR(solve_H_RR_workspace_SHprimme(
+            basisSize, withVtBV, primme->target, ctx));
+   }
+   int blockSize = min(primme->numEvals, basisSize);
+   CHKERR(Num_update_VWXR_workspace_Sprimme(primme->nLocal, blockSize,
+         blockSize, primme->massMatrixMatvec ? blockSize : 0, 0, blockSize,
+         ctx));
+
+   return 0;
+}
+
+STATIC int verify_norms_workspace(int basisSize, primme_context ctx) {
+
+   CHKERR(globalSum_workspace_RHprimme(basisSize, ctx));
+   CHKERR(check_convergence_workspace_Sprimme(
+         1 /* X */, 1 /* R */, 0, 0, basisSize, 0, ctx));
+
+   return 0;
+}
+
 /******************************************************************************
            Dynamic Method Switching uses the following functions 
     ---------------------------------------------------------------------
@@ -126,12 +126,107 @@
 int main_iter_dprimme(dummy_type_dprimme *evals, dummy_type_dprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Sprimme)
+#  define main_iter_workspace_Sprimme CONCAT(main_iter_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Rprimme)
+#  define main_iter_workspace_Rprimme CONCAT(main_iter_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SHprimme)
+#  define main_iter_workspace_SHprimme CONCAT(main_iter_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RHprimme)
+#  define main_iter_workspace_RHprimme CONCAT(main_iter_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SXprimme)
+#  define main_iter_workspace_SXprimme CONCAT(main_iter_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RXprimme)
+#  define main_iter_workspace_RXprimme CONCAT(main_iter_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Shprimme)
+#  define main_iter_workspace_Shprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Rhprimme)
+#  define main_iter_workspace_Rhprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Ssprimme)
+#  define main_iter_workspace_Ssprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Rsprimme)
+#  define main_iter_workspace_Rsprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Sdprimme)
+#  define main_iter_workspace_Sdprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Rdprimme)
+#  define main_iter_workspace_Rdprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Sqprimme)
+#  define main_iter_workspace_Sqprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_Rqprimme)
+#  define main_iter_workspace_Rqprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SXhprimme)
+#  define main_iter_workspace_SXhprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RXhprimme)
+#  define main_iter_workspace_RXhprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SXsprimme)
+#  define main_iter_workspace_SXsprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RXsprimme)
+#  define main_iter_workspace_RXsprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SXdprimme)
+#  define main_iter_workspace_SXdprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RXdprimme)
+#  define main_iter_workspace_RXdprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SXqprimme)
+#  define main_iter_workspace_SXqprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RXqprimme)
+#  define main_iter_workspace_RXqprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SHhprimme)
+#  define main_iter_workspace_SHhprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RHhprimme)
+#  define main_iter_workspace_RHhprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SHsprimme)
+#  define main_iter_workspace_SHsprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RHsprimme)
+#  define main_iter_workspace_RHsprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SHdprimme)
+#  define main_iter_workspace_SHdprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RHdprimme)
+#  define main_iter_workspace_RHdprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_SHqprimme)
+#  define main_iter_workspace_SHqprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(main_iter_workspace_RHqprimme)
+#  define main_iter_workspace_RHqprimme CONCAT(main_iter_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int main_iter_workspace_dprimme(primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(malloc_basis)
+#  define malloc_basis CONCAT(malloc_basis,WITH_KIND(SCALAR_SUF))
+#endif
+int malloc_basisdprimme(PRIMME_INT n, dummy_type_dprimme **x, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(prepare_candidates)
 #  define prepare_candidates CONCAT(prepare_candidates,WITH_KIND(SCALAR_SUF))
 #endif
 int prepare_candidatesdprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *W,
       PRIMME_INT ldW, dummy_type_dprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_dprimme *H, int ldH, int basisSize, dummy_type_dprimme *X, dummy_type_dprimme *R, dummy_type_dprimme *BX,
+      dummy_type_dprimme *H, int ldH, dummy_type_dprimme *WtW, int ldWtW, int basisSize, dummy_type_dprimme *X, dummy_type_dprimme *R, dummy_type_dprimme *BX,
       int computeXR, dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_dprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -142,6 +237,13 @@ int prepare_candidatesdprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(estimate_residual_norms)
+#  define estimate_residual_norms CONCAT(estimate_residual_norms,WITH_KIND(SCALAR_SUF))
+#endif
+int estimate_residual_normsdprimme(dummy_type_dprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_dprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int n, dummy_type_dprimme *norms,
+      primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(copy_back_candidates)
 #  define copy_back_candidates CONCAT(copy_back_candidates,WITH_KIND(SCALAR_SUF))
 #endif
@@ -157,6 +259,36 @@ int copy_back_candidatesdprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normsdprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *W, PRIMME_INT ldW,
       dummy_type_dprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(malloc_basis_workspace)
+#  define malloc_basis_workspace CONCAT(malloc_basis_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int malloc_basis_workspacedprimme(PRIMME_INT n, dummy_type_dprimme **x,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_range_workspace)
+#  define update_Q_range_workspace CONCAT(update_Q_range_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int update_Q_range_workspacedprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_candidates_workspace)
+#  define prepare_candidates_workspace CONCAT(prepare_candidates_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int prepare_candidates_workspacedprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(estimate_residual_norms_workspace)
+#  define estimate_residual_norms_workspace CONCAT(estimate_residual_norms_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int estimate_residual_norms_workspacedprimme(
+      int basisSize, int n, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(copy_back_candidates_workspace)
+#  define copy_back_candidates_workspace CONCAT(copy_back_candidates_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int copy_back_candidates_workspacedprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(verify_norms_workspace)
+#  define verify_norms_workspace CONCAT(verify_norms_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int verify_norms_workspacedprimme(int basisSize, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(switch_from_JDQMR)
 #  define switch_from_JDQMR CONCAT(switch_from_JDQMR,WITH_KIND(SCALAR_SUF))
 #endif
@@ -187,9 +319,11 @@ void initializeModeldprimme(void *model_, primme_params *primme);
 int main_iter_hprimme(dummy_type_sprimme *evals, dummy_type_hprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_hprimme(primme_context ctx);
+int malloc_basishprimme(PRIMME_INT n, dummy_type_hprimme **x, primme_context ctx);
 int prepare_candidateshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
       PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_hprimme *X, dummy_type_hprimme *R, dummy_type_hprimme *BX,
+      dummy_type_sprimme *H, int ldH, dummy_type_sprimme *WtW, int ldWtW, int basisSize, dummy_type_hprimme *X, dummy_type_hprimme *R, dummy_type_hprimme *BX,
       int computeXR, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_hprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -200,6 +334,10 @@ int prepare_candidateshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normshprimme(dummy_type_hprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_sprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidateshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
       PRIMME_INT ldW, dummy_type_hprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *hVecs, int ldhVecs,
@@ -209,6 +347,18 @@ int copy_back_candidateshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normshprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W, PRIMME_INT ldW,
       dummy_type_hprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacehprimme(PRIMME_INT n, dummy_type_hprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacehprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacehprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacehprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacehprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacehprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRhprimme(void *model_, primme_context ctx);
 int switch_from_GDpkhprimme(void *model_, primme_context ctx);
 int update_statisticshprimme(void *model_, primme_params *primme,
@@ -221,9 +371,11 @@ void initializeModelhprimme(void *model_, primme_params *primme);
 int main_iter_kprimme_normal(dummy_type_cprimme *evals, dummy_type_kprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_kprimme_normal(primme_context ctx);
+int malloc_basiskprimme_normal(PRIMME_INT n, dummy_type_kprimme **x, primme_context ctx);
 int prepare_candidateskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_kprimme *X, dummy_type_kprimme *R, dummy_type_kprimme *BX,
+      dummy_type_cprimme *H, int ldH, dummy_type_cprimme *WtW, int ldWtW, int basisSize, dummy_type_kprimme *X, dummy_type_kprimme *R, dummy_type_kprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_kprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -234,6 +386,10 @@ int prepare_candidateskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dumm
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normskprimme_normal(dummy_type_kprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_cprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidateskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -243,6 +399,18 @@ int copy_back_candidateskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, du
 int verify_normskprimme_normal(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W, PRIMME_INT ldW,
       dummy_type_kprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacekprimme_normal(PRIMME_INT n, dummy_type_kprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacekprimme_normal(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacekprimme_normal(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacekprimme_normal(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacekprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacekprimme_normal(int basisSize, primme_context ctx);
 int switch_from_JDQMRkprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkkprimme_normal(void *model_, primme_context ctx);
 int update_statisticskprimme_normal(void *model_, primme_params *primme,
@@ -255,9 +423,11 @@ void initializeModelkprimme_normal(void *model_, primme_params *primme);
 int main_iter_kprimme(dummy_type_sprimme *evals, dummy_type_kprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_kprimme(primme_context ctx);
+int malloc_basiskprimme(PRIMME_INT n, dummy_type_kprimme **x, primme_context ctx);
 int prepare_candidateskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_kprimme *X, dummy_type_kprimme *R, dummy_type_kprimme *BX,
+      dummy_type_cprimme *H, int ldH, dummy_type_cprimme *WtW, int ldWtW, int basisSize, dummy_type_kprimme *X, dummy_type_kprimme *R, dummy_type_kprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_kprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -268,6 +438,10 @@ int prepare_candidateskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normskprimme(dummy_type_kprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_cprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidateskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -277,6 +451,18 @@ int copy_back_candidateskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normskprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W, PRIMME_INT ldW,
       dummy_type_kprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacekprimme(PRIMME_INT n, dummy_type_kprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacekprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacekprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacekprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacekprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacekprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRkprimme(void *model_, primme_context ctx);
 int switch_from_GDpkkprimme(void *model_, primme_context ctx);
 int update_statisticskprimme(void *model_, primme_params *primme,
@@ -289,9 +475,11 @@ void initializeModelkprimme(void *model_, primme_params *primme);
 int main_iter_sprimme(dummy_type_sprimme *evals, dummy_type_sprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_sprimme(primme_context ctx);
+int malloc_basissprimme(PRIMME_INT n, dummy_type_sprimme **x, primme_context ctx);
 int prepare_candidatessprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
       PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *X, dummy_type_sprimme *R, dummy_type_sprimme *BX,
+      dummy_type_sprimme *H, int ldH, dummy_type_sprimme *WtW, int ldWtW, int basisSize, dummy_type_sprimme *X, dummy_type_sprimme *R, dummy_type_sprimme *BX,
       int computeXR, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_sprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -302,6 +490,10 @@ int prepare_candidatessprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normssprimme(dummy_type_sprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_sprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidatessprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
       PRIMME_INT ldW, dummy_type_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *hVecs, int ldhVecs,
@@ -311,6 +503,18 @@ int copy_back_candidatessprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normssprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W, PRIMME_INT ldW,
       dummy_type_sprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacesprimme(PRIMME_INT n, dummy_type_sprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacesprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacesprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacesprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacesprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacesprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRsprimme(void *model_, primme_context ctx);
 int switch_from_GDpksprimme(void *model_, primme_context ctx);
 int update_statisticssprimme(void *model_, primme_params *primme,
@@ -323,9 +527,11 @@ void initializeModelsprimme(void *model_, primme_params *primme);
 int main_iter_cprimme_normal(dummy_type_cprimme *evals, dummy_type_cprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_cprimme_normal(primme_context ctx);
+int malloc_basiscprimme_normal(PRIMME_INT n, dummy_type_cprimme **x, primme_context ctx);
 int prepare_candidatescprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *X, dummy_type_cprimme *R, dummy_type_cprimme *BX,
+      dummy_type_cprimme *H, int ldH, dummy_type_cprimme *WtW, int ldWtW, int basisSize, dummy_type_cprimme *X, dummy_type_cprimme *R, dummy_type_cprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -336,6 +542,10 @@ int prepare_candidatescprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dumm
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normscprimme_normal(dummy_type_cprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_cprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidatescprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -345,6 +555,18 @@ int copy_back_candidatescprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, du
 int verify_normscprimme_normal(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W, PRIMME_INT ldW,
       dummy_type_cprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacecprimme_normal(PRIMME_INT n, dummy_type_cprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacecprimme_normal(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacecprimme_normal(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacecprimme_normal(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacecprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacecprimme_normal(int basisSize, primme_context ctx);
 int switch_from_JDQMRcprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkcprimme_normal(void *model_, primme_context ctx);
 int update_statisticscprimme_normal(void *model_, primme_params *primme,
@@ -357,9 +579,11 @@ void initializeModelcprimme_normal(void *model_, primme_params *primme);
 int main_iter_cprimme(dummy_type_sprimme *evals, dummy_type_cprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_cprimme(primme_context ctx);
+int malloc_basiscprimme(PRIMME_INT n, dummy_type_cprimme **x, primme_context ctx);
 int prepare_candidatescprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *X, dummy_type_cprimme *R, dummy_type_cprimme *BX,
+      dummy_type_cprimme *H, int ldH, dummy_type_cprimme *WtW, int ldWtW, int basisSize, dummy_type_cprimme *X, dummy_type_cprimme *R, dummy_type_cprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -370,6 +594,10 @@ int prepare_candidatescprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normscprimme(dummy_type_cprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_cprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidatescprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -379,6 +607,18 @@ int copy_back_candidatescprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normscprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W, PRIMME_INT ldW,
       dummy_type_cprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacecprimme(PRIMME_INT n, dummy_type_cprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacecprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacecprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacecprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacecprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacecprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRcprimme(void *model_, primme_context ctx);
 int switch_from_GDpkcprimme(void *model_, primme_context ctx);
 int update_statisticscprimme(void *model_, primme_params *primme,
@@ -391,9 +631,11 @@ void initializeModelcprimme(void *model_, primme_params *primme);
 int main_iter_zprimme_normal(dummy_type_zprimme *evals, dummy_type_zprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_zprimme_normal(primme_context ctx);
+int malloc_basiszprimme_normal(PRIMME_INT n, dummy_type_zprimme **x, primme_context ctx);
 int prepare_candidateszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *X, dummy_type_zprimme *R, dummy_type_zprimme *BX,
+      dummy_type_zprimme *H, int ldH, dummy_type_zprimme *WtW, int ldWtW, int basisSize, dummy_type_zprimme *X, dummy_type_zprimme *R, dummy_type_zprimme *BX,
       int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_zprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -404,6 +646,10 @@ int prepare_candidateszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dumm
       dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normszprimme_normal(dummy_type_zprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_zprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, int n, dummy_type_dprimme *norms,
+      primme_context ctx);
 int copy_back_candidateszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
@@ -413,6 +659,18 @@ int copy_back_candidateszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, du
 int verify_normszprimme_normal(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W, PRIMME_INT ldW,
       dummy_type_zprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacezprimme_normal(PRIMME_INT n, dummy_type_zprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacezprimme_normal(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacezprimme_normal(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacezprimme_normal(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacezprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacezprimme_normal(int basisSize, primme_context ctx);
 int switch_from_JDQMRzprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkzprimme_normal(void *model_, primme_context ctx);
 int update_statisticszprimme_normal(void *model_, primme_params *primme,
@@ -425,9 +683,11 @@ void initializeModelzprimme_normal(void *model_, primme_params *primme);
 int main_iter_zprimme(dummy_type_dprimme *evals, dummy_type_zprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_zprimme(primme_context ctx);
+int malloc_basiszprimme(PRIMME_INT n, dummy_type_zprimme **x, primme_context ctx);
 int prepare_candidateszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *X, dummy_type_zprimme *R, dummy_type_zprimme *BX,
+      dummy_type_zprimme *H, int ldH, dummy_type_zprimme *WtW, int ldWtW, int basisSize, dummy_type_zprimme *X, dummy_type_zprimme *R, dummy_type_zprimme *BX,
       int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_zprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -438,6 +698,10 @@ int prepare_candidateszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_
       dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normszprimme(dummy_type_zprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_zprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int n, dummy_type_dprimme *norms,
+      primme_context ctx);
 int copy_back_candidateszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
@@ -447,6 +711,18 @@ int copy_back_candidateszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_typ
 int verify_normszprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W, PRIMME_INT ldW,
       dummy_type_zprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacezprimme(PRIMME_INT n, dummy_type_zprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacezprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacezprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacezprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacezprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacezprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRzprimme(void *model_, primme_context ctx);
 int switch_from_GDpkzprimme(void *model_, primme_context ctx);
 int update_statisticszprimme(void *model_, primme_params *primme,
@@ -459,9 +735,11 @@ void initializeModelzprimme(void *model_, primme_params *primme);
 int main_iter_magma_hprimme(dummy_type_sprimme *evals, dummy_type_magma_hprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_magma_hprimme(primme_context ctx);
+int malloc_basismagma_hprimme(PRIMME_INT n, dummy_type_magma_hprimme **x, primme_context ctx);
 int prepare_candidatesmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
       PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_magma_hprimme *X, dummy_type_magma_hprimme *R, dummy_type_magma_hprimme *BX,
+      dummy_type_sprimme *H, int ldH, dummy_type_sprimme *WtW, int ldWtW, int basisSize, dummy_type_magma_hprimme *X, dummy_type_magma_hprimme *R, dummy_type_magma_hprimme *BX,
       int computeXR, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_hprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -472,6 +750,10 @@ int prepare_candidatesmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV,
       dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normsmagma_hprimme(dummy_type_magma_hprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_sprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidatesmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
       PRIMME_INT ldW, dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *hVecs, int ldhVecs,
@@ -481,6 +763,18 @@ int copy_back_candidatesmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ld
 int verify_normsmagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W, PRIMME_INT ldW,
       dummy_type_magma_hprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacemagma_hprimme(PRIMME_INT n, dummy_type_magma_hprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacemagma_hprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacemagma_hprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacemagma_hprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacemagma_hprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacemagma_hprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRmagma_hprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_hprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_hprimme(void *model_, primme_params *primme,
@@ -493,9 +787,11 @@ void initializeModelmagma_hprimme(void *model_, primme_params *primme);
 int main_iter_magma_kprimme_normal(dummy_type_cprimme *evals, dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_magma_kprimme_normal(primme_context ctx);
+int malloc_basismagma_kprimme_normal(PRIMME_INT n, dummy_type_magma_kprimme **x, primme_context ctx);
 int prepare_candidatesmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_magma_kprimme *X, dummy_type_magma_kprimme *R, dummy_type_magma_kprimme *BX,
+      dummy_type_cprimme *H, int ldH, dummy_type_cprimme *WtW, int ldWtW, int basisSize, dummy_type_magma_kprimme *X, dummy_type_magma_kprimme *R, dummy_type_magma_kprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_kprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -506,6 +802,10 @@ int prepare_candidatesmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_I
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normsmagma_kprimme_normal(dummy_type_magma_kprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_cprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidatesmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -515,6 +815,18 @@ int copy_back_candidatesmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME
 int verify_normsmagma_kprimme_normal(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W, PRIMME_INT ldW,
       dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacemagma_kprimme_normal(PRIMME_INT n, dummy_type_magma_kprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacemagma_kprimme_normal(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacemagma_kprimme_normal(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacemagma_kprimme_normal(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacemagma_kprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacemagma_kprimme_normal(int basisSize, primme_context ctx);
 int switch_from_JDQMRmagma_kprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_kprimme_normal(void *model_, primme_context ctx);
 int update_statisticsmagma_kprimme_normal(void *model_, primme_params *primme,
@@ -527,9 +839,11 @@ void initializeModelmagma_kprimme_normal(void *model_, primme_params *primme);
 int main_iter_magma_kprimme(dummy_type_sprimme *evals, dummy_type_magma_kprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_magma_kprimme(primme_context ctx);
+int malloc_basismagma_kprimme(PRIMME_INT n, dummy_type_magma_kprimme **x, primme_context ctx);
 int prepare_candidatesmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_magma_kprimme *X, dummy_type_magma_kprimme *R, dummy_type_magma_kprimme *BX,
+      dummy_type_cprimme *H, int ldH, dummy_type_cprimme *WtW, int ldWtW, int basisSize, dummy_type_magma_kprimme *X, dummy_type_magma_kprimme *R, dummy_type_magma_kprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_kprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -540,6 +854,10 @@ int prepare_candidatesmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV,
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normsmagma_kprimme(dummy_type_magma_kprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_cprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidatesmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -549,6 +867,18 @@ int copy_back_candidatesmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ld
 int verify_normsmagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W, PRIMME_INT ldW,
       dummy_type_magma_kprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacemagma_kprimme(PRIMME_INT n, dummy_type_magma_kprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacemagma_kprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacemagma_kprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacemagma_kprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacemagma_kprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacemagma_kprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRmagma_kprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_kprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_kprimme(void *model_, primme_params *primme,
@@ -561,9 +891,11 @@ void initializeModelmagma_kprimme(void *model_, primme_params *primme);
 int main_iter_magma_sprimme(dummy_type_sprimme *evals, dummy_type_magma_sprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_magma_sprimme(primme_context ctx);
+int malloc_basismagma_sprimme(PRIMME_INT n, dummy_type_magma_sprimme **x, primme_context ctx);
 int prepare_candidatesmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
       PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_magma_sprimme *X, dummy_type_magma_sprimme *R, dummy_type_magma_sprimme *BX,
+      dummy_type_sprimme *H, int ldH, dummy_type_sprimme *WtW, int ldWtW, int basisSize, dummy_type_magma_sprimme *X, dummy_type_magma_sprimme *R, dummy_type_magma_sprimme *BX,
       int computeXR, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_sprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -574,6 +906,10 @@ int prepare_candidatesmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV,
       dummy_type_sprimme *VtBV, int ldVtBV, dummy_type_sprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normsmagma_sprimme(dummy_type_magma_sprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_sprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidatesmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
       PRIMME_INT ldW, dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_sprimme *H, int ldH, int basisSize, dummy_type_sprimme *hVecs, int ldhVecs,
@@ -583,6 +919,18 @@ int copy_back_candidatesmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ld
 int verify_normsmagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W, PRIMME_INT ldW,
       dummy_type_magma_sprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacemagma_sprimme(PRIMME_INT n, dummy_type_magma_sprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacemagma_sprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacemagma_sprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacemagma_sprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacemagma_sprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacemagma_sprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRmagma_sprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_sprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_sprimme(void *model_, primme_params *primme,
@@ -595,9 +943,11 @@ void initializeModelmagma_sprimme(void *model_, primme_params *primme);
 int main_iter_magma_cprimme_normal(dummy_type_cprimme *evals, dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_magma_cprimme_normal(primme_context ctx);
+int malloc_basismagma_cprimme_normal(PRIMME_INT n, dummy_type_magma_cprimme **x, primme_context ctx);
 int prepare_candidatesmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_magma_cprimme *X, dummy_type_magma_cprimme *R, dummy_type_magma_cprimme *BX,
+      dummy_type_cprimme *H, int ldH, dummy_type_cprimme *WtW, int ldWtW, int basisSize, dummy_type_magma_cprimme *X, dummy_type_magma_cprimme *R, dummy_type_magma_cprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -608,6 +958,10 @@ int prepare_candidatesmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_I
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normsmagma_cprimme_normal(dummy_type_magma_cprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_cprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidatesmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -617,6 +971,18 @@ int copy_back_candidatesmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME
 int verify_normsmagma_cprimme_normal(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W, PRIMME_INT ldW,
       dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, dummy_type_cprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacemagma_cprimme_normal(PRIMME_INT n, dummy_type_magma_cprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacemagma_cprimme_normal(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacemagma_cprimme_normal(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacemagma_cprimme_normal(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacemagma_cprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacemagma_cprimme_normal(int basisSize, primme_context ctx);
 int switch_from_JDQMRmagma_cprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_cprimme_normal(void *model_, primme_context ctx);
 int update_statisticsmagma_cprimme_normal(void *model_, primme_params *primme,
@@ -629,9 +995,11 @@ void initializeModelmagma_cprimme_normal(void *model_, primme_params *primme);
 int main_iter_magma_cprimme(dummy_type_sprimme *evals, dummy_type_magma_cprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_sprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_magma_cprimme(primme_context ctx);
+int malloc_basismagma_cprimme(PRIMME_INT n, dummy_type_magma_cprimme **x, primme_context ctx);
 int prepare_candidatesmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_magma_cprimme *X, dummy_type_magma_cprimme *R, dummy_type_magma_cprimme *BX,
+      dummy_type_cprimme *H, int ldH, dummy_type_cprimme *WtW, int ldWtW, int basisSize, dummy_type_magma_cprimme *X, dummy_type_magma_cprimme *R, dummy_type_magma_cprimme *BX,
       int computeXR, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_sprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_cprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -642,6 +1010,10 @@ int prepare_candidatesmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV,
       dummy_type_cprimme *VtBV, int ldVtBV, dummy_type_cprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normsmagma_cprimme(dummy_type_magma_cprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_cprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals, int n, dummy_type_sprimme *norms,
+      primme_context ctx);
 int copy_back_candidatesmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_cprimme *H, int ldH, int basisSize, dummy_type_cprimme *hVecs, int ldhVecs,
@@ -651,6 +1023,18 @@ int copy_back_candidatesmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ld
 int verify_normsmagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W, PRIMME_INT ldW,
       dummy_type_magma_cprimme *BV, PRIMME_INT ldBV, dummy_type_sprimme *hVals, int basisSize, dummy_type_sprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacemagma_cprimme(PRIMME_INT n, dummy_type_magma_cprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacemagma_cprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacemagma_cprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacemagma_cprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacemagma_cprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacemagma_cprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRmagma_cprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_cprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_cprimme(void *model_, primme_params *primme,
@@ -663,9 +1047,11 @@ void initializeModelmagma_cprimme(void *model_, primme_params *primme);
 int main_iter_magma_dprimme(dummy_type_dprimme *evals, dummy_type_magma_dprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_magma_dprimme(primme_context ctx);
+int malloc_basismagma_dprimme(PRIMME_INT n, dummy_type_magma_dprimme **x, primme_context ctx);
 int prepare_candidatesmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
       PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_dprimme *H, int ldH, int basisSize, dummy_type_magma_dprimme *X, dummy_type_magma_dprimme *R, dummy_type_magma_dprimme *BX,
+      dummy_type_dprimme *H, int ldH, dummy_type_dprimme *WtW, int ldWtW, int basisSize, dummy_type_magma_dprimme *X, dummy_type_magma_dprimme *R, dummy_type_magma_dprimme *BX,
       int computeXR, dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_dprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -676,6 +1062,10 @@ int prepare_candidatesmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV,
       dummy_type_dprimme *VtBV, int ldVtBV, dummy_type_dprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normsmagma_dprimme(dummy_type_magma_dprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_dprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_dprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int n, dummy_type_dprimme *norms,
+      primme_context ctx);
 int copy_back_candidatesmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
       PRIMME_INT ldW, dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_dprimme *H, int ldH, int basisSize, dummy_type_dprimme *hVecs, int ldhVecs,
@@ -685,6 +1075,18 @@ int copy_back_candidatesmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ld
 int verify_normsmagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W, PRIMME_INT ldW,
       dummy_type_magma_dprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacemagma_dprimme(PRIMME_INT n, dummy_type_magma_dprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacemagma_dprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacemagma_dprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacemagma_dprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacemagma_dprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacemagma_dprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRmagma_dprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_dprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_dprimme(void *model_, primme_params *primme,
@@ -697,9 +1099,11 @@ void initializeModelmagma_dprimme(void *model_, primme_params *primme);
 int main_iter_magma_zprimme_normal(dummy_type_zprimme *evals, dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_magma_zprimme_normal(primme_context ctx);
+int malloc_basismagma_zprimme_normal(PRIMME_INT n, dummy_type_magma_zprimme **x, primme_context ctx);
 int prepare_candidatesmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_magma_zprimme *X, dummy_type_magma_zprimme *R, dummy_type_magma_zprimme *BX,
+      dummy_type_zprimme *H, int ldH, dummy_type_zprimme *WtW, int ldWtW, int basisSize, dummy_type_magma_zprimme *X, dummy_type_magma_zprimme *R, dummy_type_magma_zprimme *BX,
       int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_zprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -710,6 +1114,10 @@ int prepare_candidatesmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_I
       dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normsmagma_zprimme_normal(dummy_type_magma_zprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_zprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals, int n, dummy_type_dprimme *norms,
+      primme_context ctx);
 int copy_back_candidatesmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
@@ -719,6 +1127,18 @@ int copy_back_candidatesmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME
 int verify_normsmagma_zprimme_normal(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W, PRIMME_INT ldW,
       dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, dummy_type_zprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacemagma_zprimme_normal(PRIMME_INT n, dummy_type_magma_zprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacemagma_zprimme_normal(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacemagma_zprimme_normal(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacemagma_zprimme_normal(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacemagma_zprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacemagma_zprimme_normal(int basisSize, primme_context ctx);
 int switch_from_JDQMRmagma_zprimme_normal(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_zprimme_normal(void *model_, primme_context ctx);
 int update_statisticsmagma_zprimme_normal(void *model_, primme_params *primme,
@@ -731,9 +1151,11 @@ void initializeModelmagma_zprimme_normal(void *model_, primme_params *primme);
 int main_iter_magma_zprimme(dummy_type_dprimme *evals, dummy_type_magma_zprimme *evecs, PRIMME_INT ldevecs,
       dummy_type_dprimme *resNorms, double startTime, int *ret, int *numRet,
       primme_context ctx);
+int main_iter_workspace_magma_zprimme(primme_context ctx);
+int malloc_basismagma_zprimme(PRIMME_INT n, dummy_type_magma_zprimme **x, primme_context ctx);
 int prepare_candidatesmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
-      dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_magma_zprimme *X, dummy_type_magma_zprimme *R, dummy_type_magma_zprimme *BX,
+      dummy_type_zprimme *H, int ldH, dummy_type_zprimme *WtW, int ldWtW, int basisSize, dummy_type_magma_zprimme *X, dummy_type_magma_zprimme *R, dummy_type_magma_zprimme *BX,
       int computeXR, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals,
       int *flags, int remainedEvals, dummy_type_dprimme *blockNorms, int blockNormsSize,
       int maxBlockSize, dummy_type_magma_zprimme *evecs, int numLocked, PRIMME_INT ldevecs,
@@ -744,6 +1166,10 @@ int prepare_candidatesmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV,
       dummy_type_zprimme *VtBV, int ldVtBV, dummy_type_zprimme *prevhVecs, int nprevhVecs,
       int ldprevhVecs, int practConvChecking, int *map, double startTime,
       primme_context ctx);
+int estimate_residual_normsmagma_zprimme(dummy_type_magma_zprimme *R, PRIMME_INT ldR,
+      PRIMME_INT nLocal, dummy_type_zprimme *WtW, int ldWtW, int basisSize,
+      dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals, int n, dummy_type_dprimme *norms,
+      primme_context ctx);
 int copy_back_candidatesmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, PRIMME_INT nLocal,
       dummy_type_zprimme *H, int ldH, int basisSize, dummy_type_zprimme *hVecs, int ldhVecs,
@@ -753,6 +1179,18 @@ int copy_back_candidatesmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ld
 int verify_normsmagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W, PRIMME_INT ldW,
       dummy_type_magma_zprimme *BV, PRIMME_INT ldBV, dummy_type_dprimme *hVals, int basisSize, dummy_type_dprimme *resNorms,
       int *flags, int *numConverged, primme_context ctx);
+int malloc_basis_workspacemagma_zprimme(PRIMME_INT n, dummy_type_magma_zprimme **x,
+      primme_context ctx);
+int update_Q_range_workspacemagma_zprimme(int withR, int withQtQ, int n, int maxnX,
+      primme_context ctx);
+int prepare_candidates_workspacemagma_zprimme(int basisSize, int maxBlockSize,
+      int computeXR, int withWtW, int withVtBV, int numLocked,
+      primme_context ctx);
+int estimate_residual_norms_workspacemagma_zprimme(
+      int basisSize, int n, primme_context ctx);
+int copy_back_candidates_workspacemagma_zprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int verify_norms_workspacemagma_zprimme(int basisSize, primme_context ctx);
 int switch_from_JDQMRmagma_zprimme(void *model_, primme_context ctx);
 int switch_from_GDpkmagma_zprimme(void *model_, primme_context ctx);
 int update_statisticsmagma_zprimme(void *model_, primme_params *primme,
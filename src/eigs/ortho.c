@@ -174,6 +174,15 @@ int Bortho_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *R, int ldR,
    double eps_orth;
    CHKERR(machineEpsOrth_Sprimme(&eps_orth, ctx));
 
+   /* If fused, every orthogonalization pass does a single reduction: the    */
+   /* norm of the vector is reduced together with the overlaps, the norm     */
+   /* after the pass is obtained from them, and the check for loss of all    */
+   /* digits is delayed to the next pass. With primme_orth_dcgs2 this is    */
+   /* used for the vectors that main_iter cannot delay (see ortho_dcgs2).    */
+
+   int fused = ctx.commReduce ||
+               (primme && primme->orth == primme_orth_dcgs2);
+
    for(i=b1; i <= b2; i++) {
     
       int nOrth;  // number of orthogonalizations of the current vector
@@ -224,9 +233,11 @@ int Bortho_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *R, int ldR,
          }
 
          // Compute the B norm of the current vector, V[i], if it wasn't computed
-         // in previous iteration
+         // in previous iteration. With commReduce or primme_orth_dcgs2 it
+         // is always computed here, and it is reduced together with the
+         // overlaps
 
-         if (nOrth == 1) {
+         if (nOrth == 1 || fused) {
             s02 = REAL_PART(Num_dot_Sprimme(nLocal, &V[ldV*i], 1, Bx, 1, ctx));
             if (primme) primme->stats.numOrthoInnerProds += 1;
          }
@@ -277,28 +288,56 @@ int Bortho_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *R, int ldR,
          if (nOrth == 1) {
             s0 = sqrt(s02 = REAL_PART(overlaps[i+numLocked]));
          }
+         else if (fused) {
+            /* The norm before this iteration is the norm after the previous */
+            /* one. Check here if the previous iteration lost all digits.    */
 
-         /* Compute the norm s1 explicitly */
-         
-         if (B) {
-            CHKERR(B(&V[ldV*i], ldV, Bx, nLocal, 1, Bctx));
-            Bx_update = 1;
+            HREAL s0prev = s0;
+            s0 = sqrt(s02 = REAL_PART(overlaps[i+numLocked]));
+            if (s0 <= eps_orth * s0prev) {
+               PRINTF(5, "Vector %d lost all significant digits in ortho",
+                     i - b1);
+               nOrth = maxNumOrthos;
+               continue;
+            }
+         }
+
+         if (fused) {
+            /* Save a reduction by computing the norm s1 from the overlaps:   */
+            /* s1^2 = s0^2 - |overlaps|^2. The cancellation is harmless when  */
+            /* s1 > tol*s0; otherwise the vector is orthogonalized again and  */
+            /* the norm is computed explicitly in the next iteration.         */
+
+            s12 = s02 - REAL_PART(Num_dot_SHprimme(i + numLocked, overlaps, 1,
+                              overlaps, 1, ctx));
+            s1 = sqrt(max(s12, 0.0));
+         }
+         else {
+            /* Compute the norm s1 explicitly */
+
+            if (B) {
+               CHKERR(B(&V[ldV*i], ldV, Bx, nLocal, 1, Bctx));
+               Bx_update = 1;
+            }
+            s12 = REAL_PART(
+                  Num_dot_Sprimme(nLocal, &V[ldV * i], 1, Bx, 1, ctx));
+            if (primme) primme->stats.numOrthoInnerProds += 1;
+            CHKERR(globalSum_RHprimme(&s12, 1, ctx));
+            s1 = sqrt(s12);
          }
-         s12 = REAL_PART(
-               Num_dot_Sprimme(nLocal, &V[ldV * i], 1, Bx, 1, ctx));
-         if (primme) primme->stats.numOrthoInnerProds += 1;
-         CHKERR(globalSum_RHprimme(&s12, 1, ctx));
-         s1 = sqrt(s12);
 
-         if (!ISFINITE(s0) || !ISFINITE(s1) || s1 <= eps_orth * s0) {
+         if (!ISFINITE(s0) || !ISFINITE(s1) ||
+               (!fused && s1 <= eps_orth * s0)) {
             PRINTF(5, "Vector %d lost all significant digits in ortho",
                   i - b1);
             nOrth = maxNumOrthos;
          }
          else if (s1 <= tol*s0 || (!primme && nOrth < maxNumOrthos)) {
             /* No numerical benefit in normalizing the vector before reortho */
-            s0 = s1;
-            s02 = s12;
+            if (!fused) {
+               s0 = s1;
+               s02 = s12;
+            }
          }
          else {
             if (updateR && R) R[ldR * i + i] = s1;
@@ -370,6 +409,88 @@ int ortho_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *R, int ldR, int b1, int b2
    return b2_out == b2+1 ? 0 : -3;
 }
 
+/**********************************************************************
+ * Function ortho_dcgs2 - First pass of the delayed classical Gram-Schmidt
+ * with reorthogonalization (DCGS2) on the vector V(:,b),
+ *
+ *    V(:,b) = V(:,b) - V(:,0:b-1)*V(:,0:b-1)'*V(:,b),
+ *
+ * with a single reduction for the overlaps and the norm of the vector.
+ * The second pass and the normalization are delayed to the next reduction,
+ * which update_projection_dcgs2 does together with the update of H.
+ *
+ * The vector is scaled by the norm after the pass estimated from the
+ * overlaps, s1^2 = s0^2 - |overlaps|^2. The relative error of s1 is
+ * O(machEps*(s0/s1)^2) (see the notes at the top of this file), and a
+ * second pass is enough only if the first one did not lose too many
+ * digits. So if s1 <= 1e2*sqrt(machEps)*s0, with the machine epsilon
+ * from machineEpsOrth, the vector is not delayed, and the caller should
+ * orthogonalize it again with Bortho_gen.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * ldV        Leading dimension of the basis
+ * b          Index of the vector to orthogonalize
+ * nLocal     Number of rows of each vector stored on this node
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * V          Basis vectors
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * delayed    1 if update_projection_dcgs2 should do the second pass;
+ *            0 if the vector should be orthogonalized with Bortho_gen
+ *
+ **********************************************************************/
+
+TEMPLATE_PLEASE
+int ortho_dcgs2_Sprimme(SCALAR *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   double t0 = primme_wTimer();
+   PRIMME_INT numGlobalSum0 = primme ? primme->stats.numGlobalSum : 0;
+
+   /* overlaps = V(:,0:b)'*V(:,b); the last one is s0^2 */
+
+   HSCALAR *overlaps;
+   CHKERR(Num_malloc_SHprimme(b + 1, &overlaps, ctx));
+   Num_zero_matrix_SHprimme(overlaps, 1, b + 1, 1, ctx);
+   CHKERR(Num_gemv_ddh_Sprimme("C", nLocal, b + 1, 1.0, V, ldV, &V[ldV * b],
+         1, 0.0, overlaps, 1, ctx));
+   CHKERR(globalSum_SHprimme(overlaps, b + 1, ctx));
+
+   HREAL s02 = REAL_PART(overlaps[b]);
+   HREAL s12 =
+         s02 - REAL_PART(Num_dot_SHprimme(b, overlaps, 1, overlaps, 1, ctx));
+   double eps_orth;
+   CHKERR(machineEpsOrth_Sprimme(&eps_orth, ctx));
+   *delayed = ISFINITE(s12) && s12 > 1e4 * eps_orth * s02;
+
+   /* V(:,b) = (V(:,b) - V(:,0:b-1)*overlaps(0:b-1)) / s1 */
+
+   if (b > 0) {
+      CHKERR(Num_gemv_dhd_Sprimme("N", nLocal, b, -1.0, V, ldV, overlaps, 1,
+            1.0, &V[ldV * b], 1, ctx));
+   }
+   if (*delayed) {
+      CHKERR(Num_scal_Sprimme(nLocal, 1.0 / sqrt(s12), &V[ldV * b], 1, ctx));
+   }
+
+   CHKERR(Num_free_SHprimme(overlaps, ctx));
+
+   if (primme) {
+      primme->stats.numOrthoInnerProds += 2 * b + 1;
+      primme->stats.numOrthoVectors += 1;
+      primme->stats.numOrthoGlobalSum +=
+            primme->stats.numGlobalSum - numGlobalSum0;
+      primme->stats.timeOrtho += primme_wTimer() - t0;
+   }
+
+   return 0;
+}
+
 #ifdef USE_HOST
 
 #ifndef ORTHO__PRIVATE_H
@@ -402,6 +523,7 @@ int Bortho_local_Sprimme(HSCALAR *V, int ldV, HSCALAR *R,
    ctx.numProcs = 1;
    ctx.procID = 0;
    ctx.mpicomm = NULL;
+   ctx.commReduce = 0;
    ctx.primme = NULL;
 
    /* Call orthogonalization */
@@ -451,6 +573,281 @@ int ortho_block_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
 }
 
 
+/**********************************************************************
+ * Function Bortho_cholqr - This routine orthonormalizes
+ * a block of vectors (from b1 to including b2 in basis)
+ * against other vectors in the same array (from 0 to b1-1 in basis),
+ * against a set of locked vectors (from 0 to numLocked-1 in locked),
+ * and themselves, with block Gram-Schmidt and Cholesky QR.
+ *
+ * Every pass computes C = [locked V(0:b1-1)]'*B*X and G = X'*B*X with a
+ * single reduction, where X = V(b1:b2). The Gram matrix of X - Q*C is
+ * G - C'*C, and its Cholesky factor T gives the new X = (X - Q*C)/T.
+ * Two passes (CholQR2) produce a basis orthonormal up to machine precision
+ * if cond(X) < eps^{-1/2}. If the factorization fails or X is numerically
+ * rank deficient, G is shifted and two more passes are done (shifted
+ * CholQR3). If that happens again after a shifted pass, the block is
+ * passed to Bortho_gen, which replaces the dependent columns by random
+ * vectors.
+ *
+ * If given, the returning R and RLocked satisfy
+ *
+ *    input_V = [locked output_V] * [RLocked; R]
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * V          Basis vectors
+ * ldV        Leading dimension of the basis
+ * R          Rotations done in the basis regarding V
+ * ldR        The leading dimension of R
+ * b1, b2     Range of V columns to be orthonormalized
+ * locked     Array that holds locked vectors if they are in-core
+ * ldLocked   Leading dimension of locked
+ * numLocked  Number of vectors in locked
+ * RLocked    Rotations done in the basis regarding locked
+ * ldRLocked  The leading dimension of RLocked
+ * nLocal     Number of rows of each vector stored on this node
+ * B          Inner product
+ * Bctx       Context for function B
+ * iseed      Seeds used to generate random vectors
+ * b2_out     The number of linear independent columns
+ * ctx        primme context
+ *
+ * Return Value
+ * ------------
+ *  error code
+ * 
+ **********************************************************************/
+
+STATIC int Bortho_cholqr_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *R,
+      int ldR, int b1, int b2, SCALAR *locked, PRIMME_INT ldLocked,
+      int numLocked, HSCALAR *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(SCALAR *, PRIMME_INT, SCALAR *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int i;                   /* loop index */
+   int nX = b2 - b1 + 1;    /* number of vectors to orthogonalize */
+   int nQ = numLocked + b1; /* number of vectors to orthogonalize against */
+   int ldG = nQ + nX;       /* leading dimension of G */
+   SCALAR *X = &V[ldV * b1];
+   int maxPasses = 5;       /* more passes than that go to Bortho_gen */
+   double eps_orth;         /* machine precision of the reductions */
+   int passes;              /* number of passes to do */
+   int pass;                /* current pass */
+   int shifted = 0;         /* whether some pass has been shifted */
+
+   double t0 = primme_wTimer();
+
+   /* Zero the columns from b1 to b2 of R, and set the diagonal block to I */
+
+   HSCALAR *r = NULL; /* The diagonal block of R(b1:b2) */
+   int ldr = 0;
+
+   if (R) {
+      CHKERR(Num_zero_matrix_SHprimme(&R[ldR * b1], b2 + 1, nX, ldR, ctx));
+      r = &R[ldR * b1 + b1];
+      ldr = ldR;
+   }
+   if (RLocked) {
+      CHKERR(Num_zero_matrix_SHprimme(
+            RLocked, numLocked, nX, ldRLocked, ctx));
+      if (!r) {
+         CHKERR(Num_malloc_SHprimme(nX * nX, &r, ctx));
+         ldr = nX;
+         CHKERR(Num_zero_matrix_SHprimme(r, nX, nX, ldr, ctx));
+      }
+   }
+   if (r) {
+      for (i = 0; i < nX; i++) r[ldr * i + i] = 1.0;
+   }
+
+   /* Allocate workspace */
+
+   HSCALAR *G, *T;
+   CHKERR(Num_malloc_SHprimme(ldG * nX, &G, ctx));
+   CHKERR(Num_malloc_SHprimme(nX * nX, &T, ctx));
+   SCALAR *BX;
+   PRIMME_INT ldBX;
+   if (B) {
+      ldBX = nLocal;
+      CHKERR(Num_malloc_Sprimme(ldBX * nX, &BX, ctx));
+   } else {
+      ldBX = ldV;
+      BX = X;
+   }
+
+   CHKERR(machineEpsOrth_Sprimme(&eps_orth, ctx));
+   passes = (primme->orth == primme_orth_shifted_cholqr3) ? 3 : 2;
+   for (pass = 0; pass < passes; pass++) {
+      /* [C; G] = [locked V(0:b1-1) X]'*B*X */
+
+      if (B) CHKERR(B(X, ldV, BX, ldBX, nX, Bctx));
+      CHKERR(Num_zero_matrix_SHprimme(G, ldG, nX, ldG, ctx));
+      CHKERR(Num_gemm_ddh_Sprimme("C", "N", numLocked, nX, nLocal, 1.0,
+            locked, ldLocked, BX, ldBX, 0.0, G, ldG, ctx));
+      CHKERR(Num_gemm_ddh_Sprimme("C", "N", b1, nX, nLocal, 1.0, V, ldV, BX,
+            ldBX, 0.0, &G[numLocked], ldG, ctx));
+      CHKERR(Num_compute_gramm_ddh_Sprimme(X, nLocal, nX, ldV, BX, ldBX, 0.0,
+            &G[nQ], ldG, 1 /* Hermitian */, ctx));
+      primme->stats.numOrthoInnerProds += ldG * nX;
+      CHKERR(globalSum_SHprimme(G, ldG * nX, ctx));
+
+      /* T = chol(G - C'*C). NOTE: every process factorizes the same      */
+      /* reduced G instead of broadcasting T from the root; otherwise the */
+      /* broadcasts, which may be done with globalSum, would triple the   */
+      /* reductions per pass.                                             */
+      /* If the factorization fails or some column of X lost all its      */
+      /* significant digits, shift G (shifted CholQR3), which makes the   */
+      /* lost columns noise that the next passes orthonormalize. If that  */
+      /* also happens after a shifted pass, give up.                      */
+
+      int info = 0;
+      int shift = (primme->orth == primme_orth_shifted_cholqr3 && pass == 0);
+      while (1) {
+         CHKERR(Num_copy_matrix_SHprimme(&G[nQ], nX, nX, ldG, T, nX, ctx));
+         CHKERR(Num_gemm_SHprimme("C", "N", nX, nX, nQ, -1.0, G, ldG, G, ldG,
+               1.0, T, nX, ctx));
+         if (shift) {
+            /* s = 11*(m*n + n*(n+1))*eps*||X||^2, where ||X||^2 is */
+            /* bounded by trace(G - C'*C)                           */
+
+            HREAL trace = 0.0;
+            for (i = 0; i < nX; i++) trace += fabs(REAL_PART(T[nX * i + i]));
+            HREAL s = 11.0 * ((double)primme->n * nX + nX * (nX + 1)) *
+                      MACHINE_EPSILON * trace;
+            for (i = 0; i < nX; i++) T[nX * i + i] += s;
+         }
+         CHKERR(Num_potrf_SHprimme("U", nX, T, nX, &info, ctx));
+
+         /* The squared norm of column i after deflating Q and the previous */
+         /* columns is T(i,i)^2; it is noise if it is at the level of the   */
+         /* rounding error in G(i,i) - |C(:,i)|^2                           */
+
+         for (i = 0; info == 0 && !shift && i < nX; i++) {
+            HREAL t = REAL_PART(T[nX * i + i]);
+            if (!ISFINITE(t) || t * t <= ldG * eps_orth *
+                                         REAL_PART(G[ldG * i + nQ + i])) {
+               info = i + 1;
+            }
+         }
+         if (info == 0 || shift || shifted) break;
+         shift = 1;
+      }
+      if (info != 0) break;
+
+      /* After a shifted pass, do two more passes */
+
+      if (shift) {
+         shifted = 1;
+         passes = pass + 3;
+         if (passes > maxPasses) break;
+      }
+
+      /* X = (X - [locked V(0:b1-1)]*C)/T */
+
+      CHKERR(Num_gemm_dhd_Sprimme("N", "N", nLocal, nX, numLocked, -1.0,
+            locked, ldLocked, G, ldG, 1.0, X, ldV, ctx));
+      CHKERR(Num_gemm_dhd_Sprimme("N", "N", nLocal, nX, b1, -1.0, V, ldV,
+            &G[numLocked], ldG, 1.0, X, ldV, ctx));
+      CHKERR(Num_trsm_hd_Sprimme(
+            "R", "U", "N", "N", nLocal, nX, 1.0, T, nX, X, ldV, ctx));
+      primme->stats.numOrthoInnerProds += nQ * nX;
+
+      /* Accumulate the rotations */
+
+      CHKERR(update_R_cholqr(G, ldG, T, nX, r, ldr, R, ldR, b1, b2, RLocked,
+            ldRLocked, numLocked, ctx));
+   }
+
+   primme->stats.timeOrtho += primme_wTimer() - t0;
+
+   *b2_out = b2 + 1;
+   if (pass < passes) {
+      /* Orthogonalize the current X with Bortho_gen, and accumulate its */
+      /* rotations as well                                               */
+
+      PRINTF(5, "CholQR failed in ortho; using Gram-Schmidt instead");
+
+      HSCALAR *Rt = NULL, *RLt = NULL;
+      if (r) {
+         CHKERR(Num_malloc_SHprimme((b2 + 1) * (b2 + 1), &Rt, ctx));
+         CHKERR(Num_malloc_SHprimme(numLocked * nX, &RLt, ctx));
+      }
+      CHKERR(Bortho_gen_Sprimme(V, ldV, Rt, b2 + 1, b1, b2, locked, ldLocked,
+            numLocked, RLt, numLocked, nLocal, B, Bctx, iseed, b2_out, ctx));
+
+      /* Bortho_gen returns [RLt; Rt(0:b1-1,b1:b2)], which plays the role */
+      /* of C, and Rt(b1:b2,b1:b2), which plays the role of T             */
+
+      if (r) {
+         CHKERR(Num_zero_matrix_SHprimme(G, ldG, nX, ldG, ctx));
+         CHKERR(Num_copy_matrix_SHprimme(
+               RLt, numLocked, nX, numLocked, G, ldG, ctx));
+         CHKERR(Num_copy_matrix_SHprimme(&Rt[(b2 + 1) * b1], b1, nX, b2 + 1,
+               &G[numLocked], ldG, ctx));
+         CHKERR(Num_copy_matrix_SHprimme(
+               &Rt[(b2 + 1) * b1 + b1], nX, nX, b2 + 1, T, nX, ctx));
+         CHKERR(update_R_cholqr(G, ldG, T, nX, r, ldr, R, ldR, b1, b2,
+               RLocked, ldRLocked, numLocked, ctx));
+         CHKERR(Num_free_SHprimme(Rt, ctx));
+         CHKERR(Num_free_SHprimme(RLt, ctx));
+      }
+   }
+
+   /* Free workspaces */
+
+   if (!R && RLocked) CHKERR(Num_free_SHprimme(r, ctx));
+   CHKERR(Num_free_SHprimme(G, ctx));
+   CHKERR(Num_free_SHprimme(T, ctx));
+   if (B) CHKERR(Num_free_Sprimme(BX, ctx));
+
+   return 0;
+}
+
+/**********************************************************************
+ * Function update_R_cholqr - Accumulate the rotations of a pass of
+ *    Bortho_cholqr. If X = Q*C + Xn*T, where Q = [locked V(0:b1-1)], and
+ *    X0 = Q*S + X*r, then do S += C*r and r = T*r.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * C, ldC     The projection of X onto Q, and its leading dimension
+ * T, ldT     The upper triangular factor of Xn, and its leading dimension
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * r, ldr     The diagonal block of R, and its leading dimension
+ * R, ldR     Rotations done in the basis regarding V
+ * b1, b2     Range of V columns being orthonormalized
+ * RLocked    Rotations done in the basis regarding locked
+ * ldRLocked  The leading dimension of RLocked
+ * numLocked  Number of vectors in locked
+ *
+ **********************************************************************/
+
+STATIC int update_R_cholqr(HSCALAR *C, int ldC, HSCALAR *T, int ldT,
+      HSCALAR *r, int ldr, HSCALAR *R, int ldR, int b1, int b2,
+      HSCALAR *RLocked, int ldRLocked, int numLocked, primme_context ctx) {
+
+   int nX = b2 - b1 + 1;
+
+   if (!r) return 0;
+
+   if (RLocked) {
+      CHKERR(Num_gemm_SHprimme("N", "N", numLocked, nX, nX, 1.0, C, ldC, r,
+            ldr, 1.0, RLocked, ldRLocked, ctx));
+   }
+   if (R) {
+      CHKERR(Num_gemm_SHprimme("N", "N", b1, nX, nX, 1.0, &C[numLocked], ldC,
+            r, ldr, 1.0, &R[ldR * b1], ldR, ctx));
+   }
+   CHKERR(Num_trmm_SHprimme(
+         "L", "U", "N", "N", nX, nX, 1.0, T, ldT, r, ldr, ctx));
+
+   return 0;
+}
+
 /**********************************************************************
  * Function Bortho_gen_block - This routine orthonormalizes
  * a block of of vectors (from b1 to including b2 in basis)
@@ -519,13 +916,29 @@ STATIC int Bortho_block_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
    double eps_orth;
    CHKERR(machineEpsOrth_Sprimme(&eps_orth, ctx));
 
+   /* Count the reductions done on this call */
+
+   PRIMME_INT numGlobalSum0 = primme ? primme->stats.numGlobalSum : 0;
+   if (primme) primme->stats.numOrthoVectors += b2 - b1;
+
    if (VLtBVL == NULL) {
-      CHKERR(Bortho_gen_Sprimme(V, ldV, R, ldR, b1, b2 - 1, locked, ldLocked,
-            numLocked, RLocked, ldRLocked, nLocal, B, Bctx, primme->iseed,
-            b2_out, ctx));
+      if (primme && (primme->orth == primme_orth_cholqr2 ||
+                          primme->orth == primme_orth_shifted_cholqr3)) {
+         CHKERR(Bortho_cholqr_Sprimme(V, ldV, R, ldR, b1, b2 - 1, locked,
+               ldLocked, numLocked, RLocked, ldRLocked, nLocal, B, Bctx,
+               primme->iseed, b2_out, ctx));
+      } else {
+         CHKERR(Bortho_gen_Sprimme(V, ldV, R, ldR, b1, b2 - 1, locked,
+               ldLocked, numLocked, RLocked, ldRLocked, nLocal, B, Bctx,
+               primme->iseed, b2_out, ctx));
+      }
       if (B && BV) {
          CHKERR(B(&V[ldV * b1], ldV, &BV[ldBV * b1], ldBV, *b2_out - b1, Bctx));
       }
+      if (primme) {
+         primme->stats.numOrthoGlobalSum +=
+               primme->stats.numGlobalSum - numGlobalSum0;
+      }
       return 0;
    }
 
@@ -664,7 +1077,7 @@ STATIC int Bortho_block_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
          else plus1 = min(its + 1, plus1);
       }
 
-      if (ctx.procID == 0) {
+      if (ctx.procID == 0 || ctx.commReduce) {
          // If the norm of the vector overflows, discard the inner product with
          // other vectors and set the maximum value as the norm
          for (i = 0; i < b2 - b1; i++) {
@@ -774,7 +1187,7 @@ STATIC int Bortho_block_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
 
    /* Return the number of linearly independent columns */
 
-   if (ctx.procID == 0) {
+   if (ctx.procID == 0 || ctx.commReduce) {
       b2 = rank_estimation(
                  VLtBVL, numLocked + b1, numLocked + b2, maxRank, ldVLtBVL) -
            numLocked;
@@ -797,7 +1210,11 @@ STATIC int Bortho_block_gen_Sprimme(SCALAR *V, PRIMME_INT ldV, HSCALAR *VLtBVL,
    CHKERR(update_cholesky_Sprimme(VLtBVL, ldVLtBVL, fVLtBVL, ldfVLtBVL,
          numLocked + b1, numLocked + b2, ctx));
 
-   if (primme) primme->stats.timeOrtho += primme_wTimer() - t0;
+   if (primme) {
+      primme->stats.timeOrtho += primme_wTimer() - t0;
+      primme->stats.numOrthoGlobalSum +=
+            primme->stats.numGlobalSum - numGlobalSum0;
+   }
 
    return 0;
 }
@@ -828,7 +1245,7 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, int nQ, PRIMME_INT ldQ,
       int *inX, int nX, PRIMME_INT ldX, HREAL *norms, primme_context ctx) {
 
    primme_params *primme = ctx.primme;
-   int i, j, M=PRIMME_BLOCK_SIZE;
+   int i, j, c, M=PRIMME_BLOCK_SIZE;
    PRIMME_INT mQ = primme->nLocal;
 
    double t0 = primme_wTimer();
@@ -843,33 +1260,45 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, int nQ, PRIMME_INT ldQ,
       }
    }
 
+   /* If the reductions can be overlapped with local work, process the   */
+   /* columns of X in two chunks: the local products of a chunk are      */
+   /* computed while the reduction of the previous chunk is in flight.   */
+
+   int nChunks = (nX > 1 && globalSum_is_split_Tprimme(ctx)) ? 2 : 1;
+   primme_globalsum_request reqs[2];
+
    /* y = Q'*X */
 
    HSCALAR *y;
    CHKERR(Num_malloc_SHprimme(nQ * nX, &y, ctx));
    CHKERR(Num_zero_matrix_SHprimme(y, nQ, nX, nQ, ctx));
-   if (!inX) {
-      CHKERR(Num_gemm_ddh_Sprimme(
-            "C", "N", nQ, nX, mQ, 1.0, Q, ldQ, X, ldX, 0.0, y, nQ, ctx));
-   }
-   else {
-      int m=min(M, mQ);
-      SCALAR *X0;
+   SCALAR *X0 = NULL;
+   int m=min(M, mQ);
+   if (inX) {
       CHKERR(Num_malloc_Sprimme(m*nX, &X0, ctx));
-      CHKERR(Num_zero_matrix_SHprimme(y, nQ, nX, nQ, ctx));
-      for (i=0, m=min(M,mQ); i < mQ; i+=m, m=min(m,mQ-i)) {
-         CHKERR(Num_copy_matrix_columns_Sprimme(
-               &X[i], m, inX, nX, ldX, X0, NULL, m, ctx));
-         CHKERR(Num_gemm_ddh_Sprimme(
-               "C", "N", nQ, nX, m, 1.0, &Q[i], ldQ, X0, m, 1.0, y, nQ, ctx));
+   }
+   for (c = 0; c < nChunks; c++) {
+      int c0 = nX * c / nChunks, nXc = nX * (c + 1) / nChunks - c0;
+      if (!inX) {
+         CHKERR(Num_gemm_ddh_Sprimme("C", "N", nQ, nXc, mQ, 1.0, Q, ldQ,
+               &X[ldX * c0], ldX, 0.0, &y[nQ * c0], nQ, ctx));
+      } else {
+         for (i = 0, m = min(M, mQ); i < mQ; i += m, m = min(m, mQ - i)) {
+            Mem_stream_rows(Q, sizeof(SCALAR), ldQ, mQ, nQ, i, m, ctx);
+            CHKERR(Num_copy_matrix_columns_Sprimme(
+                  &X[i], m, &inX[c0], nXc, ldX, X0, NULL, m, ctx));
+            CHKERR(Num_gemm_ddh_Sprimme("C", "N", nQ, nXc, m, 1.0, &Q[i],
+                  ldQ, X0, m, 1.0, &y[nQ * c0], nQ, ctx));
+         }
       }
-      CHKERR(Num_free_Sprimme(X0, ctx));
+
+      /* Start the reduction on y(:,c0:c0+nXc-1) */
+
+      CHKERR(globalSum_begin_SHprimme(&y[nQ * c0], nQ * nXc, &reqs[c], ctx));
    }
    primme->stats.numOrthoInnerProds += nQ*nX;
 
-   /* Reduction on y */
-
-   CHKERR(globalSum_SHprimme(y, nQ*nX, ctx));
+   for (c = 0; c < nChunks; c++) CHKERR(globalSum_wait_Tprimme(&reqs[c], ctx));
    
    /* z = QtBQ\y */
 
@@ -892,34 +1321,45 @@ int ortho_single_iteration_Sprimme(SCALAR *Q, int nQ, PRIMME_INT ldQ,
 
    /* X = X - BQ*(QtBQ\y); norms(i) = norm(X(i)) */
 
-   SCALAR *X0 = NULL;
-   int m=min(M, mQ);
-   if (inX) {
-      CHKERR(Num_malloc_Sprimme(m*nX, &X0, ctx));
-   }
    if (norms) for (i=0; i<nX; i++) norms[i] = 0.0;
-   for (i=0; i < mQ; i+=m, m=min(m,mQ-i)) {
-      if (inX) {
-         CHKERR(Num_copy_matrix_columns_Sprimme(
-               &X[i], m, inX, nX, ldX, X0, NULL, m, ctx));
-      }
-      CHKERR(Num_gemm_dhd_Sprimme("N", "N", m, nX, nQ, -1.0, &BQ[i], ldBQ, y, nQ,
-            1.0, inX ? X0 : &X[i], inX ? m : ldX, ctx));
-      if (inX) {
-         CHKERR(Num_copy_matrix_columns_Sprimme(
-               X0, m, NULL, nX, m, &X[i], inX, ldX, ctx));
+   for (c = 0; c < nChunks; c++) {
+      int c0 = nX * c / nChunks, nXc = nX * (c + 1) / nChunks - c0;
+      int *inXc = inX ? &inX[c0] : NULL;
+      SCALAR *Xc = inX ? X : &X[ldX * c0];
+      for (i = 0, m = min(M, mQ); i < mQ; i += m, m = min(m, mQ - i)) {
+         /* Read ahead the next rows of the arrays that are out of core */
+         Mem_stream_rows(BQ, sizeof(SCALAR), ldBQ, mQ, nQ, i, m, ctx);
+         if (!inX) Mem_stream_rows(Xc, sizeof(SCALAR), ldX, mQ, nXc, i, m, ctx);
+         if (inX) {
+            CHKERR(Num_copy_matrix_columns_Sprimme(
+                  &Xc[i], m, inXc, nXc, ldX, X0, NULL, m, ctx));
+         }
+         CHKERR(Num_gemm_dhd_Sprimme("N", "N", m, nXc, nQ, -1.0, &BQ[i],
+               ldBQ, &y[nQ * c0], nQ, 1.0, inX ? X0 : &Xc[i], inX ? m : ldX,
+               ctx));
+         if (inX) {
+            CHKERR(Num_copy_matrix_columns_Sprimme(
+                  X0, m, NULL, nXc, m, &Xc[i], inXc, ldX, ctx));
+         }
+         if (norms) {
+            for (j = 0; j < nXc; j++) {
+               SCALAR *x = inX ? &X0[j * m] : &Xc[j * ldX + i];
+               norms[c0 + j] += REAL_PART(Num_dot_Sprimme(m, x, 1, x, 1, ctx));
+            }
+         }
       }
+
+      /* Start the reduction of norms(c0:c0+nXc-1) */
+
       if (norms) {
-         for (j = 0; j < nX; j++) {
-            SCALAR *x = inX ? &X0[j * m] : &X[j * ldX + i];
-            norms[j] += REAL_PART(Num_dot_Sprimme(m, x, 1, x, 1, ctx));
-         }
+         CHKERR(globalSum_begin_RHprimme(&norms[c0], nXc, &reqs[c], ctx));
       }
    }
 
    if (norms) {
-      /* Store the reduction of norms */
-      CHKERR(globalSum_RHprimme(norms, nX, ctx));
+      for (c = 0; c < nChunks; c++) {
+         CHKERR(globalSum_wait_Tprimme(&reqs[c], ctx));
+      }
  
       for (i=0; i<nX; i++) norms[i] = sqrt(norms[i]);
       primme->stats.numOrthoInnerProds += nX;
@@ -1004,6 +1444,15 @@ STATIC int Num_ortho_kernel(SCALAR *Q, PRIMME_INT M, int nQ, PRIMME_INT ldQ,
    /* Zero Bo */
    if (Bo) CHKERR(Num_zero_matrix_SHprimme(Bo, nQ + b2, nX, ldBo, ctx));
 
+   /* If the reduction can be overlapped with local work, compute Bo in two */
+   /* chunks of columns, Bo(:,0:nW0-1) and Bo(:,nW0:nX-1): the local        */
+   /* products of the second chunk are computed while the reduction of the */
+   /* first one is in flight.                                               */
+
+   int nW0 = (W && Bo && nX > 1 && globalSum_is_split_Tprimme(ctx)) ? nX / 2
+                                                                     : nX;
+   primme_globalsum_request reqs[2];
+
    /* Y(:,i) = Y(:,i)/D[i] */
    if (D && Y) {
       if (Yortho) {
@@ -1013,6 +1462,11 @@ STATIC int Num_ortho_kernel(SCALAR *Q, PRIMME_INT M, int nQ, PRIMME_INT ldQ,
    }
 
    for (i=0; i < M; i+=m, m=min(m,M-i)) {
+      /* Read ahead the next rows of the arrays that are out of core */
+      Mem_stream_rows(Q, sizeof(SCALAR), ldQ, M, nQ, i, m, ctx);
+      Mem_stream_rows(V, sizeof(SCALAR), ldV, M, b2, i, m, ctx);
+      if (W) Mem_stream_rows(W, sizeof(SCALAR), ldW, M, nX, i, m, ctx);
+
       if (D && Y) {
          /* X = X - Q*A(0:nQ,:) */
          if (nQ > 0) {
@@ -1040,28 +1494,57 @@ STATIC int Num_ortho_kernel(SCALAR *Q, PRIMME_INT M, int nQ, PRIMME_INT ldQ,
 
       if (!W || !Bo) continue;
 
-      /* Bo(0:nQ-1,:) += Q'*W */
-      CHKERR(Num_gemm_ddh_Sprimme("C", "N", nQ, nX, m, 1.0, &Q[i], ldQ, &W[i],
+      /* Bo(0:nQ-1,0:nW0-1) += Q'*W(:,0:nW0-1) */
+      CHKERR(Num_gemm_ddh_Sprimme("C", "N", nQ, nW0, m, 1.0, &Q[i], ldQ, &W[i],
             ldW, i == 0 ? 0.0 : 1.0, Bo, ldBo, ctx));
-#ifdef USE_HOST
-      /* Bo(nQ:nQ+b2-1,:) += V(:b2-1)'*W */
-      CHKERR(Num_gemm_ddh_Sprimme("C", "N", b2, nX, m, 1.0, &V[i], ldV, &W[i],
-            ldW, i == 0 ? 0.0 : 1.0, Bo + nQ, ldBo, ctx));
-#else
-      /* Bo(nQ:nQ+b1-1,:) += V(:b1-1)'*W */
-      CHKERR(Num_gemm_ddh_Sprimme("C", "N", b1, nX, m, 1.0, &V[i], ldV, &W[i],
-            ldW, i == 0 ? 0.0 : 1.0, Bo + nQ, ldBo, ctx));
-
-      /* Bo(nQ+b1:nQ+b2-1,:) += V(b1:b2-1)'*W */
-      CHKERR(Num_compute_gramm_ddh_Sprimme(&V[ldV * b1 + i], m, nX, ldV, &W[i],
-            ldW, i == 0 ? 0.0 : 1.0, Bo + nQ + b1, ldBo, 1 /* symmetric */,
-            ctx));
+#ifndef USE_HOST
+      if (nW0 == nX) {
+         /* Bo(nQ:nQ+b1-1,:) += V(:b1-1)'*W */
+         CHKERR(Num_gemm_ddh_Sprimme("C", "N", b1, nX, m, 1.0, &V[i], ldV,
+               &W[i], ldW, i == 0 ? 0.0 : 1.0, Bo + nQ, ldBo, ctx));
+
+         /* Bo(nQ+b1:nQ+b2-1,:) += V(b1:b2-1)'*W */
+         CHKERR(Num_compute_gramm_ddh_Sprimme(&V[ldV * b1 + i], m, nX, ldV,
+               &W[i], ldW, i == 0 ? 0.0 : 1.0, Bo + nQ + b1, ldBo,
+               1 /* symmetric */, ctx));
+         continue;
+      }
 #endif
+      /* Bo(nQ:nQ+b2-1,0:nW0-1) += V(:b2-1)'*W(:,0:nW0-1) */
+      CHKERR(Num_gemm_ddh_Sprimme("C", "N", b2, nW0, m, 1.0, &V[i], ldV, &W[i],
+            ldW, i == 0 ? 0.0 : 1.0, Bo + nQ, ldBo, ctx));
    }
 
    /* B = globalSum(Bo) */
    if (ctx.numProcs > 1) {
-      CHKERR(globalSum_SHprimme(Bo, (nQ + b2) * nX, ctx));
+      CHKERR(globalSum_begin_SHprimme(Bo, (nQ + b2) * nW0, &reqs[0], ctx));
+   }
+
+   /* Bo(:,nW0:nX-1) = [Q V(:b2-1)]'*W(:,nW0:nX-1) while Bo(:,0:nW0-1) is */
+   /* being reduced                                                       */
+
+   if (nW0 < nX) {
+      HSCALAR *Bo1 = &Bo[ldBo * nW0];
+      m = min(PRIMME_BLOCK_SIZE, M);
+      for (i = 0; i < M; i += m, m = min(m, M - i)) {
+         Mem_stream_rows(Q, sizeof(SCALAR), ldQ, M, nQ, i, m, ctx);
+         Mem_stream_rows(V, sizeof(SCALAR), ldV, M, b2, i, m, ctx);
+         Mem_stream_rows(&W[ldW * nW0], sizeof(SCALAR), ldW, M, nX - nW0, i, m,
+               ctx);
+         CHKERR(Num_gemm_ddh_Sprimme("C", "N", nQ, nX - nW0, m, 1.0, &Q[i],
+               ldQ, &W[ldW * nW0 + i], ldW, i == 0 ? 0.0 : 1.0, Bo1, ldBo,
+               ctx));
+         CHKERR(Num_gemm_ddh_Sprimme("C", "N", b2, nX - nW0, m, 1.0, &V[i],
+               ldV, &W[ldW * nW0 + i], ldW, i == 0 ? 0.0 : 1.0, Bo1 + nQ,
+               ldBo, ctx));
+      }
+      CHKERR(globalSum_begin_SHprimme(
+            Bo1, (nQ + b2) * (nX - nW0), &reqs[1], ctx));
+   }
+
+   if (ctx.numProcs > 1) {
+      CHKERR(globalSum_wait_Tprimme(&reqs[0], ctx));
+      if (nW0 < nX) CHKERR(globalSum_wait_Tprimme(&reqs[1], ctx));
       CHKERR(Num_copy_matrix_SHprimme(Bo, nQ+b2, nX, nQ+b2, B, ldB, ctx));
    }
 
@@ -1202,7 +1685,7 @@ int update_cholesky_Sprimme(HSCALAR *VtV, int ldVtV, HSCALAR *fVtV, int ldfVtV,
 
    HSCALAR *A;
    CHKERR(Num_malloc_SHprimme(n * (n - n0), &A, ctx));
-   if (ctx.procID == 0) {
+   if (ctx.procID == 0 || ctx.commReduce) {
       CHKERR(Num_copy_matrix_SHprimme(&VtV[ldVtV * n0], n,
             n - n0, ldVtV, A, n, ctx));
       CHKERR(Num_trsm_SHprimme("L", "U", "C", "N", n0, n - n0, 1.0, fVtV,
@@ -1219,4 +1702,296 @@ int update_cholesky_Sprimme(HSCALAR *VtV, int ldVtV, HSCALAR *fVtV, int ldfVtV,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutines *_workspace - Take from the dry arena of the context the same
+ *    blocks that the function without the suffix takes with the given sizes.
+ *    The flags withX tell whether the optional array X of the function is
+ *    given. See main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int Bortho_gen_workspace_Sprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx) {
+
+   HSCALAR *overlaps;
+   SCALAR *Bx;
+   CHKERR(Num_malloc_SHprimme(b2 + 1 + numLocked, &overlaps, ctx));
+   CHKERR(Num_malloc_Sprimme(withB ? nLocal : 0, &Bx, ctx));
+   if (withMass) CHKERR(massMatrixMatvec_workspace_Sprimme(nLocal, 1, ctx));
+   CHKERR(globalSum_workspace_SHprimme(b2 + 1 + numLocked, ctx));
+   CHKERR(globalSum_workspace_RHprimme(1, ctx));
+   CHKERR(Num_free_SHprimme(overlaps, ctx));
+   CHKERR(Num_free_Sprimme(Bx, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int ortho_dcgs2_workspace_Sprimme(int b, primme_context ctx) {
+
+   HSCALAR *overlaps;
+   CHKERR(Num_malloc_SHprimme(b + 1, &overlaps, ctx));
+   CHKERR(globalSum_workspace_SHprimme(b + 1, ctx));
+   CHKERR(Num_free_SHprimme(overlaps, ctx));
+
+   return 0;
+}
+
+#ifdef USE_HOST
+
+TEMPLATE_PLEASE
+int Bortho_local_workspace_Sprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, primme_context ctx) {
+
+   ctx.numProcs = 1;
+   ctx.procID = 0;
+   ctx.mpicomm = NULL;
+   ctx.commReduce = 0;
+   ctx.primme = NULL;
+
+   return Bortho_gen_workspace_SHprimme(
+         b2, numLocked, nLocal, withB, 0 /* no mass matrix */, ctx);
+}
+
+#endif /* USE_HOST */
+
+STATIC int Bortho_cholqr_workspace_Sprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx) {
+
+   int nX = b2 - b1 + 1;
+   int ldG = numLocked + b1 + nX;
+
+   HSCALAR *r = NULL, *G, *T;
+   SCALAR *BX = NULL;
+   if (withRLocked && !withR) CHKERR(Num_malloc_SHprimme(nX * nX, &r, ctx));
+   CHKERR(Num_malloc_SHprimme(ldG * nX, &G, ctx));
+   CHKERR(Num_malloc_SHprimme(nX * nX, &T, ctx));
+   if (withB) CHKERR(Num_malloc_Sprimme(nLocal * nX, &BX, ctx));
+
+   /* Passes */
+
+   if (withB) CHKERR(massMatrixMatvec_workspace_Sprimme(nLocal, nX, ctx));
+   CHKERR(globalSum_workspace_SHprimme(ldG * nX, ctx));
+
+   /* Fallback to Bortho_gen */
+
+   HSCALAR *Rt = NULL, *RLt = NULL;
+   if (withR || withRLocked) {
+      CHKERR(Num_malloc_SHprimme((b2 + 1) * (b2 + 1), &Rt, ctx));
+      CHKERR(Num_malloc_SHprimme(numLocked * nX, &RLt, ctx));
+   }
+   CHKERR(Bortho_gen_workspace_Sprimme(
+         b2, numLocked, nLocal, withB, withB, ctx));
+   CHKERR(Num_free_SHprimme(Rt, ctx));
+   CHKERR(Num_free_SHprimme(RLt, ctx));
+
+   CHKERR(Num_free_SHprimme(r, ctx));
+   CHKERR(Num_free_SHprimme(G, ctx));
+   CHKERR(Num_free_SHprimme(T, ctx));
+   CHKERR(Num_free_Sprimme(BX, ctx));
+
+   return 0;
+}
+
+STATIC int Num_ortho_kernel_workspace(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx) {
+
+   SCALAR *Xo = NULL;
+   HSCALAR *Bo = NULL;
+   if (withXo) {
+      CHKERR(Num_malloc_Sprimme(min(PRIMME_BLOCK_SIZE, M) * nX, &Xo, ctx));
+   }
+   if (ctx.numProcs > 1) {
+      CHKERR(Num_malloc_SHprimme((nQ + b2) * nX, &Bo, ctx));
+      int nW0 = (withW && nX > 1 && globalSum_is_split_Tprimme(ctx)) ? nX / 2
+                                                                     : nX;
+      primme_globalsum_request reqs[2];
+      CHKERR(globalSum_begin_workspace_SHprimme((nQ + b2) * nW0, &reqs[0], ctx));
+      if (nW0 < nX) {
+         CHKERR(globalSum_begin_workspace_SHprimme(
+               (nQ + b2) * (nX - nW0), &reqs[1], ctx));
+      }
+      CHKERR(globalSum_wait_workspace_Tprimme(&reqs[0], ctx));
+      if (nW0 < nX) CHKERR(globalSum_wait_workspace_Tprimme(&reqs[1], ctx));
+   }
+   CHKERR(Num_free_SHprimme(Bo, ctx));
+   CHKERR(Num_free_Sprimme(Xo, ctx));
+
+   return 0;
+}
+
+STATIC int Bortho_block_gen_workspace_Sprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   b2++; /* NOTE: Let's use C range convention */
+
+   if (b2 <= b1) return 0;
+
+   if (!withVLtBVL) {
+      if (primme && (primme->orth == primme_orth_cholqr2 ||
+                          primme->orth == primme_orth_shifted_cholqr3)) {
+         CHKERR(Bortho_cholqr_workspace_Sprimme(withR, b1, b2 - 1, numLocked,
+               withRLocked, nLocal, withB, ctx));
+      } else {
+         CHKERR(Bortho_gen_workspace_Sprimme(
+               b2 - 1, numLocked, nLocal, withB, withB, ctx));
+      }
+      if (withB && withBV) {
+         CHKERR(massMatrixMatvec_workspace_Sprimme(nLocal, b2 - b1, ctx));
+      }
+      return 0;
+   }
+
+   int nVL = b1 + numLocked;
+   HSCALAR *r = NULL, *VLtBVLdA, *Y, *C;
+   HREAL *D, *N;
+   SCALAR *BX = NULL;
+   if (withRLocked && !withR) {
+      CHKERR(Num_malloc_SHprimme((b2 - b1) * (b2 - b1), &r, ctx));
+   }
+   CHKERR(Num_malloc_RHprimme(b2-b1, &D, ctx));
+   CHKERR(Num_malloc_RHprimme(b2-b1, &N, ctx));
+   CHKERR(Num_malloc_SHprimme(nVL*(b2-b1), &VLtBVLdA, ctx));
+   CHKERR(Num_malloc_SHprimme((b2-b1)*(b2-b1), &Y, ctx));
+   CHKERR(Num_malloc_SHprimme((b2-b1)*(b2-b1), &C, ctx));
+   if (withB && !withBV) {
+      PRIMME_INT ldBX =
+            primme && nLocal == primme->nLocal ? primme->ldOPs : nLocal;
+      CHKERR(Num_malloc_Sprimme(ldBX * (b2 - b1), &BX, ctx));
+   }
+
+   /* Iterations of CG-SVQB */
+
+   if (withB) {
+      CHKERR(Num_ortho_kernel_workspace(
+            nLocal, numLocked, b2, b2 - b1, 1 /* Xo */, 0 /* no W */, ctx));
+      CHKERR(massMatrixMatvec_workspace_Sprimme(nLocal, b2 - b1, ctx));
+      CHKERR(Num_ortho_kernel_workspace(
+            nLocal, numLocked, b2, b2 - b1, 0 /* no Xo */, 1 /* W */, ctx));
+   } else {
+      CHKERR(Num_ortho_kernel_workspace(
+            nLocal, numLocked, b2, b2 - b1, 1 /* Xo */, 1 /* W */, ctx));
+   }
+   if (ctx.procID == 0 || ctx.commReduce) {
+      CHKERR(Num_heev_SHprimme("V", "U", b2 - b1, NULL, b2 - b1, NULL, ctx));
+   }
+   CHKERR(broadcast_workspace_SHprimme(nVL*(b2-b1), ctx));
+   CHKERR(broadcast_workspace_RHprimme(b2-b1, ctx));
+   CHKERR(broadcast_workspace_SHprimme((b2 - b1) * (b2 - b1), ctx));
+   CHKERR(broadcast_workspace_Tprimme(primme_op_int, 1, ctx));
+
+   CHKERR(Num_free_SHprimme(r, ctx));
+   CHKERR(Num_free_RHprimme(D, ctx));
+   CHKERR(Num_free_RHprimme(N, ctx));
+   CHKERR(Num_free_SHprimme(VLtBVLdA, ctx));
+   CHKERR(Num_free_SHprimme(Y, ctx));
+   CHKERR(Num_free_SHprimme(C, ctx));
+   CHKERR(Num_free_Sprimme(BX, ctx));
+
+   CHKERR(update_cholesky_workspace_Sprimme(
+         numLocked + b1, numLocked + b2, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int Bortho_block_workspace_Sprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx) {
+
+   return Bortho_block_gen_workspace_Sprimme(withVLtBVL, withR, b1, b2,
+         numLocked, ctx.primme->massMatrixMatvec ? 1 : 0, withBV, withRLocked,
+         nLocal, ctx);
+}
+
+/* Bortho_block_workspace for any block b1:b2 with b2 < n and at most maxnX */
+/* columns. For a number of columns, the blocks taken grow with b1.        */
+
+TEMPLATE_PLEASE
+int Bortho_block_range_workspace_Sprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx) {
+
+   int nX;
+   for (nX = 1; nX <= min(n, maxnX); nX++) {
+      CHKERR(Bortho_block_workspace_Sprimme(withVLtBVL, 0, n - nX, n - 1,
+            numLocked, withBV, withRLocked, nLocal, ctx));
+   }
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int ortho_block_workspace_Sprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx) {
+
+   return Bortho_block_gen_workspace_Sprimme(withVLtBVL, withR, b1, b2,
+         numLocked, 0 /* no B */, 0 /* no BV */, withRLocked, nLocal, ctx);
+}
+
+TEMPLATE_PLEASE
+int ortho_single_iteration_workspace_Sprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx) {
+
+   int c;
+   int nChunks = (nX > 1 && globalSum_is_split_Tprimme(ctx)) ? 2 : 1;
+   primme_globalsum_request reqs[2];
+
+   HSCALAR *y;
+   SCALAR *X0 = NULL;
+   CHKERR(Num_malloc_SHprimme(nQ * nX, &y, ctx));
+   if (withInX) {
+      CHKERR(Num_malloc_Sprimme(
+            min(PRIMME_BLOCK_SIZE, ctx.primme->nLocal) * nX, &X0, ctx));
+   }
+   for (c = 0; c < nChunks; c++) {
+      int c0 = nX * c / nChunks, nXc = nX * (c + 1) / nChunks - c0;
+      CHKERR(globalSum_begin_workspace_SHprimme(nQ * nXc, &reqs[c], ctx));
+   }
+   for (c = 0; c < nChunks; c++) {
+      CHKERR(globalSum_wait_workspace_Tprimme(&reqs[c], ctx));
+   }
+   if (withQtBQ) {
+      HSCALAR *z, *fQtBQ;
+      int *pQtBQ;
+      CHKERR(Num_malloc_SHprimme(nQ * nX, &z, ctx));
+      CHKERR(Num_malloc_SHprimme(nQ * nQ, &fQtBQ, ctx));
+      CHKERR(Num_malloc_iprimme(nQ, &pQtBQ, ctx));
+      if (nQ > 1) {
+         CHKERR(Num_hetrf_SHprimme("U", nQ, NULL, nQ, NULL, ctx));
+         CHKERR(Num_hetrs_SHprimme("U", nQ, nX, NULL, nQ, NULL, NULL, nQ, ctx));
+      }
+      CHKERR(Num_free_SHprimme(fQtBQ, ctx));
+      CHKERR(Num_free_iprimme(pQtBQ, ctx));
+      CHKERR(Num_free_SHprimme(z, ctx));
+   }
+   if (withNorms) {
+      for (c = 0; c < nChunks; c++) {
+         int c0 = nX * c / nChunks, nXc = nX * (c + 1) / nChunks - c0;
+         CHKERR(globalSum_begin_workspace_RHprimme(nXc, &reqs[c], ctx));
+      }
+      for (c = 0; c < nChunks; c++) {
+         CHKERR(globalSum_wait_workspace_Tprimme(&reqs[c], ctx));
+      }
+   }
+   CHKERR(Num_free_SHprimme(y, ctx));
+   CHKERR(Num_free_Sprimme(X0, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int update_cholesky_workspace_Sprimme(int n0, int n, primme_context ctx) {
+
+   HSCALAR *A;
+   CHKERR(Num_malloc_SHprimme(n * (n - n0), &A, ctx));
+   CHKERR(broadcast_workspace_SHprimme(n * (n - n0), ctx));
+   CHKERR(Num_free_SHprimme(A, ctx));
+
+   return 0;
+}
+
 #endif /* SUPPORTED_TYPE */
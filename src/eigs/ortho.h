@@ -221,6 +221,98 @@ int Bortho_gen_dprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme
 int ortho_dprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *R, int ldR, int b1, int b2,
                   dummy_type_dprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Sprimme)
+#  define ortho_dcgs2_Sprimme CONCAT(ortho_dcgs2_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Rprimme)
+#  define ortho_dcgs2_Rprimme CONCAT(ortho_dcgs2_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SHprimme)
+#  define ortho_dcgs2_SHprimme CONCAT(ortho_dcgs2_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RHprimme)
+#  define ortho_dcgs2_RHprimme CONCAT(ortho_dcgs2_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SXprimme)
+#  define ortho_dcgs2_SXprimme CONCAT(ortho_dcgs2_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RXprimme)
+#  define ortho_dcgs2_RXprimme CONCAT(ortho_dcgs2_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Shprimme)
+#  define ortho_dcgs2_Shprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Rhprimme)
+#  define ortho_dcgs2_Rhprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Ssprimme)
+#  define ortho_dcgs2_Ssprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Rsprimme)
+#  define ortho_dcgs2_Rsprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Sdprimme)
+#  define ortho_dcgs2_Sdprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Rdprimme)
+#  define ortho_dcgs2_Rdprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Sqprimme)
+#  define ortho_dcgs2_Sqprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_Rqprimme)
+#  define ortho_dcgs2_Rqprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SXhprimme)
+#  define ortho_dcgs2_SXhprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RXhprimme)
+#  define ortho_dcgs2_RXhprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SXsprimme)
+#  define ortho_dcgs2_SXsprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RXsprimme)
+#  define ortho_dcgs2_RXsprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SXdprimme)
+#  define ortho_dcgs2_SXdprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RXdprimme)
+#  define ortho_dcgs2_RXdprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SXqprimme)
+#  define ortho_dcgs2_SXqprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RXqprimme)
+#  define ortho_dcgs2_RXqprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SHhprimme)
+#  define ortho_dcgs2_SHhprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RHhprimme)
+#  define ortho_dcgs2_RHhprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SHsprimme)
+#  define ortho_dcgs2_SHsprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RHsprimme)
+#  define ortho_dcgs2_RHsprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SHdprimme)
+#  define ortho_dcgs2_SHdprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RHdprimme)
+#  define ortho_dcgs2_RHdprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_SHqprimme)
+#  define ortho_dcgs2_SHqprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_RHqprimme)
+#  define ortho_dcgs2_RHqprimme CONCAT(ortho_dcgs2_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int ortho_dcgs2_dprimme(dummy_type_dprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(local_matvec)
 #  define local_matvec CONCAT(local_matvec,SCALAR_SUF)
 #endif
@@ -515,6 +607,20 @@ int ortho_block_dprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimm
       int b1, int b2, dummy_type_dprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_dprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_cholqr_Sprimme)
+#  define Bortho_cholqr_Sprimme CONCAT(Bortho_cholqr_Sprimme,SCALAR_SUF)
+#endif
+int Bortho_cholqr_Sprimmedprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *R,
+      int ldR, int b1, int b2, dummy_type_dprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_dprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_dprimme *, PRIMME_INT, dummy_type_dprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_R_cholqr)
+#  define update_R_cholqr CONCAT(update_R_cholqr,SCALAR_SUF)
+#endif
+int update_R_cholqrdprimme(dummy_type_dprimme *C, int ldC, dummy_type_dprimme *T, int ldT,
+      dummy_type_dprimme *r, int ldr, dummy_type_dprimme *R, int ldR, int b1, int b2,
+      dummy_type_dprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_gen_Sprimme)
 #  define Bortho_block_gen_Sprimme CONCAT(Bortho_block_gen_Sprimme,SCALAR_SUF)
 #endif
@@ -725,6 +831,759 @@ int rank_estimationdprimme(dummy_type_dprimme *V, int n0, int n1, int n, int ldV
 #endif
 int update_cholesky_dprimme(dummy_type_dprimme *VtV, int ldVtV, dummy_type_dprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Sprimme)
+#  define Bortho_gen_workspace_Sprimme CONCAT(Bortho_gen_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Rprimme)
+#  define Bortho_gen_workspace_Rprimme CONCAT(Bortho_gen_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SHprimme)
+#  define Bortho_gen_workspace_SHprimme CONCAT(Bortho_gen_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RHprimme)
+#  define Bortho_gen_workspace_RHprimme CONCAT(Bortho_gen_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SXprimme)
+#  define Bortho_gen_workspace_SXprimme CONCAT(Bortho_gen_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RXprimme)
+#  define Bortho_gen_workspace_RXprimme CONCAT(Bortho_gen_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Shprimme)
+#  define Bortho_gen_workspace_Shprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Rhprimme)
+#  define Bortho_gen_workspace_Rhprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Ssprimme)
+#  define Bortho_gen_workspace_Ssprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Rsprimme)
+#  define Bortho_gen_workspace_Rsprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Sdprimme)
+#  define Bortho_gen_workspace_Sdprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Rdprimme)
+#  define Bortho_gen_workspace_Rdprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Sqprimme)
+#  define Bortho_gen_workspace_Sqprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_Rqprimme)
+#  define Bortho_gen_workspace_Rqprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SXhprimme)
+#  define Bortho_gen_workspace_SXhprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RXhprimme)
+#  define Bortho_gen_workspace_RXhprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SXsprimme)
+#  define Bortho_gen_workspace_SXsprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RXsprimme)
+#  define Bortho_gen_workspace_RXsprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SXdprimme)
+#  define Bortho_gen_workspace_SXdprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RXdprimme)
+#  define Bortho_gen_workspace_RXdprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SXqprimme)
+#  define Bortho_gen_workspace_SXqprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RXqprimme)
+#  define Bortho_gen_workspace_RXqprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SHhprimme)
+#  define Bortho_gen_workspace_SHhprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RHhprimme)
+#  define Bortho_gen_workspace_RHhprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SHsprimme)
+#  define Bortho_gen_workspace_SHsprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RHsprimme)
+#  define Bortho_gen_workspace_RHsprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SHdprimme)
+#  define Bortho_gen_workspace_SHdprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RHdprimme)
+#  define Bortho_gen_workspace_RHdprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_SHqprimme)
+#  define Bortho_gen_workspace_SHqprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_gen_workspace_RHqprimme)
+#  define Bortho_gen_workspace_RHqprimme CONCAT(Bortho_gen_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Bortho_gen_workspace_dprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Sprimme)
+#  define ortho_dcgs2_workspace_Sprimme CONCAT(ortho_dcgs2_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Rprimme)
+#  define ortho_dcgs2_workspace_Rprimme CONCAT(ortho_dcgs2_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SHprimme)
+#  define ortho_dcgs2_workspace_SHprimme CONCAT(ortho_dcgs2_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RHprimme)
+#  define ortho_dcgs2_workspace_RHprimme CONCAT(ortho_dcgs2_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SXprimme)
+#  define ortho_dcgs2_workspace_SXprimme CONCAT(ortho_dcgs2_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RXprimme)
+#  define ortho_dcgs2_workspace_RXprimme CONCAT(ortho_dcgs2_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Shprimme)
+#  define ortho_dcgs2_workspace_Shprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Rhprimme)
+#  define ortho_dcgs2_workspace_Rhprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Ssprimme)
+#  define ortho_dcgs2_workspace_Ssprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Rsprimme)
+#  define ortho_dcgs2_workspace_Rsprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Sdprimme)
+#  define ortho_dcgs2_workspace_Sdprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Rdprimme)
+#  define ortho_dcgs2_workspace_Rdprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Sqprimme)
+#  define ortho_dcgs2_workspace_Sqprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_Rqprimme)
+#  define ortho_dcgs2_workspace_Rqprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SXhprimme)
+#  define ortho_dcgs2_workspace_SXhprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RXhprimme)
+#  define ortho_dcgs2_workspace_RXhprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SXsprimme)
+#  define ortho_dcgs2_workspace_SXsprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RXsprimme)
+#  define ortho_dcgs2_workspace_RXsprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SXdprimme)
+#  define ortho_dcgs2_workspace_SXdprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RXdprimme)
+#  define ortho_dcgs2_workspace_RXdprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SXqprimme)
+#  define ortho_dcgs2_workspace_SXqprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RXqprimme)
+#  define ortho_dcgs2_workspace_RXqprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SHhprimme)
+#  define ortho_dcgs2_workspace_SHhprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RHhprimme)
+#  define ortho_dcgs2_workspace_RHhprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SHsprimme)
+#  define ortho_dcgs2_workspace_SHsprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RHsprimme)
+#  define ortho_dcgs2_workspace_RHsprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SHdprimme)
+#  define ortho_dcgs2_workspace_SHdprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RHdprimme)
+#  define ortho_dcgs2_workspace_RHdprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_SHqprimme)
+#  define ortho_dcgs2_workspace_SHqprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_dcgs2_workspace_RHqprimme)
+#  define ortho_dcgs2_workspace_RHqprimme CONCAT(ortho_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int ortho_dcgs2_workspace_dprimme(int b, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Sprimme)
+#  define Bortho_local_workspace_Sprimme CONCAT(Bortho_local_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Rprimme)
+#  define Bortho_local_workspace_Rprimme CONCAT(Bortho_local_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SHprimme)
+#  define Bortho_local_workspace_SHprimme CONCAT(Bortho_local_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RHprimme)
+#  define Bortho_local_workspace_RHprimme CONCAT(Bortho_local_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SXprimme)
+#  define Bortho_local_workspace_SXprimme CONCAT(Bortho_local_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RXprimme)
+#  define Bortho_local_workspace_RXprimme CONCAT(Bortho_local_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Shprimme)
+#  define Bortho_local_workspace_Shprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Rhprimme)
+#  define Bortho_local_workspace_Rhprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Ssprimme)
+#  define Bortho_local_workspace_Ssprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Rsprimme)
+#  define Bortho_local_workspace_Rsprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Sdprimme)
+#  define Bortho_local_workspace_Sdprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Rdprimme)
+#  define Bortho_local_workspace_Rdprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Sqprimme)
+#  define Bortho_local_workspace_Sqprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_Rqprimme)
+#  define Bortho_local_workspace_Rqprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SXhprimme)
+#  define Bortho_local_workspace_SXhprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RXhprimme)
+#  define Bortho_local_workspace_RXhprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SXsprimme)
+#  define Bortho_local_workspace_SXsprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RXsprimme)
+#  define Bortho_local_workspace_RXsprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SXdprimme)
+#  define Bortho_local_workspace_SXdprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RXdprimme)
+#  define Bortho_local_workspace_RXdprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SXqprimme)
+#  define Bortho_local_workspace_SXqprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RXqprimme)
+#  define Bortho_local_workspace_RXqprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SHhprimme)
+#  define Bortho_local_workspace_SHhprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RHhprimme)
+#  define Bortho_local_workspace_RHhprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SHsprimme)
+#  define Bortho_local_workspace_SHsprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RHsprimme)
+#  define Bortho_local_workspace_RHsprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SHdprimme)
+#  define Bortho_local_workspace_SHdprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RHdprimme)
+#  define Bortho_local_workspace_RHdprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_SHqprimme)
+#  define Bortho_local_workspace_SHqprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_local_workspace_RHqprimme)
+#  define Bortho_local_workspace_RHqprimme CONCAT(Bortho_local_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Bortho_local_workspace_dprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_cholqr_workspace_Sprimme)
+#  define Bortho_cholqr_workspace_Sprimme CONCAT(Bortho_cholqr_workspace_Sprimme,SCALAR_SUF)
+#endif
+int Bortho_cholqr_workspace_Sprimmedprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_ortho_kernel_workspace)
+#  define Num_ortho_kernel_workspace CONCAT(Num_ortho_kernel_workspace,SCALAR_SUF)
+#endif
+int Num_ortho_kernel_workspacedprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_gen_workspace_Sprimme)
+#  define Bortho_block_gen_workspace_Sprimme CONCAT(Bortho_block_gen_workspace_Sprimme,SCALAR_SUF)
+#endif
+int Bortho_block_gen_workspace_Sprimmedprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Sprimme)
+#  define Bortho_block_workspace_Sprimme CONCAT(Bortho_block_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Rprimme)
+#  define Bortho_block_workspace_Rprimme CONCAT(Bortho_block_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SHprimme)
+#  define Bortho_block_workspace_SHprimme CONCAT(Bortho_block_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RHprimme)
+#  define Bortho_block_workspace_RHprimme CONCAT(Bortho_block_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SXprimme)
+#  define Bortho_block_workspace_SXprimme CONCAT(Bortho_block_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RXprimme)
+#  define Bortho_block_workspace_RXprimme CONCAT(Bortho_block_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Shprimme)
+#  define Bortho_block_workspace_Shprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Rhprimme)
+#  define Bortho_block_workspace_Rhprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Ssprimme)
+#  define Bortho_block_workspace_Ssprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Rsprimme)
+#  define Bortho_block_workspace_Rsprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Sdprimme)
+#  define Bortho_block_workspace_Sdprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Rdprimme)
+#  define Bortho_block_workspace_Rdprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Sqprimme)
+#  define Bortho_block_workspace_Sqprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_Rqprimme)
+#  define Bortho_block_workspace_Rqprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SXhprimme)
+#  define Bortho_block_workspace_SXhprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RXhprimme)
+#  define Bortho_block_workspace_RXhprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SXsprimme)
+#  define Bortho_block_workspace_SXsprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RXsprimme)
+#  define Bortho_block_workspace_RXsprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SXdprimme)
+#  define Bortho_block_workspace_SXdprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RXdprimme)
+#  define Bortho_block_workspace_RXdprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SXqprimme)
+#  define Bortho_block_workspace_SXqprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RXqprimme)
+#  define Bortho_block_workspace_RXqprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SHhprimme)
+#  define Bortho_block_workspace_SHhprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RHhprimme)
+#  define Bortho_block_workspace_RHhprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SHsprimme)
+#  define Bortho_block_workspace_SHsprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RHsprimme)
+#  define Bortho_block_workspace_RHsprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SHdprimme)
+#  define Bortho_block_workspace_SHdprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RHdprimme)
+#  define Bortho_block_workspace_RHdprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_SHqprimme)
+#  define Bortho_block_workspace_SHqprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_workspace_RHqprimme)
+#  define Bortho_block_workspace_RHqprimme CONCAT(Bortho_block_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Bortho_block_workspace_dprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Sprimme)
+#  define Bortho_block_range_workspace_Sprimme CONCAT(Bortho_block_range_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Rprimme)
+#  define Bortho_block_range_workspace_Rprimme CONCAT(Bortho_block_range_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SHprimme)
+#  define Bortho_block_range_workspace_SHprimme CONCAT(Bortho_block_range_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RHprimme)
+#  define Bortho_block_range_workspace_RHprimme CONCAT(Bortho_block_range_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SXprimme)
+#  define Bortho_block_range_workspace_SXprimme CONCAT(Bortho_block_range_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RXprimme)
+#  define Bortho_block_range_workspace_RXprimme CONCAT(Bortho_block_range_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Shprimme)
+#  define Bortho_block_range_workspace_Shprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Rhprimme)
+#  define Bortho_block_range_workspace_Rhprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Ssprimme)
+#  define Bortho_block_range_workspace_Ssprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Rsprimme)
+#  define Bortho_block_range_workspace_Rsprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Sdprimme)
+#  define Bortho_block_range_workspace_Sdprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Rdprimme)
+#  define Bortho_block_range_workspace_Rdprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Sqprimme)
+#  define Bortho_block_range_workspace_Sqprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_Rqprimme)
+#  define Bortho_block_range_workspace_Rqprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SXhprimme)
+#  define Bortho_block_range_workspace_SXhprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RXhprimme)
+#  define Bortho_block_range_workspace_RXhprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SXsprimme)
+#  define Bortho_block_range_workspace_SXsprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RXsprimme)
+#  define Bortho_block_range_workspace_RXsprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SXdprimme)
+#  define Bortho_block_range_workspace_SXdprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RXdprimme)
+#  define Bortho_block_range_workspace_RXdprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SXqprimme)
+#  define Bortho_block_range_workspace_SXqprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RXqprimme)
+#  define Bortho_block_range_workspace_RXqprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SHhprimme)
+#  define Bortho_block_range_workspace_SHhprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RHhprimme)
+#  define Bortho_block_range_workspace_RHhprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SHsprimme)
+#  define Bortho_block_range_workspace_SHsprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RHsprimme)
+#  define Bortho_block_range_workspace_RHsprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SHdprimme)
+#  define Bortho_block_range_workspace_SHdprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RHdprimme)
+#  define Bortho_block_range_workspace_RHdprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_SHqprimme)
+#  define Bortho_block_range_workspace_SHqprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(Bortho_block_range_workspace_RHqprimme)
+#  define Bortho_block_range_workspace_RHqprimme CONCAT(Bortho_block_range_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int Bortho_block_range_workspace_dprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Sprimme)
+#  define ortho_block_workspace_Sprimme CONCAT(ortho_block_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Rprimme)
+#  define ortho_block_workspace_Rprimme CONCAT(ortho_block_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SHprimme)
+#  define ortho_block_workspace_SHprimme CONCAT(ortho_block_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RHprimme)
+#  define ortho_block_workspace_RHprimme CONCAT(ortho_block_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SXprimme)
+#  define ortho_block_workspace_SXprimme CONCAT(ortho_block_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RXprimme)
+#  define ortho_block_workspace_RXprimme CONCAT(ortho_block_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Shprimme)
+#  define ortho_block_workspace_Shprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Rhprimme)
+#  define ortho_block_workspace_Rhprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Ssprimme)
+#  define ortho_block_workspace_Ssprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Rsprimme)
+#  define ortho_block_workspace_Rsprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Sdprimme)
+#  define ortho_block_workspace_Sdprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Rdprimme)
+#  define ortho_block_workspace_Rdprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Sqprimme)
+#  define ortho_block_workspace_Sqprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_Rqprimme)
+#  define ortho_block_workspace_Rqprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SXhprimme)
+#  define ortho_block_workspace_SXhprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RXhprimme)
+#  define ortho_block_workspace_RXhprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SXsprimme)
+#  define ortho_block_workspace_SXsprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RXsprimme)
+#  define ortho_block_workspace_RXsprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SXdprimme)
+#  define ortho_block_workspace_SXdprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RXdprimme)
+#  define ortho_block_workspace_RXdprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SXqprimme)
+#  define ortho_block_workspace_SXqprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RXqprimme)
+#  define ortho_block_workspace_RXqprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SHhprimme)
+#  define ortho_block_workspace_SHhprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RHhprimme)
+#  define ortho_block_workspace_RHhprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SHsprimme)
+#  define ortho_block_workspace_SHsprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RHsprimme)
+#  define ortho_block_workspace_RHsprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SHdprimme)
+#  define ortho_block_workspace_SHdprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RHdprimme)
+#  define ortho_block_workspace_RHdprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_SHqprimme)
+#  define ortho_block_workspace_SHqprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_block_workspace_RHqprimme)
+#  define ortho_block_workspace_RHqprimme CONCAT(ortho_block_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int ortho_block_workspace_dprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Sprimme)
+#  define ortho_single_iteration_workspace_Sprimme CONCAT(ortho_single_iteration_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Rprimme)
+#  define ortho_single_iteration_workspace_Rprimme CONCAT(ortho_single_iteration_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SHprimme)
+#  define ortho_single_iteration_workspace_SHprimme CONCAT(ortho_single_iteration_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RHprimme)
+#  define ortho_single_iteration_workspace_RHprimme CONCAT(ortho_single_iteration_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SXprimme)
+#  define ortho_single_iteration_workspace_SXprimme CONCAT(ortho_single_iteration_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RXprimme)
+#  define ortho_single_iteration_workspace_RXprimme CONCAT(ortho_single_iteration_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Shprimme)
+#  define ortho_single_iteration_workspace_Shprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Rhprimme)
+#  define ortho_single_iteration_workspace_Rhprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Ssprimme)
+#  define ortho_single_iteration_workspace_Ssprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Rsprimme)
+#  define ortho_single_iteration_workspace_Rsprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Sdprimme)
+#  define ortho_single_iteration_workspace_Sdprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Rdprimme)
+#  define ortho_single_iteration_workspace_Rdprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Sqprimme)
+#  define ortho_single_iteration_workspace_Sqprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_Rqprimme)
+#  define ortho_single_iteration_workspace_Rqprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SXhprimme)
+#  define ortho_single_iteration_workspace_SXhprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RXhprimme)
+#  define ortho_single_iteration_workspace_RXhprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SXsprimme)
+#  define ortho_single_iteration_workspace_SXsprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RXsprimme)
+#  define ortho_single_iteration_workspace_RXsprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SXdprimme)
+#  define ortho_single_iteration_workspace_SXdprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RXdprimme)
+#  define ortho_single_iteration_workspace_RXdprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SXqprimme)
+#  define ortho_single_iteration_workspace_SXqprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RXqprimme)
+#  define ortho_single_iteration_workspace_RXqprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SHhprimme)
+#  define ortho_single_iteration_workspace_SHhprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RHhprimme)
+#  define ortho_single_iteration_workspace_RHhprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SHsprimme)
+#  define ortho_single_iteration_workspace_SHsprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RHsprimme)
+#  define ortho_single_iteration_workspace_RHsprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SHdprimme)
+#  define ortho_single_iteration_workspace_SHdprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RHdprimme)
+#  define ortho_single_iteration_workspace_RHdprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_SHqprimme)
+#  define ortho_single_iteration_workspace_SHqprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_single_iteration_workspace_RHqprimme)
+#  define ortho_single_iteration_workspace_RHqprimme CONCAT(ortho_single_iteration_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int ortho_single_iteration_workspace_dprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Sprimme)
+#  define update_cholesky_workspace_Sprimme CONCAT(update_cholesky_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Rprimme)
+#  define update_cholesky_workspace_Rprimme CONCAT(update_cholesky_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SHprimme)
+#  define update_cholesky_workspace_SHprimme CONCAT(update_cholesky_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RHprimme)
+#  define update_cholesky_workspace_RHprimme CONCAT(update_cholesky_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SXprimme)
+#  define update_cholesky_workspace_SXprimme CONCAT(update_cholesky_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RXprimme)
+#  define update_cholesky_workspace_RXprimme CONCAT(update_cholesky_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Shprimme)
+#  define update_cholesky_workspace_Shprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Rhprimme)
+#  define update_cholesky_workspace_Rhprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Ssprimme)
+#  define update_cholesky_workspace_Ssprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Rsprimme)
+#  define update_cholesky_workspace_Rsprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Sdprimme)
+#  define update_cholesky_workspace_Sdprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Rdprimme)
+#  define update_cholesky_workspace_Rdprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Sqprimme)
+#  define update_cholesky_workspace_Sqprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_Rqprimme)
+#  define update_cholesky_workspace_Rqprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SXhprimme)
+#  define update_cholesky_workspace_SXhprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RXhprimme)
+#  define update_cholesky_workspace_RXhprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SXsprimme)
+#  define update_cholesky_workspace_SXsprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RXsprimme)
+#  define update_cholesky_workspace_RXsprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SXdprimme)
+#  define update_cholesky_workspace_SXdprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RXdprimme)
+#  define update_cholesky_workspace_RXdprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SXqprimme)
+#  define update_cholesky_workspace_SXqprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RXqprimme)
+#  define update_cholesky_workspace_RXqprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SHhprimme)
+#  define update_cholesky_workspace_SHhprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RHhprimme)
+#  define update_cholesky_workspace_RHhprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SHsprimme)
+#  define update_cholesky_workspace_SHsprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RHsprimme)
+#  define update_cholesky_workspace_RHsprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SHdprimme)
+#  define update_cholesky_workspace_SHdprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RHdprimme)
+#  define update_cholesky_workspace_RHdprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_SHqprimme)
+#  define update_cholesky_workspace_SHqprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_cholesky_workspace_RHqprimme)
+#  define update_cholesky_workspace_RHqprimme CONCAT(update_cholesky_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int update_cholesky_workspace_dprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR,
       int b1, int b2, dummy_type_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -733,6 +1592,8 @@ int Bortho_gen_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme
 int ortho_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR, int b1, int b2,
                   dummy_type_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int local_matvechprimme(dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *y, PRIMME_INT ldy,
       int bs, void *Bctx_);
 int Bortho_local_hprimme(dummy_type_sprimme *V, int ldV, dummy_type_sprimme *R,
@@ -751,6 +1612,14 @@ int ortho_block_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_sprimm
       int b1, int b2, dummy_type_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmehprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R,
+      int ldR, int b1, int b2, dummy_type_hprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_hprimme *, PRIMME_INT, dummy_type_hprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrhprimme(dummy_type_sprimme *C, int ldC, dummy_type_sprimme *T, int ldT,
+      dummy_type_sprimme *r, int ldr, dummy_type_sprimme *R, int ldR, int b1, int b2,
+      dummy_type_sprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmehprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *VLtBVL,
       int ldVLtBVL, dummy_type_sprimme *fVLtBVL, int ldfVLtBVL, dummy_type_sprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -769,6 +1638,30 @@ int decompositionhprimme(dummy_type_sprimme *H, int n, int ldH, dummy_type_sprim
 int rank_estimationhprimme(dummy_type_sprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_hprimme(dummy_type_sprimme *VtV, int ldVtV, dummy_type_sprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_hprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_hprimme(int b, primme_context ctx);
+int Bortho_local_workspace_hprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmehprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacehprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmehprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_hprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_hprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_hprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_hprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_hprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR,
       int b1, int b2, dummy_type_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -777,6 +1670,8 @@ int Bortho_gen_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme
 int ortho_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR, int b1, int b2,
                   dummy_type_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int local_matveckprimme(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_cprimme *y, PRIMME_INT ldy,
       int bs, void *Bctx_);
 int Bortho_local_kprimme(dummy_type_cprimme *V, int ldV, dummy_type_cprimme *R,
@@ -795,6 +1690,14 @@ int ortho_block_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_cprimm
       int b1, int b2, dummy_type_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmekprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R,
+      int ldR, int b1, int b2, dummy_type_kprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_kprimme *, PRIMME_INT, dummy_type_kprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrkprimme(dummy_type_cprimme *C, int ldC, dummy_type_cprimme *T, int ldT,
+      dummy_type_cprimme *r, int ldr, dummy_type_cprimme *R, int ldR, int b1, int b2,
+      dummy_type_cprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmekprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *VLtBVL,
       int ldVLtBVL, dummy_type_cprimme *fVLtBVL, int ldfVLtBVL, dummy_type_cprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -813,6 +1716,30 @@ int decompositionkprimme(dummy_type_cprimme *H, int n, int ldH, dummy_type_cprim
 int rank_estimationkprimme(dummy_type_cprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_kprimme(dummy_type_cprimme *VtV, int ldVtV, dummy_type_cprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_kprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_kprimme(int b, primme_context ctx);
+int Bortho_local_workspace_kprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmekprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacekprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmekprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_kprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_kprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_kprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_kprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_kprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR,
       int b1, int b2, dummy_type_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -821,6 +1748,8 @@ int Bortho_gen_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme
 int ortho_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR, int b1, int b2,
                   dummy_type_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int local_matvecsprimme(dummy_type_sprimme *x, PRIMME_INT ldx, dummy_type_sprimme *y, PRIMME_INT ldy,
       int bs, void *Bctx_);
 int Bortho_local_sprimme(dummy_type_sprimme *V, int ldV, dummy_type_sprimme *R,
@@ -839,6 +1768,14 @@ int ortho_block_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimm
       int b1, int b2, dummy_type_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmesprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R,
+      int ldR, int b1, int b2, dummy_type_sprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_sprimme *, PRIMME_INT, dummy_type_sprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrsprimme(dummy_type_sprimme *C, int ldC, dummy_type_sprimme *T, int ldT,
+      dummy_type_sprimme *r, int ldr, dummy_type_sprimme *R, int ldR, int b1, int b2,
+      dummy_type_sprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmesprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *VLtBVL,
       int ldVLtBVL, dummy_type_sprimme *fVLtBVL, int ldfVLtBVL, dummy_type_sprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -857,6 +1794,30 @@ int decompositionsprimme(dummy_type_sprimme *H, int n, int ldH, dummy_type_sprim
 int rank_estimationsprimme(dummy_type_sprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_sprimme(dummy_type_sprimme *VtV, int ldVtV, dummy_type_sprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_sprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_sprimme(int b, primme_context ctx);
+int Bortho_local_workspace_sprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmesprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacesprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmesprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_sprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_sprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_sprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_sprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_sprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR,
       int b1, int b2, dummy_type_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -865,6 +1826,8 @@ int Bortho_gen_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme
 int ortho_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR, int b1, int b2,
                   dummy_type_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int local_matveccprimme(dummy_type_cprimme *x, PRIMME_INT ldx, dummy_type_cprimme *y, PRIMME_INT ldy,
       int bs, void *Bctx_);
 int Bortho_local_cprimme(dummy_type_cprimme *V, int ldV, dummy_type_cprimme *R,
@@ -883,6 +1846,14 @@ int ortho_block_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimm
       int b1, int b2, dummy_type_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmecprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R,
+      int ldR, int b1, int b2, dummy_type_cprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_cprimme *, PRIMME_INT, dummy_type_cprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrcprimme(dummy_type_cprimme *C, int ldC, dummy_type_cprimme *T, int ldT,
+      dummy_type_cprimme *r, int ldr, dummy_type_cprimme *R, int ldR, int b1, int b2,
+      dummy_type_cprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmecprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *VLtBVL,
       int ldVLtBVL, dummy_type_cprimme *fVLtBVL, int ldfVLtBVL, dummy_type_cprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -901,6 +1872,30 @@ int decompositioncprimme(dummy_type_cprimme *H, int n, int ldH, dummy_type_cprim
 int rank_estimationcprimme(dummy_type_cprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_cprimme(dummy_type_cprimme *VtV, int ldVtV, dummy_type_cprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_cprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_cprimme(int b, primme_context ctx);
+int Bortho_local_workspace_cprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmecprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacecprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmecprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_cprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_cprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_cprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_cprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_cprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R, int ldR,
       int b1, int b2, dummy_type_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -909,6 +1904,8 @@ int Bortho_gen_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme
 int ortho_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R, int ldR, int b1, int b2,
                   dummy_type_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int local_matveczprimme(dummy_type_zprimme *x, PRIMME_INT ldx, dummy_type_zprimme *y, PRIMME_INT ldy,
       int bs, void *Bctx_);
 int Bortho_local_zprimme(dummy_type_zprimme *V, int ldV, dummy_type_zprimme *R,
@@ -927,6 +1924,14 @@ int ortho_block_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimm
       int b1, int b2, dummy_type_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmezprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R,
+      int ldR, int b1, int b2, dummy_type_zprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_zprimme *, PRIMME_INT, dummy_type_zprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrzprimme(dummy_type_zprimme *C, int ldC, dummy_type_zprimme *T, int ldT,
+      dummy_type_zprimme *r, int ldr, dummy_type_zprimme *R, int ldR, int b1, int b2,
+      dummy_type_zprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmezprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *VLtBVL,
       int ldVLtBVL, dummy_type_zprimme *fVLtBVL, int ldfVLtBVL, dummy_type_zprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -945,6 +1950,30 @@ int decompositionzprimme(dummy_type_zprimme *H, int n, int ldH, dummy_type_zprim
 int rank_estimationzprimme(dummy_type_zprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_zprimme(dummy_type_zprimme *VtV, int ldVtV, dummy_type_zprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_zprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_zprimme(int b, primme_context ctx);
+int Bortho_local_workspace_zprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmezprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacezprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmezprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_zprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_zprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_zprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_zprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_zprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -953,6 +1982,8 @@ int Bortho_gen_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_
 int ortho_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR, int b1, int b2,
                   dummy_type_magma_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int B_matvecmagma_hprimme(dummy_type_magma_hprimme *x, PRIMME_INT ldx, dummy_type_magma_hprimme *y, PRIMME_INT ldy,
       int bs, void *ctx_);
 int Bortho_block_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *VLtBVL,
@@ -965,6 +1996,14 @@ int ortho_block_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy
       int b1, int b2, dummy_type_magma_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmemagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R,
+      int ldR, int b1, int b2, dummy_type_magma_hprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_magma_hprimme *, PRIMME_INT, dummy_type_magma_hprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrmagma_hprimme(dummy_type_sprimme *C, int ldC, dummy_type_sprimme *T, int ldT,
+      dummy_type_sprimme *r, int ldr, dummy_type_sprimme *R, int ldR, int b1, int b2,
+      dummy_type_sprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmemagma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_sprimme *VLtBVL,
       int ldVLtBVL, dummy_type_sprimme *fVLtBVL, int ldfVLtBVL, dummy_type_sprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_magma_hprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -983,6 +2022,28 @@ int decompositionmagma_hprimme(dummy_type_sprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_hprimme(dummy_type_sprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_hprimme(dummy_type_sprimme *VtV, int ldVtV, dummy_type_sprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_magma_hprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_magma_hprimme(int b, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmemagma_hprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacemagma_hprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmemagma_hprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_magma_hprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_magma_hprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_magma_hprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_magma_hprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_magma_hprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -991,6 +2052,8 @@ int Bortho_gen_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_
 int ortho_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR, int b1, int b2,
                   dummy_type_magma_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int B_matvecmagma_kprimme(dummy_type_magma_kprimme *x, PRIMME_INT ldx, dummy_type_magma_kprimme *y, PRIMME_INT ldy,
       int bs, void *ctx_);
 int Bortho_block_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *VLtBVL,
@@ -1003,6 +2066,14 @@ int ortho_block_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy
       int b1, int b2, dummy_type_magma_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmemagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R,
+      int ldR, int b1, int b2, dummy_type_magma_kprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_magma_kprimme *, PRIMME_INT, dummy_type_magma_kprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrmagma_kprimme(dummy_type_cprimme *C, int ldC, dummy_type_cprimme *T, int ldT,
+      dummy_type_cprimme *r, int ldr, dummy_type_cprimme *R, int ldR, int b1, int b2,
+      dummy_type_cprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmemagma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_cprimme *VLtBVL,
       int ldVLtBVL, dummy_type_cprimme *fVLtBVL, int ldfVLtBVL, dummy_type_cprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_magma_kprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -1021,6 +2092,28 @@ int decompositionmagma_kprimme(dummy_type_cprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_kprimme(dummy_type_cprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_kprimme(dummy_type_cprimme *VtV, int ldVtV, dummy_type_cprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_magma_kprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_magma_kprimme(int b, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmemagma_kprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacemagma_kprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmemagma_kprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_magma_kprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_magma_kprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_magma_kprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_magma_kprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_magma_kprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -1029,6 +2122,8 @@ int Bortho_gen_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_
 int ortho_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R, int ldR, int b1, int b2,
                   dummy_type_magma_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int B_matvecmagma_sprimme(dummy_type_magma_sprimme *x, PRIMME_INT ldx, dummy_type_magma_sprimme *y, PRIMME_INT ldy,
       int bs, void *ctx_);
 int Bortho_block_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *VLtBVL,
@@ -1041,6 +2136,14 @@ int ortho_block_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy
       int b1, int b2, dummy_type_magma_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmemagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *R,
+      int ldR, int b1, int b2, dummy_type_magma_sprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_sprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_magma_sprimme *, PRIMME_INT, dummy_type_magma_sprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrmagma_sprimme(dummy_type_sprimme *C, int ldC, dummy_type_sprimme *T, int ldT,
+      dummy_type_sprimme *r, int ldr, dummy_type_sprimme *R, int ldR, int b1, int b2,
+      dummy_type_sprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmemagma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *VLtBVL,
       int ldVLtBVL, dummy_type_sprimme *fVLtBVL, int ldfVLtBVL, dummy_type_sprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_magma_sprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -1059,6 +2162,28 @@ int decompositionmagma_sprimme(dummy_type_sprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_sprimme(dummy_type_sprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_sprimme(dummy_type_sprimme *VtV, int ldVtV, dummy_type_sprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_magma_sprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_magma_sprimme(int b, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmemagma_sprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacemagma_sprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmemagma_sprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_magma_sprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_magma_sprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_magma_sprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_magma_sprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_magma_sprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -1067,6 +2192,8 @@ int Bortho_gen_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_
 int ortho_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R, int ldR, int b1, int b2,
                   dummy_type_magma_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int B_matvecmagma_cprimme(dummy_type_magma_cprimme *x, PRIMME_INT ldx, dummy_type_magma_cprimme *y, PRIMME_INT ldy,
       int bs, void *ctx_);
 int Bortho_block_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *VLtBVL,
@@ -1079,6 +2206,14 @@ int ortho_block_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy
       int b1, int b2, dummy_type_magma_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmemagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *R,
+      int ldR, int b1, int b2, dummy_type_magma_cprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_cprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_magma_cprimme *, PRIMME_INT, dummy_type_magma_cprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrmagma_cprimme(dummy_type_cprimme *C, int ldC, dummy_type_cprimme *T, int ldT,
+      dummy_type_cprimme *r, int ldr, dummy_type_cprimme *R, int ldR, int b1, int b2,
+      dummy_type_cprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmemagma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *VLtBVL,
       int ldVLtBVL, dummy_type_cprimme *fVLtBVL, int ldfVLtBVL, dummy_type_cprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_magma_cprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -1097,6 +2232,28 @@ int decompositionmagma_cprimme(dummy_type_cprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_cprimme(dummy_type_cprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_cprimme(dummy_type_cprimme *VtV, int ldVtV, dummy_type_cprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_magma_cprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_magma_cprimme(int b, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmemagma_cprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacemagma_cprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmemagma_cprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_magma_cprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_magma_cprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_magma_cprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_magma_cprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_magma_cprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_dprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_dprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -1105,6 +2262,8 @@ int Bortho_gen_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_
 int ortho_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *R, int ldR, int b1, int b2,
                   dummy_type_magma_dprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int B_matvecmagma_dprimme(dummy_type_magma_dprimme *x, PRIMME_INT ldx, dummy_type_magma_dprimme *y, PRIMME_INT ldy,
       int bs, void *ctx_);
 int Bortho_block_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *VLtBVL,
@@ -1117,6 +2276,14 @@ int ortho_block_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy
       int b1, int b2, dummy_type_magma_dprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_dprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmemagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *R,
+      int ldR, int b1, int b2, dummy_type_magma_dprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_dprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_magma_dprimme *, PRIMME_INT, dummy_type_magma_dprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrmagma_dprimme(dummy_type_dprimme *C, int ldC, dummy_type_dprimme *T, int ldT,
+      dummy_type_dprimme *r, int ldr, dummy_type_dprimme *R, int ldR, int b1, int b2,
+      dummy_type_dprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmemagma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *VLtBVL,
       int ldVLtBVL, dummy_type_dprimme *fVLtBVL, int ldfVLtBVL, dummy_type_dprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_magma_dprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -1135,6 +2302,28 @@ int decompositionmagma_dprimme(dummy_type_dprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_dprimme(dummy_type_dprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_dprimme(dummy_type_dprimme *VtV, int ldVtV, dummy_type_dprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_magma_dprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_magma_dprimme(int b, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmemagma_dprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacemagma_dprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmemagma_dprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_magma_dprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_magma_dprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_magma_dprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_magma_dprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_magma_dprimme(int n0, int n, primme_context ctx);
 int Bortho_gen_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R, int ldR,
       int b1, int b2, dummy_type_magma_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
@@ -1143,6 +2332,8 @@ int Bortho_gen_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_
 int ortho_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R, int ldR, int b1, int b2,
                   dummy_type_magma_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
                   PRIMME_INT nLocal, PRIMME_INT *iseed, primme_context ctx);
+int ortho_dcgs2_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, int b, PRIMME_INT nLocal,
+      int *delayed, primme_context ctx);
 int B_matvecmagma_zprimme(dummy_type_magma_zprimme *x, PRIMME_INT ldx, dummy_type_magma_zprimme *y, PRIMME_INT ldy,
       int bs, void *ctx_);
 int Bortho_block_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *VLtBVL,
@@ -1155,6 +2346,14 @@ int ortho_block_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy
       int b1, int b2, dummy_type_magma_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
       dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal, int maxRank,
       int *b2_out, primme_context ctx);
+int Bortho_cholqr_Sprimmemagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *R,
+      int ldR, int b1, int b2, dummy_type_magma_zprimme *locked, PRIMME_INT ldLocked,
+      int numLocked, dummy_type_zprimme *RLocked, int ldRLocked, PRIMME_INT nLocal,
+      int (*B)(dummy_type_magma_zprimme *, PRIMME_INT, dummy_type_magma_zprimme *, PRIMME_INT, int, void *),
+      void *Bctx, PRIMME_INT *iseed, int *b2_out, primme_context ctx);
+int update_R_cholqrmagma_zprimme(dummy_type_zprimme *C, int ldC, dummy_type_zprimme *T, int ldT,
+      dummy_type_zprimme *r, int ldr, dummy_type_zprimme *R, int ldR, int b1, int b2,
+      dummy_type_zprimme *RLocked, int ldRLocked, int numLocked, primme_context ctx);
 int Bortho_block_gen_Sprimmemagma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *VLtBVL,
       int ldVLtBVL, dummy_type_zprimme *fVLtBVL, int ldfVLtBVL, dummy_type_zprimme *R, PRIMME_INT ldR,
       int b1, int b2, dummy_type_magma_zprimme *locked, PRIMME_INT ldLocked, int numLocked,
@@ -1173,4 +2372,26 @@ int decompositionmagma_zprimme(dummy_type_zprimme *H, int n, int ldH, dummy_type
 int rank_estimationmagma_zprimme(dummy_type_zprimme *V, int n0, int n1, int n, int ldV);
 int update_cholesky_magma_zprimme(dummy_type_zprimme *VtV, int ldVtV, dummy_type_zprimme *fVtV, int ldfVtV,
       int n0, int n, primme_context ctx);
+int Bortho_gen_workspace_magma_zprimme(int b2, int numLocked, PRIMME_INT nLocal,
+      int withB, int withMass, primme_context ctx);
+int ortho_dcgs2_workspace_magma_zprimme(int b, primme_context ctx);
+int Bortho_cholqr_workspace_Sprimmemagma_zprimme(int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, int withB,
+      primme_context ctx);
+int Num_ortho_kernel_workspacemagma_zprimme(PRIMME_INT M, int nQ, int b2, int nX,
+      int withXo, int withW, primme_context ctx);
+int Bortho_block_gen_workspace_Sprimmemagma_zprimme(int withVLtBVL, int withR, int b1,
+      int b2, int numLocked, int withB, int withBV, int withRLocked,
+      PRIMME_INT nLocal, primme_context ctx);
+int Bortho_block_workspace_magma_zprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int Bortho_block_range_workspace_magma_zprimme(int withVLtBVL, int n, int maxnX,
+      int numLocked, int withBV, int withRLocked, PRIMME_INT nLocal,
+      primme_context ctx);
+int ortho_block_workspace_magma_zprimme(int withVLtBVL, int withR, int b1, int b2,
+      int numLocked, int withRLocked, PRIMME_INT nLocal, primme_context ctx);
+int ortho_single_iteration_workspace_magma_zprimme(int nQ, int withQtBQ,
+      int withInX, int nX, int withNorms, primme_context ctx);
+int update_cholesky_workspace_magma_zprimme(int n0, int n, primme_context ctx);
 #endif
@@ -62,11 +62,23 @@
 #include "template_normal.h"
 #include "common_eigs.h"
 #include "primme_interface.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* With adaptivePrecision, the solve in single precision stops when the      */
+/* residual norms are below this factor times the machine precision times |A| */
+
+#ifndef ADAPTIVE_PRECISION_TOL
+#define ADAPTIVE_PRECISION_TOL 100.0
+#endif
+
 /* Keep automatically generated headers under this section  */
 #ifndef CHECK_TEMPLATE
 #include "primme_c.h"
 #include "main_iter.h"
 #include "auxiliary_eigs.h"
+#include "ortho.h"
 #endif
 
 /*******************************************************************************
@@ -104,7 +116,7 @@ int Xprimme(XEVAL *evals, XSCALAR *evecs, XREAL *resNorms,
             primme_params *primme) {
 
    return Xprimme_aux_Sprimme((void *)evals, (void *)evecs, (void *)resNorms, primme,
-         PRIMME_OP_SCALAR);
+         PRIMME_OP_SCALAR, NULL, 0);
 }
 
 // Definition for *hsprimme, *ksprimme, and *kcprimme
@@ -124,12 +136,192 @@ int Xsprimme(KIND(float, PRIMME_COMPLEX_FLOAT) * evals, XSCALAR *evecs,
       float *resNorms, primme_params *primme) {
 
    return Xprimme_aux_Sprimme((void *)evals, (void *)evecs, (void *)resNorms, primme,
-         primme_op_float);
+         primme_op_float, NULL, 0);
 }
 
 #  undef Xsprimme
 #endif
 
+/*******************************************************************************
+ * Subroutine Xprimme_solve - Like Xprimme, but the working buffers are taken
+ *    from the workspace kept in the solver handle, and the parameters are
+ *    only checked if they changed since the last solve with the handle. The
+ *    workspace grows to the size that the memory query says when the setup
+ *    changes, so the solves do not take memory from the heap.
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * evals, evecs, resNorms  As in Xprimme
+ *
+ * solver  The handle with the parameters and the workspace
+ *
+ * Return Value
+ * ------------
+ * return  error code
+ ******************************************************************************/
+
+int Xprimme_solve(XEVAL *evals, XSCALAR *evecs, XREAL *resNorms,
+      primme_solver *solver) {
+
+   static const char kind = 0; /* tells apart the variants of Xprimme_solve */
+   primme_params *primme = solver->primme;
+   void *workspace = primme->workspace;
+   size_t lworkspace = primme->lworkspace;
+   int ret = 0;
+
+   /* If the setup has changed, query the size of the workspace and grow */
+   /* it if needed. The query takes the context out of the current       */
+   /* workspace, so it does not call malloc either. If malloc fails, the */
+   /* solver takes the memory from the heap as usual.                    */
+
+   int checked = solver->checkedKind == &kind && evals && evecs && resNorms &&
+                 primme_params_same_setup(&solver->checked, primme);
+   if (!checked) {
+      primme->workspace = solver->workspace;
+      primme->lworkspace = solver->lworkspace;
+      ret = Xprimme_aux_Sprimme(
+            NULL, NULL, NULL, primme, PRIMME_OP_SCALAR, NULL, 0);
+      if (ret == 0 && primme->lworkspace > solver->lworkspace) {
+         free(solver->workspace);
+         solver->workspace = malloc(primme->lworkspace);
+         solver->lworkspace = solver->workspace ? primme->lworkspace : 0;
+      }
+   }
+
+   if (ret == 0) {
+      primme->workspace = solver->workspace;
+      primme->lworkspace = solver->lworkspace;
+      ret = Xprimme_aux_Sprimme((void *)evals, (void *)evecs, (void *)resNorms,
+            primme, PRIMME_OP_SCALAR, NULL, checked);
+   }
+
+   /* Keep the setup that passed the checks, with the defaults set */
+
+   primme->workspace = workspace;
+   primme->lworkspace = lworkspace;
+   if (ret == 0) {
+      memcpy(&solver->checked, primme, sizeof(primme_params));
+      solver->checkedKind = &kind;
+   } else {
+      solver->checkedKind = NULL;
+   }
+   return ret;
+}
+
+/*******************************************************************************
+ * Subroutine Xprimme_batch - Solve several independent problems. If PRIMME is
+ *    built with OpenMP, the problems are distributed dynamically among the
+ *    threads, so that a thread takes the next problem when it finishes one.
+ *    Every thread keeps a workspace for its solves, which grows to the size
+ *    that the memory query says for every new setup; so the solves do not
+ *    take memory from the heap. Every thread also keeps the setup of its last
+ *    successful solve, and the parameters of a problem with the same setup
+ *    are not checked again.
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * numProblems  Number of problems
+ *
+ * evals, evecs, resNorms  The arrays for every problem, as in Xprimme
+ *
+ * primme  Array with the parameters of every problem
+ *
+ * ret     If not NULL, the error code of every problem
+ *
+ * Return Value
+ * ------------
+ * return  zero if all solves succeed, or the error code of the first problem
+ *         that failed
+ ******************************************************************************/
+
+int Xprimme_batch(int numProblems, XEVAL **evals, XSCALAR **evecs,
+      XREAL **resNorms, primme_params *primme, int *ret) {
+
+   int i, firstError = numProblems, err = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+   {
+      void *workspace = NULL;
+      size_t lworkspace = 0;
+      primme_params checked, setup;
+      int hasChecked = 0;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (i = 0; i < numProblems; i++) {
+         primme_params *p = &primme[i];
+
+         /* Skip the checks if the problem has the same setup as the last */
+         /* one that passed them in this thread                           */
+
+         memcpy(&setup, p, sizeof(primme_params));
+         int isChecked = hasChecked && evals[i] && evecs[i] && resNorms[i] &&
+                         primme_params_same_setup(&checked, &setup);
+
+         /* Use the thread's workspace if the caller didn't give one. For */
+         /* a new setup, grow it first to the size of the memory query    */
+
+         int r = 0;
+         int ownWorkspace = (p->workspace == NULL);
+         if (ownWorkspace && !isChecked) {
+            p->workspace = workspace;
+            p->lworkspace = lworkspace;
+            r = Xprimme_aux_Sprimme(
+                  NULL, NULL, NULL, p, PRIMME_OP_SCALAR, NULL, 0);
+            if (r == 0 && p->lworkspace > lworkspace) {
+               free(workspace);
+               workspace = malloc(p->lworkspace);
+               lworkspace = workspace ? p->lworkspace : 0;
+            }
+         }
+         if (ownWorkspace) {
+            p->workspace = workspace;
+            p->lworkspace = lworkspace;
+         }
+
+         /* A profiler records a single sequence of calls, so it is not */
+         /* used by solves running concurrently                         */
+
+         primme_profiler *profiler = p->profiler;
+#ifdef _OPENMP
+         if (omp_get_num_threads() > 1) p->profiler = NULL;
+#endif
+
+         if (r == 0) {
+            r = Xprimme_aux_Sprimme((void *)evals[i], (void *)evecs[i],
+                  (void *)resNorms[i], p, PRIMME_OP_SCALAR, NULL, isChecked);
+         }
+         p->profiler = profiler;
+         if (r == 0 && !isChecked) {
+            memcpy(&checked, &setup, sizeof(primme_params));
+            hasChecked = 1;
+         }
+         if (ownWorkspace) {
+            p->workspace = NULL;
+            p->lworkspace = 0;
+         }
+
+         if (ret) ret[i] = r;
+         if (r != 0) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            if (i < firstError) {
+               firstError = i;
+               err = r;
+            }
+         }
+      }
+
+      free(workspace);
+   }
+
+   return err;
+}
+
 /*******************************************************************************
  * Subroutine Xprimme_aux - set defaults depending on the callee's type, and
  *    call wrapper_Sprimme with type set in internalPrecision. 
@@ -149,6 +341,13 @@ int Xsprimme(KIND(float, PRIMME_COMPLEX_FLOAT) * evals, XSCALAR *evecs,
  *
  * evals_resNorms_type The type of the arrays evals and resNorsm.
  *
+ * arena   If not NULL, the arena of the caller from which the working
+ *         buffers are taken (used by primme_svds); otherwise the buffers
+ *         are taken from a new arena on primme->workspace
+ *
+ * checked If nonzero, the parameters passed the checks in a previous call
+ *         and are not checked again (used by Xprimme_solve)
+ *
  * Return Value
  * ------------
  * return  error code
@@ -156,13 +355,25 @@ int Xsprimme(KIND(float, PRIMME_COMPLEX_FLOAT) * evals, XSCALAR *evecs,
 
 TEMPLATE_PLEASE
 int Xprimme_aux_Sprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type) {
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked) {
 
 #ifdef SUPPORTED_TYPE
 
    /* Generate context */
 
    primme_context ctx = primme_get_context(primme);
+   ctx.checkedParams = checked;
+
+   /* Serve the allocations during the solve from an arena, which takes */
+   /* the memory from primme->workspace if given. If it fails, the       */
+   /* allocations are done with malloc                                   */
+
+   if (arena) {
+      Mem_attach_arena(arena, &ctx);
+   } else {
+      Mem_create_arena(primme->workspace, primme->lworkspace, &ctx);
+   }
 
    /* Set the current type as the default type for user's operators */
 
@@ -190,34 +401,59 @@ int Xprimme_aux_Sprimme(void *evals, void *evecs, void *resNorms,
    int ret;
    primme_op_datatype t = primme->internalPrecision;
    if (t == primme_op_default) t = PRIMME_OP_SCALAR;
-   switch (t) {
-#  ifdef SUPPORTED_HALF_TYPE
-   case primme_op_half:
-      CHKERRVAL(wrapper_Shprimme(evals, evecs, resNorms, evals_resNorms_type,
-                      PRIMME_OP_SCALAR, &outInitSize, ctx),
+
+   /* Start in single precision if asked for and supported; the search */
+   /* space is kept in memory, which is not supported on GPUs or for    */
+   /* generalized problems                                              */
+
+   int adaptive = 0;
+#  if defined(USE_HOST) && !defined(PRIMME_WITHOUT_FLOAT) &&                   \
+         (defined(USE_DOUBLE) || defined(USE_DOUBLECOMPLEX))
+   adaptive = primme->adaptivePrecision && t == primme_op_double &&
+              evals != NULL && evecs != NULL && resNorms != NULL &&
+              primme->convTestFun == NULL &&
+              primme->massMatrixMatvec == NULL &&
+              primme->checkpointFile == NULL;
+#  endif
+
+   if (adaptive) {
+      CHKERRVAL(adaptive_precision(evals, evecs, resNorms,
+                      evals_resNorms_type, &outInitSize, ctx),
             &ret);
-      break;
+   } else {
+      switch (t) {
+#  ifdef SUPPORTED_HALF_TYPE
+      case primme_op_half:
+         CHKERRVAL(wrapper_Shprimme(evals, evecs, resNorms,
+                         evals_resNorms_type, PRIMME_OP_SCALAR, &outInitSize,
+                         ctx),
+               &ret);
+         break;
 #  endif
 #  ifndef PRIMME_WITHOUT_FLOAT
-   case primme_op_float:
-      CHKERRVAL(wrapper_Ssprimme(evals, evecs, resNorms, evals_resNorms_type,
-                      PRIMME_OP_SCALAR, &outInitSize, ctx),
-            &ret);
-      break;
+      case primme_op_float:
+         CHKERRVAL(wrapper_Ssprimme(evals, evecs, resNorms,
+                         evals_resNorms_type, PRIMME_OP_SCALAR, &outInitSize,
+                         ctx),
+               &ret);
+         break;
 #  endif
-   case primme_op_double:
-      CHKERRVAL(wrapper_Sdprimme(evals, evecs, resNorms, evals_resNorms_type,
-                      PRIMME_OP_SCALAR, &outInitSize, ctx),
-            &ret);
-      break;
+      case primme_op_double:
+         CHKERRVAL(wrapper_Sdprimme(evals, evecs, resNorms,
+                         evals_resNorms_type, PRIMME_OP_SCALAR, &outInitSize,
+                         ctx),
+               &ret);
+         break;
 #  ifdef PRIMME_WITH_NATIVE_QUAD
-   case primme_op_quad:
-      CHKERRVAL(wrapper_Sqprimme(evals, evecs, resNorms, evals_resNorms_type,
-                      PRIMME_OP_SCALAR, &outInitSize, ctx),
-            &ret);
-      break;
+      case primme_op_quad:
+         CHKERRVAL(wrapper_Sqprimme(evals, evecs, resNorms,
+                         evals_resNorms_type, PRIMME_OP_SCALAR, &outInitSize,
+                         ctx),
+               &ret);
+         break;
 #  endif
-   default: ret = PRIMME_FUNCTION_UNAVAILABLE;
+      default: ret = PRIMME_FUNCTION_UNAVAILABLE;
+      }
    }
 
    /* Free context */
@@ -290,8 +526,9 @@ int wrapper_Sprimme(void *evals, void *evecs, void *resNorms,
 
    /* Set some defaults for sequential programs */
 
-   if (primme->numProcs <= 1 && evals != NULL && evecs != NULL &&
-         resNorms != NULL) {
+   int query = (evals == NULL && evecs == NULL && resNorms == NULL);
+   if (primme->numProcs <= 1 &&
+         (query || (evals != NULL && evecs != NULL && resNorms != NULL))) {
       primme->nLocal = primme->n;
       primme->procID = 0;
    }
@@ -330,10 +567,15 @@ int wrapper_Sprimme(void *evals, void *evecs, void *resNorms,
       }
    }
 
-   /* Deprecated input:                                              */
+   /* Memory query: if evals, evecs and resNorms are NULL, return in */
+   /* primme->lworkspace the size of the workspace for the solver     */
 
-   if (evals == NULL && evecs == NULL && resNorms == NULL)
+   if (query) {
+      CHKERR(workspace_size(
+            evals_resNorms_type, evecs_type, &primme->lworkspace, ctx));
+      *outInitSize = primme->initSize;
       return 0;
+   }
 
    /* Reset random number seed if inappropriate for DLARENV */
    /* Yields unique quadruples per proc if procID < 4096^3  */
@@ -366,10 +608,13 @@ int wrapper_Sprimme(void *evals, void *evecs, void *resNorms,
       primme->monitorFun_type = PRIMME_OP_SCALAR;
    }
 
-   /* Check primme input data for bounds, correct values etc. */
+   /* Check primme input data for bounds, correct values etc., unless */
+   /* they passed the checks already with the same setup              */
 
-   CHKERR(coordinated_exit(check_params_coherence(ctx), ctx));
-   CHKERR(check_input(evals, evecs, resNorms, primme))
+   if (!ctx.checkedParams) {
+      CHKERR(coordinated_exit(check_params_coherence(ctx), ctx));
+      CHKERR(check_input(evals, evecs, resNorms, primme))
+   }
        
    /* Cast evals, evecs and resNorms to working precision */
 
@@ -420,6 +665,250 @@ int wrapper_Sprimme(void *evals, void *evecs, void *resNorms,
    return ret;
 }
 
+/*******************************************************************************
+ * Subroutine adaptive_precision - Solve in single precision until the
+ *    residual norms are close to the single machine precision times |A|, and
+ *    continue in the precision of the call from the search space of the
+ *    first solve, instead of from scratch (see primme->adaptivePrecision).
+ *    The basis is passed from one solve to the other as with primme->recycle;
+ *    the second one casts V, orthonormalizes it again and computes W=A*V and
+ *    the projection in the new precision. If primme->eps is reachable in
+ *    single precision, only the first solve is done and the returned vectors
+ *    are orthonormalized again.
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * evals, evecs, resNorms  As in wrapper_Sprimme
+ *
+ * evals_resNorms_type The type of the arrays evals and resNorsm.
+ *
+ * outInitSize The number of columns returned back.
+ *
+ * ctx    primme context
+ *
+ * Return Value
+ * ------------
+ * return  error code
+ ******************************************************************************/
+
+STATIC int adaptive_precision(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   primme_params primme0 = *primme;
+
+   /* Solve in single precision, keeping the search space at the end. The */
+   /* eigenpairs converged so far are the initial guesses of the second   */
+   /* solve. Stopping by maxMatvecs is not an error at this point.       */
+   /* If the requested tolerance is not below the single-precision one,  */
+   /* the first solve is the whole solve.                                 */
+
+   int onlySingle = primme->eps >= ADAPTIVE_PRECISION_TOL * FLT_EPSILON;
+   primme->eps = max(primme->eps, ADAPTIVE_PRECISION_TOL * FLT_EPSILON);
+   if (!onlySingle) primme->recycle = 1;
+   primme->matrixDeltaMatvec = NULL;
+   int ret = wrapper_Ssprimme(evals, evecs, resNorms, evals_resNorms_type,
+         PRIMME_OP_SCALAR, outInitSize, ctx);
+
+   /* The products in the first solve only save memory traffic if        */
+   /* matrixMatvec works in single precision. But then the second solve  */
+   /* gets W=A*V with errors of about the single machine precision times */
+   /* |A| too, and it cannot reach a smaller tolerance; stop here instead */
+   /* of iterating until maxMatvecs.                                      */
+
+   if (primme->matrixMatvec_type != primme_op_float) {
+      PRINTF(1, "Warning: adaptivePrecision is set but matrixMatvec_type is "
+                "not primme_op_float; the matrix-vector products cost as "
+                "in double precision");
+   } else if (!onlySingle) {
+      PRINTF(1, "Warning: adaptivePrecision is set and matrixMatvec_type is "
+                "primme_op_float; eps=%g is not reachable with "
+                "matrix-vector products in single precision",
+            primme0.eps);
+      if (ret == 0) ret = PRIMME_MAIN_ITER_FAILURE;
+      onlySingle = 1;
+      if (!primme0.recycle) primme_free(primme);
+   }
+
+   /* In that case, just orthonormalize the returned vectors again in the */
+   /* precision of the call; their residual norms change by about the    */
+   /* single machine precision times |A|, which is below the tolerance if */
+   /* onlySingle was set from the start                                   */
+
+   if (onlySingle) {
+      primme->eps = primme0.eps;
+      primme->recycle = primme0.recycle;
+      primme->matrixDeltaMatvec = primme0.matrixDeltaMatvec;
+      if ((ret == 0 || ret == PRIMME_MAIN_ITER_FAILURE) && *outInitSize > 0) {
+         CHKERR(ortho_Sprimme((SCALAR *)evecs, primme->ldevecs, NULL, 0,
+               primme->numOrthoConst,
+               primme->numOrthoConst + *outInitSize - 1, NULL, 0, 0,
+               primme->nLocal, primme->iseed, ctx));
+      }
+      return ret;
+   }
+
+   /* Restore the parameters changed by the first solve */
+
+   primme_stats stats0 = primme->stats;
+   void *recycledBasis = primme->recycledBasis;
+   *primme = primme0;
+   primme->recycledBasis = recycledBasis;
+   if (ret != PRIMME_MAIN_ITER_FAILURE) CHKERR(ret);
+
+   /* Continue in the precision of the call */
+
+   primme->recycle = 1;
+   primme->matrixDeltaMatvec = NULL;
+   primme->initSize = *outInitSize;
+   primme->maxMatvecs = max(0, primme0.maxMatvecs - stats0.numMatvecs);
+   ret = wrapper_Sprimme(evals, evecs, resNorms, evals_resNorms_type,
+         PRIMME_OP_SCALAR, outInitSize, ctx);
+
+   primme->recycle = primme0.recycle;
+   primme->matrixDeltaMatvec = primme0.matrixDeltaMatvec;
+   primme->maxMatvecs = primme0.maxMatvecs;
+   if (!primme->recycle) primme_free(primme);
+
+   /* Report the work of both solves */
+
+   primme->stats.numOuterIterations += stats0.numOuterIterations;
+   primme->stats.numRestarts += stats0.numRestarts;
+   primme->stats.numMatvecs += stats0.numMatvecs;
+   primme->stats.numPreconds += stats0.numPreconds;
+   primme->stats.numGlobalSum += stats0.numGlobalSum;
+   primme->stats.numBroadcast += stats0.numBroadcast;
+   primme->stats.volumeGlobalSum += stats0.volumeGlobalSum;
+   primme->stats.volumeBroadcast += stats0.volumeBroadcast;
+   primme->stats.flopsDense += stats0.flopsDense;
+   primme->stats.numOrthoInnerProds += stats0.numOrthoInnerProds;
+   primme->stats.elapsedTime += stats0.elapsedTime;
+   primme->stats.timeMatvec += stats0.timeMatvec;
+   primme->stats.timePrecond += stats0.timePrecond;
+   primme->stats.timeOrtho += stats0.timeOrtho;
+   primme->stats.timeGlobalSum += stats0.timeGlobalSum;
+   primme->stats.timeBroadcast += stats0.timeBroadcast;
+   primme->stats.timeDense += stats0.timeDense;
+   primme->stats.numOrthoGlobalSum += stats0.numOrthoGlobalSum;
+   primme->stats.numOrthoVectors += stats0.numOrthoVectors;
+
+   return ret;
+}
+
+
+/******************************************************************************
+ * Subroutine workspace_size - return the size of primme->workspace so that
+ *    all allocations in wrapper_Sprimme are taken from it. The allocations
+ *    of the solve are replayed on a dry arena (see main_iter_workspace), and
+ *    the size is the peak of that arena. If the context already has a dry
+ *    arena (the memory query of primme_svds), the allocations are replayed
+ *    on it instead, on top of the blocks of the caller.
+ *
+ * INPUT
+ * -----
+ *  evals_resNorms_type  The type of the arrays evals and resNorms
+ *  evecs_type           The type of the array evecs
+ *
+ * OUTPUT
+ * ------
+ *  size                 Number of bytes
+ *
+ ******************************************************************************/
+
+STATIC int workspace_size(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   int nested = Mem_dry_run(ctx);
+   if (!nested) CHKERR(Mem_create_dry_arena(&ctx));
+   Mem_push_frame(&ctx);
+
+   /* With adaptivePrecision, the solve in single precision and the solve */
+   /* in the precision of the call take the memory one after the other    */
+   /* (see adaptive_precision)                                            */
+
+   int adaptive = 0;
+#if defined(USE_HOST) && !defined(PRIMME_WITHOUT_FLOAT) &&                     \
+      (defined(USE_DOUBLE) || defined(USE_DOUBLECOMPLEX))
+   adaptive = primme->adaptivePrecision && primme->convTestFun == NULL &&
+              primme->massMatrixMatvec == NULL &&
+              primme->checkpointFile == NULL;
+#endif
+
+   if (adaptive) {
+      primme_params primme0 = *primme;
+      primme_context ctx0 = ctx;
+      ctx0.primme = &primme0;
+      primme0.recycle = 1;
+      primme0.matrixDeltaMatvec = NULL;
+      CHKERR(wrapper_workspace_Ssprimme(evals_resNorms_type, evecs_type, ctx0));
+      CHKERR(Bortho_gen_workspace_Sprimme(
+            primme->numOrthoConst + primme->numEvals - 1, 0, primme->nLocal,
+            0 /* no B */, 0 /* no mass */, ctx));
+      primme0.initSize = max(primme->initSize, primme->numEvals);
+      CHKERR(wrapper_workspace_Sprimme(evals_resNorms_type, evecs_type, ctx0));
+   } else {
+      CHKERR(wrapper_workspace_Sprimme(evals_resNorms_type, evecs_type, ctx));
+   }
+
+   *size = Mem_workspace_size(ctx.arena->peak);
+
+   Mem_pop_frame(&ctx);
+   if (!nested) CHKERR(Mem_destroy_arena(&ctx));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine wrapper_workspace - Take from the dry arena of the context the
+ *    same blocks that wrapper_Sprimme takes for arrays evals, resNorms and
+ *    evecs of the given types. See main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int wrapper_workspace_Sprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx) {
+
+   /* The default callbacks set by wrapper_Sprimme change the blocks taken */
+
+   primme_params primme0 = *ctx.primme;
+   primme_params *primme = &primme0;
+   ctx.primme = primme;
+   if (!primme->convTestFun) {
+      primme->convTestFun = convTestFunAbsolute;
+      primme->convTestFun_type = PRIMME_OP_SCALAR;
+   }
+   if (!primme->monitorFun) {
+      primme->monitorFun = default_monitor;
+      primme->monitorFun_type = PRIMME_OP_SCALAR;
+   }
+
+   HEVAL *evals0;
+   HREAL *resNorms0;
+   SCALAR *evecs0;
+   CHKERR(KIND(Num_matrix_astype_RHprimme, Num_matrix_astype_SHprimme)(NULL, 1,
+         primme->numEvals, 1, evals_resNorms_type, (void **)&evals0, NULL,
+         PRIMME_OP_HREAL, 1 /* alloc */, 0 /* not copy */, ctx));
+   CHKERR(Num_matrix_astype_Sprimme(NULL, primme->nLocal,
+         primme->numOrthoConst + max(primme->numEvals, primme->initSize),
+         primme->ldevecs, evecs_type, (void **)&evecs0, NULL,
+         PRIMME_OP_SCALAR, 1 /* alloc */, 0 /* not copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, primme->numEvals, 1,
+         evals_resNorms_type, (void **)&resNorms0, NULL, PRIMME_OP_HREAL,
+         1 /* alloc */, 0 /* not copy */, ctx));
+
+   CHKERR(main_iter_workspace_Sprimme(ctx));
+
+   if (evals0) {
+      CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(evals0, ctx));
+   }
+   if (evecs0) CHKERR(Num_free_Sprimme(evecs0, ctx));
+   if (resNorms0) CHKERR(Num_free_RHprimme(resNorms0, ctx));
+
+   return 0;
+}
 
 /******************************************************************************
  * Subroutine check_input - checks the value of the input arrays, evals,
@@ -448,6 +937,7 @@ STATIC int check_input(
    else if (primme->matrixMatvec == NULL) 
       ret = -7;
    else if (primme->applyPreconditioner == NULL && 
+            primme->correctionParams.chebyshevDegree <= 0 &&
             primme->correctionParams.precondition > 0 ) 
       ret = -8;
    else if (primme->numEvals > primme->n)
@@ -517,6 +1007,9 @@ STATIC int check_input(
    else if (primme->massMatrixMatvec &&
             primme->projectionParams.projection != primme_proj_RR)
       ret = -39;
+   else if (primme->initBasisMode == primme_init_checkpoint &&
+            primme->checkpointFile == NULL)
+      ret = -36;
    /* Please keep this if instruction at the end */
    else if ( primme->target == primme_largest_abs ||
              primme->target == primme_closest_geq ||
@@ -731,6 +1224,10 @@ STATIC void default_monitor(void *basisEvals_, int *basisSize, int *basisFlags,
 STATIC int check_params_coherence(primme_context ctx) {
    primme_params *primme = ctx.primme;
 
+   /* The checks below rely on the broadcast, so don't skip it */
+
+   ctx.commReduce = 0;
+
    /* Check number of procs and procs with id zero */
 
    HREAL aux[2] = {(HREAL)1.0, (HREAL)(ctx.procID == 0 ? 1.0 : 0.0)};
@@ -766,6 +1263,7 @@ STATIC int check_params_coherence(primme_context ctx) {
    PARALLEL_CHECK(primme->invBNorm);
    PARALLEL_CHECK(primme->eps);
    PARALLEL_CHECK(primme->orth);
+   PARALLEL_CHECK(primme->commReduce);
    PARALLEL_CHECK(primme->initBasisMode);
    PARALLEL_CHECK(primme->projectionParams.projection);
    PARALLEL_CHECK(primme->restartingParams.maxPrevRetain);
@@ -780,6 +1278,8 @@ STATIC int check_params_coherence(primme_context ctx) {
    PARALLEL_CHECK(primme->correctionParams.projectors.SkewX);
    PARALLEL_CHECK(primme->correctionParams.convTest);
    PARALLEL_CHECK(primme->correctionParams.relTolBase);
+   PARALLEL_CHECK(primme->correctionParams.chebyshevDegree);
+   PARALLEL_CHECK(primme->adaptivePrecision);
 
    return 0;
 }
@@ -124,7 +124,8 @@
 #  define Xprimme_aux_RHqprimme CONCAT(Xprimme_aux_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
 #endif
 int Xprimme_aux_dprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 #if !defined(CHECK_TEMPLATE) && !defined(wrapper_Sprimme)
 #  define wrapper_Sprimme CONCAT(wrapper_,WITH_KIND(SCALAR_SUF))
 #endif
@@ -218,6 +219,109 @@ int Xprimme_aux_dprimme(void *evals, void *evecs, void *resNorms,
 int wrapper_dprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(adaptive_precision)
+#  define adaptive_precision CONCAT(adaptive_precision,WITH_KIND(SCALAR_SUF))
+#endif
+int adaptive_precisiondprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(workspace_size)
+#  define workspace_size CONCAT(workspace_size,WITH_KIND(SCALAR_SUF))
+#endif
+int workspace_sizedprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Sprimme)
+#  define wrapper_workspace_Sprimme CONCAT(wrapper_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Rprimme)
+#  define wrapper_workspace_Rprimme CONCAT(wrapper_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SHprimme)
+#  define wrapper_workspace_SHprimme CONCAT(wrapper_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RHprimme)
+#  define wrapper_workspace_RHprimme CONCAT(wrapper_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SXprimme)
+#  define wrapper_workspace_SXprimme CONCAT(wrapper_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RXprimme)
+#  define wrapper_workspace_RXprimme CONCAT(wrapper_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Shprimme)
+#  define wrapper_workspace_Shprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Rhprimme)
+#  define wrapper_workspace_Rhprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Ssprimme)
+#  define wrapper_workspace_Ssprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Rsprimme)
+#  define wrapper_workspace_Rsprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Sdprimme)
+#  define wrapper_workspace_Sdprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Rdprimme)
+#  define wrapper_workspace_Rdprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Sqprimme)
+#  define wrapper_workspace_Sqprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_Rqprimme)
+#  define wrapper_workspace_Rqprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SXhprimme)
+#  define wrapper_workspace_SXhprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RXhprimme)
+#  define wrapper_workspace_RXhprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SXsprimme)
+#  define wrapper_workspace_SXsprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RXsprimme)
+#  define wrapper_workspace_RXsprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SXdprimme)
+#  define wrapper_workspace_SXdprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RXdprimme)
+#  define wrapper_workspace_RXdprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SXqprimme)
+#  define wrapper_workspace_SXqprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RXqprimme)
+#  define wrapper_workspace_RXqprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SHhprimme)
+#  define wrapper_workspace_SHhprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RHhprimme)
+#  define wrapper_workspace_RHhprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SHsprimme)
+#  define wrapper_workspace_SHsprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RHsprimme)
+#  define wrapper_workspace_RHsprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SHdprimme)
+#  define wrapper_workspace_SHdprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RHdprimme)
+#  define wrapper_workspace_RHdprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_SHqprimme)
+#  define wrapper_workspace_SHqprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(wrapper_workspace_RHqprimme)
+#  define wrapper_workspace_RHqprimme CONCAT(wrapper_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int wrapper_workspace_dprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(check_input)
 #  define check_input CONCAT(check_input,WITH_KIND(SCALAR_SUF))
 #endif
@@ -245,10 +349,18 @@ int check_params_coherencedprimme(primme_context ctx);
 #endif
 int coordinated_exitdprimme(int ret, primme_context ctx);
 int Xprimme_aux_hprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_hprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionhprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizehprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_hprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputhprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutehprimme(double *eval, void *evec, double *rNorm,
@@ -261,10 +373,18 @@ void default_monitorhprimme(void *basisEvals_, int *basisSize, int *basisFlags,
 int check_params_coherencehprimme(primme_context ctx);
 int coordinated_exithprimme(int ret, primme_context ctx);
 int Xprimme_aux_kprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_kprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionkprimme_normal(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizekprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_kprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputkprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutekprimme_normal(double *eval, void *evec, double *rNorm,
@@ -277,10 +397,18 @@ void default_monitorkprimme_normal(void *basisEvals_, int *basisSize, int *basis
 int check_params_coherencekprimme_normal(primme_context ctx);
 int coordinated_exitkprimme_normal(int ret, primme_context ctx);
 int Xprimme_aux_kprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_kprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionkprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizekprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_kprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputkprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutekprimme(double *eval, void *evec, double *rNorm,
@@ -293,10 +421,18 @@ void default_monitorkprimme(void *basisEvals_, int *basisSize, int *basisFlags,
 int check_params_coherencekprimme(primme_context ctx);
 int coordinated_exitkprimme(int ret, primme_context ctx);
 int Xprimme_aux_sprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_sprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionsprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizesprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_sprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputsprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutesprimme(double *eval, void *evec, double *rNorm,
@@ -309,10 +445,18 @@ void default_monitorsprimme(void *basisEvals_, int *basisSize, int *basisFlags,
 int check_params_coherencesprimme(primme_context ctx);
 int coordinated_exitsprimme(int ret, primme_context ctx);
 int Xprimme_aux_cprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_cprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisioncprimme_normal(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizecprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_cprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputcprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutecprimme_normal(double *eval, void *evec, double *rNorm,
@@ -325,10 +469,18 @@ void default_monitorcprimme_normal(void *basisEvals_, int *basisSize, int *basis
 int check_params_coherencecprimme_normal(primme_context ctx);
 int coordinated_exitcprimme_normal(int ret, primme_context ctx);
 int Xprimme_aux_cprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_cprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisioncprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizecprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_cprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputcprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutecprimme(double *eval, void *evec, double *rNorm,
@@ -341,10 +493,18 @@ void default_monitorcprimme(void *basisEvals_, int *basisSize, int *basisFlags,
 int check_params_coherencecprimme(primme_context ctx);
 int coordinated_exitcprimme(int ret, primme_context ctx);
 int Xprimme_aux_zprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_zprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionzprimme_normal(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizezprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_zprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputzprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutezprimme_normal(double *eval, void *evec, double *rNorm,
@@ -357,10 +517,18 @@ void default_monitorzprimme_normal(void *basisEvals_, int *basisSize, int *basis
 int check_params_coherencezprimme_normal(primme_context ctx);
 int coordinated_exitzprimme_normal(int ret, primme_context ctx);
 int Xprimme_aux_zprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_zprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionzprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizezprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_zprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputzprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutezprimme(double *eval, void *evec, double *rNorm,
@@ -373,10 +541,18 @@ void default_monitorzprimme(void *basisEvals_, int *basisSize, int *basisFlags,
 int check_params_coherencezprimme(primme_context ctx);
 int coordinated_exitzprimme(int ret, primme_context ctx);
 int Xprimme_aux_magma_hprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_magma_hprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionmagma_hprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizemagma_hprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_magma_hprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputmagma_hprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_hprimme(double *eval, void *evec, double *rNorm,
@@ -389,10 +565,18 @@ void default_monitormagma_hprimme(void *basisEvals_, int *basisSize, int *basisF
 int check_params_coherencemagma_hprimme(primme_context ctx);
 int coordinated_exitmagma_hprimme(int ret, primme_context ctx);
 int Xprimme_aux_magma_kprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_magma_kprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionmagma_kprimme_normal(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizemagma_kprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_magma_kprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputmagma_kprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_kprimme_normal(double *eval, void *evec, double *rNorm,
@@ -405,10 +589,18 @@ void default_monitormagma_kprimme_normal(void *basisEvals_, int *basisSize, int
 int check_params_coherencemagma_kprimme_normal(primme_context ctx);
 int coordinated_exitmagma_kprimme_normal(int ret, primme_context ctx);
 int Xprimme_aux_magma_kprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_magma_kprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionmagma_kprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizemagma_kprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_magma_kprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputmagma_kprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_kprimme(double *eval, void *evec, double *rNorm,
@@ -421,10 +613,18 @@ void default_monitormagma_kprimme(void *basisEvals_, int *basisSize, int *basisF
 int check_params_coherencemagma_kprimme(primme_context ctx);
 int coordinated_exitmagma_kprimme(int ret, primme_context ctx);
 int Xprimme_aux_magma_sprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_magma_sprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionmagma_sprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizemagma_sprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_magma_sprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputmagma_sprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_sprimme(double *eval, void *evec, double *rNorm,
@@ -437,10 +637,18 @@ void default_monitormagma_sprimme(void *basisEvals_, int *basisSize, int *basisF
 int check_params_coherencemagma_sprimme(primme_context ctx);
 int coordinated_exitmagma_sprimme(int ret, primme_context ctx);
 int Xprimme_aux_magma_cprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_magma_cprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionmagma_cprimme_normal(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizemagma_cprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_magma_cprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputmagma_cprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_cprimme_normal(double *eval, void *evec, double *rNorm,
@@ -453,10 +661,18 @@ void default_monitormagma_cprimme_normal(void *basisEvals_, int *basisSize, int
 int check_params_coherencemagma_cprimme_normal(primme_context ctx);
 int coordinated_exitmagma_cprimme_normal(int ret, primme_context ctx);
 int Xprimme_aux_magma_cprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_magma_cprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionmagma_cprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizemagma_cprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_magma_cprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputmagma_cprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_cprimme(double *eval, void *evec, double *rNorm,
@@ -469,10 +685,18 @@ void default_monitormagma_cprimme(void *basisEvals_, int *basisSize, int *basisF
 int check_params_coherencemagma_cprimme(primme_context ctx);
 int coordinated_exitmagma_cprimme(int ret, primme_context ctx);
 int Xprimme_aux_magma_dprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_magma_dprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionmagma_dprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizemagma_dprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_magma_dprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputmagma_dprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_dprimme(double *eval, void *evec, double *rNorm,
@@ -485,10 +709,18 @@ void default_monitormagma_dprimme(void *basisEvals_, int *basisSize, int *basisF
 int check_params_coherencemagma_dprimme(primme_context ctx);
 int coordinated_exitmagma_dprimme(int ret, primme_context ctx);
 int Xprimme_aux_magma_zprimme_normal(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_magma_zprimme_normal(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionmagma_zprimme_normal(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizemagma_zprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_magma_zprimme_normal(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputmagma_zprimme_normal(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_zprimme_normal(double *eval, void *evec, double *rNorm,
@@ -501,10 +733,18 @@ void default_monitormagma_zprimme_normal(void *basisEvals_, int *basisSize, int
 int check_params_coherencemagma_zprimme_normal(primme_context ctx);
 int coordinated_exitmagma_zprimme_normal(int ret, primme_context ctx);
 int Xprimme_aux_magma_zprimme(void *evals, void *evecs, void *resNorms,
-            primme_params *primme, primme_op_datatype evals_resNorms_type);
+            primme_params *primme, primme_op_datatype evals_resNorms_type,
+            primme_arena *arena, int checked);
 int wrapper_magma_zprimme(void *evals, void *evecs, void *resNorms,
       primme_op_datatype evals_resNorms_type, primme_op_datatype evecs_type,
       int *outInitSize, primme_context ctx);
+int adaptive_precisionmagma_zprimme(void *evals, void *evecs, void *resNorms,
+      primme_op_datatype evals_resNorms_type, int *outInitSize,
+      primme_context ctx);
+int workspace_sizemagma_zprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, size_t *size, primme_context ctx);
+int wrapper_workspace_magma_zprimme(primme_op_datatype evals_resNorms_type,
+      primme_op_datatype evecs_type, primme_context ctx);
 int check_inputmagma_zprimme(
       void *evals, void *evecs, void *resNorms, primme_params *primme);
 void convTestFunAbsolutemagma_zprimme(double *eval, void *evec, double *rNorm,
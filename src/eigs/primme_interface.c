@@ -59,7 +59,12 @@ typedef union {
          struct primme_params *, int *);
    void (*globalSumRealFunc_v)(
          void *, void *, int *, struct primme_params *, int *);
+   void (*globalSumRealBeginFunc_v)(
+         void *, void *, int *, struct primme_params *, void **, int *);
+   void (*globalSumRealWaitFunc_v)(void **, struct primme_params *, int *);
    void (*broadcastRealFunc_v)(void *, int *, struct primme_params *, int *);
+   void (*splitCommFunc_v)(int *, int *, struct primme_params *,
+         struct primme_params *, int *);
    void (*convTestFun_v)(
          double *, void *, double *, int *, struct primme_params *, int *);
    void (*monitorFun_v)(void *basisEvals, int *basisSize, int *basisFlags,
@@ -84,10 +89,65 @@ primme_params * primme_params_create(void) {
  *  * Free the internally allocated work arrays of the primme structure 
  *   *****************************************************************************/
 int primme_params_destroy(primme_params *primme) {
+    if (primme) primme_free(primme);
     free(primme);
     return 0;
 }
 
+/*****************************************************************************
+ * Allocate a solver handle for the problem in primme. The workspace is
+ * allocated on the first solve and kept until primme_solver_destroy.
+ *****************************************************************************/
+primme_solver * primme_solver_create(primme_params *primme) {
+
+   primme_solver *solver = NULL;
+   if (MALLOC_PRIMME(1, &solver) == 0) {
+      solver->primme = primme;
+      solver->workspace = NULL;
+      solver->lworkspace = 0;
+      solver->checkedKind = NULL;
+   }
+   return solver;
+}
+
+/*****************************************************************************
+ * Return whether the parameters a and b have the same setup, that is, they
+ * only differ in the fields that change from solve to solve: the statistics,
+ * the initial vectors, the seed, the workspace, the state kept by recycle
+ * and the user's data of the operators.
+ *****************************************************************************/
+int primme_params_same_setup(primme_params *a, primme_params *b) {
+
+   primme_params a0, b0;
+   memcpy(&a0, a, sizeof(primme_params));
+   memcpy(&b0, b, sizeof(primme_params));
+   primme_params *p[2] = {&a0, &b0};
+   int i;
+   for (i = 0; i < 2; i++) {
+      memset(&p[i]->stats, 0, sizeof(primme_stats));
+      memset(p[i]->iseed, 0, sizeof(p[i]->iseed));
+      p[i]->initSize = 0;
+      p[i]->workspace = NULL;
+      p[i]->lworkspace = 0;
+      p[i]->recycledBasis = NULL;
+      p[i]->ShiftsForPreconditioner = NULL;
+      p[i]->matrix = NULL;
+      p[i]->massMatrix = NULL;
+      p[i]->preconditioner = NULL;
+      p[i]->monitor = NULL;
+   }
+   return memcmp(&a0, &b0, sizeof(primme_params)) == 0;
+}
+
+/*****************************************************************************
+ * Free the solver handle and its workspace
+ *****************************************************************************/
+int primme_solver_destroy(primme_solver *solver) {
+   if (solver) free(solver->workspace);
+   free(solver);
+   return 0;
+}
+
 
 /*******************************************************************************
  * Subroutine primme_initialize - Set primme_params members to default values.
@@ -128,8 +188,12 @@ void primme_initialize(primme_params *primme) {
    primme->commInfo                = NULL;
    primme->globalSumReal           = NULL;
    primme->globalSumReal_type      = primme_op_default;
+   primme->globalSumRealBegin      = NULL;
+   primme->globalSumRealWait       = NULL;
    primme->broadcastReal           = NULL;
    primme->broadcastReal_type      = primme_op_default;
+   primme->commReduce              = 0;
+   primme->splitComm               = NULL;
 
    /* Initial guesses/constraints */
    primme->initSize                = 0;
@@ -163,6 +227,7 @@ void primme_initialize(primme_params *primme) {
    primme->correctionParams.projectors.SkewX   = 0;
    primme->correctionParams.relTolBase         = 0;
    primme->correctionParams.convTest           = primme_adaptive_ETolerance;
+   primme->correctionParams.chebyshevDegree    = 0;
 
    /* Printing and reporting */
    primme->outputFile                          = stdout;
@@ -192,6 +257,11 @@ void primme_initialize(primme_params *primme) {
    primme->stats.maxConvTol                    = 0.0;
    primme->stats.estimateResidualError         = 0.0;
    primme->stats.lockingIssue                  = 0;
+   primme->stats.numOrthoGlobalSum             = 0;
+   primme->stats.numOrthoVectors               = 0;
+   primme->stats.numAllocs                     = 0;
+   primme->stats.numHeapAllocs                 = 0;
+   primme->stats.lworkspaceNeeded              = 0;
 
    /* Optional user defined structures */
    primme->matrix                  = NULL;
@@ -209,11 +279,78 @@ void primme_initialize(primme_params *primme) {
    primme->convtest                = NULL;
    primme->ldevecs                 = -1;
    primme->ldOPs                   = -1;
+   primme->workspace               = NULL;
+   primme->lworkspace              = 0;
+   primme->recycle                 = 0;
+   primme->matrixDeltaMatvec       = NULL;
+   primme->recycledBasis           = NULL;
+   primme->checkpointFile          = NULL;
+   primme->checkpointFrequency     = 0;
+   primme->outOfCoreDir            = NULL;
+   primme->adaptivePrecision       = 0;
    primme->monitorFun              = NULL;
    primme->monitorFun_type         = primme_op_default;
    primme->monitor                 = NULL;
    primme->queue                   = NULL;
    primme->profile                 = NULL;
+   primme->profiler                = NULL;
+}
+
+/*******************************************************************************
+ * Subroutine primme_get_workspace_size - Return the size of the workspace that
+ *    the solver of the given precision takes for the problem in primme; that
+ *    is, the value that the call to the solver with evals, evecs and resNorms
+ *    set to NULL returns in primme->lworkspace.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * type       precision of evecs: primme_op_half, primme_op_float or
+ *            primme_op_double (hprimme, sprimme and dprimme)
+ * isComplex  if nonzero, evecs is complex (kprimme, cprimme and zprimme)
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * primme     Structure containing various solver parameters and statistics;
+ *            the default values of the parameters are set as in the solver
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * lworkspace size of the workspace in bytes
+ *
+ * Return Value
+ * ------------
+ * error code from the solver
+ *
+ ******************************************************************************/
+
+int primme_get_workspace_size(primme_params *primme, primme_op_datatype type,
+      int isComplex, size_t *lworkspace) {
+
+   /* The query returns the size in primme->lworkspace; keep the value of */
+   /* the caller                                                          */
+
+   size_t lworkspace0 = primme->lworkspace;
+   int ret;
+   switch (type) {
+   case primme_op_half:
+      ret = isComplex ? kprimme(NULL, NULL, NULL, primme)
+                      : hprimme(NULL, NULL, NULL, primme);
+      break;
+   case primme_op_float:
+      ret = isComplex ? cprimme(NULL, NULL, NULL, primme)
+                      : sprimme(NULL, NULL, NULL, primme);
+      break;
+   case primme_op_default:
+   case primme_op_double:
+      ret = isComplex ? zprimme(NULL, NULL, NULL, primme)
+                      : dprimme(NULL, NULL, NULL, primme);
+      break;
+   default: ret = PRIMME_FUNCTION_UNAVAILABLE;
+   }
+   if (ret == 0) *lworkspace = primme->lworkspace;
+   primme->lworkspace = lworkspace0;
+
+   return ret;
 }
 
 /*******************************************************************************
@@ -226,8 +363,16 @@ void primme_initialize(primme_params *primme) {
  ******************************************************************************/
 
 void primme_free(primme_params *primme) {
-   (void)primme;
-   /* No function */
+
+   /* Free the search space kept by recycle, unless primme is a copy of */
+   /* the struct that allocated it                                      */
+
+   primme_recycled_basis *r = (primme_recycled_basis *)primme->recycledBasis;
+   if (r && r->owner == (void *)primme) {
+      free(r->V);
+      free(r);
+   }
+   primme->recycledBasis = NULL;
 }
 
 /******************************************************************************
@@ -321,7 +466,11 @@ int primme_set_method(primme_preset_method method, primme_params *primme) {
       primme->maxBlockSize = 1;
    }
    if (primme->correctionParams.precondition == -1) {
-      primme->correctionParams.precondition = primme->applyPreconditioner ? 1 : 0;
+      primme->correctionParams.precondition =
+            primme->applyPreconditioner ||
+                  primme->correctionParams.chebyshevDegree > 0
+                  ? 1
+                  : 0;
    }
 
    if (method == PRIMME_Arnoldi) {
@@ -666,6 +815,7 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINT_PRIMME_INT(nLocal);
    PRINT(numProcs, %d);
    PRINT(procID, %d);
+   PRINT(commReduce, %d);
 
    fprintf(outputFile, "\n// Output and reporting\n");
    PRINT(printLevel, %d);
@@ -698,6 +848,7 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINTIF(initBasisMode, primme_init_krylov);
    PRINTIF(initBasisMode, primme_init_random);
    PRINTIF(initBasisMode, primme_init_user);
+   PRINTIF(initBasisMode, primme_init_checkpoint);
 
    PRINT(numTargetShifts, %d);
    if (primme.numTargetShifts > 0 && primme.targetShifts) {
@@ -714,6 +865,18 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINT(numOrthoConst, %d);
    PRINT_PRIMME_INT(ldevecs);
    PRINT_PRIMME_INT(ldOPs);
+   PRINT(lworkspace, %zu);
+   PRINT(recycle, %d);
+   if (primme.checkpointFile) {
+      fprintf(outputFile, "%s.checkpointFile = %s\n", prefix,
+            primme.checkpointFile);
+   }
+   PRINT(checkpointFrequency, %d);
+   if (primme.outOfCoreDir) {
+      fprintf(outputFile, "%s.outOfCoreDir = %s\n", prefix,
+            primme.outOfCoreDir);
+   }
+   PRINT(adaptivePrecision, %d);
    fprintf(outputFile, "%s.iseed =", prefix);
    for (i=0; i<4;i++) {
       fprintf(outputFile, " %" PRIMME_INT_P, primme.iseed[i]);
@@ -721,6 +884,9 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    fprintf(outputFile, "\n");
    PRINTIF(orth, primme_orth_implicit_I);
    PRINTIF(orth, primme_orth_explicit_I);
+   PRINTIF(orth, primme_orth_cholqr2);
+   PRINTIF(orth, primme_orth_shifted_cholqr3);
+   PRINTIF(orth, primme_orth_dcgs2);
 
    PRINTIF(internalPrecision, primme_op_half);
    PRINTIF(internalPrecision, primme_op_float);
@@ -734,6 +900,7 @@ void primme_display_params_prefix(const char* prefix, primme_params primme) {
    PRINTParams(correction, robustShifts, %d);
    PRINTParams(correction, maxInnerIterations, %d);
    PRINTParams(correction, relTolBase, %g);
+   PRINTParams(correction, chebyshevDegree, %d);
 
    PRINTParamsIF(correction, convTest, primme_full_LTolerance);
    PRINTParamsIF(correction, convTest, primme_decreasing_LTolerance);
@@ -816,9 +983,21 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_globalSumReal:
               v->globalSumRealFunc_v = primme->globalSumReal;
       break;
+      case PRIMME_globalSumRealBegin:
+              v->globalSumRealBeginFunc_v = primme->globalSumRealBegin;
+      break;
+      case PRIMME_globalSumRealWait:
+              v->globalSumRealWaitFunc_v = primme->globalSumRealWait;
+      break;
       case PRIMME_broadcastReal:
               v->broadcastRealFunc_v = primme->broadcastReal;
       break;
+      case PRIMME_commReduce:
+              *(PRIMME_INT*)value = primme->commReduce;
+      break;
+      case PRIMME_splitComm:
+              v->splitCommFunc_v = primme->splitComm;
+      break;
       case PRIMME_numEvals:
               *(PRIMME_INT*)value = primme->numEvals;
       break;
@@ -941,6 +1120,9 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_correctionParams_relTolBase:
               *(double*)value = primme->correctionParams.relTolBase;
       break;
+      case PRIMME_correctionParams_chebyshevDegree:
+              *(PRIMME_INT*)value = primme->correctionParams.chebyshevDegree;
+      break;
       case PRIMME_stats_numOuterIterations:
               *(PRIMME_INT*)value = primme->stats.numOuterIterations;
       break;
@@ -1013,12 +1195,51 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_stats_lockingIssue:
               *(PRIMME_INT*)value = primme->stats.lockingIssue;
       break;
+      case PRIMME_stats_numOrthoGlobalSum:
+              *(PRIMME_INT*)value = primme->stats.numOrthoGlobalSum;
+      break;
+      case PRIMME_stats_numOrthoVectors:
+              *(PRIMME_INT*)value = primme->stats.numOrthoVectors;
+      break;
+      case PRIMME_stats_numAllocs:
+              *(PRIMME_INT*)value = primme->stats.numAllocs;
+      break;
+      case PRIMME_stats_numHeapAllocs:
+              *(PRIMME_INT*)value = primme->stats.numHeapAllocs;
+      break;
+      case PRIMME_stats_lworkspaceNeeded:
+              *(PRIMME_INT*)value = primme->stats.lworkspaceNeeded;
+      break;
       case PRIMME_ldevecs:
               *(PRIMME_INT*)value = primme->ldevecs;
       break;
       case PRIMME_ldOPs:
               *(PRIMME_INT*)value = primme->ldOPs;
       break;
+      case PRIMME_workspace:
+              *(ptr_v*)value = primme->workspace;
+      break;
+      case PRIMME_lworkspace:
+              *(PRIMME_INT*)value = (PRIMME_INT)primme->lworkspace;
+      break;
+      case PRIMME_recycle:
+              *(PRIMME_INT*)value = primme->recycle;
+      break;
+      case PRIMME_matrixDeltaMatvec:
+              v->matFunc_v = primme->matrixDeltaMatvec;
+      break;
+      case PRIMME_checkpointFile:
+              *(str_v*)value = primme->checkpointFile;
+      break;
+      case PRIMME_checkpointFrequency:
+              *(PRIMME_INT*)value = primme->checkpointFrequency;
+      break;
+      case PRIMME_outOfCoreDir:
+              *(str_v*)value = primme->outOfCoreDir;
+      break;
+      case PRIMME_adaptivePrecision:
+              *(PRIMME_INT*)value = primme->adaptivePrecision;
+      break;
       case PRIMME_convTestFun:
               v->convTestFun_v = primme->convTestFun;
       break;
@@ -1043,6 +1264,9 @@ int primme_get_member(primme_params *primme, primme_params_label label,
       case PRIMME_profile:
               *(str_v*)value = primme->profile;
       break;
+      case PRIMME_profiler:
+              *(ptr_v*)value = primme->profiler;
+      break;
       default :
       return 1;
    }
@@ -1115,12 +1339,25 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_globalSumReal_type:
               primme->globalSumReal_type = (primme_op_datatype)*(PRIMME_INT*)value;
       break;
+      case PRIMME_globalSumRealBegin:
+              primme->globalSumRealBegin = v.globalSumRealBeginFunc_v;
+      break;
+      case PRIMME_globalSumRealWait:
+              primme->globalSumRealWait = v.globalSumRealWaitFunc_v;
+      break;
       case PRIMME_broadcastReal:
               primme->broadcastReal = v.broadcastRealFunc_v;
       break;
       case PRIMME_broadcastReal_type:
               primme->broadcastReal_type = (primme_op_datatype)*(PRIMME_INT*)value;
       break;
+      case PRIMME_commReduce:
+              if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
+              primme->commReduce = (int)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_splitComm:
+              primme->splitComm = v.splitCommFunc_v;
+      break;
       case PRIMME_numEvals:
               if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
               primme->numEvals = (int)*(PRIMME_INT*)value;
@@ -1263,6 +1500,10 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_correctionParams_relTolBase:
               primme->correctionParams.relTolBase = *(double*)value;
       break;
+      case PRIMME_correctionParams_chebyshevDegree:
+              if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
+              primme->correctionParams.chebyshevDegree = (int)*(PRIMME_INT*)value;
+      break;
       case PRIMME_stats_numOuterIterations:
               primme->stats.numOuterIterations = *(PRIMME_INT*)value;
       break;
@@ -1329,6 +1570,21 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_stats_lockingIssue:
               primme->stats.lockingIssue = *(PRIMME_INT*)value;
       break;
+      case PRIMME_stats_numOrthoGlobalSum:
+              primme->stats.numOrthoGlobalSum = *(PRIMME_INT*)value;
+      break;
+      case PRIMME_stats_numOrthoVectors:
+              primme->stats.numOrthoVectors = *(PRIMME_INT*)value;
+      break;
+      case PRIMME_stats_numAllocs:
+              primme->stats.numAllocs = *(PRIMME_INT*)value;
+      break;
+      case PRIMME_stats_numHeapAllocs:
+              primme->stats.numHeapAllocs = *(PRIMME_INT*)value;
+      break;
+      case PRIMME_stats_lworkspaceNeeded:
+              primme->stats.lworkspaceNeeded = *(PRIMME_INT*)value;
+      break;
       case PRIMME_convTestFun:
               primme->convTestFun = v.convTestFun_v;
       break;
@@ -1344,6 +1600,34 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_ldOPs:
               primme->ldOPs = *(PRIMME_INT*)value;
       break;
+      case PRIMME_workspace:
+              primme->workspace = (ptr_v)value;
+      break;
+      case PRIMME_lworkspace:
+              if (*(PRIMME_INT*)value < 0) return 1;
+              primme->lworkspace = (size_t)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_recycle:
+              if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
+              primme->recycle = (int)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_matrixDeltaMatvec:
+              primme->matrixDeltaMatvec = v.matFunc_v;
+      break;
+      case PRIMME_checkpointFile:
+              primme->checkpointFile = (str_v)value;
+      break;
+      case PRIMME_checkpointFrequency:
+              if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
+              primme->checkpointFrequency = (int)*(PRIMME_INT*)value;
+      break;
+      case PRIMME_outOfCoreDir:
+              primme->outOfCoreDir = (str_v)value;
+      break;
+      case PRIMME_adaptivePrecision:
+              if (*(PRIMME_INT*)value > INT_MAX) return 1; else 
+              primme->adaptivePrecision = (int)*(PRIMME_INT*)value;
+      break;
       case PRIMME_monitorFun:
               primme->monitorFun = v.monitorFun_v;
       break;
@@ -1359,6 +1643,9 @@ int primme_set_member(primme_params *primme, primme_params_label label,
       case PRIMME_profile:
               primme->profile = (str_v)value;
       break;
+      case PRIMME_profiler:
+              primme->profiler = (primme_profiler *)value;
+      break;
       default : 
       return 1;
    }
@@ -1418,7 +1705,11 @@ int primme_member_info(primme_params_label *label, const char **label_name,
    IF_IS(commInfo                     , commInfo);
    IF_IS(nLocal                       , nLocal);
    IF_IS(globalSumReal                , globalSumReal);
+   IF_IS(globalSumRealBegin           , globalSumRealBegin);
+   IF_IS(globalSumRealWait            , globalSumRealWait);
    IF_IS(broadcastReal                , broadcastReal);
+   IF_IS(commReduce                   , commReduce);
+   IF_IS(splitComm                    , splitComm);
    IF_IS(numEvals                     , numEvals);
    IF_IS(target                       , target);
    IF_IS(numTargetShifts              , numTargetShifts);
@@ -1459,6 +1750,7 @@ int primme_member_info(primme_params_label *label, const char **label_name,
    IF_IS(correction_projectors_SkewX  , correctionParams_projectors_SkewX);
    IF_IS(correction_convTest          , correctionParams_convTest);
    IF_IS(correction_relTolBase        , correctionParams_relTolBase);
+   IF_IS(correction_chebyshevDegree   , correctionParams_chebyshevDegree);
    IF_IS(stats_numOuterIterations     , stats_numOuterIterations);
    IF_IS(stats_numRestarts            , stats_numRestarts);
    IF_IS(stats_numMatvecs             , stats_numMatvecs);
@@ -1483,16 +1775,30 @@ int primme_member_info(primme_params_label *label, const char **label_name,
    IF_IS(stats_estimateInvBNorm       , stats_estimateInvBNorm);
    IF_IS(stats_maxConvTol             , stats_maxConvTol);
    IF_IS(stats_lockingIssue           , stats_lockingIssue);
+   IF_IS(stats_numOrthoGlobalSum      , stats_numOrthoGlobalSum);
+   IF_IS(stats_numOrthoVectors        , stats_numOrthoVectors);
+   IF_IS(stats_numAllocs              , stats_numAllocs);
+   IF_IS(stats_numHeapAllocs          , stats_numHeapAllocs);
+   IF_IS(stats_lworkspaceNeeded       , stats_lworkspaceNeeded);
    IF_IS(convTestFun                  , convTestFun);
    IF_IS(convTestFun_type             , convTestFun_type);
    IF_IS(convtest                     , convtest);
    IF_IS(ldevecs                      , ldevecs);
    IF_IS(ldOPs                        , ldOPs);
+   IF_IS(workspace                    , workspace);
+   IF_IS(lworkspace                   , lworkspace);
+   IF_IS(recycle                      , recycle);
+   IF_IS(matrixDeltaMatvec            , matrixDeltaMatvec);
+   IF_IS(checkpointFile               , checkpointFile);
+   IF_IS(checkpointFrequency          , checkpointFrequency);
+   IF_IS(outOfCoreDir                 , outOfCoreDir);
+   IF_IS(adaptivePrecision            , adaptivePrecision);
    IF_IS(monitorFun                   , monitorFun);
    IF_IS(monitorFun_type              , monitorFun_type);
    IF_IS(monitor                      , monitor);
    IF_IS(queue                        , queue);
    IF_IS(profile                      , profile);
+   IF_IS(profiler                     , profiler);
 #undef IF_IS
 
    /* Return error if no label was found */
@@ -1508,6 +1814,7 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_globalSumReal_type:
       case PRIMME_broadcastReal_type:
       case PRIMME_massMatrixMatvec_type:
+      case PRIMME_commReduce:
       case PRIMME_n:
       case PRIMME_numEvals:
       case PRIMME_target:
@@ -1535,6 +1842,7 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_correctionParams_projectors_SkewQ:
       case PRIMME_correctionParams_projectors_SkewX:
       case PRIMME_correctionParams_convTest:
+      case PRIMME_correctionParams_chebyshevDegree:
       case PRIMME_stats_numOuterIterations:
       case PRIMME_stats_numRestarts:
       case PRIMME_stats_numMatvecs:
@@ -1544,6 +1852,11 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_stats_numBroadcast:
       case PRIMME_stats_volumeBroadcast:
       case PRIMME_stats_lockingIssue:
+      case PRIMME_stats_numOrthoGlobalSum:
+      case PRIMME_stats_numOrthoVectors:
+      case PRIMME_stats_numAllocs:
+      case PRIMME_stats_numHeapAllocs:
+      case PRIMME_stats_lworkspaceNeeded:
       case PRIMME_numProcs:
       case PRIMME_procID:
       case PRIMME_nLocal:
@@ -1551,6 +1864,10 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_printLevel:
       case PRIMME_ldevecs:
       case PRIMME_ldOPs:
+      case PRIMME_lworkspace:
+      case PRIMME_recycle:
+      case PRIMME_checkpointFrequency:
+      case PRIMME_adaptivePrecision:
       case PRIMME_monitorFun_type:
       case PRIMME_convTestFun_type:
       if (type) *type = primme_int;
@@ -1600,7 +1917,10 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_applyPreconditioner:
       case PRIMME_commInfo:
       case PRIMME_globalSumReal:
+      case PRIMME_globalSumRealBegin:
+      case PRIMME_globalSumRealWait:
       case PRIMME_broadcastReal:
+      case PRIMME_splitComm:
       case PRIMME_massMatrixMatvec:
       case PRIMME_outputFile:
       case PRIMME_matrix:
@@ -1611,11 +1931,16 @@ int primme_member_info(primme_params_label *label, const char **label_name,
       case PRIMME_monitorFun:
       case PRIMME_monitor:
       case PRIMME_queue:
+      case PRIMME_workspace:
+      case PRIMME_matrixDeltaMatvec:
+      case PRIMME_profiler:
       if (type) *type = primme_pointer;
       if (arity) *arity = 1;
       break;
 
       case PRIMME_profile:
+      case PRIMME_checkpointFile:
+      case PRIMME_outOfCoreDir:
       if (type) *type = primme_string;
       if (arity) *arity = 1;
       break;
@@ -1683,6 +2008,7 @@ int primme_constant_info(const char* label_name, int *value) {
    IF_IS(primme_init_krylov);
    IF_IS(primme_init_random);
    IF_IS(primme_init_user);
+   IF_IS(primme_init_checkpoint);
    IF_IS(primme_full_LTolerance);
    IF_IS(primme_decreasing_LTolerance);
    IF_IS(primme_adaptive_ETolerance);
@@ -1704,6 +2030,9 @@ int primme_constant_info(const char* label_name, int *value) {
    IF_IS(primme_orth_default);
    IF_IS(primme_orth_explicit_I);
    IF_IS(primme_orth_implicit_I);
+   IF_IS(primme_orth_cholqr2);
+   IF_IS(primme_orth_shifted_cholqr3);
+   IF_IS(primme_orth_dcgs2);
 
    /* enum member from op_datatype */
    IF_IS(primme_op_default);   
@@ -1797,6 +2126,7 @@ int primme_enum_member_info(
    IF_IS(primme_init_krylov);
    IF_IS(primme_init_random);
    IF_IS(primme_init_user);
+   IF_IS(primme_init_checkpoint);
    break;
 
    case PRIMME_correctionParams_convTest:
@@ -1810,6 +2140,9 @@ int primme_enum_member_info(
    IF_IS(primme_orth_default);
    IF_IS(primme_orth_explicit_I);
    IF_IS(primme_orth_implicit_I);
+   IF_IS(primme_orth_cholqr2);
+   IF_IS(primme_orth_shifted_cholqr3);
+   IF_IS(primme_orth_dcgs2);
    break;
 
    case PRIMME_matrixMatvec_type:
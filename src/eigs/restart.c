@@ -401,7 +401,7 @@ int restart_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV, PRIMME_INT nLocal,
 
    HREAL fn = 0.0; /* = max(|I - VtBV|_F, |I - QtQ|_F) * problemNorm */
 
-   if (ctx.procID == 0) {
+   if (ctx.procID == 0 || ctx.commReduce) {
       if (VtBV) {
          HREAL n = 0;
          int i,j, nVtBV = primme->numOrthoConst + *numLocked + restartSize;
@@ -1277,7 +1277,7 @@ int Num_aux_update_VWXR_Sprimme(SCALAR *V, SCALAR *W, SCALAR *BV,
       HSCALAR *work;
       assert(nVtBV == nX0e - nX0b);
       CHKERR(Num_malloc_SHprimme((nX0e - nX0b) * evecsSize, &work, ctx));
-      if (ctx.procID == 0) {
+      if (ctx.procID == 0 || ctx.commReduce) {
          Num_zero_matrix_SHprimme(work, evecsSize, nX0e - nX0b, evecsSize, ctx);
          CHKERR(Num_gemm_SHprimme("N", "N", evecsSize, nX0e - nX0b, nV, 1.0,
                &VtBV[evecsSize * ldVtBV], ldVtBV, h, ldh, 0.0, work, evecsSize,
@@ -1623,7 +1623,7 @@ STATIC int restart_RR(HSCALAR *H, int ldH, HSCALAR *VtBV, int ldVtBV,
    double aNorm = primme?max(primme->aNorm, primme->stats.estimateLargestSVal):0.0;
 
 #ifdef USE_HERMITIAN
-   if (primme->orth == primme_orth_implicit_I) {
+   if (primme->orth != primme_orth_explicit_I) {
 
       // If coefficient vectors from the previous iteration were retained, then
       // insert the computed overlap matrix into the restarted H
@@ -1859,7 +1859,7 @@ STATIC int restart_refined(SCALAR *V, PRIMME_INT ldV, SCALAR *W, PRIMME_INT ldW,
    /* ------------------------------- */
 
 #ifdef USE_HERMITIAN
-   if (H && primme->orth == primme_orth_implicit_I) {
+   if (H && primme->orth != primme_orth_explicit_I) {
       CHKERR(compute_submatrix_SHprimme(hVecs, restartSize, ldhVecs, H,
             basisSize, ldH, 1 /* Hermitian */, H, ldH, ctx));
    }
@@ -2278,7 +2278,7 @@ STATIC int restart_harmonic(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
    /* ------------------------------- */
 
 #ifdef USE_HERMITIAN
-   if (primme->orth == primme_orth_implicit_I) {
+   if (primme->orth != primme_orth_explicit_I) {
       CHKERR(compute_submatrix_SHprimme(hVecs, restartSize, ldhVecs, H,
             basisSize, ldH, 1 /* Hermitian */, H, ldH, ctx));
    }
@@ -2352,7 +2352,7 @@ STATIC int ortho_coefficient_vectors_Sprimme(HSCALAR *hVecs, int basisSize,
    HSCALAR *rwork; /* auxiliary space to broadcast the retained vectors */
    CHKERR(Num_malloc_SHprimme(basisSize*(*numPrevRetained)+1, &rwork, ctx));
 
-   if (ctx.procID == 0) {
+   if (ctx.procID == 0 || ctx.commReduce) {
 
       /* First, retain coefficient vectors corresponding to current block */
       /* vectors.  If all of those have been retained, then retain the    */ 
@@ -2535,4 +2535,309 @@ STATIC int compute_residual_columns(PRIMME_INT m, HEVAL *evals, SCALAR *x,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutines *_workspace - Take from the dry arena of the context the same
+ *    blocks that the function without the suffix takes with the given sizes.
+ *    The flags withX tell whether the optional array X of the function is
+ *    given. The sizes that depend on the convergence, as restartSize and
+ *    numPrevRetained, are replaced by their largest values. See
+ *    main_iter_workspace.
+ ******************************************************************************/
+
+STATIC int Num_aux_update_VWXR_workspace_Sprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx) {
+
+   CHKERR(Num_update_VWXR_workspace_Sprimme(mV, nX, nY, nBX, nGH, nNorms, ctx));
+
+   if (nVtBV > 0) {
+      HSCALAR *work;
+      CHKERR(Num_malloc_SHprimme(nVtBV * evecsSize, &work, ctx));
+      CHKERR(broadcast_workspace_SHprimme(nVtBV * evecsSize, ctx));
+      CHKERR(Num_free_SHprimme(work, ctx));
+   }
+
+   return 0;
+}
+
+STATIC int compute_residual_columns_workspace(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx) {
+
+   if (n == 0) return 0;
+
+   int M = min(m, PRIMME_BLOCK_SIZE);
+   SCALAR *X0, *R0, *BX0 = NULL;
+   CHKERR(Num_malloc_Sprimme(nd * M, &X0, ctx));
+   CHKERR(Num_malloc_Sprimme(nd * M, &R0, ctx));
+   if (withBxo) CHKERR(Num_malloc_Sprimme(nd * M, &BX0, ctx));
+   CHKERR(Num_free_Sprimme(X0, ctx));
+   CHKERR(Num_free_Sprimme(R0, ctx));
+   if (withBxo) CHKERR(Num_free_Sprimme(BX0, ctx));
+
+   return 0;
+}
+
+STATIC int ortho_coefficient_vectors_workspace_Sprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx) {
+
+   HSCALAR *rwork;
+   CHKERR(Num_malloc_SHprimme(basisSize * numPrevRetained + 1, &rwork, ctx));
+   if ((ctx.procID == 0 || ctx.commReduce) && numPrevRetained > 0) {
+      CHKERR(Bortho_local_workspace_SHprimme(
+            0, basisSize, basisSize, withVtBV, ctx));
+   }
+   CHKERR(broadcast_workspace_SHprimme(basisSize * numPrevRetained + 1, ctx));
+   CHKERR(Num_free_SHprimme(rwork, ctx));
+
+   return 0;
+}
+
+STATIC int restart_soft_locking_workspace_Sprimme(
+      int basisSize, int withVtBV, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int withH = KIND(primme->orth == primme_orth_explicit_I, 1);
+   int nGH = (withVtBV ? basisSize * basisSize : 0) +
+             (withH ? basisSize * basisSize : 0);
+
+   CHKERR(KIND(permute_vecs_workspace_RHprimme,
+         permute_vecs_workspace_SHprimme)(1, basisSize, ctx));
+   CHKERR(permute_vecs_workspace_SHprimme(basisSize, basisSize, ctx));
+   CHKERR(Num_aux_update_VWXR_workspace_Sprimme(primme->nLocal, basisSize,
+         basisSize, primme->massMatrixMatvec ? basisSize : 0, nGH,
+         min(primme->maxBlockSize, basisSize), withVtBV ? basisSize : 0,
+         primme->numOrthoConst, ctx));
+
+   return 0;
+}
+
+STATIC int restart_locking_workspace_Sprimme(
+      int basisSize, int withVtBV, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int withH = KIND(primme->orth == primme_orth_explicit_I, 1);
+   int nGH = (withVtBV ? basisSize * basisSize : 0) +
+             (withH ? basisSize * basisSize : 0);
+   int numPacked = min(basisSize, primme->numEvals);
+   int maxBlockSize = min(basisSize, primme->maxBlockSize);
+
+   CHKERR(KIND(permute_vecs_workspace_RHprimme,
+         permute_vecs_workspace_SHprimme)(1, basisSize, ctx));
+   CHKERR(permute_vecs_workspace_SHprimme(basisSize, basisSize, ctx));
+   CHKERR(Num_aux_update_VWXR_workspace_Sprimme(primme->nLocal, basisSize,
+         basisSize, primme->massMatrixMatvec ? basisSize : 0, nGH,
+         maxBlockSize + numPacked, withVtBV ? basisSize : 0,
+         primme->numOrthoConst + primme->numEvals, ctx));
+   CHKERR(permute_vecs_workspace_iprimme(basisSize, ctx));
+   CHKERR(check_convergence_workspace_Sprimme(1 /* X given */,
+         0 /* R not given */, withVtBV, primme->numEvals, numPacked, 0, ctx));
+
+   int *ifailed;
+   HREAL *blockNorms0;
+   CHKERR(Num_malloc_iprimme(numPacked, &ifailed, ctx));
+   CHKERR(Num_malloc_RHprimme(maxBlockSize, &blockNorms0, ctx));
+   CHKERR(Num_free_RHprimme(blockNorms0, ctx));
+   CHKERR(compute_residual_columns_workspace(primme->nLocal, numPacked,
+         maxBlockSize, primme->massMatrixMatvec ? 1 : 0, ctx));
+   CHKERR(permute_vecs_workspace_iprimme(numPacked, ctx));
+
+   if (withVtBV) {
+      int *iV;
+      HSCALAR *rwork;
+      int nVtBV = primme->numOrthoConst + primme->numEvals + basisSize;
+      CHKERR(Num_malloc_iprimme(basisSize, &iV, ctx));
+      CHKERR(Num_malloc_SHprimme(nVtBV * basisSize, &rwork, ctx));
+      CHKERR(Num_free_SHprimme(rwork, ctx));
+      CHKERR(Num_free_iprimme(iV, ctx));
+   }
+   CHKERR(Num_free_iprimme(ifailed, ctx));
+
+   CHKERR(monitorFun_workspace_Sprimme(0, primme->numEvals, ctx));
+
+   return 0;
+}
+
+STATIC int restart_RR_workspace(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx) {
+
+#ifdef USE_HERMITIAN
+   if (ctx.primme->orth != primme_orth_explicit_I) {
+      CHKERR(compute_submatrix_workspace_SHprimme(
+            numPrevRetained, basisSize, ctx));
+   }
+#else
+   (void)numPrevRetained; /* unused parameter */
+#endif /* USE_HERMITIAN */
+
+   /* The projected problem of the retained vectors is smaller than the */
+   /* whole one solved when the target shift changes                    */
+
+   CHKERR(solve_H_workspace_SHprimme(basisSize, withVtBV, 0, ctx));
+   CHKERR(KIND(permute_vecs_workspace_RHprimme,
+         permute_vecs_workspace_SHprimme)(1, basisSize, ctx));
+
+   return 0;
+}
+
+STATIC int restart_refined_workspace(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+#ifdef USE_HERMITIAN
+   if (primme->orth != primme_orth_explicit_I) {
+      CHKERR(compute_submatrix_workspace_SHprimme(
+            basisSize, basisSize, ctx));
+   }
+#endif /* USE_HERMITIAN */
+
+   /* Quick exit if the target has changed */
+
+   CHKERR(update_Q_workspace_Sprimme(1 /* R */, withQtQ, basisSize, 0, ctx));
+   CHKERR(solve_H_workspace_SHprimme(basisSize, withVtBV, withQtQ, ctx));
+
+   /* Update of R and Q otherwise */
+
+   int *restartPerm0, *invhVecsPerm;
+   HSCALAR *RPrevhVecs, *hVecsRot0, *rwork;
+   HEVAL *dummyhVals;
+   CHKERR(Num_malloc_iprimme(basisSize, &restartPerm0, ctx));
+   CHKERR(Num_malloc_SHprimme(
+         (size_t)numPrevRetained * basisSize, &RPrevhVecs, ctx));
+   CHKERR(Num_malloc_SHprimme((size_t)basisSize * basisSize, &hVecsRot0, ctx));
+   CHKERR(Bortho_local_workspace_SHprimme(
+         basisSize - 1, 0, basisSize, withQtQ, ctx));
+   CHKERR(Num_malloc_SHprimme((size_t)basisSize * basisSize, &rwork, ctx));
+   CHKERR(Num_free_SHprimme(rwork, ctx));
+   CHKERR(Num_free_SHprimme(hVecsRot0, ctx));
+   CHKERR(Num_free_SHprimme(RPrevhVecs, ctx));
+   CHKERR(Bortho_local_workspace_SHprimme(
+         basisSize - 1, 0, basisSize, withQtQ, ctx));
+   CHKERR(Num_free_iprimme(restartPerm0, ctx));
+   CHKERR(Num_update_VWXR_workspace_Sprimme(primme->nLocal, basisSize, 0, 0,
+         withQtQ ? basisSize * basisSize : 0, 0, ctx));
+   if (withQtQ) CHKERR(update_cholesky_workspace_Sprimme(0, basisSize, ctx));
+   CHKERR(KIND(Num_malloc_RHprimme, Num_malloc_SHprimme)(
+         basisSize, &dummyhVals, ctx));
+   CHKERR(solve_H_workspace_SHprimme(basisSize, withVtBV, withQtQ, ctx));
+   CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(dummyhVals, ctx));
+   CHKERR(KIND(permute_vecs_workspace_RHprimme,
+         permute_vecs_workspace_SHprimme)(1, basisSize, ctx));
+   CHKERR(Num_malloc_iprimme(basisSize, &invhVecsPerm, ctx));
+   CHKERR(permute_vecs_workspace_SHprimme(basisSize, basisSize, ctx));
+   CHKERR(Num_free_iprimme(invhVecsPerm, ctx));
+
+   return 0;
+}
+
+STATIC int restart_harmonic_workspace(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx) {
+
+#ifdef USE_HERMITIAN
+   if (ctx.primme->orth != primme_orth_explicit_I) {
+      CHKERR(compute_submatrix_workspace_SHprimme(
+            basisSize, basisSize, ctx));
+   }
+#endif /* USE_HERMITIAN */
+
+   CHKERR(update_Q_workspace_Sprimme(1 /* R */, withQtQ, basisSize, 0, ctx));
+   CHKERR(update_projection_workspace_Sprimme(
+         0, basisSize, 0 /* unsymmetric */, ctx));
+   CHKERR(solve_H_workspace_SHprimme(basisSize, withVtBV, withQtQ, ctx));
+
+   return 0;
+}
+
+STATIC int restart_projection_workspace_Sprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+
+   switch (primme->projectionParams.projection) {
+   case primme_proj_RR:
+      CHKERR(restart_RR_workspace(
+            basisSize, numPrevRetained, withVtBV, ctx));
+      break;
+
+   case primme_proj_harmonic:
+      CHKERR(restart_harmonic_workspace(basisSize, withVtBV, withQtQ, ctx));
+      break;
+
+   case primme_proj_refined:
+      CHKERR(restart_refined_workspace(
+            basisSize, numPrevRetained, withVtBV, withQtQ, ctx));
+      break;
+
+   default:
+      assert(0);
+   }
+
+   if (withEvecsHat) {
+      double *shiftsForPreconditioner = NULL;
+      if (primme->numTargetShifts > 0 &&
+            primme->numEvals > primme->numTargetShifts) {
+         CHKERR(Num_malloc_dprimme(
+               primme->numEvals, &shiftsForPreconditioner, ctx));
+      }
+      CHKERR(applyPreconditioner_workspace_Sprimme(
+            primme->nLocal, primme->numEvals, ctx));
+      if (shiftsForPreconditioner) {
+         CHKERR(Num_free_dprimme(shiftsForPreconditioner, ctx));
+      }
+      CHKERR(update_XKinvBX_workspace_Sprimme(
+            0, primme->numOrthoConst + primme->numEvals, ctx));
+   }
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int restart_workspace_Sprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int numPrevRetained =
+         max(0, min(primme->restartingParams.maxPrevRetain, basisSize - 1));
+
+   CHKERR(ortho_coefficient_vectors_workspace_Sprimme(
+         basisSize, numPrevRetained, withVtBV, ctx));
+
+   int *restartPerm, *hVecsPerm;
+   CHKERR(Num_malloc_iprimme(basisSize, &restartPerm, ctx));
+   CHKERR(Num_malloc_iprimme(basisSize, &hVecsPerm, ctx));
+
+   if (!primme->locking) {
+      CHKERR(restart_soft_locking_workspace_Sprimme(basisSize, withVtBV, ctx));
+   } else {
+      CHKERR(restart_locking_workspace_Sprimme(basisSize, withVtBV, ctx));
+   }
+
+   /* Update fVtBV; the restarted and the newly locked vectors are from the */
+   /* basis                                                                 */
+
+   if (withVtBV) {
+      int maxRank = primme->numOrthoConst +
+                    (primme->locking ? primme->numEvals : 0) + basisSize;
+      CHKERR(update_cholesky_workspace_Sprimme(
+            maxRank - basisSize, maxRank, ctx));
+   }
+
+   if (primme->target != primme_smallest && primme->target != primme_largest) {
+      CHKERR(KIND(permute_vecs_workspace_RHprimme,
+            permute_vecs_workspace_SHprimme)(1, basisSize, ctx));
+   }
+
+   CHKERR(restart_projection_workspace_Sprimme(basisSize, numPrevRetained,
+         withVtBV, withQtQ, withEvecsHat, ctx));
+   CHKERR(Num_free_iprimme(restartPerm, ctx));
+   if (!primme->locking) {
+      CHKERR(permute_vecs_workspace_Sprimme(primme->nLocal, basisSize, ctx));
+   }
+   CHKERR(Num_free_iprimme(hVecsPerm, ctx));
+   CHKERR(broadcast_workspace_RHprimme(1, ctx));
+
+   return 0;
+}
+
 #endif /* SUPPORTED_TYPE */
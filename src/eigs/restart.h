@@ -334,6 +334,145 @@ int compute_residual_columnsdprimme(PRIMME_INT m, dummy_type_dprimme *evals, dum
       dummy_type_dprimme *xo, dummy_type_dprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_dprimme *ro,
       PRIMME_INT ldro, dummy_type_dprimme *xd, dummy_type_dprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_dprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(Num_aux_update_VWXR_workspace_Sprimme)
+#  define Num_aux_update_VWXR_workspace_Sprimme CONCAT(Num_aux_update_VWXR_workspace_Sprimme,WITH_KIND(SCALAR_SUF))
+#endif
+int Num_aux_update_VWXR_workspace_Sprimmedprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(compute_residual_columns_workspace)
+#  define compute_residual_columns_workspace CONCAT(compute_residual_columns_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int compute_residual_columns_workspacedprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(ortho_coefficient_vectors_workspace_Sprimme)
+#  define ortho_coefficient_vectors_workspace_Sprimme CONCAT(ortho_coefficient_vectors_workspace_Sprimme,WITH_KIND(SCALAR_SUF))
+#endif
+int ortho_coefficient_vectors_workspace_Sprimmedprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(restart_soft_locking_workspace_Sprimme)
+#  define restart_soft_locking_workspace_Sprimme CONCAT(restart_soft_locking_workspace_Sprimme,WITH_KIND(SCALAR_SUF))
+#endif
+int restart_soft_locking_workspace_Sprimmedprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(restart_locking_workspace_Sprimme)
+#  define restart_locking_workspace_Sprimme CONCAT(restart_locking_workspace_Sprimme,WITH_KIND(SCALAR_SUF))
+#endif
+int restart_locking_workspace_Sprimmedprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(restart_RR_workspace)
+#  define restart_RR_workspace CONCAT(restart_RR_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int restart_RR_workspacedprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(restart_refined_workspace)
+#  define restart_refined_workspace CONCAT(restart_refined_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int restart_refined_workspacedprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(restart_harmonic_workspace)
+#  define restart_harmonic_workspace CONCAT(restart_harmonic_workspace,WITH_KIND(SCALAR_SUF))
+#endif
+int restart_harmonic_workspacedprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(restart_projection_workspace_Sprimme)
+#  define restart_projection_workspace_Sprimme CONCAT(restart_projection_workspace_Sprimme,WITH_KIND(SCALAR_SUF))
+#endif
+int restart_projection_workspace_Sprimmedprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Sprimme)
+#  define restart_workspace_Sprimme CONCAT(restart_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Rprimme)
+#  define restart_workspace_Rprimme CONCAT(restart_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SHprimme)
+#  define restart_workspace_SHprimme CONCAT(restart_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RHprimme)
+#  define restart_workspace_RHprimme CONCAT(restart_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SXprimme)
+#  define restart_workspace_SXprimme CONCAT(restart_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RXprimme)
+#  define restart_workspace_RXprimme CONCAT(restart_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Shprimme)
+#  define restart_workspace_Shprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Rhprimme)
+#  define restart_workspace_Rhprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Ssprimme)
+#  define restart_workspace_Ssprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Rsprimme)
+#  define restart_workspace_Rsprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Sdprimme)
+#  define restart_workspace_Sdprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Rdprimme)
+#  define restart_workspace_Rdprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Sqprimme)
+#  define restart_workspace_Sqprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_Rqprimme)
+#  define restart_workspace_Rqprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SXhprimme)
+#  define restart_workspace_SXhprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RXhprimme)
+#  define restart_workspace_RXhprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SXsprimme)
+#  define restart_workspace_SXsprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RXsprimme)
+#  define restart_workspace_RXsprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SXdprimme)
+#  define restart_workspace_SXdprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RXdprimme)
+#  define restart_workspace_RXdprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SXqprimme)
+#  define restart_workspace_SXqprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RXqprimme)
+#  define restart_workspace_RXqprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SHhprimme)
+#  define restart_workspace_SHhprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RHhprimme)
+#  define restart_workspace_RHhprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SHsprimme)
+#  define restart_workspace_SHsprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RHsprimme)
+#  define restart_workspace_RHsprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SHdprimme)
+#  define restart_workspace_SHdprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RHdprimme)
+#  define restart_workspace_RHdprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_SHqprimme)
+#  define restart_workspace_SHqprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(restart_workspace_RHqprimme)
+#  define restart_workspace_RHqprimme CONCAT(restart_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int restart_workspace_dprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_hprimme(dummy_type_hprimme *V, dummy_type_hprimme *W, dummy_type_hprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_hprimme *evecs,
@@ -431,6 +570,28 @@ int compute_residual_columnshprimme(PRIMME_INT m, dummy_type_sprimme *evals, dum
       dummy_type_hprimme *xo, dummy_type_hprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_hprimme *ro,
       PRIMME_INT ldro, dummy_type_hprimme *xd, dummy_type_hprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_hprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmehprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacehprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmehprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmehprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmehprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacehprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacehprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacehprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmehprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_hprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_kprimme_normal(dummy_type_kprimme *V, dummy_type_kprimme *W, dummy_type_kprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_kprimme *evecs,
@@ -528,6 +689,28 @@ int compute_residual_columnskprimme_normal(PRIMME_INT m, dummy_type_cprimme *eva
       dummy_type_kprimme *xo, dummy_type_kprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_kprimme *ro,
       PRIMME_INT ldro, dummy_type_kprimme *xd, dummy_type_kprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_kprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmekprimme_normal(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacekprimme_normal(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmekprimme_normal(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmekprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmekprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacekprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacekprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacekprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmekprimme_normal(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_kprimme_normal(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_kprimme(dummy_type_kprimme *V, dummy_type_kprimme *W, dummy_type_kprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_kprimme *evecs,
@@ -625,6 +808,28 @@ int compute_residual_columnskprimme(PRIMME_INT m, dummy_type_sprimme *evals, dum
       dummy_type_kprimme *xo, dummy_type_kprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_kprimme *ro,
       PRIMME_INT ldro, dummy_type_kprimme *xd, dummy_type_kprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_kprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmekprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacekprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmekprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmekprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmekprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacekprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacekprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacekprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmekprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_kprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_sprimme(dummy_type_sprimme *V, dummy_type_sprimme *W, dummy_type_sprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_sprimme *evecs,
@@ -722,6 +927,28 @@ int compute_residual_columnssprimme(PRIMME_INT m, dummy_type_sprimme *evals, dum
       dummy_type_sprimme *xo, dummy_type_sprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_sprimme *ro,
       PRIMME_INT ldro, dummy_type_sprimme *xd, dummy_type_sprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_sprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmesprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacesprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmesprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmesprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmesprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacesprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacesprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacesprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmesprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_sprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_cprimme_normal(dummy_type_cprimme *V, dummy_type_cprimme *W, dummy_type_cprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_cprimme *evecs,
@@ -819,6 +1046,28 @@ int compute_residual_columnscprimme_normal(PRIMME_INT m, dummy_type_cprimme *eva
       dummy_type_cprimme *xo, dummy_type_cprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_cprimme *ro,
       PRIMME_INT ldro, dummy_type_cprimme *xd, dummy_type_cprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_cprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmecprimme_normal(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacecprimme_normal(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmecprimme_normal(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmecprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmecprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacecprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacecprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacecprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmecprimme_normal(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_cprimme_normal(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_cprimme(dummy_type_cprimme *V, dummy_type_cprimme *W, dummy_type_cprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_cprimme *evecs,
@@ -916,6 +1165,28 @@ int compute_residual_columnscprimme(PRIMME_INT m, dummy_type_sprimme *evals, dum
       dummy_type_cprimme *xo, dummy_type_cprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_cprimme *ro,
       PRIMME_INT ldro, dummy_type_cprimme *xd, dummy_type_cprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_cprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmecprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacecprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmecprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmecprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmecprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacecprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacecprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacecprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmecprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_cprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_zprimme_normal(dummy_type_zprimme *V, dummy_type_zprimme *W, dummy_type_zprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_zprimme *evecs,
@@ -1013,6 +1284,28 @@ int compute_residual_columnszprimme_normal(PRIMME_INT m, dummy_type_zprimme *eva
       dummy_type_zprimme *xo, dummy_type_zprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_zprimme *ro,
       PRIMME_INT ldro, dummy_type_zprimme *xd, dummy_type_zprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_zprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmezprimme_normal(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacezprimme_normal(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmezprimme_normal(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmezprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmezprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacezprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacezprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacezprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmezprimme_normal(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_zprimme_normal(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_zprimme(dummy_type_zprimme *V, dummy_type_zprimme *W, dummy_type_zprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_zprimme *evecs,
@@ -1110,6 +1403,28 @@ int compute_residual_columnszprimme(PRIMME_INT m, dummy_type_dprimme *evals, dum
       dummy_type_zprimme *xo, dummy_type_zprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_zprimme *ro,
       PRIMME_INT ldro, dummy_type_zprimme *xd, dummy_type_zprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_zprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmezprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacezprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmezprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmezprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmezprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacezprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacezprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacezprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmezprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_zprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_magma_hprimme(dummy_type_magma_hprimme *V, dummy_type_magma_hprimme *W, dummy_type_magma_hprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_magma_hprimme *evecs,
@@ -1207,6 +1522,28 @@ int compute_residual_columnsmagma_hprimme(PRIMME_INT m, dummy_type_sprimme *eval
       dummy_type_magma_hprimme *xo, dummy_type_magma_hprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_magma_hprimme *ro,
       PRIMME_INT ldro, dummy_type_magma_hprimme *xd, dummy_type_magma_hprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_magma_hprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmemagma_hprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacemagma_hprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmemagma_hprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmemagma_hprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmemagma_hprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacemagma_hprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacemagma_hprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacemagma_hprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmemagma_hprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_magma_hprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_magma_kprimme_normal(dummy_type_magma_kprimme *V, dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_magma_kprimme *evecs,
@@ -1304,6 +1641,28 @@ int compute_residual_columnsmagma_kprimme_normal(PRIMME_INT m, dummy_type_cprimm
       dummy_type_magma_kprimme *xo, dummy_type_magma_kprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_magma_kprimme *ro,
       PRIMME_INT ldro, dummy_type_magma_kprimme *xd, dummy_type_magma_kprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_magma_kprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmemagma_kprimme_normal(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacemagma_kprimme_normal(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmemagma_kprimme_normal(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmemagma_kprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmemagma_kprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacemagma_kprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacemagma_kprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacemagma_kprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmemagma_kprimme_normal(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_magma_kprimme_normal(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_magma_kprimme(dummy_type_magma_kprimme *V, dummy_type_magma_kprimme *W, dummy_type_magma_kprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_magma_kprimme *evecs,
@@ -1401,6 +1760,28 @@ int compute_residual_columnsmagma_kprimme(PRIMME_INT m, dummy_type_sprimme *eval
       dummy_type_magma_kprimme *xo, dummy_type_magma_kprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_magma_kprimme *ro,
       PRIMME_INT ldro, dummy_type_magma_kprimme *xd, dummy_type_magma_kprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_magma_kprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmemagma_kprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacemagma_kprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmemagma_kprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmemagma_kprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmemagma_kprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacemagma_kprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacemagma_kprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacemagma_kprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmemagma_kprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_magma_kprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_magma_sprimme(dummy_type_magma_sprimme *V, dummy_type_magma_sprimme *W, dummy_type_magma_sprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_magma_sprimme *evecs,
@@ -1498,6 +1879,28 @@ int compute_residual_columnsmagma_sprimme(PRIMME_INT m, dummy_type_sprimme *eval
       dummy_type_magma_sprimme *xo, dummy_type_magma_sprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_magma_sprimme *ro,
       PRIMME_INT ldro, dummy_type_magma_sprimme *xd, dummy_type_magma_sprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_magma_sprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmemagma_sprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacemagma_sprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmemagma_sprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmemagma_sprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmemagma_sprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacemagma_sprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacemagma_sprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacemagma_sprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmemagma_sprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_magma_sprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_magma_cprimme_normal(dummy_type_magma_cprimme *V, dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_cprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_magma_cprimme *evecs,
@@ -1595,6 +1998,28 @@ int compute_residual_columnsmagma_cprimme_normal(PRIMME_INT m, dummy_type_cprimm
       dummy_type_magma_cprimme *xo, dummy_type_magma_cprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_magma_cprimme *ro,
       PRIMME_INT ldro, dummy_type_magma_cprimme *xd, dummy_type_magma_cprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_magma_cprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmemagma_cprimme_normal(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacemagma_cprimme_normal(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmemagma_cprimme_normal(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmemagma_cprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmemagma_cprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacemagma_cprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacemagma_cprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacemagma_cprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmemagma_cprimme_normal(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_magma_cprimme_normal(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_magma_cprimme(dummy_type_magma_cprimme *V, dummy_type_magma_cprimme *W, dummy_type_magma_cprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_sprimme *hVals, dummy_type_sprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_sprimme *blockNorms, dummy_type_magma_cprimme *evecs,
@@ -1692,6 +2117,28 @@ int compute_residual_columnsmagma_cprimme(PRIMME_INT m, dummy_type_sprimme *eval
       dummy_type_magma_cprimme *xo, dummy_type_magma_cprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_magma_cprimme *ro,
       PRIMME_INT ldro, dummy_type_magma_cprimme *xd, dummy_type_magma_cprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_magma_cprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmemagma_cprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacemagma_cprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmemagma_cprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmemagma_cprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmemagma_cprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacemagma_cprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacemagma_cprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacemagma_cprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmemagma_cprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_magma_cprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_magma_dprimme(dummy_type_magma_dprimme *V, dummy_type_magma_dprimme *W, dummy_type_magma_dprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_magma_dprimme *evecs,
@@ -1789,6 +2236,28 @@ int compute_residual_columnsmagma_dprimme(PRIMME_INT m, dummy_type_dprimme *eval
       dummy_type_magma_dprimme *xo, dummy_type_magma_dprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_magma_dprimme *ro,
       PRIMME_INT ldro, dummy_type_magma_dprimme *xd, dummy_type_magma_dprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_magma_dprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmemagma_dprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacemagma_dprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmemagma_dprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmemagma_dprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmemagma_dprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacemagma_dprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacemagma_dprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacemagma_dprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmemagma_dprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_magma_dprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_magma_zprimme_normal(dummy_type_magma_zprimme *V, dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_zprimme *hVals, dummy_type_dprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_magma_zprimme *evecs,
@@ -1886,6 +2355,28 @@ int compute_residual_columnsmagma_zprimme_normal(PRIMME_INT m, dummy_type_zprimm
       dummy_type_magma_zprimme *xo, dummy_type_magma_zprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_magma_zprimme *ro,
       PRIMME_INT ldro, dummy_type_magma_zprimme *xd, dummy_type_magma_zprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_magma_zprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmemagma_zprimme_normal(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacemagma_zprimme_normal(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmemagma_zprimme_normal(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmemagma_zprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmemagma_zprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacemagma_zprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacemagma_zprimme_normal(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacemagma_zprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmemagma_zprimme_normal(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_magma_zprimme_normal(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 int restart_magma_zprimme(dummy_type_magma_zprimme *V, dummy_type_magma_zprimme *W, dummy_type_magma_zprimme *BV, PRIMME_INT nLocal,
       int basisSize, PRIMME_INT ldV, dummy_type_dprimme *hVals, dummy_type_dprimme *hSVals, int *flags,
       int *iev, int *ievSize, dummy_type_dprimme *blockNorms, dummy_type_magma_zprimme *evecs,
@@ -1983,4 +2474,26 @@ int compute_residual_columnsmagma_zprimme(PRIMME_INT m, dummy_type_dprimme *eval
       dummy_type_magma_zprimme *xo, dummy_type_magma_zprimme *Bxo, int no, PRIMME_INT ldxo, int io0, dummy_type_magma_zprimme *ro,
       PRIMME_INT ldro, dummy_type_magma_zprimme *xd, dummy_type_magma_zprimme *Bxd, int nd, int *pd,
       PRIMME_INT ldxd, dummy_type_magma_zprimme *rd, PRIMME_INT ldrd, primme_context ctx);
+int Num_aux_update_VWXR_workspace_Sprimmemagma_zprimme(PRIMME_INT mV, int nX, int nY,
+      int nBX, int nGH, int nNorms, int nVtBV, int evecsSize,
+      primme_context ctx);
+int compute_residual_columns_workspacemagma_zprimme(
+      PRIMME_INT m, int n, int nd, int withBxo, primme_context ctx);
+int ortho_coefficient_vectors_workspace_Sprimmemagma_zprimme(
+      int basisSize, int numPrevRetained, int withVtBV, primme_context ctx);
+int restart_soft_locking_workspace_Sprimmemagma_zprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_locking_workspace_Sprimmemagma_zprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int restart_RR_workspacemagma_zprimme(int basisSize, int numPrevRetained,
+      int withVtBV, primme_context ctx);
+int restart_refined_workspacemagma_zprimme(int basisSize, int numPrevRetained,
+      int withVtBV, int withQtQ, primme_context ctx);
+int restart_harmonic_workspacemagma_zprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int restart_projection_workspace_Sprimmemagma_zprimme(int basisSize,
+      int numPrevRetained, int withVtBV, int withQtQ, int withEvecsHat,
+      primme_context ctx);
+int restart_workspace_magma_zprimme(int basisSize, int withVtBV, int withQtQ,
+      int withEvecsHat, primme_context ctx);
 #endif
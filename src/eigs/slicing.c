@@ -0,0 +1,1032 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ * File: slicing.c
+ *
+ * Purpose - Compute all eigenpairs in an interval by splitting the interval
+ *           into slices and solving every slice independently.
+ *
+ * The number of eigenvalues in the interval is estimated with the kernel
+ * polynomial method (KPM), and the interval is split into slices with about
+ * sliceSize eigenvalues each. Every slice is solved with target
+ * primme_closest_abs and the center of the slice as the shift, so the cost of
+ * every solve depends on the size of the slice and not on the size of the
+ * interval. The slices are solved concurrently by the OpenMP threads if the
+ * library is built with OpenMP, and by groups of processes if the user
+ * provides splitComm in parallel programs. Finally the pairs are merged in
+ * ascending order, and the pairs near the boundary between slices that were
+ * found by both slices are removed by orthogonalizing them against the close
+ * pairs of the other slice.
+ *
+ ******************************************************************************/
+
+#ifndef THIS_FILE
+#define THIS_FILE "../eigs/slicing.c"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "numerical.h"
+#include "template_normal.h"
+#include "common_eigs.h"
+#include "primme_interface.h"
+
+#ifndef SLICING_PRIVATE_H
+#define SLICING_PRIVATE_H
+
+#define SLICING_LANCZOS_STEPS 30   /* steps to estimate the spectrum bounds */
+#define SLICING_KPM_DEGREE 100     /* degree of the KPM expansion */
+#define SLICING_KPM_VECTORS 10     /* random vectors to estimate the trace */
+#define SLICING_DEFAULT_SIZE 50    /* eigenvalues per slice if not given */
+#define SLICING_PI 3.14159265358979323846
+#define SLICING_INFO_SIZE 16       /* numbers sent per slice by gather_slices */
+
+typedef struct {
+   double lower, upper;    /* interval of the slice */
+   double shift;           /* center of the interval, the target shift */
+   double estimate;        /* estimated number of eigenvalues in the slice */
+   int numEvals;           /* number of pairs returned by the solves */
+   void *evals;            /* eigenvalues returned by the solves */
+   void *evecs;            /* eigenvectors returned by the solves */
+   void *resNorms;         /* residual norms returned by the solves */
+   primme_stats stats;     /* accumulated statistics of the solves */
+   int ret;                /* error code of the last solve */
+} slicing_slice;
+
+#endif /* SLICING_PRIVATE_H */
+
+/* Keep automatically generated headers under this section  */
+#ifndef CHECK_TEMPLATE
+#include "slicing.h"
+#include "auxiliary_eigs.h"
+#include "primme_c.h"
+#endif
+
+/*******************************************************************************
+ * Subroutine Xprimme_slicing - Compute all eigenpairs with eigenvalues in
+ *    [lower, upper] for Hermitian problems.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * lower, upper  The interval
+ *
+ * sliceSize  Desired number of eigenvalues in every slice; if not positive,
+ *            SLICING_DEFAULT_SIZE
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * evals     The eigenvalues in ascending order
+ *
+ * evecs     The eigenvectors, with leading dimension primme->nLocal
+ *
+ * resNorms  The residual norms
+ *
+ * numEvals  On input, the number of pairs that fit in evals, evecs and
+ *           resNorms. On output, the number of pairs returned
+ *
+ * primme    Parameters of the solves; target, targetShifts, numEvals,
+ *           initSize and numOrthoConst are set for every slice. With several
+ *           processes, the slices are solved by the groups set by splitComm
+ *
+ * Return Value
+ * ------------
+ * error code
+ ******************************************************************************/
+
+int Xprimme_slicing(XREAL lower, XREAL upper, int sliceSize, XEVAL *evals,
+      XSCALAR *evecs, XREAL *resNorms, int *numEvals, primme_params *primme) {
+
+#if defined(SUPPORTED_TYPE) && defined(USE_HERMITIAN) && defined(USE_HOST) && \
+      !defined(USE_HALF) && !defined(USE_HALFCOMPLEX)
+
+   if (primme == NULL) return -4;
+   if (primme->matrixMatvec == NULL) return -7;
+   if (numEvals == NULL || *numEvals < 0) return -11;
+   if (!(lower <= upper)) return -13;
+   if (evals == NULL) return -30;
+   if (evecs == NULL) return -31;
+   if (resNorms == NULL) return -32;
+
+   /* Set the current type as the default type for user's operators */
+
+   if (primme->matrixMatvec_type == primme_op_default)
+      primme->matrixMatvec_type = PRIMME_OP_SCALAR;
+   if (primme->globalSumReal && primme->globalSumReal_type == primme_op_default)
+      primme->globalSumReal_type = PRIMME_OP_SCALAR;
+   if (primme->numProcs <= 1) {
+      primme->nLocal = primme->n;
+      primme->procID = 0;
+   }
+
+   /* The estimation of the spectrum calls the operators with vectors of */
+   /* leading dimension nLocal before any solve sets the default ldOPs   */
+
+   if (primme->ldOPs == -1) primme->ldOPs = primme->nLocal;
+
+   /* Set default monitor, which prints the messages of the slicing */
+
+   if (!primme->monitorFun) {
+      primme->monitorFun = default_monitor;
+      primme->monitorFun_type = PRIMME_OP_SCALAR;
+   }
+
+   /* Generate context */
+
+   primme_context ctx = primme_get_context(primme);
+   Mem_create_arena(primme->workspace, primme->lworkspace, &ctx);
+
+   int ret;
+   CHKERRVAL(slicing_Sprimme(lower, upper, sliceSize, evals, evecs, resNorms,
+                   numEvals, ctx),
+         &ret);
+
+   primme_free_context(ctx);
+
+   return ret;
+#else
+
+   (void)lower;
+   (void)upper;
+   (void)sliceSize;
+   (void)evals;
+   (void)evecs;
+   (void)resNorms;
+
+   if (numEvals) *numEvals = 0;
+   (void)primme;
+   return PRIMME_FUNCTION_UNAVAILABLE;
+#endif
+}
+
+#if defined(SUPPORTED_TYPE) && defined(USE_HERMITIAN) && defined(USE_HOST) && \
+      !defined(USE_HALF) && !defined(USE_HALFCOMPLEX)
+
+/*******************************************************************************
+ * Subroutine slicing_Sprimme - Estimate the eigenvalue counts, split the
+ *    interval, solve the slices and merge the pairs.
+ *
+ * INPUT/OUTPUT ARRAYS AND PARAMETERS
+ * ----------------------------------
+ * See Xprimme_slicing
+ *
+ * Return Value
+ * ------------
+ * error code
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int slicing_Sprimme(HREAL lower, HREAL upper, int sliceSize, HREAL *evals,
+      SCALAR *evecs, HREAL *resNorms, int *numEvals, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   double t0 = primme_wTimer();
+   int i, j;
+
+   /* Reset the statistics; the matvecs done by the estimation are also */
+   /* counted                                                           */
+
+   primme_stats stats0 = primme->stats;
+   memset(&primme->stats, 0, sizeof(primme_stats));
+   primme->stats.estimateMinEVal = stats0.estimateMinEVal;
+   primme->stats.estimateMaxEVal = stats0.estimateMaxEVal;
+   primme->stats.estimateLargestSVal = stats0.estimateLargestSVal;
+
+   /* Estimate the eigenvalue counts */
+
+   HREAL lmin, lmax;
+   CHKERR(spectrum_bounds(&lmin, &lmax, ctx));
+   HREAL mu[SLICING_KPM_DEGREE];
+   CHKERR(kpm_moments(lmin, lmax, mu, ctx));
+
+   /* Split [lower, upper] into slices with the same number of eigenvalues */
+   /* in the scaled interval [-1, 1]                                       */
+
+   HREAL c = (lmax + lmin) / 2.0, e = (lmax - lmin) / 2.0;
+   HREAL xl = (lower - c) / e, xu = (upper - c) / e;
+   HREAL nl = kpm_count(xl, mu), nu = kpm_count(xu, mu);
+   if (sliceSize <= 0) sliceSize = SLICING_DEFAULT_SIZE;
+   int numSlices = max(1, (int)ceil((nu - nl) / sliceSize));
+   numSlices = (int)min(numSlices, primme->n);
+
+   slicing_slice *slices;
+   CHKERR(MALLOC_PRIMME(numSlices, &slices));
+   HREAL a = lower, na = nl;
+   for (i = 0; i < numSlices; i++) {
+      HREAL b = upper, nb = nu;
+      if (i < numSlices - 1) {
+         /* Bisection on the count, which is nondecreasing */
+         HREAL target = nl + (nu - nl) * (i + 1) / numSlices;
+         HREAL x0 = (a - c) / e, x1 = xu;
+         for (j = 0; j < 50; j++) {
+            HREAL xm = (x0 + x1) / 2.0;
+            if (kpm_count(xm, mu) < target) x0 = xm;
+            else x1 = xm;
+         }
+         b = c + e * (x0 + x1) / 2.0;
+         nb = target;
+      }
+      slices[i].lower = a;
+      slices[i].upper = b;
+      slices[i].shift = (a + b) / 2.0;
+      slices[i].estimate = max(0.0, nb - na);
+      slices[i].numEvals = 0;
+      slices[i].evals = slices[i].evecs = slices[i].resNorms = NULL;
+      slices[i].ret = 0;
+      a = b;
+      na = nb;
+   }
+
+   PRINTF(2, "Slicing: spectrum in [%g, %g], about %g eigenvalues in "
+             "[%g, %g], %d slices",
+         (double)lmin, (double)lmax, (double)(nu - nl), (double)lower,
+         (double)upper, numSlices);
+
+   /* Split the processes in groups. The slice i is solved by the group */
+   /* i % numGroups                                                      */
+
+   primme_params primme_group = *primme;
+   int numGroups = 1, group = 0;
+   int split = (primme->numProcs > 1 && primme->splitComm && numSlices > 1);
+   PRIMME_INT row0 = 0, grow0 = 0;
+   if (split) {
+      CHKERR(split_processes(min(primme->numProcs, numSlices), &numGroups,
+            &group, &primme_group, &row0, &grow0, ctx));
+   }
+
+   /* Solve the slices. Every solve is independent, so they are done by */
+   /* different threads. With several processes, the processes of a     */
+   /* group solve the slices of the group one after another.            */
+
+   int numProcs = primme->numProcs;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (numProcs <= 1)
+#endif
+   for (i = 0; i < numSlices; i++) {
+      if (i % numGroups == group) {
+         slices[i].ret = solve_slice(&slices[i], &primme_group);
+      }
+   }
+   (void)numProcs;
+
+   /* Send the pairs of every slice to all processes, and release the */
+   /* groups                                                           */
+
+   if (split) {
+      int ret0 = gather_slices(slices, numSlices, numGroups, group,
+            &primme_group, row0, grow0, ctx);
+      int zero = 0, ierr = 0;
+      primme->splitComm(&zero, &group, &primme_group, primme, &ierr);
+      CHKERR(ret0);
+      CHKERRM(ierr, PRIMME_USER_FAILURE, "Error returned by 'splitComm' %d",
+            ierr);
+   }
+
+   for (i = 0; i < numSlices; i++) {
+      PRINTF(2, "Slicing: slice %d in [%g, %g], %d pairs, %" PRIMME_INT_P
+                " matvecs, %g s",
+            i, slices[i].lower, slices[i].upper, slices[i].numEvals,
+            slices[i].stats.numMatvecs, slices[i].stats.elapsedTime);
+   }
+
+   /* Merge the pairs in ascending order, and remove the repeated pairs */
+
+   int ret = 0, numCandidates = 0;
+   for (i = 0; i < numSlices; i++) {
+      if (slices[i].ret != 0 && ret == 0) ret = slices[i].ret;
+      numCandidates += slices[i].numEvals;
+   }
+
+   int *cslice, *cidx;
+   CHKERR(Num_malloc_iprimme(numCandidates, &cslice, ctx));
+   CHKERR(Num_malloc_iprimme(numCandidates, &cidx, ctx));
+   int numc = 0;
+   for (i = 0; i < numSlices; i++) {
+      for (j = 0; j < slices[i].numEvals; j++) {
+         HREAL lambda = ((HREAL *)slices[i].evals)[j];
+         int k;
+         for (k = numc; k > 0; k--) {
+            if (((HREAL *)slices[cslice[k - 1]].evals)[cidx[k - 1]] <= lambda)
+               break;
+            cslice[k] = cslice[k - 1];
+            cidx[k] = cidx[k - 1];
+         }
+         cslice[k] = i;
+         cidx[k] = j;
+         numc++;
+      }
+   }
+
+   HREAL tol = 10.0 * MACHINE_EPSILON * max(fabs(lmin), fabs(lmax));
+   PRIMME_INT nLocal = primme->nLocal;
+   int *oslice;
+   HSCALAR *h;
+   CHKERR(Num_malloc_iprimme(max(1, *numEvals), &oslice, ctx));
+   CHKERR(Num_malloc_SHprimme(max(1, *numEvals), &h, ctx));
+   int numOut = 0;
+   for (i = 0; i < numc; i++) {
+      slicing_slice *s = &slices[cslice[i]];
+      HREAL lambda = ((HREAL *)s->evals)[cidx[i]];
+      HREAL rnorm = ((HREAL *)s->resNorms)[cidx[i]];
+
+      /* Keep the pairs in the output interval and in the slice interval, */
+      /* widened by the residual norm                                     */
+
+      if (lambda < lower || lambda > upper) continue;
+      if (lambda < s->lower - rnorm - tol || lambda > s->upper + rnorm + tol)
+         continue;
+      if (numOut >= *numEvals) {
+         PRINTF(1, "Slicing: evals, evecs and resNorms are too small; at "
+                   "least %d pairs are in the interval", numOut + 1);
+         if (ret == 0) ret = -46;
+         break;
+      }
+
+      SCALAR *x = &evecs[nLocal * numOut];
+      Num_copy_Sprimme(nLocal, &((SCALAR *)s->evecs)[nLocal * cidx[i]], 1, x,
+            1, ctx);
+
+      /* Orthogonalize against the returned pairs from other slices with */
+      /* eigenvalue close to lambda, and drop the pair if most of it is  */
+      /* in the span of them                                              */
+
+      int k0 = numOut;
+      while (k0 > 0 &&
+             evals[k0 - 1] >= lambda - rnorm - resNorms[k0 - 1] - tol) {
+         k0--;
+      }
+      int nh = 0;
+      for (j = k0; j < numOut; j++) {
+         if (oslice[j] == cslice[i]) continue;
+         h[nh++] = Num_dot_Sprimme(nLocal, &evecs[nLocal * j], 1, x, 1, ctx);
+      }
+      if (nh > 0) {
+         CHKERR(globalSum_SHprimme(h, nh, ctx));
+         nh = 0;
+         for (j = k0; j < numOut; j++) {
+            if (oslice[j] == cslice[i]) continue;
+            Num_axpy_Sprimme(
+                  nLocal, -h[nh++], &evecs[nLocal * j], 1, x, 1, ctx);
+         }
+         HREAL norm;
+         CHKERR(Num_dist_dots_real_Sprimme(x, nLocal, x, nLocal, nLocal, 1,
+               &norm, ctx));
+         norm = sqrt(norm);
+         if (norm < 0.5) continue;
+         Num_scal_Sprimme(nLocal, 1.0 / norm, x, 1, ctx);
+      }
+
+      evals[numOut] = lambda;
+      resNorms[numOut] = rnorm;
+      oslice[numOut] = cslice[i];
+      numOut++;
+   }
+   *numEvals = numOut;
+
+   /* Accumulate the statistics of the slices */
+
+   for (i = 0; i < numSlices; i++) {
+      primme_stats *st = &slices[i].stats;
+      primme->stats.numOuterIterations += st->numOuterIterations;
+      primme->stats.numRestarts += st->numRestarts;
+      primme->stats.numMatvecs += st->numMatvecs;
+      primme->stats.numPreconds += st->numPreconds;
+      primme->stats.numGlobalSum += st->numGlobalSum;
+      primme->stats.volumeGlobalSum += st->volumeGlobalSum;
+      primme->stats.numOrthoInnerProds += st->numOrthoInnerProds;
+      primme->stats.timeMatvec += st->timeMatvec;
+      primme->stats.timePrecond += st->timePrecond;
+      primme->stats.timeOrtho += st->timeOrtho;
+      primme->stats.timeGlobalSum += st->timeGlobalSum;
+      primme->stats.maxConvTol = max(primme->stats.maxConvTol, st->maxConvTol);
+      primme->stats.lockingIssue |= st->lockingIssue;
+      free(slices[i].evals);
+      free(slices[i].evecs);
+      free(slices[i].resNorms);
+   }
+   primme->stats.estimateMinEVal = lmin;
+   primme->stats.estimateMaxEVal = lmax;
+   primme->stats.elapsedTime = primme_wTimer() - t0;
+
+   free(slices);
+   CHKERR(Num_free_iprimme(cslice, ctx));
+   CHKERR(Num_free_iprimme(cidx, ctx));
+   CHKERR(Num_free_iprimme(oslice, ctx));
+   CHKERR(Num_free_SHprimme(h, ctx));
+
+   return ret;
+}
+
+/*******************************************************************************
+ * Subroutine spectrum_bounds - Return an interval containing the spectrum.
+ *    If aNorm is given, the interval is [-aNorm, aNorm]; otherwise a few steps
+ *    of Lanczos are done, and the extreme Ritz values are widened by the
+ *    norm of the last residual.
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * lmin, lmax   The bounds
+ *
+ * Return Value
+ * ------------
+ * error code
+ ******************************************************************************/
+
+STATIC int spectrum_bounds(HREAL *lmin, HREAL *lmax,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   int i, j;
+
+   if (primme->aNorm > 0.0) {
+      *lmin = -primme->aNorm;
+      *lmax = primme->aNorm;
+      return 0;
+   }
+
+   int m = (int)min(SLICING_LANCZOS_STEPS, primme->n);
+   SCALAR *V;
+   HREAL alpha[SLICING_LANCZOS_STEPS], beta[SLICING_LANCZOS_STEPS];
+   CHKERR(Num_malloc_Sprimme(nLocal * 3, &V, ctx));
+   SCALAR *v0 = V, *v = &V[nLocal], *w = &V[nLocal * 2];
+
+   /* v = random unit vector */
+
+   PRIMME_INT iseed[4];
+   CHKERR(slicing_seed(iseed, ctx));
+   CHKERR(Num_larnv_Sprimme(3, iseed, nLocal, v, ctx));
+   HREAL norm;
+   CHKERR(Num_dist_dots_real_Sprimme(v, nLocal, v, nLocal, nLocal, 1, &norm,
+         ctx));
+   Num_scal_Sprimme(nLocal, 1.0 / sqrt(norm), v, 1, ctx);
+   Num_zero_matrix_Sprimme(v0, nLocal, 1, nLocal, ctx);
+
+   /* Lanczos: w = A*v - alpha*v - beta*v0 */
+
+   int k;
+   for (k = 0; k < m; k++) {
+      CHKERR(matrixMatvec_Sprimme(v, nLocal, nLocal, w, nLocal, 0, 1, ctx));
+      CHKERR(Num_dist_dots_real_Sprimme(v, nLocal, w, nLocal, nLocal, 1,
+            &alpha[k], ctx));
+      for (i = 0; i < nLocal; i++) {
+         w[i] -= alpha[k] * v[i] + (k > 0 ? beta[k - 1] : 0.0) * v0[i];
+      }
+      CHKERR(Num_dist_dots_real_Sprimme(w, nLocal, w, nLocal, nLocal, 1,
+            &beta[k], ctx));
+      beta[k] = sqrt(beta[k]);
+      SCALAR *t = v0;
+      v0 = v;
+      v = w;
+      w = t;
+      if (beta[k] <= MACHINE_EPSILON * fabs(alpha[k])) {
+         k++;
+         break;
+      }
+      Num_scal_Sprimme(nLocal, 1.0 / beta[k], v, 1, ctx);
+   }
+
+   /* Extreme eigenvalues of the tridiagonal matrix by bisection on the */
+   /* Sturm sequence, starting from the Gershgorin interval             */
+
+   HREAL g0 = HUGE_VAL, g1 = -HUGE_VAL;
+   for (i = 0; i < k; i++) {
+      HREAL r = (i > 0 ? fabs(beta[i - 1]) : 0.0) +
+                (i < k - 1 ? fabs(beta[i]) : 0.0);
+      g0 = min(g0, alpha[i] - r);
+      g1 = max(g1, alpha[i] + r);
+   }
+   HREAL bounds[2];
+   for (j = 0; j < 2; j++) {
+      HREAL x0 = g0, x1 = g1;
+      for (i = 0; i < 60; i++) {
+         HREAL xm = (x0 + x1) / 2.0;
+         if (sturm_count(alpha, beta, k, xm) >= (j == 0 ? 1 : k)) x1 = xm;
+         else x0 = xm;
+      }
+      bounds[j] = (x0 + x1) / 2.0;
+   }
+   HREAL pad = max(fabs(beta[k - 1]), (bounds[1] - bounds[0]) * 1e-3);
+   *lmin = bounds[0] - pad;
+   *lmax = bounds[1] + pad;
+
+   CHKERR(Num_free_Sprimme(V, ctx));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine kpm_moments - Estimate the trace of T_k((A-c*I)/e) for the
+ *    Chebyshev polynomials T_k, k=0:SLICING_KPM_DEGREE-1, where [c-e, c+e] is
+ *    [lmin, lmax], with random vectors. Two moments are obtained for every
+ *    matvec using T_{2k} = 2*T_k^2 - T_0 and T_{2k+1} = 2*T_{k+1}*T_k - T_1.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * lmin, lmax   Interval containing the spectrum
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * mu           The moments damped with the Jackson kernel
+ *
+ * Return Value
+ * ------------
+ * error code
+ ******************************************************************************/
+
+STATIC int kpm_moments(
+      HREAL lmin, HREAL lmax, HREAL *mu, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT nLocal = primme->nLocal;
+   int nv = (int)min(SLICING_KPM_VECTORS, primme->n);
+   int M = SLICING_KPM_DEGREE;
+   HREAL c = (lmax + lmin) / 2.0, e = (lmax - lmin) / 2.0;
+   HREAL dots[SLICING_KPM_VECTORS];
+   PRIMME_INT i;
+   int j, k;
+
+   SCALAR *T;
+   CHKERR(Num_malloc_Sprimme(nLocal * nv * 3, &T, ctx));
+   SCALAR *Tkm1 = T, *Tk = &T[nLocal * nv], *Tkp1 = &T[nLocal * nv * 2];
+
+   /* T_0 = random unit vectors */
+
+   PRIMME_INT iseed[4];
+   CHKERR(slicing_seed(iseed, ctx));
+   CHKERR(Num_larnv_Sprimme(3, iseed, nLocal * nv, Tkm1, ctx));
+   CHKERR(Num_dist_dots_real_Sprimme(
+         Tkm1, nLocal, Tkm1, nLocal, nLocal, nv, dots, ctx));
+   for (j = 0; j < nv; j++) {
+      Num_scal_Sprimme(nLocal, 1.0 / sqrt(dots[j]), &Tkm1[nLocal * j], 1, ctx);
+   }
+
+   /* T_1 = (A - c*I)/e * T_0 */
+
+   CHKERR(matrixMatvec_Sprimme(Tkm1, nLocal, nLocal, Tk, nLocal, 0, nv, ctx));
+   for (i = 0; i < nLocal * nv; i++) Tk[i] = (Tk[i] - c * Tkm1[i]) / e;
+
+   mu[0] = nv;
+   CHKERR(Num_dist_dots_real_Sprimme(
+         Tkm1, nLocal, Tk, nLocal, nLocal, nv, dots, ctx));
+   for (j = 0, mu[1] = 0.0; j < nv; j++) mu[1] += dots[j];
+
+   for (k = 1; 2 * k < M; k++) {
+      /* mu_{2k} = 2*T_k'*T_k - mu_0 */
+
+      CHKERR(Num_dist_dots_real_Sprimme(
+            Tk, nLocal, Tk, nLocal, nLocal, nv, dots, ctx));
+      for (j = 0, mu[2 * k] = -mu[0]; j < nv; j++) mu[2 * k] += 2.0 * dots[j];
+      if (2 * k + 1 >= M) break;
+
+      /* T_{k+1} = 2*(A - c*I)/e*T_k - T_{k-1} */
+
+      CHKERR(matrixMatvec_Sprimme(Tk, nLocal, nLocal, Tkp1, nLocal, 0, nv, ctx));
+      for (i = 0; i < nLocal * nv; i++) {
+         Tkp1[i] = 2.0 * (Tkp1[i] - c * Tk[i]) / e - Tkm1[i];
+      }
+
+      /* mu_{2k+1} = 2*T_{k+1}'*T_k - mu_1 */
+
+      CHKERR(Num_dist_dots_real_Sprimme(
+            Tkp1, nLocal, Tk, nLocal, nLocal, nv, dots, ctx));
+      for (j = 0, mu[2 * k + 1] = -mu[1]; j < nv; j++) {
+         mu[2 * k + 1] += 2.0 * dots[j];
+      }
+
+      SCALAR *t = Tkm1;
+      Tkm1 = Tk;
+      Tk = Tkp1;
+      Tkp1 = t;
+   }
+
+   /* Scale the averages to estimate the traces, and apply the Jackson */
+   /* damping, which makes the estimated density nonnegative            */
+
+   for (k = 0; k < M; k++) {
+      HREAL th = SLICING_PI / (M + 1);
+      HREAL g = ((M - k + 1) * cos(th * k) + sin(th * k) / tan(th)) / (M + 1);
+      mu[k] *= g * primme->n / nv;
+   }
+
+   CHKERR(Num_free_Sprimme(T, ctx));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Function kpm_count - Return the estimated number of eigenvalues of
+ *    (A-c*I)/e smaller than x, from the moments returned by kpm_moments.
+ ******************************************************************************/
+
+STATIC HREAL kpm_count(HREAL x, HREAL *mu) {
+
+   if (x <= -1.0) return 0.0;
+   if (x >= 1.0) return mu[0];
+
+   HREAL th = acos(x);
+   HREAL r = mu[0] * (SLICING_PI - th) / SLICING_PI;
+   int k;
+   for (k = 1; k < SLICING_KPM_DEGREE; k++) {
+      r -= 2.0 * mu[k] * sin(k * th) / (k * SLICING_PI);
+   }
+   return r;
+}
+
+/*******************************************************************************
+ * Function sturm_count - Return the number of eigenvalues smaller than x of
+ *    the symmetric tridiagonal matrix with diagonal a and off-diagonal b.
+ ******************************************************************************/
+
+STATIC int sturm_count(HREAL *a, HREAL *b, int n, HREAL x) {
+
+   int i, count = 0;
+   HREAL d = 1.0;
+   for (i = 0; i < n; i++) {
+      d = a[i] - x - (i > 0 ? b[i - 1] * b[i - 1] / d : 0.0);
+      if (d == 0.0) d = -MACHINE_EPSILON * (fabs(a[i]) + fabs(x) + 1.0);
+      if (d < 0.0) count++;
+   }
+   return count;
+}
+
+/*******************************************************************************
+ * Subroutine slicing_seed - Return a valid seed for Num_larnv from
+ *    primme->iseed, or from the process id if it is not set.
+ ******************************************************************************/
+
+STATIC int slicing_seed(PRIMME_INT *iseed, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int i;
+   for (i = 0; i < 4; i++) {
+      iseed[i] = primme->iseed[i];
+      if (iseed[i] < 0 || iseed[i] > 4095) iseed[i] = (primme->procID + i) % 4096;
+   }
+   iseed[3] |= 1;
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine split_processes - Split the processes in groups with splitComm,
+ *    and return the first row of the process in primme and in the group. The
+ *    rows of the vectors are distributed in blocks in the order of procID, in
+ *    primme and in every group.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * maxGroups  The number of groups suggested to splitComm
+ *
+ * OUTPUT PARAMETERS
+ * -----------------
+ * numGroups    The number of groups
+ *
+ * group        The group of this process, in [0, numGroups)
+ *
+ * primme_group The parameters of the solves of the group
+ *
+ * row0, grow0  The first row of this process in primme and in the group
+ *
+ * Return Value
+ * ------------
+ * error code
+ ******************************************************************************/
+
+STATIC int split_processes(int maxGroups, int *numGroups, int *group,
+      primme_params *primme_group, PRIMME_INT *row0, PRIMME_INT *grow0,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int numProcs = primme->numProcs, i, g;
+
+   *numGroups = maxGroups;
+   *group = 0;
+   int ierr = 0;
+   primme->splitComm(numGroups, group, primme_group, primme, &ierr);
+   CHKERRM(ierr, PRIMME_USER_FAILURE, "Error returned by 'splitComm' %d",
+         ierr);
+   if (primme_group->ldOPs < primme_group->nLocal) {
+      primme_group->ldOPs = primme_group->nLocal;
+   }
+
+   /* Gather the groups, the procID and the rows of every process */
+
+   double *info;
+   CHKERR(Num_malloc_dprimme(numProcs * 5, &info, ctx));
+   for (i = 0; i < numProcs * 5; i++) info[i] = 0.0;
+   info[primme->procID * 5 + 0] = primme->nLocal;
+   info[primme->procID * 5 + 1] = *group;
+   info[primme->procID * 5 + 2] = primme_group->procID;
+   info[primme->procID * 5 + 3] = primme_group->nLocal;
+   info[primme->procID * 5 + 4] = *numGroups;
+   CHKERR(globalSum_Tprimme(info, primme_op_double, numProcs * 5, ctx));
+
+   /* Check that all processes have the same number of groups, and that */
+   /* every group has all rows                                          */
+
+   int ok = (*numGroups >= 1 && *numGroups <= numProcs);
+   for (i = 0; i < numProcs; i++) {
+      if ((int)info[i * 5 + 4] != *numGroups || info[i * 5 + 1] < 0 ||
+            (int)info[i * 5 + 1] >= *numGroups) {
+         ok = 0;
+      }
+   }
+   for (g = 0; g < *numGroups && ok; g++) {
+      double n = 0.0;
+      for (i = 0; i < numProcs; i++) {
+         if ((int)info[i * 5 + 1] == g) n += info[i * 5 + 3];
+      }
+      if (n != (double)primme->n) ok = 0;
+   }
+
+   *row0 = *grow0 = 0;
+   for (i = 0; i < numProcs; i++) {
+      if (i < primme->procID) *row0 += (PRIMME_INT)info[i * 5 + 0];
+      if ((int)info[i * 5 + 1] == *group &&
+            info[i * 5 + 2] < primme_group->procID) {
+         *grow0 += (PRIMME_INT)info[i * 5 + 3];
+      }
+   }
+   CHKERR(Num_free_dprimme(info, ctx));
+
+   if (!ok) {
+      int zero = 0;
+      primme->splitComm(&zero, group, primme_group, primme, &ierr);
+      PRINTF(1, "Slicing: every group of 'splitComm' should have the %"
+                PRIMME_INT_P " rows",
+            primme->n);
+      return -47;
+   }
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine gather_slices - Send the pairs and the statistics of every slice
+ *    from the group that solved it to all processes. The eigenvectors
+ *    are returned with the rows of the process in primme.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * slices        The slices
+ *
+ * numSlices     The number of slices
+ *
+ * numGroups     The number of groups; the slice i was solved by the group
+ *               i % numGroups
+ *
+ * group         The group of this process
+ *
+ * primme_group  The parameters of the solves of the group
+ *
+ * row0, grow0   The first row of this process in primme and in the group
+ *
+ * Return Value
+ * ------------
+ * error code
+ ******************************************************************************/
+
+STATIC int gather_slices(slicing_slice *slices, int numSlices, int numGroups,
+      int group, primme_params *primme_group, PRIMME_INT row0,
+      PRIMME_INT grow0, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   PRIMME_INT n = primme->n, nLocal = primme->nLocal;
+   PRIMME_INT gnLocal = primme_group->nLocal;
+   int i, j;
+
+   /* Send the number of pairs, the error code and the statistics; only */
+   /* the first process of the group sends them                         */
+
+   double *info;
+   CHKERR(Num_malloc_dprimme(numSlices * SLICING_INFO_SIZE, &info, ctx));
+   for (i = 0; i < numSlices * SLICING_INFO_SIZE; i++) info[i] = 0.0;
+   for (i = 0; i < numSlices; i++) {
+      if (i % numGroups != group || primme_group->procID != 0) continue;
+      primme_stats *st = &slices[i].stats;
+      double *v = &info[i * SLICING_INFO_SIZE];
+      v[0] = slices[i].numEvals;
+      v[1] = slices[i].ret;
+      v[2] = st->numOuterIterations;
+      v[3] = st->numRestarts;
+      v[4] = st->numMatvecs;
+      v[5] = st->numPreconds;
+      v[6] = st->numGlobalSum;
+      v[7] = st->volumeGlobalSum;
+      v[8] = st->numOrthoInnerProds;
+      v[9] = st->timeMatvec;
+      v[10] = st->timePrecond;
+      v[11] = st->timeOrtho;
+      v[12] = st->timeGlobalSum;
+      v[13] = st->maxConvTol;
+      v[14] = st->lockingIssue;
+      v[15] = st->elapsedTime;
+   }
+   CHKERR(globalSum_Tprimme(
+         info, primme_op_double, numSlices * SLICING_INFO_SIZE, ctx));
+   for (i = 0; i < numSlices; i++) {
+      primme_stats *st = &slices[i].stats;
+      double *v = &info[i * SLICING_INFO_SIZE];
+      slices[i].ret = (int)v[1];
+      memset(st, 0, sizeof(primme_stats));
+      st->numOuterIterations = (PRIMME_INT)v[2];
+      st->numRestarts = (PRIMME_INT)v[3];
+      st->numMatvecs = (PRIMME_INT)v[4];
+      st->numPreconds = (PRIMME_INT)v[5];
+      st->numGlobalSum = (PRIMME_INT)v[6];
+      st->volumeGlobalSum = (PRIMME_INT)v[7];
+      st->numOrthoInnerProds = v[8];
+      st->timeMatvec = v[9];
+      st->timePrecond = v[10];
+      st->timeOrtho = v[11];
+      st->timeGlobalSum = v[12];
+      st->maxConvTol = v[13];
+      st->lockingIssue = (int)v[14];
+      st->elapsedTime = v[15];
+   }
+
+   /* Send the pairs of every slice. The processes of the group put their */
+   /* rows of the eigenvectors in a vector with all rows, and every        */
+   /* process takes its rows after the sum                                 */
+
+   for (i = 0; i < numSlices; i++) {
+      slicing_slice *s = &slices[i];
+      int m = (int)info[i * SLICING_INFO_SIZE];
+      int owner = (i % numGroups == group);
+      if (m <= 0) {
+         s->numEvals = 0;
+         continue;
+      }
+
+      HREAL *vals;
+      SCALAR *vecs;
+      CHKERR(Num_malloc_RHprimme(m * 2, &vals, ctx));
+      CHKERR(Num_malloc_Sprimme(n * m, &vecs, ctx));
+      for (j = 0; j < m * 2; j++) vals[j] = 0.0;
+      Num_zero_matrix_Sprimme(vecs, n, m, n, ctx);
+      if (owner) {
+         if (primme_group->procID == 0) {
+            for (j = 0; j < m; j++) {
+               vals[j] = ((HREAL *)s->evals)[j];
+               vals[m + j] = ((HREAL *)s->resNorms)[j];
+            }
+         }
+         CHKERR(Num_copy_matrix_Sprimme((SCALAR *)s->evecs, gnLocal, m,
+               gnLocal, &vecs[grow0], n, ctx));
+      }
+      CHKERR(globalSum_RHprimme(vals, m * 2, ctx));
+      CHKERR(globalSum_Sprimme(vecs, n * m, ctx));
+
+      void *evals = realloc(s->evals, sizeof(HREAL) * m);
+      if (evals) s->evals = evals;
+      void *evecs = realloc(s->evecs, sizeof(SCALAR) * nLocal * m);
+      if (evecs) s->evecs = evecs;
+      void *resNorms = realloc(s->resNorms, sizeof(HREAL) * m);
+      if (resNorms) s->resNorms = resNorms;
+      if (evals && evecs && resNorms) {
+         for (j = 0; j < m; j++) {
+            ((HREAL *)s->evals)[j] = vals[j];
+            ((HREAL *)s->resNorms)[j] = vals[m + j];
+         }
+         CHKERR(Num_copy_matrix_Sprimme(
+               &vecs[row0], nLocal, m, n, (SCALAR *)s->evecs, nLocal, ctx));
+         s->numEvals = m;
+      }
+      CHKERR(Num_free_RHprimme(vals, ctx));
+      CHKERR(Num_free_Sprimme(vecs, ctx));
+      if (!evals || !evecs || !resNorms) {
+         CHKERR(Num_free_dprimme(info, ctx));
+         return PRIMME_MALLOC_FAILURE;
+      }
+   }
+
+   CHKERR(Num_free_dprimme(info, ctx));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine solve_slice - Find the eigenpairs in the interval of the slice.
+ *    The solver looks for the eigenvalues closest to the center of the slice.
+ *    If all the returned eigenvalues are in the slice, there may be more
+ *    eigenvalues in the slice, and the solve is repeated asking for twice the
+ *    eigenvalues and starting from the returned vectors.
+ *
+ *    The function doesn't use a context because it may be called by several
+ *    threads at the same time, and the buffers of the slice are allocated
+ *    with malloc.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * -----------------------
+ * s       The slice
+ *
+ * primme0 The parameters of the solve, which are copied
+ *
+ * Return Value
+ * ------------
+ * error code
+ ******************************************************************************/
+
+STATIC int solve_slice(slicing_slice *s, primme_params *primme0) {
+
+   primme_params primme = *primme0;
+   PRIMME_INT nLocal = primme.nLocal;
+   int i;
+
+   primme.target = primme_closest_abs;
+   primme.numTargetShifts = 1;
+   primme.targetShifts = &s->shift;
+   primme.numOrthoConst = 0;
+   primme.initSize = 0;
+   primme.ldevecs = nLocal;
+   primme.workspace = NULL;
+   primme.lworkspace = 0;
+   primme.recycle = 0;
+   primme.recycledBasis = NULL;
+   primme.checkpointFile = NULL;
+   primme.profiler = NULL; /* slices may be solved concurrently */
+   if (primme.initBasisMode == primme_init_checkpoint) {
+      primme.initBasisMode = primme_init_default;
+   }
+   memset(&s->stats, 0, sizeof(primme_stats));
+
+   /* Ask for a few more than the estimated eigenvalues, because the */
+   /* estimation may be short and to check that all were found       */
+
+   int m = (int)min(primme.n, (PRIMME_INT)(s->estimate * 1.1) + 5);
+   while (1) {
+      /* Resize the buffers keeping the pairs from the previous solve */
+
+      void *evals = realloc(s->evals, sizeof(HREAL) * m);
+      if (evals) s->evals = evals;
+      void *evecs = realloc(s->evecs, sizeof(SCALAR) * nLocal * m);
+      if (evecs) s->evecs = evecs;
+      void *resNorms = realloc(s->resNorms, sizeof(HREAL) * m);
+      if (resNorms) s->resNorms = resNorms;
+      if (!evals || !evecs || !resNorms) return PRIMME_MALLOC_FAILURE;
+
+      primme.numEvals = m;
+      int ret = Xprimme((XEVAL *)s->evals, (XSCALAR *)s->evecs,
+            (XREAL *)s->resNorms, &primme);
+      s->numEvals = primme.initSize;
+
+      s->stats.numOuterIterations += primme.stats.numOuterIterations;
+      s->stats.numRestarts += primme.stats.numRestarts;
+      s->stats.numMatvecs += primme.stats.numMatvecs;
+      s->stats.numPreconds += primme.stats.numPreconds;
+      s->stats.numGlobalSum += primme.stats.numGlobalSum;
+      s->stats.volumeGlobalSum += primme.stats.volumeGlobalSum;
+      s->stats.numOrthoInnerProds += primme.stats.numOrthoInnerProds;
+      s->stats.timeMatvec += primme.stats.timeMatvec;
+      s->stats.timePrecond += primme.stats.timePrecond;
+      s->stats.timeOrtho += primme.stats.timeOrtho;
+      s->stats.timeGlobalSum += primme.stats.timeGlobalSum;
+      s->stats.maxConvTol = max(s->stats.maxConvTol, primme.stats.maxConvTol);
+      s->stats.lockingIssue |= primme.stats.lockingIssue;
+      s->stats.elapsedTime += primme.stats.elapsedTime;
+      if (ret != 0) return ret;
+
+      /* The slice is complete if some eigenvalue is out of the slice */
+
+      for (i = 0; i < s->numEvals; i++) {
+         HREAL lambda = ((HREAL *)s->evals)[i];
+         if (lambda < s->lower || lambda > s->upper) break;
+      }
+      if (i < s->numEvals || m >= primme.n) break;
+
+      /* Start the next solve from the pairs found */
+
+      primme.initSize = s->numEvals;
+      m = (int)min(primme.n, 2 * (PRIMME_INT)m);
+   }
+
+   return 0;
+}
+
+#endif /* SUPPORTED_TYPE && USE_HERMITIAN && USE_HOST */
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ *   NOTE: THIS FILE IS AUTOMATICALLY GENERATED. PLEASE DON'T MODIFY
+ ******************************************************************************/
+
+
+#ifndef slicing_H
+#define slicing_H
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Sprimme)
+#  define slicing_Sprimme CONCAT(slicing_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Rprimme)
+#  define slicing_Rprimme CONCAT(slicing_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SHprimme)
+#  define slicing_SHprimme CONCAT(slicing_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RHprimme)
+#  define slicing_RHprimme CONCAT(slicing_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SXprimme)
+#  define slicing_SXprimme CONCAT(slicing_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RXprimme)
+#  define slicing_RXprimme CONCAT(slicing_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Shprimme)
+#  define slicing_Shprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Rhprimme)
+#  define slicing_Rhprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Ssprimme)
+#  define slicing_Ssprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Rsprimme)
+#  define slicing_Rsprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Sdprimme)
+#  define slicing_Sdprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Rdprimme)
+#  define slicing_Rdprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Sqprimme)
+#  define slicing_Sqprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_Rqprimme)
+#  define slicing_Rqprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SXhprimme)
+#  define slicing_SXhprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RXhprimme)
+#  define slicing_RXhprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SXsprimme)
+#  define slicing_SXsprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RXsprimme)
+#  define slicing_RXsprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SXdprimme)
+#  define slicing_SXdprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RXdprimme)
+#  define slicing_RXdprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SXqprimme)
+#  define slicing_SXqprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RXqprimme)
+#  define slicing_RXqprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SHhprimme)
+#  define slicing_SHhprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RHhprimme)
+#  define slicing_RHhprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SHsprimme)
+#  define slicing_SHsprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RHsprimme)
+#  define slicing_RHsprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SHdprimme)
+#  define slicing_SHdprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RHdprimme)
+#  define slicing_RHdprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_SHqprimme)
+#  define slicing_SHqprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_RHqprimme)
+#  define slicing_RHqprimme CONCAT(slicing_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int slicing_dprimme(dummy_type_dprimme lower, dummy_type_dprimme upper, int sliceSize, dummy_type_dprimme *evals,
+      dummy_type_dprimme *evecs, dummy_type_dprimme *resNorms, int *numEvals, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(spectrum_bounds)
+#  define spectrum_bounds CONCAT(spectrum_bounds,WITH_KIND(SCALAR_SUF))
+#endif
+int spectrum_boundsdprimme(dummy_type_dprimme *lmin, dummy_type_dprimme *lmax,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(kpm_moments)
+#  define kpm_moments CONCAT(kpm_moments,WITH_KIND(SCALAR_SUF))
+#endif
+int kpm_momentsdprimme(
+      dummy_type_dprimme lmin, dummy_type_dprimme lmax, dummy_type_dprimme *mu, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(kpm_count)
+#  define kpm_count CONCAT(kpm_count,WITH_KIND(SCALAR_SUF))
+#endif
+dummy_type_dprimme kpm_countdprimme(dummy_type_dprimme x, dummy_type_dprimme *mu);
+#if !defined(CHECK_TEMPLATE) && !defined(sturm_count)
+#  define sturm_count CONCAT(sturm_count,WITH_KIND(SCALAR_SUF))
+#endif
+int sturm_countdprimme(dummy_type_dprimme *a, dummy_type_dprimme *b, int n, dummy_type_dprimme x);
+#if !defined(CHECK_TEMPLATE) && !defined(slicing_seed)
+#  define slicing_seed CONCAT(slicing_seed,WITH_KIND(SCALAR_SUF))
+#endif
+int slicing_seeddprimme(PRIMME_INT *iseed, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(split_processes)
+#  define split_processes CONCAT(split_processes,WITH_KIND(SCALAR_SUF))
+#endif
+int split_processesdprimme(int maxGroups, int *numGroups, int *group,
+      primme_params *primme_group, PRIMME_INT *row0, PRIMME_INT *grow0,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(gather_slices)
+#  define gather_slices CONCAT(gather_slices,WITH_KIND(SCALAR_SUF))
+#endif
+int gather_slicesdprimme(slicing_slice *slices, int numSlices, int numGroups,
+      int group, primme_params *primme_group, PRIMME_INT row0,
+      PRIMME_INT grow0, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(solve_slice)
+#  define solve_slice CONCAT(solve_slice,WITH_KIND(SCALAR_SUF))
+#endif
+int solve_slicedprimme(slicing_slice *s, primme_params *primme0);
+int slicing_sprimme(dummy_type_sprimme lower, dummy_type_sprimme upper, int sliceSize, dummy_type_sprimme *evals,
+      dummy_type_sprimme *evecs, dummy_type_sprimme *resNorms, int *numEvals, primme_context ctx);
+int spectrum_boundssprimme(dummy_type_sprimme *lmin, dummy_type_sprimme *lmax,
+      primme_context ctx);
+int kpm_momentssprimme(
+      dummy_type_sprimme lmin, dummy_type_sprimme lmax, dummy_type_sprimme *mu, primme_context ctx);
+dummy_type_sprimme kpm_countsprimme(dummy_type_sprimme x, dummy_type_sprimme *mu);
+int sturm_countsprimme(dummy_type_sprimme *a, dummy_type_sprimme *b, int n, dummy_type_sprimme x);
+int slicing_seedsprimme(PRIMME_INT *iseed, primme_context ctx);
+int split_processessprimme(int maxGroups, int *numGroups, int *group,
+      primme_params *primme_group, PRIMME_INT *row0, PRIMME_INT *grow0,
+      primme_context ctx);
+int gather_slicessprimme(slicing_slice *slices, int numSlices, int numGroups,
+      int group, primme_params *primme_group, PRIMME_INT row0,
+      PRIMME_INT grow0, primme_context ctx);
+int solve_slicesprimme(slicing_slice *s, primme_params *primme0);
+int slicing_cprimme(dummy_type_sprimme lower, dummy_type_sprimme upper, int sliceSize, dummy_type_sprimme *evals,
+      dummy_type_cprimme *evecs, dummy_type_sprimme *resNorms, int *numEvals, primme_context ctx);
+int spectrum_boundscprimme(dummy_type_sprimme *lmin, dummy_type_sprimme *lmax,
+      primme_context ctx);
+int kpm_momentscprimme(
+      dummy_type_sprimme lmin, dummy_type_sprimme lmax, dummy_type_sprimme *mu, primme_context ctx);
+dummy_type_sprimme kpm_countcprimme(dummy_type_sprimme x, dummy_type_sprimme *mu);
+int sturm_countcprimme(dummy_type_sprimme *a, dummy_type_sprimme *b, int n, dummy_type_sprimme x);
+int slicing_seedcprimme(PRIMME_INT *iseed, primme_context ctx);
+int split_processescprimme(int maxGroups, int *numGroups, int *group,
+      primme_params *primme_group, PRIMME_INT *row0, PRIMME_INT *grow0,
+      primme_context ctx);
+int gather_slicescprimme(slicing_slice *slices, int numSlices, int numGroups,
+      int group, primme_params *primme_group, PRIMME_INT row0,
+      PRIMME_INT grow0, primme_context ctx);
+int solve_slicecprimme(slicing_slice *s, primme_params *primme0);
+int slicing_zprimme(dummy_type_dprimme lower, dummy_type_dprimme upper, int sliceSize, dummy_type_dprimme *evals,
+      dummy_type_zprimme *evecs, dummy_type_dprimme *resNorms, int *numEvals, primme_context ctx);
+int spectrum_boundszprimme(dummy_type_dprimme *lmin, dummy_type_dprimme *lmax,
+      primme_context ctx);
+int kpm_momentszprimme(
+      dummy_type_dprimme lmin, dummy_type_dprimme lmax, dummy_type_dprimme *mu, primme_context ctx);
+dummy_type_dprimme kpm_countzprimme(dummy_type_dprimme x, dummy_type_dprimme *mu);
+int sturm_countzprimme(dummy_type_dprimme *a, dummy_type_dprimme *b, int n, dummy_type_dprimme x);
+int slicing_seedzprimme(PRIMME_INT *iseed, primme_context ctx);
+int split_processeszprimme(int maxGroups, int *numGroups, int *group,
+      primme_params *primme_group, PRIMME_INT *row0, PRIMME_INT *grow0,
+      primme_context ctx);
+int gather_sliceszprimme(slicing_slice *slices, int numSlices, int numGroups,
+      int group, primme_params *primme_group, PRIMME_INT row0,
+      PRIMME_INT grow0, primme_context ctx);
+int solve_slicezprimme(slicing_slice *s, primme_params *primme0);
+#endif
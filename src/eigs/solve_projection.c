@@ -102,8 +102,9 @@ int solve_H_Sprimme(SCALAR *H, int basisSize, int ldH, SCALAR *VtBV, int ldVtBV,
    /* In parallel (especially with heterogeneous processors/libraries) ensure */
    /* that every process has the same hVecs and hU. Only processor 0 solves   */
    /* the projected problem and broadcasts the resulting matrices to the rest */
+   /* With commReduce every process solves it and skips the broadcast.        */
 
-   if (ctx.primme->procID == 0) {
+   if (ctx.primme->procID == 0 || ctx.commReduce) {
       switch (ctx.primme->projectionParams.projection) {
          case primme_proj_RR:
             CHKERR(solve_H_RR_Sprimme(H, ldH, VtBV, ldVtBV, hVecs, ldhVecs,
@@ -665,7 +666,7 @@ STATIC int solve_H_brcast_Sprimme(int basisSize, SCALAR *hU, int ldhU,
 
    /* Quick exit */
 
-   if (basisSize <= 0) return 0;
+   if (basisSize <= 0 || ctx.commReduce) return 0;
 
    /* Allocate memory */
 
@@ -1063,6 +1064,193 @@ int map_vecs_Sprimme(HSCALAR *V, int m, int nV, int ldV, HSCALAR *W, int n0,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutines *_workspace - Take from the dry arena of the context the same
+ *    blocks that the function without the suffix takes with the given sizes.
+ *    The flags withX tell whether the optional array X of the function is
+ *    given. See main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int solve_H_RR_workspace_Sprimme(int basisSize, int withVtBV,
+      primme_target target, primme_context ctx) {
+
+   if (basisSize == 0) return 0;
+
+#ifdef USE_HERMITIAN
+   SCALAR dummyB;
+   CHKERR(Num_hegv_Sprimme("V", "U", basisSize, NULL, basisSize,
+         withVtBV ? &dummyB : NULL, basisSize, NULL, ctx));
+
+   if (target == primme_smallest || target == primme_largest) return 0;
+
+   int *permu;
+   CHKERR(Num_malloc_iprimme(basisSize, &permu, ctx));
+   CHKERR(permute_vecs_workspace_Rprimme(1, basisSize, ctx));
+   CHKERR(permute_vecs_workspace_Sprimme(basisSize, basisSize, ctx));
+   CHKERR(Num_free_iprimme(permu, ctx));
+#else
+   (void)target; /* unused parameter */
+
+   SCALAR *T, *U = NULL;
+   CHKERR(Num_malloc_Sprimme(basisSize * basisSize, &T, ctx));
+   if (withVtBV) CHKERR(Num_malloc_Sprimme(basisSize * basisSize, &U, ctx));
+   CHKERR(Num_gees_Sprimme(
+         "V", basisSize, NULL, basisSize, NULL, NULL, basisSize, ctx));
+   CHKERR(Num_free_Sprimme(T, ctx));
+   CHKERR(Num_free_Sprimme(U, ctx));
+
+   int *perm;
+   CHKERR(Num_malloc_iprimme(basisSize, &perm, ctx));
+   CHKERR(permute_vecs_workspace_Sprimme(basisSize, basisSize, ctx));
+   CHKERR(Num_free_iprimme(perm, ctx));
+#endif /* USE_HERMITIAN */
+
+   return 0;
+}
+
+STATIC int solve_H_Harm_workspace_Sprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx) {
+
+   if (basisSize == 0) return 0;
+
+   primme_target target;
+   switch(ctx.primme->target) {
+      case primme_closest_geq: target = primme_largest; break;
+      case primme_closest_leq: target = primme_smallest; break;
+      case primme_closest_abs: target = primme_largest_abs; break;
+      default: assert(0); target = ctx.primme->target;
+   }
+
+   SCALAR *rwork;
+   int *pivots;
+   CHKERR(Num_malloc_Sprimme(basisSize * basisSize, &rwork, ctx));
+   CHKERR(Num_malloc_iprimme(basisSize, &pivots, ctx));
+   CHKERR(solve_H_RR_workspace_Sprimme(basisSize, withQtQ, target, ctx));
+   CHKERR(Num_free_iprimme(pivots, ctx));
+   CHKERR(Bortho_local_workspace_SHprimme(
+         basisSize - 1, 0, basisSize, withVtBV, ctx));
+   CHKERR(Num_free_Sprimme(rwork, ctx));
+
+   return 0;
+}
+
+STATIC int solve_H_Ref_workspace_Sprimme(
+      int basisSize, int withVtBV, primme_context ctx) {
+
+   if (basisSize == 0) return 0;
+
+   primme_params *primme = ctx.primme;
+   SCALAR *U_VtBV = NULL, *rwork;
+   if (withVtBV) {
+      CHKERR(Num_malloc_Sprimme(basisSize * basisSize, &U_VtBV, ctx));
+   }
+   CHKERR(Num_gesvd_Sprimme("S", "O", basisSize, basisSize, NULL, basisSize,
+         NULL, NULL, basisSize, NULL, basisSize, ctx));
+   CHKERR(Num_malloc_Sprimme((size_t)basisSize * basisSize, &rwork, ctx));
+   CHKERR(Num_free_Sprimme(U_VtBV, ctx));
+   if (primme->target == primme_closest_abs ||
+         primme->target == primme_closest_leq ||
+         primme->target == primme_closest_geq) {
+      int *perm;
+      CHKERR(Num_malloc_iprimme(basisSize, &perm, ctx));
+      CHKERR(permute_vecs_workspace_Rprimme(1, basisSize, ctx));
+      CHKERR(permute_vecs_workspace_Sprimme(basisSize, basisSize, ctx));
+      CHKERR(permute_vecs_workspace_Sprimme(basisSize, basisSize, ctx));
+      CHKERR(Num_free_iprimme(perm, ctx));
+   }
+   CHKERR(Num_free_Sprimme(rwork, ctx));
+
+   return 0;
+}
+
+STATIC int solve_H_brcast_workspace_Sprimme(
+      int basisSize, int withhU, int withhSVals, primme_context ctx) {
+
+   const size_t c = sizeof(SCALAR)/sizeof(REAL);
+
+   if (basisSize <= 0 || ctx.commReduce) return 0;
+
+   int n = basisSize * basisSize;
+   if (withhU) n += basisSize * basisSize;
+   n += KIND((basisSize + c - 1) / c, basisSize);
+   if (withhSVals) n += (basisSize + c - 1) / c;
+   SCALAR *rwork;
+   CHKERR(Num_malloc_Sprimme(n, &rwork, ctx));
+   CHKERR(broadcast_workspace_Sprimme(n, ctx));
+   CHKERR(Num_free_Sprimme(rwork, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int solve_H_workspace_Sprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx) {
+
+   primme_projection projection = ctx.primme->projectionParams.projection;
+
+   if (ctx.primme->procID == 0 || ctx.commReduce) {
+      switch (projection) {
+         case primme_proj_RR:
+            CHKERR(solve_H_RR_workspace_Sprimme(
+                  basisSize, withVtBV, ctx.primme->target, ctx));
+            break;
+
+         case primme_proj_harmonic:
+            CHKERR(solve_H_Harm_workspace_Sprimme(
+                  basisSize, withVtBV, withQtQ, ctx));
+            break;
+
+         case primme_proj_refined:
+            CHKERR(solve_H_Ref_workspace_Sprimme(basisSize, withVtBV, ctx));
+            break;
+
+         default:
+            assert(0);
+      }
+   }
+
+   CHKERR(solve_H_brcast_workspace_Sprimme(basisSize,
+         projection != primme_proj_RR, projection == primme_proj_refined,
+         ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int prepare_vecs_workspace_Sprimme(
+      int basisSize, int blockSize, primme_context ctx) {
+
+   if (ctx.primme->projectionParams.projection != primme_proj_refined ||
+         basisSize == 0 || blockSize == 0) {
+      return 0;
+   }
+
+   /* The clusters solved with Rayleigh-Ritz have at most basisSize columns */
+
+   SCALAR *aH;
+   CHKERR(Num_malloc_Sprimme((size_t)basisSize * basisSize, &aH, ctx));
+   CHKERR(compute_submatrix_workspace_Sprimme(basisSize, basisSize, ctx));
+   CHKERR(solve_H_RR_workspace_Sprimme(
+         basisSize, 0, ctx.primme->target, ctx));
+   CHKERR(Num_free_Sprimme(aH, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int map_vecs_workspace_Sprimme(int nV, int n0, int n, primme_context ctx) {
+
+   HREAL *Vnorms;
+   HSCALAR *ip;
+   CHKERR(Num_malloc_RHprimme(nV, &Vnorms, ctx));
+   CHKERR(Num_malloc_SHprimme(nV * (n - n0), &ip, ctx));
+   CHKERR(Num_free_RHprimme(Vnorms, ctx));
+   CHKERR(Num_free_SHprimme(ip, ctx));
+
+   return 0;
+}
+
 #endif /* defined(USE_HOST) && ((!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)) */
 
 #endif /* SUPPORTED_TYPE */
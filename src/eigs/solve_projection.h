@@ -427,6 +427,388 @@ int prepare_vecs_dprimme(int basisSize, int i0, int blockSize, dummy_type_dprimm
 #endif
 int map_vecs_dprimme(dummy_type_dprimme *V, int m, int nV, int ldV, dummy_type_dprimme *W, int n0,
       int n, int ldW, int *p, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Sprimme)
+#  define solve_H_RR_workspace_Sprimme CONCAT(solve_H_RR_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Rprimme)
+#  define solve_H_RR_workspace_Rprimme CONCAT(solve_H_RR_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SHprimme)
+#  define solve_H_RR_workspace_SHprimme CONCAT(solve_H_RR_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RHprimme)
+#  define solve_H_RR_workspace_RHprimme CONCAT(solve_H_RR_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SXprimme)
+#  define solve_H_RR_workspace_SXprimme CONCAT(solve_H_RR_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RXprimme)
+#  define solve_H_RR_workspace_RXprimme CONCAT(solve_H_RR_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Shprimme)
+#  define solve_H_RR_workspace_Shprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Rhprimme)
+#  define solve_H_RR_workspace_Rhprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Ssprimme)
+#  define solve_H_RR_workspace_Ssprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Rsprimme)
+#  define solve_H_RR_workspace_Rsprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Sdprimme)
+#  define solve_H_RR_workspace_Sdprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Rdprimme)
+#  define solve_H_RR_workspace_Rdprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Sqprimme)
+#  define solve_H_RR_workspace_Sqprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_Rqprimme)
+#  define solve_H_RR_workspace_Rqprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SXhprimme)
+#  define solve_H_RR_workspace_SXhprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RXhprimme)
+#  define solve_H_RR_workspace_RXhprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SXsprimme)
+#  define solve_H_RR_workspace_SXsprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RXsprimme)
+#  define solve_H_RR_workspace_RXsprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SXdprimme)
+#  define solve_H_RR_workspace_SXdprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RXdprimme)
+#  define solve_H_RR_workspace_RXdprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SXqprimme)
+#  define solve_H_RR_workspace_SXqprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RXqprimme)
+#  define solve_H_RR_workspace_RXqprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SHhprimme)
+#  define solve_H_RR_workspace_SHhprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RHhprimme)
+#  define solve_H_RR_workspace_RHhprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SHsprimme)
+#  define solve_H_RR_workspace_SHsprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RHsprimme)
+#  define solve_H_RR_workspace_RHsprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SHdprimme)
+#  define solve_H_RR_workspace_SHdprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RHdprimme)
+#  define solve_H_RR_workspace_RHdprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_SHqprimme)
+#  define solve_H_RR_workspace_SHqprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_RR_workspace_RHqprimme)
+#  define solve_H_RR_workspace_RHqprimme CONCAT(solve_H_RR_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int solve_H_RR_workspace_dprimme(int basisSize, int withVtBV,
+      primme_target target, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_Harm_workspace_Sprimme)
+#  define solve_H_Harm_workspace_Sprimme CONCAT(solve_H_Harm_workspace_Sprimme,WITH_KIND(SCALAR_SUF))
+#endif
+int solve_H_Harm_workspace_Sprimmedprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_Ref_workspace_Sprimme)
+#  define solve_H_Ref_workspace_Sprimme CONCAT(solve_H_Ref_workspace_Sprimme,WITH_KIND(SCALAR_SUF))
+#endif
+int solve_H_Ref_workspace_Sprimmedprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_brcast_workspace_Sprimme)
+#  define solve_H_brcast_workspace_Sprimme CONCAT(solve_H_brcast_workspace_Sprimme,WITH_KIND(SCALAR_SUF))
+#endif
+int solve_H_brcast_workspace_Sprimmedprimme(
+      int basisSize, int withhU, int withhSVals, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Sprimme)
+#  define solve_H_workspace_Sprimme CONCAT(solve_H_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Rprimme)
+#  define solve_H_workspace_Rprimme CONCAT(solve_H_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SHprimme)
+#  define solve_H_workspace_SHprimme CONCAT(solve_H_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RHprimme)
+#  define solve_H_workspace_RHprimme CONCAT(solve_H_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SXprimme)
+#  define solve_H_workspace_SXprimme CONCAT(solve_H_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RXprimme)
+#  define solve_H_workspace_RXprimme CONCAT(solve_H_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Shprimme)
+#  define solve_H_workspace_Shprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Rhprimme)
+#  define solve_H_workspace_Rhprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Ssprimme)
+#  define solve_H_workspace_Ssprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Rsprimme)
+#  define solve_H_workspace_Rsprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Sdprimme)
+#  define solve_H_workspace_Sdprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Rdprimme)
+#  define solve_H_workspace_Rdprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Sqprimme)
+#  define solve_H_workspace_Sqprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_Rqprimme)
+#  define solve_H_workspace_Rqprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SXhprimme)
+#  define solve_H_workspace_SXhprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RXhprimme)
+#  define solve_H_workspace_RXhprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SXsprimme)
+#  define solve_H_workspace_SXsprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RXsprimme)
+#  define solve_H_workspace_RXsprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SXdprimme)
+#  define solve_H_workspace_SXdprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RXdprimme)
+#  define solve_H_workspace_RXdprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SXqprimme)
+#  define solve_H_workspace_SXqprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RXqprimme)
+#  define solve_H_workspace_RXqprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SHhprimme)
+#  define solve_H_workspace_SHhprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RHhprimme)
+#  define solve_H_workspace_RHhprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SHsprimme)
+#  define solve_H_workspace_SHsprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RHsprimme)
+#  define solve_H_workspace_RHsprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SHdprimme)
+#  define solve_H_workspace_SHdprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RHdprimme)
+#  define solve_H_workspace_RHdprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_SHqprimme)
+#  define solve_H_workspace_SHqprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(solve_H_workspace_RHqprimme)
+#  define solve_H_workspace_RHqprimme CONCAT(solve_H_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int solve_H_workspace_dprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Sprimme)
+#  define prepare_vecs_workspace_Sprimme CONCAT(prepare_vecs_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Rprimme)
+#  define prepare_vecs_workspace_Rprimme CONCAT(prepare_vecs_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SHprimme)
+#  define prepare_vecs_workspace_SHprimme CONCAT(prepare_vecs_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RHprimme)
+#  define prepare_vecs_workspace_RHprimme CONCAT(prepare_vecs_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SXprimme)
+#  define prepare_vecs_workspace_SXprimme CONCAT(prepare_vecs_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RXprimme)
+#  define prepare_vecs_workspace_RXprimme CONCAT(prepare_vecs_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Shprimme)
+#  define prepare_vecs_workspace_Shprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Rhprimme)
+#  define prepare_vecs_workspace_Rhprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Ssprimme)
+#  define prepare_vecs_workspace_Ssprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Rsprimme)
+#  define prepare_vecs_workspace_Rsprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Sdprimme)
+#  define prepare_vecs_workspace_Sdprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Rdprimme)
+#  define prepare_vecs_workspace_Rdprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Sqprimme)
+#  define prepare_vecs_workspace_Sqprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_Rqprimme)
+#  define prepare_vecs_workspace_Rqprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SXhprimme)
+#  define prepare_vecs_workspace_SXhprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RXhprimme)
+#  define prepare_vecs_workspace_RXhprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SXsprimme)
+#  define prepare_vecs_workspace_SXsprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RXsprimme)
+#  define prepare_vecs_workspace_RXsprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SXdprimme)
+#  define prepare_vecs_workspace_SXdprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RXdprimme)
+#  define prepare_vecs_workspace_RXdprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SXqprimme)
+#  define prepare_vecs_workspace_SXqprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RXqprimme)
+#  define prepare_vecs_workspace_RXqprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SHhprimme)
+#  define prepare_vecs_workspace_SHhprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RHhprimme)
+#  define prepare_vecs_workspace_RHhprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SHsprimme)
+#  define prepare_vecs_workspace_SHsprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RHsprimme)
+#  define prepare_vecs_workspace_RHsprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SHdprimme)
+#  define prepare_vecs_workspace_SHdprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RHdprimme)
+#  define prepare_vecs_workspace_RHdprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_SHqprimme)
+#  define prepare_vecs_workspace_SHqprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(prepare_vecs_workspace_RHqprimme)
+#  define prepare_vecs_workspace_RHqprimme CONCAT(prepare_vecs_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int prepare_vecs_workspace_dprimme(
+      int basisSize, int blockSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Sprimme)
+#  define map_vecs_workspace_Sprimme CONCAT(map_vecs_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Rprimme)
+#  define map_vecs_workspace_Rprimme CONCAT(map_vecs_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SHprimme)
+#  define map_vecs_workspace_SHprimme CONCAT(map_vecs_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RHprimme)
+#  define map_vecs_workspace_RHprimme CONCAT(map_vecs_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SXprimme)
+#  define map_vecs_workspace_SXprimme CONCAT(map_vecs_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RXprimme)
+#  define map_vecs_workspace_RXprimme CONCAT(map_vecs_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Shprimme)
+#  define map_vecs_workspace_Shprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Rhprimme)
+#  define map_vecs_workspace_Rhprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Ssprimme)
+#  define map_vecs_workspace_Ssprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Rsprimme)
+#  define map_vecs_workspace_Rsprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Sdprimme)
+#  define map_vecs_workspace_Sdprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Rdprimme)
+#  define map_vecs_workspace_Rdprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Sqprimme)
+#  define map_vecs_workspace_Sqprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_Rqprimme)
+#  define map_vecs_workspace_Rqprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SXhprimme)
+#  define map_vecs_workspace_SXhprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RXhprimme)
+#  define map_vecs_workspace_RXhprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SXsprimme)
+#  define map_vecs_workspace_SXsprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RXsprimme)
+#  define map_vecs_workspace_RXsprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SXdprimme)
+#  define map_vecs_workspace_SXdprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RXdprimme)
+#  define map_vecs_workspace_RXdprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SXqprimme)
+#  define map_vecs_workspace_SXqprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RXqprimme)
+#  define map_vecs_workspace_RXqprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SHhprimme)
+#  define map_vecs_workspace_SHhprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RHhprimme)
+#  define map_vecs_workspace_RHhprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SHsprimme)
+#  define map_vecs_workspace_SHsprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RHsprimme)
+#  define map_vecs_workspace_RHsprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SHdprimme)
+#  define map_vecs_workspace_SHdprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RHdprimme)
+#  define map_vecs_workspace_RHdprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_SHqprimme)
+#  define map_vecs_workspace_SHqprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(map_vecs_workspace_RHqprimme)
+#  define map_vecs_workspace_RHqprimme CONCAT(map_vecs_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int map_vecs_workspace_dprimme(int nV, int n0, int n, primme_context ctx);
 int solve_H_sprimme(dummy_type_sprimme *H, int basisSize, int ldH, dummy_type_sprimme *VtBV, int ldVtBV,
       dummy_type_sprimme *R, int ldR, dummy_type_sprimme *QtV, int ldQtV, dummy_type_sprimme *QtQ, int ldQtQ,
       dummy_type_sprimme *hU, int ldhU, dummy_type_sprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals,
@@ -452,6 +834,19 @@ int prepare_vecs_sprimme(int basisSize, int i0, int blockSize, dummy_type_sprimm
       primme_context ctx);
 int map_vecs_sprimme(dummy_type_sprimme *V, int m, int nV, int ldV, dummy_type_sprimme *W, int n0,
       int n, int ldW, int *p, primme_context ctx);
+int solve_H_RR_workspace_sprimme(int basisSize, int withVtBV,
+      primme_target target, primme_context ctx);
+int solve_H_Harm_workspace_Sprimmesprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int solve_H_Ref_workspace_Sprimmesprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int solve_H_brcast_workspace_Sprimmesprimme(
+      int basisSize, int withhU, int withhSVals, primme_context ctx);
+int solve_H_workspace_sprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int prepare_vecs_workspace_sprimme(
+      int basisSize, int blockSize, primme_context ctx);
+int map_vecs_workspace_sprimme(int nV, int n0, int n, primme_context ctx);
 int solve_H_cprimme_normal(dummy_type_cprimme *H, int basisSize, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
       dummy_type_cprimme *R, int ldR, dummy_type_cprimme *QtV, int ldQtV, dummy_type_cprimme *QtQ, int ldQtQ,
       dummy_type_cprimme *hU, int ldhU, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_cprimme *hVals,
@@ -477,6 +872,19 @@ int prepare_vecs_cprimme_normal(int basisSize, int i0, int blockSize, dummy_type
       primme_context ctx);
 int map_vecs_cprimme_normal(dummy_type_cprimme *V, int m, int nV, int ldV, dummy_type_cprimme *W, int n0,
       int n, int ldW, int *p, primme_context ctx);
+int solve_H_RR_workspace_cprimme_normal(int basisSize, int withVtBV,
+      primme_target target, primme_context ctx);
+int solve_H_Harm_workspace_Sprimmecprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int solve_H_Ref_workspace_Sprimmecprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int solve_H_brcast_workspace_Sprimmecprimme_normal(
+      int basisSize, int withhU, int withhSVals, primme_context ctx);
+int solve_H_workspace_cprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int prepare_vecs_workspace_cprimme_normal(
+      int basisSize, int blockSize, primme_context ctx);
+int map_vecs_workspace_cprimme_normal(int nV, int n0, int n, primme_context ctx);
 int solve_H_cprimme(dummy_type_cprimme *H, int basisSize, int ldH, dummy_type_cprimme *VtBV, int ldVtBV,
       dummy_type_cprimme *R, int ldR, dummy_type_cprimme *QtV, int ldQtV, dummy_type_cprimme *QtQ, int ldQtQ,
       dummy_type_cprimme *hU, int ldhU, dummy_type_cprimme *hVecs, int ldhVecs, dummy_type_sprimme *hVals,
@@ -502,6 +910,19 @@ int prepare_vecs_cprimme(int basisSize, int i0, int blockSize, dummy_type_cprimm
       primme_context ctx);
 int map_vecs_cprimme(dummy_type_cprimme *V, int m, int nV, int ldV, dummy_type_cprimme *W, int n0,
       int n, int ldW, int *p, primme_context ctx);
+int solve_H_RR_workspace_cprimme(int basisSize, int withVtBV,
+      primme_target target, primme_context ctx);
+int solve_H_Harm_workspace_Sprimmecprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int solve_H_Ref_workspace_Sprimmecprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int solve_H_brcast_workspace_Sprimmecprimme(
+      int basisSize, int withhU, int withhSVals, primme_context ctx);
+int solve_H_workspace_cprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int prepare_vecs_workspace_cprimme(
+      int basisSize, int blockSize, primme_context ctx);
+int map_vecs_workspace_cprimme(int nV, int n0, int n, primme_context ctx);
 int solve_H_zprimme_normal(dummy_type_zprimme *H, int basisSize, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
       dummy_type_zprimme *R, int ldR, dummy_type_zprimme *QtV, int ldQtV, dummy_type_zprimme *QtQ, int ldQtQ,
       dummy_type_zprimme *hU, int ldhU, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_zprimme *hVals,
@@ -527,6 +948,19 @@ int prepare_vecs_zprimme_normal(int basisSize, int i0, int blockSize, dummy_type
       primme_context ctx);
 int map_vecs_zprimme_normal(dummy_type_zprimme *V, int m, int nV, int ldV, dummy_type_zprimme *W, int n0,
       int n, int ldW, int *p, primme_context ctx);
+int solve_H_RR_workspace_zprimme_normal(int basisSize, int withVtBV,
+      primme_target target, primme_context ctx);
+int solve_H_Harm_workspace_Sprimmezprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int solve_H_Ref_workspace_Sprimmezprimme_normal(
+      int basisSize, int withVtBV, primme_context ctx);
+int solve_H_brcast_workspace_Sprimmezprimme_normal(
+      int basisSize, int withhU, int withhSVals, primme_context ctx);
+int solve_H_workspace_zprimme_normal(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int prepare_vecs_workspace_zprimme_normal(
+      int basisSize, int blockSize, primme_context ctx);
+int map_vecs_workspace_zprimme_normal(int nV, int n0, int n, primme_context ctx);
 int solve_H_zprimme(dummy_type_zprimme *H, int basisSize, int ldH, dummy_type_zprimme *VtBV, int ldVtBV,
       dummy_type_zprimme *R, int ldR, dummy_type_zprimme *QtV, int ldQtV, dummy_type_zprimme *QtQ, int ldQtQ,
       dummy_type_zprimme *hU, int ldhU, dummy_type_zprimme *hVecs, int ldhVecs, dummy_type_dprimme *hVals,
@@ -552,4 +986,17 @@ int prepare_vecs_zprimme(int basisSize, int i0, int blockSize, dummy_type_zprimm
       primme_context ctx);
 int map_vecs_zprimme(dummy_type_zprimme *V, int m, int nV, int ldV, dummy_type_zprimme *W, int n0,
       int n, int ldW, int *p, primme_context ctx);
+int solve_H_RR_workspace_zprimme(int basisSize, int withVtBV,
+      primme_target target, primme_context ctx);
+int solve_H_Harm_workspace_Sprimmezprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int solve_H_Ref_workspace_Sprimmezprimme(
+      int basisSize, int withVtBV, primme_context ctx);
+int solve_H_brcast_workspace_Sprimmezprimme(
+      int basisSize, int withhU, int withhSVals, primme_context ctx);
+int solve_H_workspace_zprimme(
+      int basisSize, int withVtBV, int withQtQ, primme_context ctx);
+int prepare_vecs_workspace_zprimme(
+      int basisSize, int blockSize, primme_context ctx);
+int map_vecs_workspace_zprimme(int nV, int n0, int n, primme_context ctx);
 #endif
@@ -112,4 +112,25 @@ int update_Q_Sprimme(SCALAR *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, SCALAR *W,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine update_Q_workspace - Take from the dry arena of the context the
+ *    same blocks that update_Q takes with the given sizes. The flags withR and
+ *    withQtQ tell whether R and QtQ are given. See main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int update_Q_workspace_Sprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx) {
+
+   if (blockSize <= 0 || !withR) return 0;
+
+   HEVAL *t;
+   CHKERR(KIND(Num_malloc_RHprimme, Num_malloc_SHprimme)(blockSize, &t, ctx));
+   CHKERR(KIND(Num_free_RHprimme, Num_free_SHprimme)(t, ctx));
+   CHKERR(ortho_block_workspace_Sprimme(withQtQ, 1 /* R */, nQ,
+         nQ + blockSize - 1, 0, 0, ctx.primme->nLocal, ctx));
+
+   return 0;
+}
+
 #endif /* SUPPORTED_TYPE */
@@ -127,72 +127,198 @@ int update_Q_dprimme(dummy_type_dprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV,
       PRIMME_INT ldW, dummy_type_dprimme *Q, PRIMME_INT ldQ, dummy_type_dprimme *R, int ldR,
       dummy_type_dprimme *QtQ, int ldQtQ, dummy_type_dprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Sprimme)
+#  define update_Q_workspace_Sprimme CONCAT(update_Q_workspace_,WITH_KIND(SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Rprimme)
+#  define update_Q_workspace_Rprimme CONCAT(update_Q_workspace_,WITH_KIND(REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SHprimme)
+#  define update_Q_workspace_SHprimme CONCAT(update_Q_workspace_,WITH_KIND(HOST_SCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RHprimme)
+#  define update_Q_workspace_RHprimme CONCAT(update_Q_workspace_,WITH_KIND(HOST_REAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SXprimme)
+#  define update_Q_workspace_SXprimme CONCAT(update_Q_workspace_,WITH_KIND(XSCALAR_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RXprimme)
+#  define update_Q_workspace_RXprimme CONCAT(update_Q_workspace_,WITH_KIND(XREAL_SUF))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Shprimme)
+#  define update_Q_workspace_Shprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Rhprimme)
+#  define update_Q_workspace_Rhprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Ssprimme)
+#  define update_Q_workspace_Ssprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Rsprimme)
+#  define update_Q_workspace_Rsprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Sdprimme)
+#  define update_Q_workspace_Sdprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Rdprimme)
+#  define update_Q_workspace_Rdprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Sqprimme)
+#  define update_Q_workspace_Sqprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_Rqprimme)
+#  define update_Q_workspace_Rqprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SXhprimme)
+#  define update_Q_workspace_SXhprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RXhprimme)
+#  define update_Q_workspace_RXhprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SXsprimme)
+#  define update_Q_workspace_SXsprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RXsprimme)
+#  define update_Q_workspace_RXsprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SXdprimme)
+#  define update_Q_workspace_SXdprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RXdprimme)
+#  define update_Q_workspace_RXdprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SXqprimme)
+#  define update_Q_workspace_SXqprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RXqprimme)
+#  define update_Q_workspace_RXqprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SHhprimme)
+#  define update_Q_workspace_SHhprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RHhprimme)
+#  define update_Q_workspace_RHhprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SHsprimme)
+#  define update_Q_workspace_SHsprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RHsprimme)
+#  define update_Q_workspace_RHsprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SHdprimme)
+#  define update_Q_workspace_SHdprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RHdprimme)
+#  define update_Q_workspace_RHdprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_SHqprimme)
+#  define update_Q_workspace_SHqprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),KIND_C))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_Q_workspace_RHqprimme)
+#  define update_Q_workspace_RHqprimme CONCAT(update_Q_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),KIND_C))
+#endif
+int update_Q_workspace_dprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_hprimme(dummy_type_hprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_hprimme *W,
       PRIMME_INT ldW, dummy_type_hprimme *Q, PRIMME_INT ldQ, dummy_type_sprimme *R, int ldR,
       dummy_type_sprimme *QtQ, int ldQtQ, dummy_type_sprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_hprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_kprimme_normal(dummy_type_kprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *Q, PRIMME_INT ldQ, dummy_type_cprimme *R, int ldR,
       dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_kprimme_normal(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_kprimme(dummy_type_kprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_kprimme *W,
       PRIMME_INT ldW, dummy_type_kprimme *Q, PRIMME_INT ldQ, dummy_type_cprimme *R, int ldR,
       dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_kprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_sprimme(dummy_type_sprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_sprimme *W,
       PRIMME_INT ldW, dummy_type_sprimme *Q, PRIMME_INT ldQ, dummy_type_sprimme *R, int ldR,
       dummy_type_sprimme *QtQ, int ldQtQ, dummy_type_sprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_sprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_cprimme_normal(dummy_type_cprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *Q, PRIMME_INT ldQ, dummy_type_cprimme *R, int ldR,
       dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_cprimme_normal(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_cprimme(dummy_type_cprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_cprimme *W,
       PRIMME_INT ldW, dummy_type_cprimme *Q, PRIMME_INT ldQ, dummy_type_cprimme *R, int ldR,
       dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_cprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_zprimme_normal(dummy_type_zprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *Q, PRIMME_INT ldQ, dummy_type_zprimme *R, int ldR,
       dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_zprimme_normal(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_zprimme(dummy_type_zprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_zprimme *W,
       PRIMME_INT ldW, dummy_type_zprimme *Q, PRIMME_INT ldQ, dummy_type_zprimme *R, int ldR,
       dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_zprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_magma_hprimme(dummy_type_magma_hprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_hprimme *W,
       PRIMME_INT ldW, dummy_type_magma_hprimme *Q, PRIMME_INT ldQ, dummy_type_sprimme *R, int ldR,
       dummy_type_sprimme *QtQ, int ldQtQ, dummy_type_sprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_magma_hprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_magma_kprimme_normal(dummy_type_magma_kprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *Q, PRIMME_INT ldQ, dummy_type_cprimme *R, int ldR,
       dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_magma_kprimme_normal(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_magma_kprimme(dummy_type_magma_kprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_kprimme *W,
       PRIMME_INT ldW, dummy_type_magma_kprimme *Q, PRIMME_INT ldQ, dummy_type_cprimme *R, int ldR,
       dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_magma_kprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_magma_sprimme(dummy_type_magma_sprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_sprimme *W,
       PRIMME_INT ldW, dummy_type_magma_sprimme *Q, PRIMME_INT ldQ, dummy_type_sprimme *R, int ldR,
       dummy_type_sprimme *QtQ, int ldQtQ, dummy_type_sprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_magma_sprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_magma_cprimme_normal(dummy_type_magma_cprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *Q, PRIMME_INT ldQ, dummy_type_cprimme *R, int ldR,
       dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_magma_cprimme_normal(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_magma_cprimme(dummy_type_magma_cprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_cprimme *W,
       PRIMME_INT ldW, dummy_type_magma_cprimme *Q, PRIMME_INT ldQ, dummy_type_cprimme *R, int ldR,
       dummy_type_cprimme *QtQ, int ldQtQ, dummy_type_cprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_magma_cprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_magma_dprimme(dummy_type_magma_dprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_dprimme *W,
       PRIMME_INT ldW, dummy_type_magma_dprimme *Q, PRIMME_INT ldQ, dummy_type_dprimme *R, int ldR,
       dummy_type_dprimme *QtQ, int ldQtQ, dummy_type_dprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_magma_dprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_magma_zprimme_normal(dummy_type_magma_zprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *Q, PRIMME_INT ldQ, dummy_type_zprimme *R, int ldR,
       dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_magma_zprimme_normal(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 int update_Q_magma_zprimme(dummy_type_magma_zprimme *BV, PRIMME_INT nLocal, PRIMME_INT ldBV, dummy_type_magma_zprimme *W,
       PRIMME_INT ldW, dummy_type_magma_zprimme *Q, PRIMME_INT ldQ, dummy_type_zprimme *R, int ldR,
       dummy_type_zprimme *QtQ, int ldQtQ, dummy_type_zprimme *fQtQ, int ldfQtQ, double targetShift,
       int basisSize, int blockSize, int *nQ, primme_context ctx);
+int update_Q_workspace_magma_zprimme(int withR, int withQtQ, int blockSize, int nQ,
+      primme_context ctx);
 #endif
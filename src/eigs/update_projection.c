@@ -164,4 +164,276 @@ int update_projection_Sprimme(SCALAR *X, PRIMME_INT ldX, SCALAR *Y,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine update_projection_WtW - H = V'*W and WtW = W'*W, where H and WtW
+ *    are Hermitian. Update H with blockSize columns and WtW with the columns
+ *    from nWtW up to numCols+blockSize-1, and reduce both updates in a single
+ *    global sum. Only the upper triangular portions are stored.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * V           Matrix with size nLocal x numCols+blockSize
+ * ldV         The leading dimension of V
+ * W           Matrix with size nLocal x numCols+blockSize
+ * ldW         The leading dimension of W
+ * numCols     The number of columns in H that haven't changed
+ * blockSize   The number of columns in H that have changed
+ * nWtW        The number of columns in WtW that haven't changed
+ * 
+ * INPUT/OUTPUT ARRAYS
+ * -------------------
+ * H           Matrix with size numCols+blockSize with value V'*W
+ * ldH         The leading dimension of H
+ * WtW         Matrix with size numCols+blockSize with value W'*W
+ * ldWtW       The leading dimension of WtW
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int update_projection_WtW_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
+      PRIMME_INT ldW, HSCALAR *H, PRIMME_INT ldH, HSCALAR *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int m = numCols+blockSize;
+
+   assert(ldV >= nLocal && ldW >= nLocal && ldH >= m && ldWtW >= m &&
+          nWtW <= m);
+
+   /* ------------ */
+   /* Quick return */
+   /* ------------ */
+
+   if (blockSize <= 0 && nWtW >= m) return 0;
+
+   /* ------------------------------------------------------------ */
+   /* H(:,numCols:m-1) = V'*W(:,numCols:m-1) and                   */
+   /* WtW(:,nWtW:m-1) = W'*W(:,nWtW:m-1)                           */
+   /* ------------------------------------------------------------ */
+
+   Num_zero_matrix_SHprimme(&H[ldH * numCols], m, blockSize, ldH, ctx);
+   CHKERR(Num_gemm_ddh_Sprimme("C", "N", m, blockSize, nLocal, 1.0, V, ldV,
+         &W[ldW * numCols], ldW, 0.0, &H[ldH * numCols], ldH, ctx));
+   Num_zero_matrix_SHprimme(&WtW[ldWtW * nWtW], m, m - nWtW, ldWtW, ctx);
+   CHKERR(Num_gemm_ddh_Sprimme("C", "N", m, m - nWtW, nLocal, 1.0, W, ldW,
+         &W[ldW * nWtW], ldW, 0.0, &WtW[ldWtW * nWtW], ldWtW, ctx));
+
+   if (primme->numProcs > 1) {
+      /* --------------------------------------------------------------------- */
+      /* Reduce the upper triangular part of the new columns in H and WtW.     */
+      /* --------------------------------------------------------------------- */
+
+      HSCALAR *rwork;
+      CHKERR(Num_malloc_SHprimme(m * (blockSize + m - nWtW), &rwork, ctx));
+      int countH, countWtW;
+      Num_copy_trimatrix_compact_SHprimme(&H[ldH*numCols], m, blockSize, ldH,
+            numCols, rwork, &countH);
+      Num_copy_trimatrix_compact_SHprimme(&WtW[ldWtW * nWtW], m, m - nWtW,
+            ldWtW, nWtW, &rwork[countH], &countWtW);
+
+      CHKERR(globalSum_SHprimme(rwork, countH + countWtW, ctx));
+
+      Num_copy_compact_trimatrix_SHprimme(rwork, m, blockSize, numCols,
+            &H[ldH*numCols], ldH);
+      Num_copy_compact_trimatrix_SHprimme(&rwork[countH], m, m - nWtW, nWtW,
+            &WtW[ldWtW * nWtW], ldWtW);
+      CHKERR(Num_free_SHprimme(rwork, ctx));
+   }
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine update_projection_dcgs2 - Finish the orthonormalization of the
+ *    vector V(:,numCols) started by ortho_dcgs2, and extend H = V'*W and, if
+ *    given, WtW = W'*W with it. Everything takes a single global sum. Only for
+ *    Hermitian problems with W = A*V.
+ *
+ *    With v = V(:,numCols) after the first pass and w = W(:,numCols) = A*v,
+ *    the reduction computes V'*v, V'*w and W'*w. Then the second pass of
+ *    Gram-Schmidt, v = (v - V*a)/rho with a = V(:,0:numCols-1)'*v, is also
+ *    applied to w, H and WtW without more reductions:
+ *
+ *       w = (w - W*a)/rho,
+ *       H(0:numCols-1,numCols) = (V'*w - H*a)/rho,
+ *       H(numCols,numCols) = (v'*w - 2*Re(a'*V'*w) + a'*H*a)/rho^2,
+ *
+ *    and likewise for WtW. The products W'*v are replaced by V'*w, because
+ *    A is Hermitian.
+ *
+ *    If the second pass reduces the norm of v by more than Daniel's test
+ *    allows, v needs another pass. Then V and W are left unchanged, H and the
+ *    column numCols of WtW are not updated, and done is set to 0.
+ *
+ * INPUT ARRAYS AND PARAMETERS
+ * ---------------------------
+ * ldV         The leading dimension of V
+ * ldW         The leading dimension of W
+ * numCols     The number of columns in H that haven't changed
+ * nWtW        The number of columns in WtW that haven't changed
+ *
+ * INPUT/OUTPUT ARRAYS
+ * -------------------
+ * V           Matrix with size nLocal x numCols+1
+ * W           Matrix with size nLocal x numCols+1, W = A*V
+ * H           Matrix with size numCols+1 with value V'*W
+ * ldH         The leading dimension of H
+ * WtW         Matrix with size numCols+1 with value W'*W, or NULL
+ * ldWtW       The leading dimension of WtW
+ * done        1 if V(:,numCols) has been orthonormalized and H and WtW updated
+ *
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int update_projection_dcgs2_Sprimme(SCALAR *V, PRIMME_INT ldV, SCALAR *W,
+      PRIMME_INT ldW, HSCALAR *H, PRIMME_INT ldH, HSCALAR *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx) {
+
+   primme_params *primme = ctx.primme;
+   int k = numCols, m = numCols + 1;
+   int i, j;
+   double tol = sqrt(2.0L)/2.0L; /* Daniel et al. test, as in Bortho_gen */
+
+   assert(ldV >= nLocal && ldW >= nLocal && ldH >= m &&
+          (!WtW || (ldWtW >= m && nWtW <= k)));
+
+   /* -------------------------------------------------------------- */
+   /* rwork = [V'*v V'*w W'*w], and the columns of WtW from nWtW up  */
+   /* to numCols-1 in compact form                                    */
+   /* -------------------------------------------------------------- */
+
+   int nprods = WtW ? 3 : 2;
+   int nw = WtW ? k - nWtW : 0;
+   HSCALAR *rwork;
+   CHKERR(Num_malloc_SHprimme(m * nprods + m * nw + k, &rwork, ctx));
+   HSCALAR *a = rwork, *b = &rwork[m], *g = &rwork[m * 2];
+   Num_zero_matrix_SHprimme(rwork, m, nprods, m, ctx);
+   CHKERR(Num_gemv_ddh_Sprimme("C", nLocal, m, 1.0, V, ldV, &V[ldV * k], 1,
+         0.0, a, 1, ctx));
+   CHKERR(Num_gemv_ddh_Sprimme("C", nLocal, m, 1.0, V, ldV, &W[ldW * k], 1,
+         0.0, b, 1, ctx));
+   if (WtW) {
+      CHKERR(Num_gemv_ddh_Sprimme("C", nLocal, m, 1.0, W, ldW, &W[ldW * k],
+            1, 0.0, g, 1, ctx));
+   }
+   int count = m * nprods, countWtW = 0;
+   if (nw > 0) {
+      Num_zero_matrix_SHprimme(&WtW[ldWtW * nWtW], k, nw, ldWtW, ctx);
+      CHKERR(Num_gemm_ddh_Sprimme("C", "N", k, nw, nLocal, 1.0, W, ldW,
+            &W[ldW * nWtW], ldW, 0.0, &WtW[ldWtW * nWtW], ldWtW, ctx));
+      Num_copy_trimatrix_compact_SHprimme(&WtW[ldWtW * nWtW], k, nw, ldWtW,
+            nWtW, &rwork[count], &countWtW);
+   }
+
+   CHKERR(globalSum_SHprimme(rwork, count + countWtW, ctx));
+
+   if (nw > 0) {
+      Num_copy_compact_trimatrix_SHprimme(&rwork[count], k, nw, nWtW,
+            &WtW[ldWtW * nWtW], ldWtW);
+   }
+   if (primme) primme->stats.numOrthoInnerProds += m;
+
+   /* Check the second pass: rho^2 = v'*v - |a|^2 */
+
+   HREAL alpha = REAL_PART(a[k]);
+   HREAL rho2 = alpha - REAL_PART(Num_dot_SHprimme(k, a, 1, a, 1, ctx));
+   if (!ISFINITE(rho2) || rho2 <= tol * tol * alpha) {
+      PRINTF(5, "The delayed reorthogonalization is not enough");
+      *done = 0;
+      CHKERR(Num_free_SHprimme(rwork, ctx));
+      return 0;
+   }
+   HREAL rho = sqrt(rho2);
+
+   /* v = (v - V*a)/rho and w = (w - W*a)/rho */
+
+   if (k > 0) {
+      CHKERR(Num_gemv_dhd_Sprimme("N", nLocal, k, -1.0, V, ldV, a, 1, 1.0,
+            &V[ldV * k], 1, ctx));
+      CHKERR(Num_gemv_dhd_Sprimme("N", nLocal, k, -1.0, W, ldW, a, 1, 1.0,
+            &W[ldW * k], 1, ctx));
+      if (primme) primme->stats.numOrthoInnerProds += k;
+   }
+   CHKERR(Num_scal_Sprimme(nLocal, 1.0 / rho, &V[ldV * k], 1, ctx));
+   CHKERR(Num_scal_Sprimme(nLocal, 1.0 / rho, &W[ldW * k], 1, ctx));
+
+   /* Update H and WtW as described above; Za is Z*a for Z being H and WtW */
+
+   HSCALAR *Za = &rwork[count + countWtW];
+   for (i = 0; i < nprods - 1; i++) {
+      HSCALAR *Z = i == 0 ? H : WtW, *z = i == 0 ? b : g;
+      PRIMME_INT ldZ = i == 0 ? ldH : ldWtW;
+      if (k > 0) {
+         CHKERR(Num_hemm_SHprimme(
+               "L", "U", k, 1, 1.0, Z, ldZ, a, k, 0.0, Za, k, ctx));
+      }
+      HREAL zkk = (REAL_PART(z[k]) -
+                         2.0 * REAL_PART(Num_dot_SHprimme(k, a, 1, z, 1, ctx)) +
+                         REAL_PART(Num_dot_SHprimme(k, a, 1, Za, 1, ctx))) /
+                  rho2;
+      for (j = 0; j < k; j++) Z[ldZ * k + j] = (z[j] - Za[j]) / rho;
+      Z[ldZ * k + k] = zkk;
+   }
+
+   *done = 1;
+   CHKERR(Num_free_SHprimme(rwork, ctx));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutines *_workspace - Take from the dry arena of the context the same
+ *    blocks that the function without the suffix takes with the given sizes.
+ *    See main_iter_workspace.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int update_projection_workspace_Sprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx) {
+
+   if (blockSize <= 0 || ctx.primme->numProcs <= 1) return 0;
+
+   int m = numCols + blockSize;
+   int count = isSymmetric ? m * blockSize : m * blockSize + blockSize * numCols;
+   HSCALAR *rwork;
+   CHKERR(Num_malloc_SHprimme(count, &rwork, ctx));
+   CHKERR(globalSum_workspace_SHprimme(count, ctx));
+   CHKERR(Num_free_SHprimme(rwork, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int update_projection_WtW_workspace_Sprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx) {
+
+   int m = numCols + blockSize;
+
+   if ((blockSize <= 0 && nWtW >= m) || ctx.primme->numProcs <= 1) return 0;
+
+   HSCALAR *rwork;
+   CHKERR(Num_malloc_SHprimme(m * (blockSize + m - nWtW), &rwork, ctx));
+   CHKERR(globalSum_workspace_SHprimme(m * (blockSize + m - nWtW), ctx));
+   CHKERR(Num_free_SHprimme(rwork, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int update_projection_dcgs2_workspace_Sprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx) {
+
+   int k = numCols, m = numCols + 1;
+   int nprods = withWtW ? 3 : 2;
+   int nw = withWtW ? k - nWtW : 0;
+   HSCALAR *rwork;
+   CHKERR(Num_malloc_SHprimme(m * nprods + m * nw + k, &rwork, ctx));
+   CHKERR(globalSum_workspace_SHprimme(m * nprods + m * nw, ctx));
+   CHKERR(Num_free_SHprimme(rwork, ctx));
+
+   return 0;
+}
+
 #endif /* SUPPORTED_TYPE */
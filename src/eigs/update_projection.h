@@ -126,37 +126,655 @@
 int update_projection_dprimme(dummy_type_dprimme *X, PRIMME_INT ldX, dummy_type_dprimme *Y,
       PRIMME_INT ldY, dummy_type_dprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Sprimme)
+#  define update_projection_WtW_Sprimme CONCAT(update_projection_WtW_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Rprimme)
+#  define update_projection_WtW_Rprimme CONCAT(update_projection_WtW_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SHprimme)
+#  define update_projection_WtW_SHprimme CONCAT(update_projection_WtW_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RHprimme)
+#  define update_projection_WtW_RHprimme CONCAT(update_projection_WtW_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SXprimme)
+#  define update_projection_WtW_SXprimme CONCAT(update_projection_WtW_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RXprimme)
+#  define update_projection_WtW_RXprimme CONCAT(update_projection_WtW_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Shprimme)
+#  define update_projection_WtW_Shprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Rhprimme)
+#  define update_projection_WtW_Rhprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Ssprimme)
+#  define update_projection_WtW_Ssprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Rsprimme)
+#  define update_projection_WtW_Rsprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Sdprimme)
+#  define update_projection_WtW_Sdprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Rdprimme)
+#  define update_projection_WtW_Rdprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Sqprimme)
+#  define update_projection_WtW_Sqprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_Rqprimme)
+#  define update_projection_WtW_Rqprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SXhprimme)
+#  define update_projection_WtW_SXhprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RXhprimme)
+#  define update_projection_WtW_RXhprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SXsprimme)
+#  define update_projection_WtW_SXsprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RXsprimme)
+#  define update_projection_WtW_RXsprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SXdprimme)
+#  define update_projection_WtW_SXdprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RXdprimme)
+#  define update_projection_WtW_RXdprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SXqprimme)
+#  define update_projection_WtW_SXqprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RXqprimme)
+#  define update_projection_WtW_RXqprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SHhprimme)
+#  define update_projection_WtW_SHhprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RHhprimme)
+#  define update_projection_WtW_RHhprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SHsprimme)
+#  define update_projection_WtW_SHsprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RHsprimme)
+#  define update_projection_WtW_RHsprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SHdprimme)
+#  define update_projection_WtW_SHdprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RHdprimme)
+#  define update_projection_WtW_RHdprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_SHqprimme)
+#  define update_projection_WtW_SHqprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_RHqprimme)
+#  define update_projection_WtW_RHqprimme CONCAT(update_projection_WtW_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int update_projection_WtW_dprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *W,
+      PRIMME_INT ldW, dummy_type_dprimme *H, PRIMME_INT ldH, dummy_type_dprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Sprimme)
+#  define update_projection_dcgs2_Sprimme CONCAT(update_projection_dcgs2_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Rprimme)
+#  define update_projection_dcgs2_Rprimme CONCAT(update_projection_dcgs2_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SHprimme)
+#  define update_projection_dcgs2_SHprimme CONCAT(update_projection_dcgs2_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RHprimme)
+#  define update_projection_dcgs2_RHprimme CONCAT(update_projection_dcgs2_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SXprimme)
+#  define update_projection_dcgs2_SXprimme CONCAT(update_projection_dcgs2_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RXprimme)
+#  define update_projection_dcgs2_RXprimme CONCAT(update_projection_dcgs2_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Shprimme)
+#  define update_projection_dcgs2_Shprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Rhprimme)
+#  define update_projection_dcgs2_Rhprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Ssprimme)
+#  define update_projection_dcgs2_Ssprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Rsprimme)
+#  define update_projection_dcgs2_Rsprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Sdprimme)
+#  define update_projection_dcgs2_Sdprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Rdprimme)
+#  define update_projection_dcgs2_Rdprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Sqprimme)
+#  define update_projection_dcgs2_Sqprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_Rqprimme)
+#  define update_projection_dcgs2_Rqprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SXhprimme)
+#  define update_projection_dcgs2_SXhprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RXhprimme)
+#  define update_projection_dcgs2_RXhprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SXsprimme)
+#  define update_projection_dcgs2_SXsprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RXsprimme)
+#  define update_projection_dcgs2_RXsprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SXdprimme)
+#  define update_projection_dcgs2_SXdprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RXdprimme)
+#  define update_projection_dcgs2_RXdprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SXqprimme)
+#  define update_projection_dcgs2_SXqprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RXqprimme)
+#  define update_projection_dcgs2_RXqprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SHhprimme)
+#  define update_projection_dcgs2_SHhprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RHhprimme)
+#  define update_projection_dcgs2_RHhprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SHsprimme)
+#  define update_projection_dcgs2_SHsprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RHsprimme)
+#  define update_projection_dcgs2_RHsprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SHdprimme)
+#  define update_projection_dcgs2_SHdprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RHdprimme)
+#  define update_projection_dcgs2_RHdprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_SHqprimme)
+#  define update_projection_dcgs2_SHqprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_RHqprimme)
+#  define update_projection_dcgs2_RHqprimme CONCAT(update_projection_dcgs2_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int update_projection_dcgs2_dprimme(dummy_type_dprimme *V, PRIMME_INT ldV, dummy_type_dprimme *W,
+      PRIMME_INT ldW, dummy_type_dprimme *H, PRIMME_INT ldH, dummy_type_dprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Sprimme)
+#  define update_projection_workspace_Sprimme CONCAT(update_projection_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Rprimme)
+#  define update_projection_workspace_Rprimme CONCAT(update_projection_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SHprimme)
+#  define update_projection_workspace_SHprimme CONCAT(update_projection_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RHprimme)
+#  define update_projection_workspace_RHprimme CONCAT(update_projection_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SXprimme)
+#  define update_projection_workspace_SXprimme CONCAT(update_projection_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RXprimme)
+#  define update_projection_workspace_RXprimme CONCAT(update_projection_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Shprimme)
+#  define update_projection_workspace_Shprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Rhprimme)
+#  define update_projection_workspace_Rhprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Ssprimme)
+#  define update_projection_workspace_Ssprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Rsprimme)
+#  define update_projection_workspace_Rsprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Sdprimme)
+#  define update_projection_workspace_Sdprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Rdprimme)
+#  define update_projection_workspace_Rdprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Sqprimme)
+#  define update_projection_workspace_Sqprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_Rqprimme)
+#  define update_projection_workspace_Rqprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SXhprimme)
+#  define update_projection_workspace_SXhprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RXhprimme)
+#  define update_projection_workspace_RXhprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SXsprimme)
+#  define update_projection_workspace_SXsprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RXsprimme)
+#  define update_projection_workspace_RXsprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SXdprimme)
+#  define update_projection_workspace_SXdprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RXdprimme)
+#  define update_projection_workspace_RXdprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SXqprimme)
+#  define update_projection_workspace_SXqprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RXqprimme)
+#  define update_projection_workspace_RXqprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SHhprimme)
+#  define update_projection_workspace_SHhprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RHhprimme)
+#  define update_projection_workspace_RHhprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SHsprimme)
+#  define update_projection_workspace_SHsprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RHsprimme)
+#  define update_projection_workspace_RHsprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SHdprimme)
+#  define update_projection_workspace_SHdprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RHdprimme)
+#  define update_projection_workspace_RHdprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_SHqprimme)
+#  define update_projection_workspace_SHqprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_workspace_RHqprimme)
+#  define update_projection_workspace_RHqprimme CONCAT(update_projection_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int update_projection_workspace_dprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Sprimme)
+#  define update_projection_WtW_workspace_Sprimme CONCAT(update_projection_WtW_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Rprimme)
+#  define update_projection_WtW_workspace_Rprimme CONCAT(update_projection_WtW_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SHprimme)
+#  define update_projection_WtW_workspace_SHprimme CONCAT(update_projection_WtW_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RHprimme)
+#  define update_projection_WtW_workspace_RHprimme CONCAT(update_projection_WtW_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SXprimme)
+#  define update_projection_WtW_workspace_SXprimme CONCAT(update_projection_WtW_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RXprimme)
+#  define update_projection_WtW_workspace_RXprimme CONCAT(update_projection_WtW_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Shprimme)
+#  define update_projection_WtW_workspace_Shprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Rhprimme)
+#  define update_projection_WtW_workspace_Rhprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Ssprimme)
+#  define update_projection_WtW_workspace_Ssprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Rsprimme)
+#  define update_projection_WtW_workspace_Rsprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Sdprimme)
+#  define update_projection_WtW_workspace_Sdprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Rdprimme)
+#  define update_projection_WtW_workspace_Rdprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Sqprimme)
+#  define update_projection_WtW_workspace_Sqprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_Rqprimme)
+#  define update_projection_WtW_workspace_Rqprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SXhprimme)
+#  define update_projection_WtW_workspace_SXhprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RXhprimme)
+#  define update_projection_WtW_workspace_RXhprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SXsprimme)
+#  define update_projection_WtW_workspace_SXsprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RXsprimme)
+#  define update_projection_WtW_workspace_RXsprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SXdprimme)
+#  define update_projection_WtW_workspace_SXdprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RXdprimme)
+#  define update_projection_WtW_workspace_RXdprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SXqprimme)
+#  define update_projection_WtW_workspace_SXqprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RXqprimme)
+#  define update_projection_WtW_workspace_RXqprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SHhprimme)
+#  define update_projection_WtW_workspace_SHhprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RHhprimme)
+#  define update_projection_WtW_workspace_RHhprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SHsprimme)
+#  define update_projection_WtW_workspace_SHsprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RHsprimme)
+#  define update_projection_WtW_workspace_RHsprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SHdprimme)
+#  define update_projection_WtW_workspace_SHdprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RHdprimme)
+#  define update_projection_WtW_workspace_RHdprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_SHqprimme)
+#  define update_projection_WtW_workspace_SHqprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_WtW_workspace_RHqprimme)
+#  define update_projection_WtW_workspace_RHqprimme CONCAT(update_projection_WtW_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int update_projection_WtW_workspace_dprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Sprimme)
+#  define update_projection_dcgs2_workspace_Sprimme CONCAT(update_projection_dcgs2_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Rprimme)
+#  define update_projection_dcgs2_workspace_Rprimme CONCAT(update_projection_dcgs2_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SHprimme)
+#  define update_projection_dcgs2_workspace_SHprimme CONCAT(update_projection_dcgs2_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RHprimme)
+#  define update_projection_dcgs2_workspace_RHprimme CONCAT(update_projection_dcgs2_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SXprimme)
+#  define update_projection_dcgs2_workspace_SXprimme CONCAT(update_projection_dcgs2_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RXprimme)
+#  define update_projection_dcgs2_workspace_RXprimme CONCAT(update_projection_dcgs2_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Shprimme)
+#  define update_projection_dcgs2_workspace_Shprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Rhprimme)
+#  define update_projection_dcgs2_workspace_Rhprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Ssprimme)
+#  define update_projection_dcgs2_workspace_Ssprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Rsprimme)
+#  define update_projection_dcgs2_workspace_Rsprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Sdprimme)
+#  define update_projection_dcgs2_workspace_Sdprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Rdprimme)
+#  define update_projection_dcgs2_workspace_Rdprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Sqprimme)
+#  define update_projection_dcgs2_workspace_Sqprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_Rqprimme)
+#  define update_projection_dcgs2_workspace_Rqprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SXhprimme)
+#  define update_projection_dcgs2_workspace_SXhprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RXhprimme)
+#  define update_projection_dcgs2_workspace_RXhprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SXsprimme)
+#  define update_projection_dcgs2_workspace_SXsprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RXsprimme)
+#  define update_projection_dcgs2_workspace_RXsprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SXdprimme)
+#  define update_projection_dcgs2_workspace_SXdprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RXdprimme)
+#  define update_projection_dcgs2_workspace_RXdprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SXqprimme)
+#  define update_projection_dcgs2_workspace_SXqprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RXqprimme)
+#  define update_projection_dcgs2_workspace_RXqprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SHhprimme)
+#  define update_projection_dcgs2_workspace_SHhprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RHhprimme)
+#  define update_projection_dcgs2_workspace_RHhprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SHsprimme)
+#  define update_projection_dcgs2_workspace_SHsprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RHsprimme)
+#  define update_projection_dcgs2_workspace_RHsprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SHdprimme)
+#  define update_projection_dcgs2_workspace_SHdprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RHdprimme)
+#  define update_projection_dcgs2_workspace_RHdprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_SHqprimme)
+#  define update_projection_dcgs2_workspace_SHqprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(update_projection_dcgs2_workspace_RHqprimme)
+#  define update_projection_dcgs2_workspace_RHqprimme CONCAT(update_projection_dcgs2_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int update_projection_dcgs2_workspace_dprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_hprimme(dummy_type_hprimme *X, PRIMME_INT ldX, dummy_type_hprimme *Y,
       PRIMME_INT ldY, dummy_type_sprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *H, PRIMME_INT ldH, dummy_type_sprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_hprimme(dummy_type_hprimme *V, PRIMME_INT ldV, dummy_type_hprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *H, PRIMME_INT ldH, dummy_type_sprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_hprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_hprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_hprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_kprimme(dummy_type_kprimme *X, PRIMME_INT ldX, dummy_type_kprimme *Y,
       PRIMME_INT ldY, dummy_type_cprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *H, PRIMME_INT ldH, dummy_type_cprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_kprimme(dummy_type_kprimme *V, PRIMME_INT ldV, dummy_type_kprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *H, PRIMME_INT ldH, dummy_type_cprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_kprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_kprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_kprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_sprimme(dummy_type_sprimme *X, PRIMME_INT ldX, dummy_type_sprimme *Y,
       PRIMME_INT ldY, dummy_type_sprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *H, PRIMME_INT ldH, dummy_type_sprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_sprimme(dummy_type_sprimme *V, PRIMME_INT ldV, dummy_type_sprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *H, PRIMME_INT ldH, dummy_type_sprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_sprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_sprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_sprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_cprimme(dummy_type_cprimme *X, PRIMME_INT ldX, dummy_type_cprimme *Y,
       PRIMME_INT ldY, dummy_type_cprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *H, PRIMME_INT ldH, dummy_type_cprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_cprimme(dummy_type_cprimme *V, PRIMME_INT ldV, dummy_type_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *H, PRIMME_INT ldH, dummy_type_cprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_cprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_cprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_cprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_zprimme(dummy_type_zprimme *X, PRIMME_INT ldX, dummy_type_zprimme *Y,
       PRIMME_INT ldY, dummy_type_zprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *H, PRIMME_INT ldH, dummy_type_zprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_zprimme(dummy_type_zprimme *V, PRIMME_INT ldV, dummy_type_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *H, PRIMME_INT ldH, dummy_type_zprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_zprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_zprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_zprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_magma_hprimme(dummy_type_magma_hprimme *X, PRIMME_INT ldX, dummy_type_magma_hprimme *Y,
       PRIMME_INT ldY, dummy_type_sprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *H, PRIMME_INT ldH, dummy_type_sprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_magma_hprimme(dummy_type_magma_hprimme *V, PRIMME_INT ldV, dummy_type_magma_hprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *H, PRIMME_INT ldH, dummy_type_sprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_magma_hprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_magma_hprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_magma_hprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_magma_kprimme(dummy_type_magma_kprimme *X, PRIMME_INT ldX, dummy_type_magma_kprimme *Y,
       PRIMME_INT ldY, dummy_type_cprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *H, PRIMME_INT ldH, dummy_type_cprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_magma_kprimme(dummy_type_magma_kprimme *V, PRIMME_INT ldV, dummy_type_magma_kprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *H, PRIMME_INT ldH, dummy_type_cprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_magma_kprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_magma_kprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_magma_kprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_magma_sprimme(dummy_type_magma_sprimme *X, PRIMME_INT ldX, dummy_type_magma_sprimme *Y,
       PRIMME_INT ldY, dummy_type_sprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *H, PRIMME_INT ldH, dummy_type_sprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_magma_sprimme(dummy_type_magma_sprimme *V, PRIMME_INT ldV, dummy_type_magma_sprimme *W,
+      PRIMME_INT ldW, dummy_type_sprimme *H, PRIMME_INT ldH, dummy_type_sprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_magma_sprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_magma_sprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_magma_sprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_magma_cprimme(dummy_type_magma_cprimme *X, PRIMME_INT ldX, dummy_type_magma_cprimme *Y,
       PRIMME_INT ldY, dummy_type_cprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *H, PRIMME_INT ldH, dummy_type_cprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_magma_cprimme(dummy_type_magma_cprimme *V, PRIMME_INT ldV, dummy_type_magma_cprimme *W,
+      PRIMME_INT ldW, dummy_type_cprimme *H, PRIMME_INT ldH, dummy_type_cprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_magma_cprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_magma_cprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_magma_cprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_magma_dprimme(dummy_type_magma_dprimme *X, PRIMME_INT ldX, dummy_type_magma_dprimme *Y,
       PRIMME_INT ldY, dummy_type_dprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
+      PRIMME_INT ldW, dummy_type_dprimme *H, PRIMME_INT ldH, dummy_type_dprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_magma_dprimme(dummy_type_magma_dprimme *V, PRIMME_INT ldV, dummy_type_magma_dprimme *W,
+      PRIMME_INT ldW, dummy_type_dprimme *H, PRIMME_INT ldH, dummy_type_dprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_magma_dprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_magma_dprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_magma_dprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 int update_projection_magma_zprimme(dummy_type_magma_zprimme *X, PRIMME_INT ldX, dummy_type_magma_zprimme *Y,
       PRIMME_INT ldY, dummy_type_zprimme *Z, PRIMME_INT ldZ, PRIMME_INT nLocal,
       int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *H, PRIMME_INT ldH, dummy_type_zprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int blockSize,
+      int nWtW, primme_context ctx);
+int update_projection_dcgs2_magma_zprimme(dummy_type_magma_zprimme *V, PRIMME_INT ldV, dummy_type_magma_zprimme *W,
+      PRIMME_INT ldW, dummy_type_zprimme *H, PRIMME_INT ldH, dummy_type_zprimme *WtW,
+      PRIMME_INT ldWtW, PRIMME_INT nLocal, int numCols, int nWtW, int *done,
+      primme_context ctx);
+int update_projection_workspace_magma_zprimme(
+      int numCols, int blockSize, int isSymmetric, primme_context ctx);
+int update_projection_WtW_workspace_magma_zprimme(
+      int numCols, int blockSize, int nWtW, primme_context ctx);
+int update_projection_dcgs2_workspace_magma_zprimme(
+      int numCols, int withWtW, int nWtW, primme_context ctx);
 #endif
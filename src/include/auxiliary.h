@@ -1047,6 +1047,97 @@ int Num_copy_compact_trimatrix_dprimme(dummy_type_dprimme *x, PRIMME_INT m, int
 #endif
 int compute_submatrix_dprimme(dummy_type_dprimme *X, int nX, int ldX, dummy_type_dprimme *H, int nH,
       int ldH, int isherm, dummy_type_dprimme *R, int ldR, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Sprimme)
+#  define compute_submatrix_workspace_Sprimme CONCAT(compute_submatrix_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Rprimme)
+#  define compute_submatrix_workspace_Rprimme CONCAT(compute_submatrix_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SHprimme)
+#  define compute_submatrix_workspace_SHprimme CONCAT(compute_submatrix_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RHprimme)
+#  define compute_submatrix_workspace_RHprimme CONCAT(compute_submatrix_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SXprimme)
+#  define compute_submatrix_workspace_SXprimme CONCAT(compute_submatrix_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RXprimme)
+#  define compute_submatrix_workspace_RXprimme CONCAT(compute_submatrix_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Shprimme)
+#  define compute_submatrix_workspace_Shprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Rhprimme)
+#  define compute_submatrix_workspace_Rhprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Ssprimme)
+#  define compute_submatrix_workspace_Ssprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Rsprimme)
+#  define compute_submatrix_workspace_Rsprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Sdprimme)
+#  define compute_submatrix_workspace_Sdprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Rdprimme)
+#  define compute_submatrix_workspace_Rdprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Sqprimme)
+#  define compute_submatrix_workspace_Sqprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_Rqprimme)
+#  define compute_submatrix_workspace_Rqprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SXhprimme)
+#  define compute_submatrix_workspace_SXhprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RXhprimme)
+#  define compute_submatrix_workspace_RXhprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SXsprimme)
+#  define compute_submatrix_workspace_SXsprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RXsprimme)
+#  define compute_submatrix_workspace_RXsprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SXdprimme)
+#  define compute_submatrix_workspace_SXdprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RXdprimme)
+#  define compute_submatrix_workspace_RXdprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SXqprimme)
+#  define compute_submatrix_workspace_SXqprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RXqprimme)
+#  define compute_submatrix_workspace_RXqprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SHhprimme)
+#  define compute_submatrix_workspace_SHhprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RHhprimme)
+#  define compute_submatrix_workspace_RHhprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SHsprimme)
+#  define compute_submatrix_workspace_SHsprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RHsprimme)
+#  define compute_submatrix_workspace_RHsprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SHdprimme)
+#  define compute_submatrix_workspace_SHdprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RHdprimme)
+#  define compute_submatrix_workspace_RHdprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_SHqprimme)
+#  define compute_submatrix_workspace_SHqprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(compute_submatrix_workspace_RHqprimme)
+#  define compute_submatrix_workspace_RHqprimme CONCAT(compute_submatrix_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int compute_submatrix_workspace_dprimme(int nX, int nH, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(Num_copy_matrix_columns_Sprimme)
 #  define Num_copy_matrix_columns_Sprimme CONCAT(Num_copy_matrix_columns_,SCALAR_SUF)
 #endif
@@ -1325,6 +1416,97 @@ int Num_copy_matrix_rows_dprimme(dummy_type_dprimme *x, int *xim, int m, int n,
 #endif
 int permute_vecs_dprimme(dummy_type_dprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Sprimme)
+#  define permute_vecs_workspace_Sprimme CONCAT(permute_vecs_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Rprimme)
+#  define permute_vecs_workspace_Rprimme CONCAT(permute_vecs_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SHprimme)
+#  define permute_vecs_workspace_SHprimme CONCAT(permute_vecs_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RHprimme)
+#  define permute_vecs_workspace_RHprimme CONCAT(permute_vecs_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SXprimme)
+#  define permute_vecs_workspace_SXprimme CONCAT(permute_vecs_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RXprimme)
+#  define permute_vecs_workspace_RXprimme CONCAT(permute_vecs_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Shprimme)
+#  define permute_vecs_workspace_Shprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Rhprimme)
+#  define permute_vecs_workspace_Rhprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Ssprimme)
+#  define permute_vecs_workspace_Ssprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Rsprimme)
+#  define permute_vecs_workspace_Rsprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Sdprimme)
+#  define permute_vecs_workspace_Sdprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Rdprimme)
+#  define permute_vecs_workspace_Rdprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Sqprimme)
+#  define permute_vecs_workspace_Sqprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_Rqprimme)
+#  define permute_vecs_workspace_Rqprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SXhprimme)
+#  define permute_vecs_workspace_SXhprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RXhprimme)
+#  define permute_vecs_workspace_RXhprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SXsprimme)
+#  define permute_vecs_workspace_SXsprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RXsprimme)
+#  define permute_vecs_workspace_RXsprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SXdprimme)
+#  define permute_vecs_workspace_SXdprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RXdprimme)
+#  define permute_vecs_workspace_RXdprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SXqprimme)
+#  define permute_vecs_workspace_SXqprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RXqprimme)
+#  define permute_vecs_workspace_RXqprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SHhprimme)
+#  define permute_vecs_workspace_SHhprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RHhprimme)
+#  define permute_vecs_workspace_RHhprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SHsprimme)
+#  define permute_vecs_workspace_SHsprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RHsprimme)
+#  define permute_vecs_workspace_RHsprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SHdprimme)
+#  define permute_vecs_workspace_SHdprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RHdprimme)
+#  define permute_vecs_workspace_RHdprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_SHqprimme)
+#  define permute_vecs_workspace_SHqprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_RHqprimme)
+#  define permute_vecs_workspace_RHqprimme CONCAT(permute_vecs_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int permute_vecs_workspace_dprimme(PRIMME_INT m, int n, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_iprimmeSprimme)
 #  define permute_vecs_iprimmeSprimme CONCAT(permute_vecs_iprimme,SCALAR_SUF)
 #endif
@@ -1416,6 +1598,97 @@ int permute_vecs_dprimme(dummy_type_dprimme *vecs, PRIMME_INT m, int n, PRIMME_I
 #  define permute_vecs_iprimmeRHqprimme CONCAT(permute_vecs_iprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
 #endif
 int permute_vecs_iprimme(int *vecs, int n, int *perm_, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSprimme)
+#  define permute_vecs_workspace_iprimmeSprimme CONCAT(permute_vecs_workspace_iprimme,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRprimme)
+#  define permute_vecs_workspace_iprimmeRprimme CONCAT(permute_vecs_workspace_iprimme,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSHprimme)
+#  define permute_vecs_workspace_iprimmeSHprimme CONCAT(permute_vecs_workspace_iprimme,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRHprimme)
+#  define permute_vecs_workspace_iprimmeRHprimme CONCAT(permute_vecs_workspace_iprimme,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSXprimme)
+#  define permute_vecs_workspace_iprimmeSXprimme CONCAT(permute_vecs_workspace_iprimme,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRXprimme)
+#  define permute_vecs_workspace_iprimmeRXprimme CONCAT(permute_vecs_workspace_iprimme,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeShprimme)
+#  define permute_vecs_workspace_iprimmeShprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRhprimme)
+#  define permute_vecs_workspace_iprimmeRhprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSsprimme)
+#  define permute_vecs_workspace_iprimmeSsprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRsprimme)
+#  define permute_vecs_workspace_iprimmeRsprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSdprimme)
+#  define permute_vecs_workspace_iprimmeSdprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRdprimme)
+#  define permute_vecs_workspace_iprimmeRdprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSqprimme)
+#  define permute_vecs_workspace_iprimmeSqprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRqprimme)
+#  define permute_vecs_workspace_iprimmeRqprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSXhprimme)
+#  define permute_vecs_workspace_iprimmeSXhprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRXhprimme)
+#  define permute_vecs_workspace_iprimmeRXhprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSXsprimme)
+#  define permute_vecs_workspace_iprimmeSXsprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRXsprimme)
+#  define permute_vecs_workspace_iprimmeRXsprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSXdprimme)
+#  define permute_vecs_workspace_iprimmeSXdprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRXdprimme)
+#  define permute_vecs_workspace_iprimmeRXdprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSXqprimme)
+#  define permute_vecs_workspace_iprimmeSXqprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRXqprimme)
+#  define permute_vecs_workspace_iprimmeRXqprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSHhprimme)
+#  define permute_vecs_workspace_iprimmeSHhprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRHhprimme)
+#  define permute_vecs_workspace_iprimmeRHhprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSHsprimme)
+#  define permute_vecs_workspace_iprimmeSHsprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRHsprimme)
+#  define permute_vecs_workspace_iprimmeRHsprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSHdprimme)
+#  define permute_vecs_workspace_iprimmeSHdprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRHdprimme)
+#  define permute_vecs_workspace_iprimmeRHdprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeSHqprimme)
+#  define permute_vecs_workspace_iprimmeSHqprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(permute_vecs_workspace_iprimmeRHqprimme)
+#  define permute_vecs_workspace_iprimmeRHqprimme CONCAT(permute_vecs_workspace_iprimme,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int permute_vecs_workspace_iprimme(int n, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(Num_compact_vecs_Sprimme)
 #  define Num_compact_vecs_Sprimme CONCAT(Num_compact_vecs_,SCALAR_SUF)
 #endif
@@ -1626,6 +1899,7 @@ int Num_copy_matrix_rows_hprimme(dummy_type_hprimme *x, int *xim, int m, int n,
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_hprimme(dummy_type_hprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_hprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_hprimme* Num_compact_vecs_hprimme(dummy_type_hprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_hprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1654,6 +1928,7 @@ int Num_copy_matrix_rows_kprimme(dummy_type_kprimme *x, int *xim, int m, int n,
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_kprimme(dummy_type_kprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_kprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_kprimme* Num_compact_vecs_kprimme(dummy_type_kprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_kprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1678,6 +1953,7 @@ int Num_copy_compact_trimatrix_sprimme(dummy_type_sprimme *x, PRIMME_INT m, int
       dummy_type_sprimme *y, int ldy);
 int compute_submatrix_sprimme(dummy_type_sprimme *X, int nX, int ldX, dummy_type_sprimme *H, int nH,
       int ldH, int isherm, dummy_type_sprimme *R, int ldR, primme_context ctx);
+int compute_submatrix_workspace_sprimme(int nX, int nH, primme_context ctx);
 int Num_copy_matrix_columns_sprimme(dummy_type_sprimme *x, PRIMME_INT m, int *xin, int n,
                                      PRIMME_INT ldx, dummy_type_sprimme *y, int *yin,
                                      PRIMME_INT ldy, primme_context ctx);
@@ -1686,6 +1962,7 @@ int Num_copy_matrix_rows_sprimme(dummy_type_sprimme *x, int *xim, int m, int n,
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_sprimme(dummy_type_sprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_sprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_sprimme* Num_compact_vecs_sprimme(dummy_type_sprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_sprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1710,6 +1987,7 @@ int Num_copy_compact_trimatrix_cprimme(dummy_type_cprimme *x, PRIMME_INT m, int
       dummy_type_cprimme *y, int ldy);
 int compute_submatrix_cprimme(dummy_type_cprimme *X, int nX, int ldX, dummy_type_cprimme *H, int nH,
       int ldH, int isherm, dummy_type_cprimme *R, int ldR, primme_context ctx);
+int compute_submatrix_workspace_cprimme(int nX, int nH, primme_context ctx);
 int Num_copy_matrix_columns_cprimme(dummy_type_cprimme *x, PRIMME_INT m, int *xin, int n,
                                      PRIMME_INT ldx, dummy_type_cprimme *y, int *yin,
                                      PRIMME_INT ldy, primme_context ctx);
@@ -1718,6 +1996,7 @@ int Num_copy_matrix_rows_cprimme(dummy_type_cprimme *x, int *xim, int m, int n,
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_cprimme(dummy_type_cprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_cprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_cprimme* Num_compact_vecs_cprimme(dummy_type_cprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_cprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1742,6 +2021,7 @@ int Num_copy_compact_trimatrix_zprimme(dummy_type_zprimme *x, PRIMME_INT m, int
       dummy_type_zprimme *y, int ldy);
 int compute_submatrix_zprimme(dummy_type_zprimme *X, int nX, int ldX, dummy_type_zprimme *H, int nH,
       int ldH, int isherm, dummy_type_zprimme *R, int ldR, primme_context ctx);
+int compute_submatrix_workspace_zprimme(int nX, int nH, primme_context ctx);
 int Num_copy_matrix_columns_zprimme(dummy_type_zprimme *x, PRIMME_INT m, int *xin, int n,
                                      PRIMME_INT ldx, dummy_type_zprimme *y, int *yin,
                                      PRIMME_INT ldy, primme_context ctx);
@@ -1750,6 +2030,7 @@ int Num_copy_matrix_rows_zprimme(dummy_type_zprimme *x, int *xim, int m, int n,
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_zprimme(dummy_type_zprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_zprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_zprimme* Num_compact_vecs_zprimme(dummy_type_zprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_zprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1772,6 +2053,7 @@ int Num_copy_matrix_rows_magma_hprimme(dummy_type_magma_hprimme *x, int *xim, in
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_magma_hprimme(dummy_type_magma_hprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_magma_hprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_magma_hprimme* Num_compact_vecs_magma_hprimme(dummy_type_magma_hprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_magma_hprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1794,6 +2076,7 @@ int Num_copy_matrix_rows_magma_kprimme(dummy_type_magma_kprimme *x, int *xim, in
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_magma_kprimme(dummy_type_magma_kprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_magma_kprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_magma_kprimme* Num_compact_vecs_magma_kprimme(dummy_type_magma_kprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_magma_kprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1816,6 +2099,7 @@ int Num_copy_matrix_rows_magma_sprimme(dummy_type_magma_sprimme *x, int *xim, in
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_magma_sprimme(dummy_type_magma_sprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_magma_sprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_magma_sprimme* Num_compact_vecs_magma_sprimme(dummy_type_magma_sprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_magma_sprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1838,6 +2122,7 @@ int Num_copy_matrix_rows_magma_cprimme(dummy_type_magma_cprimme *x, int *xim, in
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_magma_cprimme(dummy_type_magma_cprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_magma_cprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_magma_cprimme* Num_compact_vecs_magma_cprimme(dummy_type_magma_cprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_magma_cprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1860,6 +2145,7 @@ int Num_copy_matrix_rows_magma_dprimme(dummy_type_magma_dprimme *x, int *xim, in
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_magma_dprimme(dummy_type_magma_dprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_magma_dprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_magma_dprimme* Num_compact_vecs_magma_dprimme(dummy_type_magma_dprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_magma_dprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
@@ -1882,6 +2168,7 @@ int Num_copy_matrix_rows_magma_zprimme(dummy_type_magma_zprimme *x, int *xim, in
                                      PRIMME_INT ldy, primme_context ctx);
 int permute_vecs_magma_zprimme(dummy_type_magma_zprimme *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
                          int *perm_, primme_context ctx);
+int permute_vecs_workspace_magma_zprimme(PRIMME_INT m, int n, primme_context ctx);
 dummy_type_magma_zprimme* Num_compact_vecs_magma_zprimme(dummy_type_magma_zprimme *vecs, PRIMME_INT m, int n,
       PRIMME_INT ld, int *perm, dummy_type_magma_zprimme *work, PRIMME_INT ldwork,
       int avoidCopy, primme_context ctx);
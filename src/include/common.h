@@ -339,46 +339,33 @@ typedef struct { PRIMME_COMPLEX_QUAD a; }  dummy_type_magma_wprimme;
 /*****************************************************************************/
 
 #include "wtime.h"
+#include "profile.h"
 
-#ifdef PRIMME_PROFILE
-
-#include <regex.h>
-
-static inline const char *__compose_function_name(const char *path,
-      const char *call, const char *filename, const char *line) {
-
-   int len = strlen(path) + 1 + 45 + strlen(filename) + 1 + strlen(line) + 10;
-   char *s = (char*)malloc(len);
-   snprintf(s, len-1, "%s~%.40s@%s:%s", path, call, filename, line);
-   s[len-1] = 0;
-   return s;
-}
+/**********************************************************************
+ * Macros PROFILE_BEGIN and PROFILE_END - record the time of the code
+ *    between them in ctx.profiler, if it is set, as a call from the site
+ *    with the text CALL. The site is a static variable, so the cost
+ *    without profiler or if the site is throttled by the profiler is a
+ *    comparison. They are empty unless PRIMME_PROFILE is defined.
+ *
+ * INPUT PARAMETERS
+ * ----------------
+ * CALL    Text identifying the call
+ *
+ **********************************************************************/
 
+#ifdef PRIMME_PROFILE
 #define PROFILE_BEGIN(CALL) \
-   double ___t0 = 0; \
-   const char *old_path = ctx.path; \
-   if (ctx.path && ctx.report) { \
-      ctx.path = __compose_function_name(ctx.path, CALL, __FILE__, STR(__LINE__)); \
-      if (regexec(&ctx.profile, ctx.path, 0, NULL, 0) == 0) { \
-            ctx.report(ctx.path, -.5, ctx); \
-         ___t0 = primme_wTimer() - *ctx.timeoff; \
-      } \
-   }
+   static primme_profiler_site ___site = {CALL, __FILE__, __LINE__, 0}; \
+   double ___t0 = 0.0; \
+   int ___parent = \
+         PROFILE_UNLIKELY(PROFILE_SITE_TAG(___site) != ctx.profilerTag) \
+               ? primme_profiler_begin(ctx.profiler, &___site, &___t0) \
+               : -1;
 
 #define PROFILE_END \
-   if (ctx.path) { \
-      if (___t0 > 0) { \
-         double ___t1 = primme_wTimer(); \
-         ___t0 = ___t1 - ___t0 - *ctx.timeoff; \
-         if (___t0 > 0 && ctx.report) { \
-            ctx.report(ctx.path, ___t0, ctx); \
-            *ctx.timeoff += primme_wTimer() - ___t1; \
-         } \
-      } \
-      free((void*)ctx.path); \
-      ctx.path = old_path; \
-   }
- 
+   if (PROFILE_UNLIKELY(___parent >= 0)) \
+      primme_profiler_end(ctx.profiler, ___parent, ___t0);
 #else
 #define PROFILE_BEGIN(CALL)
 #define PROFILE_END
@@ -607,6 +594,7 @@ typedef struct primme_context_str {
 
    /* For memory management */
    primme_frame *mm;
+   primme_arena *arena; /* if not NULL, where Mem_malloc takes memory from */
 
    /* for MPI */
    int numProcs;     /* number of processes */
@@ -616,18 +604,54 @@ typedef struct primme_context_str {
          struct primme_context_str ctx); /* broadcast */
    int (*globalSum)(void *buffer, primme_op_datatype buffer_type, int count,
          struct primme_context_str ctx); /* global reduction */
+   int commReduce;   /* if nonzero, every process does the dense work that */
+                     /* otherwise process 0 does and broadcasts            */
+
+   /* For primme_solver */
+   int checkedParams; /* if nonzero, the parameters passed the checks in */
+                      /* a previous solve and are not checked again      */
 
    /* For MAGMA */
    void *queue;      /* magma device queue (magma_queue_t*) */
 
    #ifdef PRIMME_PROFILE
    /* For profiling */
-   regex_t profile;  /* Pattern of the functions to profile */
-   const char *path; /* Path of the current function */
-   double *timeoff;  /* Accumulated overhead of profiling and reporting */
+   primme_profiler *profiler; /* if not NULL, where the calls are recorded */
+   unsigned int profilerTag;  /* primme_profiler_tag(profiler)             */
+   const char *profile; /* if not NULL, report the calls matching it when */
+                        /* the context is freed, and profiler is owned     */
    #endif
 } primme_context;
 
+/*****************************************************************************/
+/* Reduction in flight started by globalSum_begin_Tprimme                    */
+/*****************************************************************************/
+
+typedef struct {
+   void *buffer;                /* Where to store the result              */
+   void *buffer0;               /* buffer cast into globalSumReal_type    */
+   primme_op_datatype buffert;  /* type of buffer                         */
+   int count;                   /* number of reduced elements             */
+   void *request;               /* handle returned by globalSumRealBegin  */
+} primme_globalsum_request;
+
+/*****************************************************************************/
+/* Search space kept between solves when primme_params.recycle is set       */
+/*****************************************************************************/
+
+typedef struct {
+   primme_op_datatype type;     /* type of the entries of V and W         */
+   size_t sizeofScalar;         /* size of an entry; tells complex apart  */
+   PRIMME_INT nLocal;           /* rows of V and W                        */
+   int numOrthoConst;           /* V is orthogonal to these constraints   */
+   int basisSize;               /* columns stored in V and W              */
+   int maxBasisSize;            /* columns allocated for V and W          */
+   void *V;                     /* basis, followed by W = A*V             */
+   void *W;
+   double normA;                /* |A| estimated by the solve that kept it */
+   void *owner;                 /* primme_params that allocated it        */
+} primme_recycled_basis;
+
 /*****************************************************************************/
 /* Miscellanea                                                               */
 /*****************************************************************************/
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ *   NOTE: THIS FILE IS AUTOMATICALLY GENERATED. PLEASE DON'T MODIFY
+ ******************************************************************************/
+
+
+#ifndef csr_H
+#define csr_H
+#if !defined(CHECK_TEMPLATE) && !defined(csr_rows)
+#  define csr_rows CONCAT(csr_rows,SCALAR_SUF)
+#endif
+void csr_rowsdprimme(
+      void *A_, int kb, void *xt_, PRIMME_INT ldxt, void *y_, PRIMME_INT ldy);
+#if !defined(CHECK_TEMPLATE) && !defined(csr_transpose)
+#  define csr_transpose CONCAT(csr_transpose,SCALAR_SUF)
+#endif
+int csr_transposedprimme(void *A_);
+#if !defined(CHECK_TEMPLATE) && !defined(sell_rows)
+#  define sell_rows CONCAT(sell_rows,SCALAR_SUF)
+#endif
+void sell_rowsdprimme(
+      void *A_, int k, void *x_, PRIMME_INT ldx, void *y_, PRIMME_INT ldy);
+#if !defined(CHECK_TEMPLATE) && !defined(csr_to_sell)
+#  define csr_to_sell CONCAT(csr_to_sell,SCALAR_SUF)
+#endif
+int csr_to_selldprimme(void *A_, int C, int sigma);
+#if !defined(CHECK_TEMPLATE) && !defined(csr_apply)
+#  define csr_apply CONCAT(csr_apply,SCALAR_SUF)
+#endif
+int csr_applydprimme(void *A_, int transpose, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy);
+#if !defined(CHECK_TEMPLATE) && !defined(csr_normal)
+#  define csr_normal CONCAT(csr_normal,SCALAR_SUF)
+#endif
+int csr_normaldprimme(void *A_, int aat, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy);
+#if !defined(CHECK_TEMPLATE) && !defined(csr_create)
+#  define csr_create CONCAT(csr_create,SCALAR_SUF)
+#endif
+void *csr_createdprimme(PRIMME_INT m, PRIMME_INT n, const void *rowptr,
+      const void *colind, const void *values, int index64, int base);
+void csr_rowssprimme(
+      void *A_, int kb, void *xt_, PRIMME_INT ldxt, void *y_, PRIMME_INT ldy);
+int csr_transposesprimme(void *A_);
+void sell_rowssprimme(
+      void *A_, int k, void *x_, PRIMME_INT ldx, void *y_, PRIMME_INT ldy);
+int csr_to_sellsprimme(void *A_, int C, int sigma);
+int csr_applysprimme(void *A_, int transpose, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy);
+int csr_normalsprimme(void *A_, int aat, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy);
+void *csr_createsprimme(PRIMME_INT m, PRIMME_INT n, const void *rowptr,
+      const void *colind, const void *values, int index64, int base);
+void csr_rowscprimme(
+      void *A_, int kb, void *xt_, PRIMME_INT ldxt, void *y_, PRIMME_INT ldy);
+int csr_transposecprimme(void *A_);
+void sell_rowscprimme(
+      void *A_, int k, void *x_, PRIMME_INT ldx, void *y_, PRIMME_INT ldy);
+int csr_to_sellcprimme(void *A_, int C, int sigma);
+int csr_applycprimme(void *A_, int transpose, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy);
+int csr_normalcprimme(void *A_, int aat, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy);
+void *csr_createcprimme(PRIMME_INT m, PRIMME_INT n, const void *rowptr,
+      const void *colind, const void *values, int index64, int base);
+void csr_rowszprimme(
+      void *A_, int kb, void *xt_, PRIMME_INT ldxt, void *y_, PRIMME_INT ldy);
+int csr_transposezprimme(void *A_);
+void sell_rowszprimme(
+      void *A_, int k, void *x_, PRIMME_INT ldx, void *y_, PRIMME_INT ldy);
+int csr_to_sellzprimme(void *A_, int C, int sigma);
+int csr_applyzprimme(void *A_, int transpose, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy);
+int csr_normalzprimme(void *A_, int aat, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy);
+void *csr_createzprimme(PRIMME_INT m, PRIMME_INT n, const void *rowptr,
+      const void *colind, const void *values, int index64, int base);
+#endif
@@ -58,6 +58,38 @@ typedef struct primme_frame_str {
                         
 } primme_frame;
 
+typedef struct primme_arena_chunk_str {
+   char *base;                      /* Start of the chunk, aligned */
+   size_t size;                     /* Size of the chunk in bytes */
+   size_t top;                      /* Offset of the first free byte */
+   size_t last;                     /* Offset of the last block + 1, or 0 */
+   int external;                    /* If nonzero, memory owned by the caller */
+   struct primme_arena_str *arena;  /* Arena with the chunk */
+   struct primme_arena_chunk_str *prev; /* Chunk below in the stack */
+   struct primme_arena_chunk_str *next; /* Next chunk */
+} primme_arena_chunk;
+
+typedef struct primme_map_str {
+   char *base;                      /* Start of the mapping */
+   size_t size;                     /* Size of the mapping in bytes */
+   int fd;                          /* File descriptor of the mapped file */
+   struct primme_map_str *next;     /* Next mapping */
+} primme_map;
+
+typedef struct primme_arena_str {
+   primme_arena_chunk *chunks;      /* List of chunks */
+   primme_arena_chunk *top;         /* Chunk with the last block */
+   primme_map *maps;                /* List of blocks from Mem_map */
+   size_t used;                     /* Bytes taken by the blocks in use */
+   size_t peak;                     /* Largest value of used */
+   PRIMME_INT numAllocs;            /* Number of blocks allocated */
+   PRIMME_INT numHeapAllocs;        /* Number of calls to malloc */
+   int external;                    /* If nonzero, memory owned by the caller */
+   int dryRun;                      /* If nonzero, blocks only take a header */
+   int refs;                        /* Number of contexts using the arena */
+   struct primme_arena_str *self;   /* Pointer to itself while in use */
+} primme_arena;
+
 int Mem_push_frame(struct primme_context_str *ctx);
 int Mem_pop_frame(struct primme_context_str *ctx);
 int Mem_pop_clean_frame(struct primme_context_str ctx);
@@ -66,5 +98,20 @@ int Mem_debug_frame(const char *debug, struct primme_context_str ctx);
 typedef int (*free_fn_type)(void *, struct primme_context_str);
 int Mem_register_alloc(void *p, free_fn_type free_fn, struct primme_context_str ctx);
 int Mem_deregister_alloc(void *p, struct primme_context_str ctx);
+int Mem_create_arena(void *workspace, size_t lworkspace,
+      struct primme_context_str *ctx);
+int Mem_create_dry_arena(struct primme_context_str *ctx);
+int Mem_attach_arena(primme_arena *arena, struct primme_context_str *ctx);
+primme_arena *Mem_workspace_arena(void *workspace, size_t lworkspace);
+int Mem_destroy_arena(struct primme_context_str *ctx);
+int Mem_malloc(size_t size, void **p, struct primme_context_str ctx);
+int Mem_free(void *p, struct primme_context_str ctx);
+int Mem_map(size_t size, const char *dir, void **p,
+      struct primme_context_str ctx);
+int Mem_stream_rows(void *x, size_t elemSize, PRIMME_INT ldx, PRIMME_INT mx,
+      int n, PRIMME_INT i, PRIMME_INT m, struct primme_context_str ctx);
+size_t Mem_block_size(size_t size);
+size_t Mem_workspace_size(size_t used);
+int Mem_dry_run(struct primme_context_str ctx);
 
 #endif
@@ -37,11 +37,26 @@
 #define PRIMME_INTERFACE_H
 
 void primme_set_defaults(primme_params *params);
+int primme_params_same_setup(primme_params *a, primme_params *b);
+
+/* Handle returned by primme_solver_create */
+
+struct primme_solver {
+   primme_params *primme;  /* parameters of the problem to solve */
+   void *workspace;        /* memory reused by every solve */
+   size_t lworkspace;      /* size of workspace in bytes */
+   primme_params checked;  /* parameters checked by the last solve */
+   const void *checkedKind; /* variant of Xprimme_solve that checked them, */
+                            /* or NULL if there is no checked parameters    */
+};
 void primme_display_params_prefix(const char* prefix, primme_params primme);
 #ifndef WITH_KIND
 #  define WITH_KIND(X) X
 #endif
 #define Xprimme WITH_KIND(SCALAR_SUF)
+#define Xprimme_solve CONCAT(Xprimme,_solve)
+#define Xprimme_batch CONCAT(Xprimme,_batch)
+#define Xprimme_slicing CONCAT(Xprimme,_slicing)
 
 /* Keep automatically generated headers under this section  */
 #ifndef CHECK_TEMPLATE
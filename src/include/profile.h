@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ * File: profile.h
+ *
+ * Purpose - Header file with the functions used by PROFILE_BEGIN and
+ *           PROFILE_END to record the calls in a primme_profiler.
+ *
+ ******************************************************************************/
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "primme_profile.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Call site. Every profiled call has a static instance, so the address */
+/* identifies the call site without any look up. The throttling state   */
+/* is kept by every profiler; the site only remembers the tag of the    */
+/* last profiler that throttled it, so that PROFILE_BEGIN skips the     */
+/* calls without calling the profiler while that profiler is in use.    */
+
+typedef struct {
+   const char *call;             /* text of the call                  */
+   const char *file;             /* file name                         */
+   int line;                     /* line number                       */
+   unsigned int tag;             /* tag of the profiler that throttled */
+                                 /* the site, or zero                  */
+} primme_profiler_site;
+
+/* The tag may be written by a thread while another one reads it */
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define PROFILE_SITE_TAG(S) __atomic_load_n(&(S).tag, __ATOMIC_RELAXED)
+#  define PROFILE_SET_SITE_TAG(S, T)                                           \
+      __atomic_store_n(&(S).tag, (T), __ATOMIC_RELAXED)
+#else
+#  define PROFILE_SITE_TAG(S) ((S).tag)
+#  define PROFILE_SET_SITE_TAG(S, T) ((S).tag = (T))
+#endif
+
+/* Keep the calls to the profiler out of the path of the usual case */
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define PROFILE_UNLIKELY(X) __builtin_expect(!!(X), 0)
+#else
+#  define PROFILE_UNLIKELY(X) (X)
+#endif
+
+unsigned int primme_profiler_tag(primme_profiler *prof);
+int primme_profiler_begin(primme_profiler *prof, primme_profiler_site *site,
+      double *t0);
+void primme_profiler_end(primme_profiler *prof, int parent, double t0);
+int primme_profiler_report(primme_profiler *prof, const char *pattern,
+      int (*report)(const char *path, double time, void *arg), void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILE_H */
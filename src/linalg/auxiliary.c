@@ -621,6 +621,24 @@ int compute_submatrix_Sprimme(SCALAR *X, int nX, int ldX, SCALAR *H, int nH,
 
   return 0;
 }
+
+/*******************************************************************************
+ * Subroutine compute_submatrix_workspace - Take from the dry arena of the
+ *    context the blocks that compute_submatrix takes with the same nX and nH
+ *    (see Mem_create_dry_arena).
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int compute_submatrix_workspace_Sprimme(int nX, int nH, primme_context ctx) {
+
+   if (nH == 0 || nX == 0) return 0;
+
+   SCALAR *rwork;
+   CHKERR(Num_malloc_Sprimme((size_t)nH * (size_t)nX, &rwork, ctx));
+   CHKERR(Num_free_Sprimme(rwork, ctx));
+
+   return 0;
+}
 #endif /* !defined(USE_HALF) && !defined(USE_HALFCOMPLEX) */
 
 #endif /* USE_HOST */
@@ -790,6 +808,25 @@ int permute_vecs_Sprimme(SCALAR *vecs, PRIMME_INT m, int n, PRIMME_INT ld,
    return 0;
 }
 
+/*******************************************************************************
+ * Subroutine permute_vecs_workspace - Take from the dry arena of the context
+ *    the blocks that permute_vecs takes with the same m and n (see
+ *    Mem_create_dry_arena).
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int permute_vecs_workspace_Sprimme(PRIMME_INT m, int n, primme_context ctx) {
+
+   int *perm;
+   SCALAR *rwork;
+   CHKERR(Num_malloc_iprimme(n, &perm, ctx));
+   CHKERR(Num_malloc_Sprimme(m, &rwork, ctx));
+   CHKERR(Num_free_iprimme(perm, ctx));
+   CHKERR(Num_free_Sprimme(rwork, ctx));
+
+   return 0;
+}
+
 #ifdef USE_DOUBLE
 TEMPLATE_PLEASE
 int permute_vecs_iprimme(int *vecs, int n, int *perm_, primme_context ctx) {
@@ -866,6 +903,16 @@ int permute_vecs_iprimme(int *vecs, int n, int *perm_, primme_context ctx) {
 
    return 0;
 }
+
+TEMPLATE_PLEASE
+int permute_vecs_workspace_iprimme(int n, primme_context ctx) {
+
+   int *perm;
+   CHKERR(Num_malloc_iprimme(n, &perm, ctx));
+   CHKERR(Num_free_iprimme(perm, ctx));
+
+   return 0;
+}
 #endif
 
 
@@ -48,12 +48,6 @@
 #include "blaslapack_private.h"
 
 #ifdef USE_DOUBLE
-static int free_fn_dummy (void *p, primme_context ctx) {
-   (void)ctx;
-   free(p);
-   return 0;
-}
-
 static int to_blas_int(PRIMME_INT i, PRIMME_BLASINT *out) {
    // If the matrix size is too large for the current BLAS, report an error
    if (i > PRIMME_BLASINT_MAX) return PRIMME_UNEXPECTED_FAILURE;
@@ -63,6 +57,285 @@ static int to_blas_int(PRIMME_INT i, PRIMME_BLASINT *out) {
 }
 #endif
 
+/* Products of a tall and skinny matrix by a few vectors, as V'*W and V*h in */
+/* the orthogonalization and the restart, with kernels for double that use  */
+/* AVX2 and FMA if the processor has them. The number of columns of the     */
+/* block of vectors is fixed at compile time, so that the partial results   */
+/* stay in registers. They are not used if PRIMME_BLAS_THREADED is defined. */
+
+#if defined(USE_DOUBLE) && (defined(__GNUC__) || defined(__clang__)) &&        \
+      (defined(__x86_64__) || defined(__i386__)) &&                            \
+      !defined(PRIMME_BLAS_THREADED)
+#  define GEMM_X86
+#  include <immintrin.h>
+
+#  ifdef __clang__
+#     define GEMM_UNROLL _Pragma("unroll")
+#  else
+#     define GEMM_UNROLL _Pragma("GCC unroll 16")
+#  endif
+
+/* Rows of the panel of V'*W computed in one pass; the panel of W is kept in */
+/* L1 while it is multiplied by all columns of V.                            */
+
+#define GEMM_TN_ROWS 128
+
+/* Minimum number of rows of the tall matrix to use the kernels */
+
+#define GEMM_MIN_ROWS 64
+
+/* Maximum number of columns of the tall matrix to use the kernels; they */
+/* are not blocked on that dimension, and for more columns the BLAS      */
+/* reuses better the data in cache                                        */
+
+#define GEMM_MAX_COLS 64
+
+/* Number of threads used by OpenBLAS and MKL, if the library is linked. */
+/* The kernels run in one thread, so they are skipped if the BLAS uses   */
+/* more.                                                                  */
+
+extern int openblas_get_num_threads(void) __attribute__((weak));
+extern int MKL_Get_Max_Threads(void) __attribute__((weak));
+
+static int gemm_blas_threaded(void) {
+   if (openblas_get_num_threads && openblas_get_num_threads() > 1) return 1;
+   if (MKL_Get_Max_Threads && MKL_Get_Max_Threads() > 1) return 1;
+   return 0;
+}
+
+__attribute__((target("avx2,fma"))) static inline double gemm_hsum(
+      __m256d v) {
+   __m128d s = _mm_add_pd(
+         _mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+   return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+}
+
+/* c(0:MI-1,0:NB-1) += alpha * a(0:rr-1,0:MI-1)' * b(0:rr-1,0:NB-1) */
+
+__attribute__((target("avx2,fma"), always_inline)) static inline void
+gemm_tn_block(const int MI, const int NB, PRIMME_INT rr, double alpha,
+      const double *a, PRIMME_INT lda, const double *b, PRIMME_INT ldb,
+      double *c, PRIMME_INT ldc) {
+
+   __m256d acc[MI * NB];
+   double t[MI * NB];
+   int u, v;
+   PRIMME_INT r;
+
+   GEMM_UNROLL for (u = 0; u < MI * NB; u++) acc[u] = _mm256_setzero_pd();
+   for (r = 0; r + 4 <= rr; r += 4) {
+      __m256d av[MI];
+      GEMM_UNROLL for (u = 0; u < MI; u++) {
+         av[u] = _mm256_loadu_pd(&a[r + u * lda]);
+      }
+      GEMM_UNROLL for (v = 0; v < NB; v++) {
+         __m256d bv = _mm256_loadu_pd(&b[r + v * ldb]);
+         GEMM_UNROLL for (u = 0; u < MI; u++) {
+            acc[u + v * MI] = _mm256_fmadd_pd(av[u], bv, acc[u + v * MI]);
+         }
+      }
+   }
+   GEMM_UNROLL for (u = 0; u < MI * NB; u++) t[u] = gemm_hsum(acc[u]);
+   for (; r < rr; r++) {
+      GEMM_UNROLL for (v = 0; v < NB; v++) {
+         GEMM_UNROLL for (u = 0; u < MI; u++) {
+            t[u + v * MI] += a[r + u * lda] * b[r + v * ldb];
+         }
+      }
+   }
+   GEMM_UNROLL for (v = 0; v < NB; v++) {
+      GEMM_UNROLL for (u = 0; u < MI; u++) {
+         c[u + v * ldc] += alpha * t[u + v * MI];
+      }
+   }
+}
+
+/* c += alpha * a' * b, with c m x n and n multiple of NB */
+
+__attribute__((target("avx2,fma"), always_inline)) static inline void
+gemm_tn_kernel(const int MI, const int NB, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT k, double alpha, const double *a, PRIMME_INT lda,
+      const double *b, PRIMME_INT ldb, double *c, PRIMME_INT ldc) {
+
+   PRIMME_INT r0, i, j;
+   for (r0 = 0; r0 < k; r0 += GEMM_TN_ROWS) {
+      PRIMME_INT rr = min(GEMM_TN_ROWS, k - r0);
+      for (j = 0; j < n; j += NB) {
+         for (i = 0; i + MI <= m; i += MI) {
+            gemm_tn_block(MI, NB, rr, alpha, &a[r0 + i * lda], lda,
+                  &b[r0 + j * ldb], ldb, &c[i + j * ldc], ldc);
+         }
+         for (; i < m; i++) {
+            gemm_tn_block(1, NB, rr, alpha, &a[r0 + i * lda], lda,
+                  &b[r0 + j * ldb], ldb, &c[i + j * ldc], ldc);
+         }
+      }
+   }
+}
+
+/* c(0:4*MV-1,0:NB-1) = alpha * a(0:4*MV-1,0:k-1) * b(0:k-1,0:NB-1) +       */
+/*                      beta * c(0:4*MV-1,0:NB-1)                             */
+
+__attribute__((target("avx2,fma"), always_inline)) static inline void
+gemm_nn_block(const int MV, const int NB, PRIMME_INT k, double alpha,
+      const double *a, PRIMME_INT lda, const double *b, PRIMME_INT ldb,
+      double beta, double *c, PRIMME_INT ldc) {
+
+   __m256d acc[MV * NB];
+   int u, v;
+   PRIMME_INT r;
+
+   GEMM_UNROLL for (u = 0; u < MV * NB; u++) acc[u] = _mm256_setzero_pd();
+   for (r = 0; r < k; r++) {
+      __m256d av[MV];
+      GEMM_UNROLL for (u = 0; u < MV; u++) {
+         av[u] = _mm256_loadu_pd(&a[4 * u + r * lda]);
+      }
+      GEMM_UNROLL for (v = 0; v < NB; v++) {
+         __m256d bv = _mm256_broadcast_sd(&b[r + v * ldb]);
+         GEMM_UNROLL for (u = 0; u < MV; u++) {
+            acc[u + v * MV] = _mm256_fmadd_pd(av[u], bv, acc[u + v * MV]);
+         }
+      }
+   }
+   __m256d alphav = _mm256_set1_pd(alpha), betav = _mm256_set1_pd(beta);
+   GEMM_UNROLL for (v = 0; v < NB; v++) {
+      GEMM_UNROLL for (u = 0; u < MV; u++) {
+         double *cv = &c[4 * u + v * ldc];
+         __m256d x = _mm256_mul_pd(alphav, acc[u + v * MV]);
+         if (beta != 0.0) x = _mm256_fmadd_pd(betav, _mm256_loadu_pd(cv), x);
+         _mm256_storeu_pd(cv, x);
+      }
+   }
+}
+
+/* c = alpha * a * b + beta * c, with c m x n and n multiple of NB. The    */
+/* rows of a are loaded once for all columns of b.                          */
+
+__attribute__((target("avx2,fma"), always_inline)) static inline void
+gemm_nn_kernel(const int MV, const int NB, PRIMME_INT m, PRIMME_INT n,
+      PRIMME_INT k, double alpha, const double *a, PRIMME_INT lda,
+      const double *b, PRIMME_INT ldb, double beta, double *c,
+      PRIMME_INT ldc) {
+
+   PRIMME_INT i, i0, j, r;
+   for (i = 0; i + 4 * MV <= m; i += 4 * MV) {
+      for (j = 0; j < n; j += NB) {
+         gemm_nn_block(MV, NB, k, alpha, &a[i], lda, &b[j * ldb], ldb, beta,
+               &c[i + j * ldc], ldc);
+      }
+   }
+   for (i0 = i, j = 0; j < n; j++) {
+      for (i = i0; i < m; i++) {
+         double s = 0.0;
+         for (r = 0; r < k; r++) s += a[i + r * lda] * b[r + j * ldb];
+         c[i + j * ldc] =
+               alpha * s + (beta != 0.0 ? beta * c[i + j * ldc] : 0.0);
+      }
+   }
+}
+
+__attribute__((target("avx2,fma"))) static void gemm_tn_avx2(PRIMME_INT m,
+      PRIMME_INT n, PRIMME_INT k, double alpha, const double *a,
+      PRIMME_INT lda, const double *b, PRIMME_INT ldb, double *c,
+      PRIMME_INT ldc) {
+
+   /* Columns of A computed together for every block size of B */
+
+   if (n == 1) {
+      gemm_tn_kernel(4, 1, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+   } else if (n == 2) {
+      gemm_tn_kernel(4, 2, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+   } else if (n == 4) {
+      gemm_tn_kernel(2, 4, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+   } else {
+      gemm_tn_kernel(1, 8, m, n, k, alpha, a, lda, b, ldb, c, ldc);
+   }
+}
+
+__attribute__((target("avx2,fma"))) static void gemm_nn_avx2(PRIMME_INT m,
+      PRIMME_INT n, PRIMME_INT k, double alpha, const double *a,
+      PRIMME_INT lda, const double *b, PRIMME_INT ldb, double beta,
+      double *c, PRIMME_INT ldc) {
+
+   /* Rows of A, in vectors of 4, computed together for every block size */
+
+   if (n == 1) {
+      gemm_nn_kernel(8, 1, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+   } else if (n == 2) {
+      gemm_nn_kernel(4, 2, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+   } else if (n == 4) {
+      gemm_nn_kernel(2, 4, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+   } else {
+      gemm_nn_kernel(1, 8, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+   }
+}
+
+/******************************************************************************
+ * Function gemm_tall_skinny - Compute C = alpha*A'*B + beta*C, with A and B
+ *    with k rows, or C = alpha*A*B + beta*C, with A and C with m rows, if the
+ *    number of rows is at least GEMM_MIN_ROWS, the number of columns of A is
+ *    at most GEMM_MAX_COLS, the number of columns of C is at most 16, the
+ *    processor has AVX2 and FMA, and the BLAS is not running with several
+ *    threads. The columns of C are split in blocks of 8, 4, 2 and 1 columns,
+ *    which have specialized kernels.
+ *
+ * Return Value
+ * ------------
+ * 1 if the product was computed, and 0 otherwise
+ *
+ ******************************************************************************/
+
+static int gemm_tall_skinny(const char *transa, const char *transb,
+      PRIMME_INT m, PRIMME_INT n, PRIMME_INT k, double alpha, double *a,
+      PRIMME_INT lda, double *b, PRIMME_INT ldb, double beta, double *c,
+      PRIMME_INT ldc) {
+
+   int tn = (*transa == 'C' || *transa == 'c' || *transa == 'T' ||
+                   *transa == 't') &&
+            (*transb == 'N' || *transb == 'n');
+   int nn = (*transa == 'N' || *transa == 'n') &&
+            (*transb == 'N' || *transb == 'n');
+
+   if (n > 16 ||
+         !((tn && k >= GEMM_MIN_ROWS && m <= GEMM_MAX_COLS) ||
+               (nn && m >= GEMM_MIN_ROWS && k <= GEMM_MAX_COLS)) ||
+         !__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma") ||
+         gemm_blas_threaded()) {
+      return 0;
+   }
+
+   /* The kernel for A'*B accumulates on C */
+
+   if (tn) {
+      PRIMME_INT i, j;
+      for (j = 0; j < n; j++) {
+         for (i = 0; i < m; i++) {
+            c[i + j * ldc] = (beta == 0.0 ? 0.0 : beta * c[i + j * ldc]);
+         }
+      }
+   }
+
+   PRIMME_INT j, nb;
+   for (j = 0; j < n; j += nb) {
+      if (n - j >= 8) nb = (n - j) / 8 * 8;
+      else if (n - j >= 4) nb = 4;
+      else if (n - j >= 2) nb = 2;
+      else nb = 1;
+      if (tn) {
+         gemm_tn_avx2(m, nb, k, alpha, a, lda, &b[j * ldb], ldb, &c[j * ldc],
+               ldc);
+      } else {
+         gemm_nn_avx2(m, nb, k, alpha, a, lda, &b[j * ldb], ldb, beta,
+               &c[j * ldc], ldc);
+      }
+   }
+
+   return 1;
+}
+
+#endif /* USE_DOUBLE && x86 */
+
 /******************************************************************************
  * Function Num_check_pointer - Return no error code if the pointer is on host.
  * 
@@ -101,17 +374,10 @@ int Num_malloc_Sprimme(PRIMME_INT n, SCALAR **x, primme_context ctx) {
       return 0;
    }
 
-   /* Allocate memory */
-
-   *x = (SCALAR *)malloc(sizeof(SCALAR) * n);
-   if (*x == NULL) return PRIMME_MALLOC_FAILURE;
-
-   /* Register the allocation */
+   /* Allocate memory and register the allocation */
 
    Mem_keep_frame(ctx);
-   Mem_register_alloc(*x, free_fn_dummy, ctx);
-
-   return 0;
+   return Mem_malloc(sizeof(SCALAR) * n, (void **)x, ctx);
 }
 
 /******************************************************************************
@@ -130,15 +396,9 @@ int Num_free_Sprimme(SCALAR *x, primme_context ctx) {
 
    if (!x) return 0;
 
-   /* Deregister the allocation */
+   /* Deregister the allocation and free the pointer */
 
-   Mem_deregister_alloc(x, ctx);
-
-   /* Free pointer */
-
-   free(x);
-
-   return 0;
+   return Mem_free(x, ctx);
 }
 
 #ifdef USE_DOUBLE
@@ -164,17 +424,10 @@ int Num_malloc_iprimme(PRIMME_INT n, int **x, primme_context ctx) {
       return 0;
    }
 
-   /* Allocate memory */
-
-   *x = (int *)malloc(sizeof(int) * n);
-   if (*x == NULL) return PRIMME_MALLOC_FAILURE;
-
-   /* Register the allocation */
+   /* Allocate memory and register the allocation */
 
    Mem_keep_frame(ctx);
-   Mem_register_alloc(*x, free_fn_dummy, ctx);
-
-   return 0;
+   return Mem_malloc(sizeof(int) * n, (void **)x, ctx);
 }
 
 /******************************************************************************
@@ -192,15 +445,9 @@ int Num_free_iprimme(int *x, primme_context ctx) {
 
    if (!x) return 0;
 
-   /* Deregister the allocation */
+   /* Deregister the allocation and free the pointer */
 
-   Mem_deregister_alloc(x, ctx);
-
-   /* Free pointer */
-
-   free(x);
-
-   return 0;
+   return Mem_free(x, ctx);
 }
 
 
@@ -226,17 +473,10 @@ static int Num_malloc_iblasprimme(
       return 0;
    }
 
-   /* Allocate memory */
-
-   *x = (PRIMME_BLASINT *)malloc(sizeof(PRIMME_BLASINT) * n);
-   if (*x == NULL) return PRIMME_MALLOC_FAILURE;
-
-   /* Register the allocation */
+   /* Allocate memory and register the allocation */
 
    Mem_keep_frame(ctx);
-   Mem_register_alloc(*x, free_fn_dummy, ctx);
-
-   return 0;
+   return Mem_malloc(sizeof(PRIMME_BLASINT) * n, (void **)x, ctx);
 }
 
 /******************************************************************************
@@ -253,15 +493,9 @@ static int Num_free_iblasprimme(PRIMME_BLASINT *x, primme_context ctx) {
 
    if (!x) return 0;
 
-   /* Deregister the allocation */
+   /* Deregister the allocation and free the pointer */
 
-   Mem_deregister_alloc(x, ctx);
-
-   /* Free pointer */
-
-   free(x);
-
-   return 0;
+   return Mem_free(x, ctx);
 }
 #endif /* USE_DOUBLE */
 
@@ -543,6 +777,12 @@ int Num_gemm_Sprimme(const char *transa, const char *transb, PRIMME_INT m,
       }
       return 0;
    }
+#if defined(USE_DOUBLE) && defined(GEMM_X86)
+   if (gemm_tall_skinny(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta,
+             c, ldc)) {
+      return 0;
+   }
+#endif
    if (n == 1) {
       PRIMME_INT mA; PRIMME_INT nA;
       if (*transa == 'n' || *transa == 'N') mA = m, nA = k;
@@ -1013,6 +1253,9 @@ int Num_scal_Sprimme(PRIMME_INT n, HSCALAR alpha, SCALAR *x, PRIMME_INT incx,
 /*******************************************************************************
  * Subroutines for dense eigenvalue decomposition
  * NOTE: xheevx is used instead of xheev because xheev is not in ESSL
+ * NOTE: with a dry arena (see Mem_create_dry_arena) the routines that take
+ *       workspace from the arena, as this one, only query LAPACK for the
+ *       size of the workspace and take it, without touching the matrices.
  ******************************************************************************/
  
 #if (!defined(USE_HALF) && !defined(USE_HALFCOMPLEX)) || defined(BLASLAPACK_WITH_HALF)
@@ -1064,17 +1307,19 @@ int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    if (linfo == 0) {
       SCALAR *work = NULL;
       CHKERR(Num_malloc_Sprimme(lldwork, &work, ctx));
-      XHEEVX(jobz, "A", uplo, &ln, a, &llda, &dummyr, &dummyr,
-            &dummyi, &dummyi, &abstol, &dummyi, w, z, &ln, work, &lldwork,
+      if (!Mem_dry_run(ctx)) {
+         XHEEVX(jobz, "A", uplo, &ln, a, &llda, &dummyr, &dummyr, &dummyi,
+               &dummyi, &abstol, &dummyi, w, z, &ln, work, &lldwork,
 #  ifdef USE_COMPLEX
-            rwork,
+               rwork,
 #  endif
-            iwork, ifail, &linfo);
+               iwork, ifail, &linfo);
+      }
       CHKERR(Num_free_Sprimme(work, ctx));
    }
 
    /* Copy z to a */
-   Num_copy_matrix_Sprimme(z, n, n, n, a, lda, ctx);
+   if (!Mem_dry_run(ctx)) Num_copy_matrix_Sprimme(z, n, n, n, a, lda, ctx);
 
    CHKERR(Num_free_Sprimme(z, ctx)); 
 #  ifdef USE_COMPLEX
@@ -1119,11 +1364,13 @@ int Num_heev_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    if (linfo == 0) {
       SCALAR *work = NULL;
       CHKERR(Num_malloc_Sprimme(lldwork, &work, ctx));
-      XHEEV(jobz, uplo, &ln, a, &llda, w, work, &lldwork,
+      if (!Mem_dry_run(ctx)) {
+         XHEEV(jobz, uplo, &ln, a, &llda, w, work, &lldwork,
 #     ifdef USE_COMPLEX
-            rwork,
+               rwork,
 #     endif
-            &linfo); 
+               &linfo);
+      }
       CHKERR(Num_free_Sprimme(work, ctx));
    }
 
@@ -1186,9 +1433,11 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    CHKERR(Num_malloc_iblasprimme(5*n, &iwork, ctx));
    CHKERR(Num_malloc_iblasprimme(n, &ifail, ctx));
 
-   Num_copy_trimatrix_Sprimme(b0, n, n, ldb0,
-         *uplo == 'U' || *uplo == 'u' ? 0 : 1, 0, b, n,
-         0 /*not to zero rest of the matrix */);
+   if (!Mem_dry_run(ctx)) {
+      Num_copy_trimatrix_Sprimme(b0, n, n, ldb0,
+            *uplo == 'U' || *uplo == 'u' ? 0 : 1, 0, b, n,
+            0 /*not to zero rest of the matrix */);
+   }
 
    /* Call to know the optimal workspace */
 
@@ -1205,17 +1454,20 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    if (linfo == 0) {
       SCALAR *work = NULL;
       CHKERR(Num_malloc_Sprimme(lldwork, &work, ctx));
-      XHEGVX(&ONE, jobz, "A", uplo, &ln, a, &llda, b, &ln, &dummyr, &dummyr,
-            &dummyi, &dummyi, &abstol, &dummyi, w, z, &ln, work, &lldwork,
+      if (!Mem_dry_run(ctx)) {
+         XHEGVX(&ONE, jobz, "A", uplo, &ln, a, &llda, b, &ln, &dummyr,
+               &dummyr, &dummyi, &dummyi, &abstol, &dummyi, w, z, &ln, work,
+               &lldwork,
 #  ifdef USE_COMPLEX
-            rwork,
+               rwork,
 #  endif
-            iwork, ifail, &linfo);
+               iwork, ifail, &linfo);
+      }
       CHKERR(Num_free_Sprimme(work, ctx));
    }
 
    /* Copy z to a */
-   Num_copy_matrix_Sprimme(z, n, n, n, a, lda, ctx);
+   if (!Mem_dry_run(ctx)) Num_copy_matrix_Sprimme(z, n, n, n, a, lda, ctx);
 
    CHKERR(Num_free_Sprimme(z, ctx)); 
    CHKERR(Num_free_Sprimme(b, ctx)); 
@@ -1251,7 +1503,7 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    CHKERR(Num_malloc_Rprimme(3*n, &rwork, ctx));
 #  endif
 
-   Num_copy_matrix_Sprimme(b0, n, n, ldb0, b, n, ctx);
+   if (!Mem_dry_run(ctx)) Num_copy_matrix_Sprimme(b0, n, n, ldb0, b, n, ctx);
 
    /* Call to know the optimal workspace */
 
@@ -1267,11 +1519,13 @@ int Num_hegv_Sprimme(const char *jobz, const char *uplo, PRIMME_INT n,
    if (linfo == 0) {
       SCALAR *work = NULL;
       CHKERR(Num_malloc_Sprimme(lldwork, &work, ctx));
-      XHEGV(&ONE, jobz, uplo, &ln, a, &llda, b, &ln, w, work, &lldwork,
+      if (!Mem_dry_run(ctx)) {
+         XHEGV(&ONE, jobz, uplo, &ln, a, &llda, b, &ln, w, work, &lldwork,
 #  ifdef USE_COMPLEX
-            rwork,
+               rwork,
 #  endif
-            &linfo);
+               &linfo);
+      }
       CHKERR(Num_free_Sprimme(work, ctx));
    }
 
@@ -1324,8 +1578,10 @@ int Num_gees_Sprimme(const char *jobvs, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
    if (linfo == 0) {
       SCALAR *work = NULL;
       CHKERR(Num_malloc_Sprimme(lldwork, &work, ctx));
-      XGEES(jobvs, "N", NULL, &ln, a, &llda, &lsdim, w, vs, &lldvs, work,
-            &lldwork, rwork, &dummyi, &linfo);
+      if (!Mem_dry_run(ctx)) {
+         XGEES(jobvs, "N", NULL, &ln, a, &llda, &lsdim, w, vs, &lldvs, work,
+               &lldwork, rwork, &dummyi, &linfo);
+      }
       CHKERR(Num_free_Sprimme(work, ctx));
    }
 
@@ -1381,12 +1637,14 @@ int Num_gesvd_Sprimme(const char *jobu, const char *jobvt, PRIMME_INT m,
       REAL *rwork;
       CHKERR(Num_malloc_Rprimme(5*n, &rwork, ctx));
 #  endif
-      XGESVD(jobu, jobvt, &lm, &ln, a, &llda, s, u, &lldu, vt, &lldvt, work,
-            &lldwork,
+      if (!Mem_dry_run(ctx)) {
+         XGESVD(jobu, jobvt, &lm, &ln, a, &llda, s, u, &lldu, vt, &lldvt,
+               work, &lldwork,
 #ifdef USE_COMPLEX
-            rwork,
+               rwork,
 #endif
-            &linfo);
+               &linfo);
+      }
       CHKERR(Num_free_Sprimme(work, ctx));
 #  ifdef USE_COMPLEX
       CHKERR(Num_free_Rprimme(rwork, ctx));
@@ -1436,13 +1694,15 @@ int Num_hetrf_Sprimme(const char *uplo, PRIMME_INT n, SCALAR *a, PRIMME_INT lda,
    if (linfo == 0) {
       SCALAR *work;
       CHKERR(Num_malloc_Sprimme(lldwork, &work, ctx));
-      XHETRF(uplo, &ln, a, &llda, lipivot, work, &lldwork, &linfo);
+      if (!Mem_dry_run(ctx)) {
+         XHETRF(uplo, &ln, a, &llda, lipivot, work, &lldwork, &linfo);
+      }
       CHKERR(Num_free_Sprimme(work, ctx));
    }
 
    if (sizeof(int) != sizeof(PRIMME_BLASINT)) {
       int i;
-      for(i=0; i<n; i++)
+      if (!Mem_dry_run(ctx)) for(i=0; i<n; i++)
          ipivot[i] = (int)lipivot[i];
       CHKERR(Num_free_iblasprimme(lipivot, ctx));
    }
@@ -1507,11 +1767,16 @@ int Num_hetrs_Sprimme(const char *uplo, PRIMME_INT n, PRIMME_INT nrhs,
 
    if (sizeof(int) != sizeof(PRIMME_BLASINT)) {
       CHKERR(Num_malloc_iblasprimme(n, &lipivot, ctx));
+      if (Mem_dry_run(ctx)) {
+         CHKERR(Num_free_iblasprimme(lipivot, ctx));
+         return 0;
+      }
       PRIMME_INT i;
       for(i=0; i<n; i++) {
          lipivot[i] = (PRIMME_BLASINT)ipivot[i];
       }
    } else {
+      if (Mem_dry_run(ctx)) return 0;
       lipivot = (PRIMME_BLASINT *)ipivot; /* cast avoid compiler warning */
    }
 
@@ -0,0 +1,1019 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ * File: csr.c
+ *
+ * Purpose - Sparse matrix in CSR format and its product with a block of
+ *           vectors, usable directly as matrixMatvec. Optionally the
+ *           matrix is also stored in SELL-C-sigma format.
+ *
+ ******************************************************************************/
+
+#ifndef THIS_FILE
+#define THIS_FILE "../linalg/csr.c"
+#endif
+
+#include <stdlib.h>   /* malloc, free, qsort */
+#include <stdint.h>   /* int64_t */
+#include <limits.h>   /* INT_MAX */
+#include "numerical.h"
+/* Keep automatically generated headers under this section  */
+#ifndef CHECK_TEMPLATE
+#include "csr.h"
+#endif
+
+/* The SELL kernels for double have versions with AVX2 and AVX-512 that are */
+/* chosen at runtime, if the compiler supports target attributes on x86.     */
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                               \
+      (defined(__x86_64__) || defined(__i386__))
+#  define SELL_X86
+#  include <immintrin.h>
+#endif
+
+#ifndef CSR_PRIVATE_H
+#define CSR_PRIVATE_H
+
+/* Number of columns of the block computed in one pass over the nonzeros.   */
+/* The partial results of a row for these columns are kept in registers or  */
+/* in L1, and the loop over them is the one vectorized by the compiler.     */
+
+#define CSR_BLOCK 64
+
+/* Maximum number of rows of a chunk in SELL-C-sigma, and default values of */
+/* C and sigma. A chunk of C rows is stored by columns, padded with zeros  */
+/* to the longest row, so that the C rows are computed with SIMD lanes.   */
+/* Sorting the rows by length inside windows of sigma rows reduces the    */
+/* padding.                                                               */
+
+#define SELL_MAX_C 64
+#define SELL_DEFAULT_C 8
+#define SELL_DEFAULT_SIGMA 256
+
+/* Rows are distributed among the OpenMP threads, if the library is built   */
+/* with OpenMP. Small matrices are not worth the cost of the parallel region.*/
+
+#ifdef _OPENMP
+#  include <omp.h>
+#  define CSR_PARALLEL_FOR                                                     \
+      _Pragma("omp parallel for schedule(dynamic, 256) if (A->m > 4096)")
+#  define CSR_THREAD_NUM omp_get_thread_num()
+#  define CSR_NUM_THREADS(A) ((A)->m > 4096 ? omp_get_max_threads() : 1)
+#else
+#  define CSR_PARALLEL_FOR
+#  define CSR_THREAD_NUM 0
+#  define CSR_NUM_THREADS(A) 1
+#endif
+
+struct primme_csr {
+   PRIMME_INT m, n;           /* number of rows and columns */
+   const void *rowptr;        /* row pointers, int or int64_t */
+   const void *colind;        /* column indices, int or int64_t */
+   const void *values;        /* nonzero values */
+   int index64;               /* whether rowptr and colind are int64_t */
+   int base;                  /* index of the first row/column, 0 or 1 */
+   int owned;                 /* whether PRIMME allocated the arrays */
+   int (*apply)(void *A, int transpose, int k, void *x, PRIMME_INT ldx,
+         void *y, PRIMME_INT ldy); /* kernel for the type of values */
+   struct primme_csr *At;     /* conjugate transpose, built on first use */
+   void *xt;                  /* spare buffer for a block of x by rows */
+   void *yt;                  /* spare buffer for the accumulators of A'*A*x */
+   int (*tosell)(void *A, int C, int sigma); /* conversion for the type */
+   int (*normal)(void *A, int aat, int k, void *x, PRIMME_INT ldx, void *y,
+         PRIMME_INT ldy);     /* A'*A or A*A' product for the type */
+
+   /* SELL-C-sigma copy of the matrix, built by primme_csr_sell */
+   int sellC;                 /* rows per chunk, or 0 if there is no copy */
+   int sellSigma;             /* rows in a sorting window */
+   int simd;                  /* kernel: 0 generic, 1 AVX2, 2 AVX-512 */
+   PRIMME_INT nchunks;        /* number of chunks */
+   int64_t *chunkptr;         /* position of the first entry of each chunk */
+   int *chunklen;             /* number of columns of each chunk */
+   int *sellcol;              /* column indices, starting at 0 */
+   void *sellval;             /* values, zero on the padding */
+   PRIMME_INT *sellrow;       /* row of A of each row in the chunks, or -1 */
+};
+
+/* The same matrix may be applied by several threads at once, as in        */
+/* dprimme_batch and dprimme_slicing. So the products don't write on A:    */
+/* a product takes the spare buffer out of A with an atomic exchange, or    */
+/* allocates one if there is none, and puts it back at the end; and the     */
+/* transpose is built aside and published with a compare-and-swap. Without */
+/* the GCC atomic builtins, every product allocates its buffers, and the    */
+/* first product by A' should not run concurrently with another one.        */
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define CSR_XCHG(P, V) __atomic_exchange_n((P), (V), __ATOMIC_ACQ_REL)
+#  define CSR_LOAD(P) __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#  define CSR_CAS(P, E, V)                                                     \
+      __atomic_compare_exchange_n(                                             \
+            (P), (E), (V), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#  define CSR_XCHG(P, V) (V)
+#  define CSR_LOAD(P) (*(P))
+#  define CSR_CAS(P, E, V) (*(P) = (V), 1)
+#endif
+
+/* The size of the buffer is stored before the returned pointer, in a      */
+/* header that keeps the alignment of malloc                               */
+
+#define CSR_BUFFER_HEADER 32
+
+/* Return a buffer of at least size bytes, taken from slot if it is large  */
+/* enough; the content is not preserved                                    */
+
+static void *csr_buffer_take(void **slot, size_t size) {
+   char *buf = (char *)CSR_XCHG(slot, NULL);
+   if (buf && *(size_t *)buf >= size) return buf + CSR_BUFFER_HEADER;
+   free(buf);
+   buf = (char *)malloc(size + CSR_BUFFER_HEADER);
+   if (!buf) return NULL;
+   *(size_t *)buf = size;
+   return buf + CSR_BUFFER_HEADER;
+}
+
+/* Keep the buffer in slot for the next product */
+
+static void csr_buffer_release(void **slot, void *buf) {
+   if (!buf) return;
+   free(CSR_XCHG(slot, (void *)((char *)buf - CSR_BUFFER_HEADER)));
+}
+
+/* Row length and index, for sorting rows inside a window */
+
+typedef struct {
+   PRIMME_INT len, row;
+} sell_row_t;
+
+static int sell_row_cmp(const void *a, const void *b) {
+   const sell_row_t *ra = (const sell_row_t *)a, *rb = (const sell_row_t *)b;
+   if (ra->len != rb->len) return ra->len < rb->len ? 1 : -1;
+   return ra->row < rb->row ? -1 : (ra->row > rb->row);
+}
+
+/* Free the SELL-C-sigma copy of A */
+
+static void sell_free(struct primme_csr *A) {
+   free(A->chunkptr);
+   free(A->chunklen);
+   free(A->sellcol);
+   free(A->sellval);
+   free(A->sellrow);
+   A->chunkptr = NULL;
+   A->chunklen = NULL;
+   A->sellcol = NULL;
+   A->sellval = NULL;
+   A->sellrow = NULL;
+   A->sellC = 0;
+   A->nchunks = 0;
+}
+
+#ifdef SELL_X86
+
+/* Compute y = A*x for the chunks of A in SELL-C-sigma, with C multiple of   */
+/* 4 (AVX2) or 8 (AVX-512). The lanes hold consecutive rows of a chunk; the */
+/* entries of x are gathered with the column indices of the lanes.          */
+
+__attribute__((target("avx2,fma")))
+static void sell_rows_avx2(struct primme_csr *A, int k, const double *x,
+      PRIMME_INT ldx, double *y, PRIMME_INT ldy) {
+
+   PRIMME_INT c;
+   CSR_PARALLEL_FOR
+   for (c = 0; c < A->nchunks; c++) {
+      const int C = A->sellC, w = A->chunklen[c];
+      const double *val = (const double *)A->sellval + A->chunkptr[c];
+      const int *col = A->sellcol + A->chunkptr[c];
+      const PRIMME_INT *row = &A->sellrow[c * C];
+      int v, r0, j, r;
+      for (v = 0; v < k; v++) {
+         const double *xv = &x[ldx * v];
+         for (r0 = 0; r0 < C; r0 += 4) {
+            __m256d acc = _mm256_setzero_pd();
+            double t[4];
+            for (j = 0; j < w; j++) {
+               __m128i ci = _mm_loadu_si128((const __m128i *)&col[j * C + r0]);
+               acc = _mm256_fmadd_pd(_mm256_loadu_pd(&val[j * C + r0]),
+                     _mm256_mask_i32gather_pd(_mm256_setzero_pd(), xv, ci,
+                           _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8),
+                     acc);
+            }
+            _mm256_storeu_pd(t, acc);
+            for (r = 0; r < 4; r++) {
+               if (row[r0 + r] >= 0) y[row[r0 + r] + ldy * v] = t[r];
+            }
+         }
+      }
+   }
+}
+
+__attribute__((target("avx512f")))
+static void sell_rows_avx512(struct primme_csr *A, int k, const double *x,
+      PRIMME_INT ldx, double *y, PRIMME_INT ldy) {
+
+   PRIMME_INT c;
+   CSR_PARALLEL_FOR
+   for (c = 0; c < A->nchunks; c++) {
+      const int C = A->sellC, w = A->chunklen[c];
+      const double *val = (const double *)A->sellval + A->chunkptr[c];
+      const int *col = A->sellcol + A->chunkptr[c];
+      const PRIMME_INT *row = &A->sellrow[c * C];
+      int v, r0, j, r;
+      for (v = 0; v < k; v++) {
+         const double *xv = &x[ldx * v];
+         for (r0 = 0; r0 < C; r0 += 8) {
+            __m512d acc = _mm512_setzero_pd();
+            double t[8];
+            for (j = 0; j < w; j++) {
+               __m256i ci =
+                     _mm256_loadu_si256((const __m256i *)&col[j * C + r0]);
+               acc = _mm512_fmadd_pd(_mm512_loadu_pd(&val[j * C + r0]),
+                     _mm512_mask_i32gather_pd(
+                           _mm512_setzero_pd(), 0xff, ci, xv, 8),
+                     acc);
+            }
+            _mm512_storeu_pd(t, acc);
+            for (r = 0; r < 8; r++) {
+               if (row[r0 + r] >= 0) y[row[r0 + r] + ldy * v] = t[r];
+            }
+         }
+      }
+   }
+}
+
+#endif /* SELL_X86 */
+
+#define Xprimme_csr_create CONCAT(SCALAR_SUF,_csr_create)
+#define Xprimme_csr_create64 CONCAT(SCALAR_SUF,_csr_create64)
+
+#endif /* CSR_PRIVATE_H */
+
+#ifdef SUPPORTED_TYPE
+
+#if defined(USE_HOST) && !defined(USE_HALF) && !defined(USE_HALFCOMPLEX)
+
+/* Compute y(:,0:kb-1) = A * x(:,0:kb-1), where x is stored by rows in xt   */
+/* with leading dimension ldxt. Every nonzero is loaded once for all kb     */
+/* columns, and the innermost loop has unit stride on xt and acc.           */
+
+#define CSR_ROWS(IT)                                                           \
+   {                                                                           \
+      const IT *rowptr = (const IT *)A->rowptr;                                \
+      const IT *colind = (const IT *)A->colind;                                \
+      PRIMME_INT i;                                                            \
+      CSR_PARALLEL_FOR                                                         \
+      for (i = 0; i < A->m; i++) {                                             \
+         SCALAR acc[CSR_BLOCK];                                                \
+         PRIMME_INT p, p1 = (PRIMME_INT)rowptr[i + 1] - A->base;               \
+         int j;                                                                \
+         for (j = 0; j < kb; j++) acc[j] = 0.0;                                \
+         for (p = (PRIMME_INT)rowptr[i] - A->base; p < p1; p++) {              \
+            const SCALAR a = values[p];                                        \
+            const SCALAR *xr =                                                 \
+                  &xt[((PRIMME_INT)colind[p] - A->base) * ldxt];               \
+            for (j = 0; j < kb; j++) acc[j] += a * xr[j];                      \
+         }                                                                     \
+         for (j = 0; j < kb; j++) y[i + ldy * j] = acc[j];                     \
+      }                                                                        \
+   }
+
+/*******************************************************************************
+ * Subroutine csr_rows - Compute a block of at most CSR_BLOCK columns of A*x
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * A_          The primme_csr
+ * kb          Number of columns
+ * xt_         The block of x stored by rows
+ * ldxt        Leading dimension of xt
+ * ldy         Leading dimension of y
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * y_          The result
+ *
+ ******************************************************************************/
+
+STATIC void csr_rows(
+      void *A_, int kb, void *xt_, PRIMME_INT ldxt, void *y_, PRIMME_INT ldy) {
+
+   struct primme_csr *A = (struct primme_csr *)A_;
+   const SCALAR *values = (const SCALAR *)A->values;
+   const SCALAR *xt = (const SCALAR *)xt_;
+   SCALAR *y = (SCALAR *)y_;
+
+   if (A->index64) {
+      CSR_ROWS(int64_t);
+   } else {
+      CSR_ROWS(int);
+   }
+}
+
+/* Build the conjugate transpose of A with int64_t indices starting at 0   */
+
+#define CSR_TRANSPOSE(IT)                                                      \
+   {                                                                           \
+      const IT *rowptr = (const IT *)A->rowptr;                                \
+      const IT *colind = (const IT *)A->colind;                                \
+      for (i = 0; i < A->m; i++) {                                             \
+         PRIMME_INT p;                                                         \
+         for (p = rowptr[i] - A->base; p < rowptr[i + 1] - A->base; p++)       \
+            trowptr[colind[p] - A->base + 1]++;                                \
+      }                                                                        \
+      for (i = 0; i < A->n; i++) trowptr[i + 1] += trowptr[i];                 \
+      for (i = 0; i < A->m; i++) {                                             \
+         PRIMME_INT p;                                                         \
+         for (p = rowptr[i] - A->base; p < rowptr[i + 1] - A->base; p++) {     \
+            int64_t q = trowptr[colind[p] - A->base]++;                        \
+            tcolind[q] = i;                                                    \
+            tvalues[q] = CONJ(values[p]);                                      \
+         }                                                                     \
+      }                                                                        \
+      for (i = A->n; i > 0; i--) trowptr[i] = trowptr[i - 1];                  \
+      trowptr[0] = 0;                                                          \
+   }
+
+/*******************************************************************************
+ * Subroutine csr_transpose - Set A->At to the conjugate transpose of A, if
+ *    it is not set yet. It may be called concurrently.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * A_          The primme_csr
+ *
+ * RETURN
+ * ----------------------------------
+ * error code
+ *
+ ******************************************************************************/
+
+STATIC int csr_transpose(void *A_) {
+
+   struct primme_csr *A = (struct primme_csr *)A_;
+   const SCALAR *values = (const SCALAR *)A->values;
+   PRIMME_INT nnz, i;
+
+   nnz = A->index64 ? ((const int64_t *)A->rowptr)[A->m] - A->base
+                    : ((const int *)A->rowptr)[A->m] - A->base;
+
+   int64_t *trowptr = (int64_t *)calloc(A->n + 1, sizeof(int64_t));
+   int64_t *tcolind = (int64_t *)malloc(sizeof(int64_t) * (nnz + 1));
+   SCALAR *tvalues = (SCALAR *)malloc(sizeof(SCALAR) * (nnz + 1));
+   if (!trowptr || !tcolind || !tvalues) {
+      free(trowptr);
+      free(tcolind);
+      free(tvalues);
+      return PRIMME_MALLOC_FAILURE;
+   }
+
+   if (A->index64) {
+      CSR_TRANSPOSE(int64_t);
+   } else {
+      CSR_TRANSPOSE(int);
+   }
+
+   struct primme_csr *At = (struct primme_csr *)csr_create(
+         A->n, A->m, trowptr, tcolind, tvalues, 1 /* index64 */, 0 /* base */);
+   if (!At) {
+      free(trowptr);
+      free(tcolind);
+      free(tvalues);
+      return PRIMME_MALLOC_FAILURE;
+   }
+   At->owned = 1;
+
+   /* Build the SELL-C-sigma copy of A' if A has one */
+
+   if (A->sellC) {
+      int ierr = csr_to_sell(At, A->sellC, A->sellSigma);
+      if (ierr) {
+         primme_csr_destroy((primme_csr *)At);
+         return ierr;
+      }
+   }
+
+   /* Publish A', unless another thread did it first */
+
+   struct primme_csr *none = NULL;
+   if (!CSR_CAS(&A->At, &none, At)) primme_csr_destroy((primme_csr *)At);
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine sell_rows - Compute y = A*x with the SELL-C-sigma copy of A
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * A_          The primme_csr
+ * k           Number of columns of x and y
+ * x_          The input block of vectors
+ * ldx         Leading dimension of x
+ * ldy         Leading dimension of y
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * y_          The result
+ *
+ ******************************************************************************/
+
+STATIC void sell_rows(
+      void *A_, int k, void *x_, PRIMME_INT ldx, void *y_, PRIMME_INT ldy) {
+
+   struct primme_csr *A = (struct primme_csr *)A_;
+   const SCALAR *x = (const SCALAR *)x_;
+   SCALAR *y = (SCALAR *)y_;
+   PRIMME_INT c;
+
+#if defined(USE_DOUBLE) && defined(SELL_X86)
+   if (A->simd == 2) {
+      sell_rows_avx512(A, k, x, ldx, y, ldy);
+      return;
+   }
+   if (A->simd == 1) {
+      sell_rows_avx2(A, k, x, ldx, y, ldy);
+      return;
+   }
+#endif
+
+   /* The chunk is read from memory for the first vector and from cache for */
+   /* the rest; the loop over the rows of the chunk is the vectorized one.  */
+
+   CSR_PARALLEL_FOR
+   for (c = 0; c < A->nchunks; c++) {
+      const int C = A->sellC, w = A->chunklen[c];
+      const SCALAR *val = (const SCALAR *)A->sellval + A->chunkptr[c];
+      const int *col = A->sellcol + A->chunkptr[c];
+      const PRIMME_INT *row = &A->sellrow[c * C];
+      int v, j, r;
+      for (v = 0; v < k; v++) {
+         const SCALAR *xv = &x[ldx * v];
+         SCALAR acc[SELL_MAX_C];
+         for (r = 0; r < C; r++) acc[r] = 0.0;
+         for (j = 0; j < w; j++) {
+            for (r = 0; r < C; r++) acc[r] += val[j * C + r] * xv[col[j * C + r]];
+         }
+         for (r = 0; r < C; r++) {
+            if (row[r] >= 0) y[row[r] + ldy * v] = acc[r];
+         }
+      }
+   }
+}
+
+#define CSR_ROW_LEN(IT, i)                                                     \
+   ((PRIMME_INT)((const IT *)A->rowptr)[(i) + 1] -                             \
+         (PRIMME_INT)((const IT *)A->rowptr)[i])
+#define CSR_ROW_START(IT, i) ((PRIMME_INT)((const IT *)A->rowptr)[i] - A->base)
+#define CSR_COL(IT, p) ((int)(((const IT *)A->colind)[p] - A->base))
+
+/*******************************************************************************
+ * Subroutine csr_to_sell - Build the SELL-C-sigma copy of A
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * A_          The primme_csr
+ * C           Number of rows in a chunk
+ * sigma       Number of rows in a window sorted by row length
+ *
+ * RETURN
+ * ----------------------------------
+ * error code
+ *
+ ******************************************************************************/
+
+STATIC int csr_to_sell(void *A_, int C, int sigma) {
+
+   struct primme_csr *A = (struct primme_csr *)A_;
+   const SCALAR *values = (const SCALAR *)A->values;
+   PRIMME_INT i, c, nchunks;
+
+   if (C <= 0) C = SELL_DEFAULT_C;
+   if (sigma <= 0) sigma = SELL_DEFAULT_SIGMA;
+   if (C > SELL_MAX_C || A->n > INT_MAX) return PRIMME_FUNCTION_UNAVAILABLE;
+   sigma = (sigma + C - 1) / C * C;
+
+   sell_free(A);
+   nchunks = (A->m + C - 1) / C;
+
+   /* Sort the rows by decreasing length inside every window of sigma rows */
+
+   sell_row_t *rows = (sell_row_t *)malloc(sizeof(sell_row_t) * (A->m + 1));
+   A->chunkptr = (int64_t *)malloc(sizeof(int64_t) * (nchunks + 1));
+   A->chunklen = (int *)malloc(sizeof(int) * (nchunks + 1));
+   A->sellrow = (PRIMME_INT *)malloc(sizeof(PRIMME_INT) * (nchunks * C + 1));
+   if (!rows || !A->chunkptr || !A->chunklen || !A->sellrow) {
+      free(rows);
+      sell_free(A);
+      return PRIMME_MALLOC_FAILURE;
+   }
+   for (i = 0; i < A->m; i++) {
+      rows[i].len = A->index64 ? CSR_ROW_LEN(int64_t, i) : CSR_ROW_LEN(int, i);
+      rows[i].row = i;
+   }
+   for (i = 0; i < A->m; i += sigma) {
+      qsort(&rows[i], min(sigma, A->m - i), sizeof(sell_row_t), sell_row_cmp);
+   }
+
+   /* Chunks are as wide as their longest row */
+
+   A->chunkptr[0] = 0;
+   for (c = 0; c < nchunks; c++) {
+      PRIMME_INT w = 0;
+      for (i = c * C; i < min((c + 1) * C, A->m); i++) w = max(w, rows[i].len);
+      if (w > INT_MAX) {
+         free(rows);
+         sell_free(A);
+         return PRIMME_FUNCTION_UNAVAILABLE;
+      }
+      A->chunklen[c] = (int)w;
+      A->chunkptr[c + 1] = A->chunkptr[c] + w * C;
+   }
+
+   A->sellcol = (int *)malloc(sizeof(int) * (A->chunkptr[nchunks] + 1));
+   A->sellval = malloc(sizeof(SCALAR) * (A->chunkptr[nchunks] + 1));
+   if (!A->sellcol || !A->sellval) {
+      free(rows);
+      sell_free(A);
+      return PRIMME_MALLOC_FAILURE;
+   }
+
+   /* Copy the rows by columns into the chunks; the padding multiplies x[0] */
+   /* by zero                                                               */
+
+   for (c = 0; c < nchunks; c++) {
+      SCALAR *val = (SCALAR *)A->sellval + A->chunkptr[c];
+      int *col = A->sellcol + A->chunkptr[c];
+      int w = A->chunklen[c], r, j;
+      for (r = 0; r < C; r++) {
+         PRIMME_INT p = 0, len = 0;
+         if (c * C + r < A->m) {
+            i = rows[c * C + r].row;
+            p = A->index64 ? CSR_ROW_START(int64_t, i) : CSR_ROW_START(int, i);
+            len = rows[c * C + r].len;
+            A->sellrow[c * C + r] = i;
+         } else {
+            A->sellrow[c * C + r] = -1;
+         }
+         for (j = 0; j < w; j++, p++) {
+            if (j < len) {
+               val[j * C + r] = values[p];
+               col[j * C + r] =
+                     A->index64 ? CSR_COL(int64_t, p) : CSR_COL(int, p);
+            } else {
+               val[j * C + r] = 0.0;
+               col[j * C + r] = 0;
+            }
+         }
+      }
+   }
+   free(rows);
+
+   A->sellC = C;
+   A->sellSigma = sigma;
+   A->nchunks = nchunks;
+   A->simd = 0;
+#if defined(USE_DOUBLE) && defined(SELL_X86)
+   if (C % 8 == 0 && __builtin_cpu_supports("avx512f")) {
+      A->simd = 2;
+   } else if (C % 4 == 0 && __builtin_cpu_supports("avx2") &&
+              __builtin_cpu_supports("fma")) {
+      A->simd = 1;
+   }
+#endif
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine csr_apply - Compute y = A*x or y = A'*x
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * A_          The primme_csr
+ * transpose   If nonzero, multiply by the conjugate transpose of A
+ * k           Number of columns of x and y
+ * x_          The input block of vectors
+ * ldx         Leading dimension of x
+ * ldy         Leading dimension of y
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * y_          The result
+ *
+ * RETURN
+ * ----------------------------------
+ * error code
+ *
+ ******************************************************************************/
+
+STATIC int csr_apply(void *A_, int transpose, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy) {
+
+   struct primme_csr *A = (struct primme_csr *)A_;
+   SCALAR *x = (SCALAR *)x_, *y = (SCALAR *)y_;
+   int j0;
+
+   if (transpose) {
+      if (!CSR_LOAD(&A->At)) {
+         int ierr = csr_transpose(A);
+         if (ierr) return ierr;
+      }
+      return csr_apply(CSR_LOAD(&A->At), 0, k, x, ldx, y, ldy);
+   }
+
+   if (A->sellC) {
+      sell_rows(A, k, x, ldx, y, ldy);
+      return 0;
+   }
+
+   SCALAR *xt = NULL;
+   for (j0 = 0; j0 < k; j0 += CSR_BLOCK) {
+      int kb = min(CSR_BLOCK, k - j0), j;
+      PRIMME_INT c;
+
+      /* A single vector is read in place. Otherwise copy the block of x by */
+      /* rows, so that the kb values multiplied by a nonzero are contiguous */
+
+      if (kb == 1) {
+         csr_rows(A, 1, &x[ldx * j0], 1, &y[ldy * j0], ldy);
+         continue;
+      }
+
+      if (!xt) {
+         xt = (SCALAR *)csr_buffer_take(
+               &A->xt, sizeof(SCALAR) * (size_t)A->n * min(CSR_BLOCK, k));
+         if (!xt) return PRIMME_MALLOC_FAILURE;
+      }
+      for (c = 0; c < A->n; c++) {
+         for (j = 0; j < kb; j++) xt[c * kb + j] = x[c + ldx * (j0 + j)];
+      }
+
+      csr_rows(A, kb, xt, kb, &y[ldy * j0], ldy);
+   }
+   csr_buffer_release(&A->xt, xt);
+
+   return 0;
+}
+
+/* Add to yt, stored by rows, A'*A*x for the block of x stored by rows in   */
+/* xt. Every row of A is read once: its product with x is kept in t, and    */
+/* the row, now in cache, is used again to accumulate its contribution.     */
+/* Every thread accumulates on its own copy of yt.                          */
+
+#define CSR_NORMAL_ROWS(IT)                                                    \
+   {                                                                           \
+      const IT *rowptr = (const IT *)A->rowptr;                                \
+      const IT *colind = (const IT *)A->colind;                                \
+      PRIMME_INT i;                                                            \
+      CSR_PARALLEL_FOR                                                         \
+      for (i = 0; i < A->m; i++) {                                             \
+         SCALAR t[CSR_BLOCK];                                                  \
+         SCALAR *ytl = &yt[(size_t)A->n * kb * CSR_THREAD_NUM];                \
+         PRIMME_INT p, p0 = (PRIMME_INT)rowptr[i] - A->base,                   \
+                       p1 = (PRIMME_INT)rowptr[i + 1] - A->base;               \
+         int j;                                                                \
+         for (j = 0; j < kb; j++) t[j] = 0.0;                                  \
+         for (p = p0; p < p1; p++) {                                           \
+            const SCALAR a = values[p];                                        \
+            const SCALAR *xr =                                                 \
+                  &xt[((PRIMME_INT)colind[p] - A->base) * kb];                 \
+            for (j = 0; j < kb; j++) t[j] += a * xr[j];                        \
+         }                                                                     \
+         for (p = p0; p < p1; p++) {                                           \
+            const SCALAR a = CONJ(values[p]);                                  \
+            SCALAR *yr = &ytl[((PRIMME_INT)colind[p] - A->base) * kb];         \
+            for (j = 0; j < kb; j++) yr[j] += a * t[j];                        \
+         }                                                                     \
+      }                                                                        \
+   }
+
+/*******************************************************************************
+ * Subroutine csr_normal - Compute y = A'*A*x or y = A*A'*x
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * A_          The primme_csr
+ * aat         If nonzero, compute A*A'*x; otherwise A'*A*x
+ * k           Number of columns of x and y
+ * x_          The input block of vectors
+ * ldx         Leading dimension of x
+ * ldy         Leading dimension of y
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * y_          The result
+ *
+ * RETURN
+ * ----------------------------------
+ * error code
+ *
+ ******************************************************************************/
+
+STATIC int csr_normal(void *A_, int aat, int k, void *x_, PRIMME_INT ldx,
+      void *y_, PRIMME_INT ldy) {
+
+   struct primme_csr *A = (struct primme_csr *)A_;
+   const SCALAR *values = (const SCALAR *)A->values;
+   SCALAR *x = (SCALAR *)x_, *y = (SCALAR *)y_;
+   int nt = CSR_NUM_THREADS(A), j0, ierr;
+
+   /* A*A' is (A')'*(A') */
+
+   if (aat) {
+      if (!CSR_LOAD(&A->At) && (ierr = csr_transpose(A))) return ierr;
+      return csr_normal(CSR_LOAD(&A->At), 0, k, x, ldx, y, ldy);
+   }
+
+   if (k <= 0) return 0;
+   size_t nkbmax = (size_t)A->n * min(CSR_BLOCK, k);
+   SCALAR *xt = (SCALAR *)csr_buffer_take(&A->xt, sizeof(SCALAR) * nkbmax);
+   SCALAR *yt =
+         (SCALAR *)csr_buffer_take(&A->yt, sizeof(SCALAR) * nkbmax * nt);
+   if (!xt || !yt) {
+      csr_buffer_release(&A->xt, xt);
+      csr_buffer_release(&A->yt, yt);
+      return PRIMME_MALLOC_FAILURE;
+   }
+
+   for (j0 = 0; j0 < k; j0 += CSR_BLOCK) {
+      int kb = min(CSR_BLOCK, k - j0), j, t;
+      size_t nkb = (size_t)A->n * kb;
+      PRIMME_INT c;
+
+      for (c = 0; c < A->n; c++) {
+         for (j = 0; j < kb; j++) xt[c * kb + j] = x[c + ldx * (j0 + j)];
+      }
+      for (c = 0; c < (PRIMME_INT)nkb * nt; c++) yt[c] = 0.0;
+
+      if (A->index64) {
+         CSR_NORMAL_ROWS(int64_t);
+      } else {
+         CSR_NORMAL_ROWS(int);
+      }
+
+      for (c = 0; c < A->n; c++) {
+         for (j = 0; j < kb; j++) {
+            SCALAR s = yt[c * kb + j];
+            for (t = 1; t < nt; t++) s += yt[nkb * t + c * kb + j];
+            y[c + ldy * (j0 + j)] = s;
+         }
+      }
+   }
+   csr_buffer_release(&A->xt, xt);
+   csr_buffer_release(&A->yt, yt);
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine csr_create - Allocate a primme_csr for the current type
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * m, n        Number of rows and columns
+ * rowptr      Row pointers, an array of size m+1
+ * colind      Column indices, an array of size rowptr[m]-base
+ * values      Nonzero values, an array of size rowptr[m]-base
+ * index64     Whether rowptr and colind are int64_t instead of int
+ * base        Index of the first row and column, 0 or 1
+ *
+ * RETURN
+ * ----------------------------------
+ * the new primme_csr, or NULL if the input is invalid or malloc failed
+ *
+ ******************************************************************************/
+
+STATIC void *csr_create(PRIMME_INT m, PRIMME_INT n, const void *rowptr,
+      const void *colind, const void *values, int index64, int base) {
+
+   if (m < 0 || n < 0 || !rowptr || (base != 0 && base != 1)) return NULL;
+
+   struct primme_csr *A =
+         (struct primme_csr *)malloc(sizeof(struct primme_csr));
+   if (!A) return NULL;
+   A->m = m;
+   A->n = n;
+   A->rowptr = rowptr;
+   A->colind = colind;
+   A->values = values;
+   A->index64 = index64;
+   A->base = base;
+   A->owned = 0;
+   A->apply = csr_apply;
+   A->At = NULL;
+   A->xt = NULL;
+   A->yt = NULL;
+   A->normal = csr_normal;
+   A->tosell = csr_to_sell;
+   A->sellC = 0;
+   A->sellSigma = 0;
+   A->simd = 0;
+   A->nchunks = 0;
+   A->chunkptr = NULL;
+   A->chunklen = NULL;
+   A->sellcol = NULL;
+   A->sellval = NULL;
+   A->sellrow = NULL;
+   return A;
+}
+
+primme_csr *Xprimme_csr_create(PRIMME_INT m, PRIMME_INT n, const int *rowptr,
+      const int *colind, const XSCALAR *values, int base) {
+   return (primme_csr *)csr_create(m, n, rowptr, colind, values, 0, base);
+}
+
+primme_csr *Xprimme_csr_create64(PRIMME_INT m, PRIMME_INT n,
+      const int64_t *rowptr, const int64_t *colind, const XSCALAR *values,
+      int base) {
+   return (primme_csr *)csr_create(m, n, rowptr, colind, values, 1, base);
+}
+
+#endif /* USE_HOST && !USE_HALF && !USE_HALFCOMPLEX */
+
+#ifdef USE_DOUBLE
+
+/*******************************************************************************
+ * Function primme_csr_apply - Compute y = A*x or, if transpose is nonzero,
+ *    y = A'*x, where A' is the conjugate transpose of A. The vectors have
+ *    the precision of the values given to the create function. The first
+ *    product by A' builds A' and keeps it until primme_csr_destroy.
+ *    Several threads may apply the same A at once.
+ *
+ * RETURN
+ * ----------------------------------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_csr_apply(primme_csr *A, int transpose, int blockSize, void *x,
+      PRIMME_INT ldx, void *y, PRIMME_INT ldy) {
+
+   if (!A || blockSize < 0 || ldx < (transpose ? A->m : A->n) ||
+         ldy < (transpose ? A->n : A->m)) {
+      return PRIMME_FUNCTION_UNAVAILABLE;
+   }
+   return A->apply(A, transpose, blockSize, x, ldx, y, ldy);
+}
+
+/*******************************************************************************
+ * Function primme_csr_apply_normal - Compute y = A'*A*x or, if aat is
+ *    nonzero, y = A*A'*x, reading every nonzero of A once for up to
+ *    CSR_BLOCK columns of x. The product with A*A' builds A' the first time.
+ *
+ * RETURN
+ * ----------------------------------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_csr_apply_normal(primme_csr *A, int aat, int blockSize, void *x,
+      PRIMME_INT ldx, void *y, PRIMME_INT ldy) {
+
+   if (!A || blockSize < 0 || ldx < (aat ? A->m : A->n) ||
+         ldy < (aat ? A->m : A->n)) {
+      return PRIMME_FUNCTION_UNAVAILABLE;
+   }
+   return A->normal(A, aat, blockSize, x, ldx, y, ldy);
+}
+
+/*******************************************************************************
+ * Function primme_csr_sell - Store A also in SELL-C-sigma format, which is
+ *    used from then on for the products with A and A'. If C or sigma are
+ *    not positive, take the default values. It should not be called while
+ *    A is being applied.
+ *
+ * RETURN
+ * ----------------------------------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_csr_sell(primme_csr *A, int C, int sigma) {
+
+   int ierr;
+
+   if (!A) return PRIMME_FUNCTION_UNAVAILABLE;
+   if ((ierr = A->tosell(A, C, sigma))) return ierr;
+
+   /* A' is built again with the SELL copy the next time it is needed */
+
+   primme_csr_destroy(A->At);
+   A->At = NULL;
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine primme_csr_matvec - matrixMatvec for primme_params that
+ *    multiplies by the primme_csr in primme->matrix
+ *
+ ******************************************************************************/
+
+void primme_csr_matvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
+      int *blockSize, primme_params *primme, int *ierr) {
+
+   primme_csr *A = (primme_csr *)primme->matrix;
+
+   if (!A || A->m != primme->n || A->n != primme->n ||
+         primme->nLocal != primme->n) {
+      *ierr = PRIMME_FUNCTION_UNAVAILABLE;
+      return;
+   }
+   *ierr = A->apply(A, 0, *blockSize, x, *ldx, y, *ldy);
+}
+
+/*******************************************************************************
+ * Subroutine primme_csr_svds_matvec - matrixMatvec for primme_svds_params
+ *    that multiplies by the primme_csr in primme_svds->matrix
+ *
+ ******************************************************************************/
+
+void primme_csr_svds_matvec(void *x, PRIMME_INT *ldx, void *y,
+      PRIMME_INT *ldy, int *blockSize, int *transpose,
+      primme_svds_params *primme_svds, int *ierr) {
+
+   primme_csr *A = (primme_csr *)primme_svds->matrix;
+
+   if (!A || A->m != primme_svds->m || A->n != primme_svds->n ||
+         primme_svds->mLocal != primme_svds->m ||
+         primme_svds->nLocal != primme_svds->n) {
+      *ierr = PRIMME_FUNCTION_UNAVAILABLE;
+      return;
+   }
+   *ierr = A->apply(A, *transpose, *blockSize, x, *ldx, y, *ldy);
+}
+
+/*******************************************************************************
+ * Subroutine primme_csr_svds_normal_matvec - matrixNormalMatvec for
+ *    primme_svds_params that multiplies by A'*A or A*A', being A the
+ *    primme_csr in primme_svds->matrix, reading A once per block of vectors
+ *
+ ******************************************************************************/
+
+void primme_csr_svds_normal_matvec(void *x, PRIMME_INT *ldx, void *y,
+      PRIMME_INT *ldy, int *blockSize, int *mode,
+      primme_svds_params *primme_svds, int *ierr) {
+
+   primme_csr *A = (primme_csr *)primme_svds->matrix;
+
+   if (!A || A->m != primme_svds->m || A->n != primme_svds->n ||
+         primme_svds->mLocal != primme_svds->m ||
+         primme_svds->nLocal != primme_svds->n ||
+         (*mode != primme_svds_op_AtA && *mode != primme_svds_op_AAt)) {
+      *ierr = PRIMME_FUNCTION_UNAVAILABLE;
+      return;
+   }
+   *ierr = A->normal(A, *mode == primme_svds_op_AAt, *blockSize, x, *ldx, y,
+         *ldy);
+}
+
+/*******************************************************************************
+ * Function primme_csr_destroy - Free the primme_csr, but not the arrays
+ *    passed to the create function
+ *
+ ******************************************************************************/
+
+int primme_csr_destroy(primme_csr *A) {
+
+   if (!A) return 0;
+   primme_csr_destroy(A->At);
+   if (A->owned) {
+      free((void *)A->rowptr);
+      free((void *)A->colind);
+      free((void *)A->values);
+   }
+   sell_free(A);
+   free(A->xt);
+   free(A->yt);
+   free(A);
+   return 0;
+}
+
+#endif /* USE_DOUBLE */
+
+#endif /* SUPPORTED_TYPE */
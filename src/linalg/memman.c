@@ -30,7 +30,7 @@
  * File: memman.c
  *
  * Purpose - Define functions to track allocated memory and free them in
- *           case of error.
+ *           case of error, and a per-solve arena for the allocations.
  *
  ******************************************************************************/
 
@@ -38,12 +38,219 @@
 #define THIS_FILE "../linalg/memman.c"
 #endif
 
+#if !defined(_GNU_SOURCE) && defined(__linux__)
+#define _GNU_SOURCE   /* sync_file_range */
+#endif
+
 #include <stdlib.h>   /* free */
+#include <stdint.h>   /* uintptr_t */
+#include <string.h>   /* strerror */
+#include <errno.h>
 #include <assert.h>
 #include <math.h>
 #include "common.h"
 #include "memman.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#  define USE_MMAP
+#  include <unistd.h>     /* mkstemp, ftruncate, unlink, close, sysconf */
+#  include <fcntl.h>      /* sync_file_range */
+#  include <sys/mman.h>   /* mmap, munmap, madvise */
+#endif
+
+
+/* Every block returned by Mem_malloc is preceded by a header. The header    */
+/* holds the register of the block in the frames, so registering the block  */
+/* does not allocate memory. If the context has an arena, the block is      */
+/* taken from the arena, which is a stack of chunks: the block is pushed on */
+/* the chunk on top, or on the next one if it has no room. A block freed on */
+/* top of the stack is returned to the chunk along with the freed blocks    */
+/* below it, and the emptied chunks are kept for the next pushes. As blocks */
+/* are freed in reverse order of allocation most of the time, after the     */
+/* first iterations the chunks are enough to serve all allocations and no   */
+/* more memory is asked to malloc.                                          */
+/*                                                                          */
+/* Every block also records the bytes taken by the blocks below it, as if   */
+/* all blocks were in a single chunk. The largest of these amounts is the   */
+/* size of the workspace that would serve the same allocations without      */
+/* asking memory to malloc.                                                 */
+/*                                                                          */
+/* In a dry arena the blocks only take room for their header, but they are */
+/* accounted with their full size. The workspace queries replay on it the   */
+/* allocations of a solve, and take the size from the largest amount.      */
+
+typedef struct {
+   primme_alloc a;               /* Register of the block */
+   primme_arena_chunk *chunk;    /* Chunk with the block, or NULL */
+   size_t prev;                  /* Offset of the previous block + 1, or 0 */
+   size_t used;                  /* Bytes taken by the blocks below */
+   int freed;                    /* Whether the block has been freed */
+} primme_block;
+
+#define BLOCK_ALIGN 64
+#define ALIGN_SIZE(S) (((S) + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN)
+#define BLOCK_HEADER_SIZE ALIGN_SIZE(sizeof(primme_block))
+#define ARENA_CHUNK_SIZE ((size_t)1 << 20)
+#define ARENA_HEADER_SIZE                                                      \
+   ALIGN_SIZE(sizeof(primme_arena) + sizeof(primme_arena_chunk))
+
+/*******************************************************************************
+ * Subroutine arena_alloc - Return a block of memory from the arena.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * arena    arena
+ * size     size of the block in bytes, excluding the header
+ *
+ * RETURN VALUE
+ * ------------
+ * the header of the block, or NULL if there is no memory
+ *
+ ******************************************************************************/
+
+static primme_block *arena_alloc(primme_arena *arena, size_t size) {
+
+   size_t need = BLOCK_HEADER_SIZE + ALIGN_SIZE(size);
+   size_t take = arena->dryRun ? BLOCK_HEADER_SIZE : need;
+
+   /* If the chunk on top has no room, move to the next chunk. The chunks */
+   /* after the top are empty; replace the next one if it is too small    */
+
+   primme_arena_chunk *c = arena->top;
+   if (!c || c->size - c->top < take) {
+      primme_arena_chunk **next = c ? &c->next : &arena->chunks;
+      primme_arena_chunk *n = *next;
+      if (!n || n->size < take) {
+         primme_arena_chunk *n_next = n ? n->next : NULL;
+         if (n) free(n);
+         size_t csize = max(take, ARENA_CHUNK_SIZE);
+         n = (primme_arena_chunk *)malloc(
+               sizeof(primme_arena_chunk) + BLOCK_ALIGN + csize);
+         if (!n) {
+            *next = n_next;
+            return NULL;
+         }
+         arena->numHeapAllocs++;
+         n->base = (char *)ALIGN_SIZE((uintptr_t)(n + 1));
+         n->size = csize;
+         n->top = n->last = 0;
+         n->external = 0;
+         n->arena = arena;
+         n->next = n_next;
+         *next = n;
+      }
+      n->prev = c;
+      arena->top = c = n;
+   }
+
+   /* Push the block on the chunk */
+
+   primme_block *b = (primme_block *)(c->base + c->top);
+   b->chunk = c;
+   b->prev = c->last;
+   b->used = arena->used;
+   b->freed = 0;
+   c->last = c->top + 1;
+   c->top += take;
+   arena->used += need;
+   arena->peak = max(arena->peak, arena->used);
+
+   return b;
+}
+
+/*******************************************************************************
+ * Subroutine free_block - Free a block returned by Mem_malloc.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * p        pointer returned by Mem_malloc
+ * ctx      context
+ *
+ ******************************************************************************/
+
+static int free_block(void *p, primme_context ctx) {
+   (void)ctx;
+
+   primme_block *b = (primme_block *)((char *)p - BLOCK_HEADER_SIZE);
+   primme_arena_chunk *c = b->chunk;
+
+   if (!c) {
+      free(b);
+      return 0;
+   }
+
+   /* Pop from the stack the freed blocks on top, moving to the chunk */
+   /* below when a chunk gets empty                                   */
+
+   primme_arena *arena = c->arena;
+   b->freed = 1;
+   for (c = arena->top; c; c = arena->top) {
+      if (c->last) {
+         primme_block *l = (primme_block *)(c->base + c->last - 1);
+         if (!l->freed) break;
+         c->top = c->last - 1;
+         c->last = l->prev;
+         arena->used = l->used;
+      } else if (c->prev) {
+         arena->top = c->prev;
+      } else {
+         break;
+      }
+   }
+
+   return 0;
+}
+
+/* Mem_map places a block in a file mapped in memory, so that arrays larger  */
+/* than the RAM can be used. The mappings are listed in the arena, so that   */
+/* Mem_free and Mem_stream_rows can tell them apart from the other blocks.   */
+
+/*******************************************************************************
+ * Function find_map - Return the mapping that contains the pointer, or NULL.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * p        pointer
+ * ctx      context
+ *
+ ******************************************************************************/
+
+static primme_map *find_map(void *p, primme_context ctx) {
+
+   if (!ctx.arena) return NULL;
+
+   primme_map *mp;
+   for (mp = ctx.arena->maps; mp; mp = mp->next) {
+      if (mp->base <= (char *)p && (char *)p < mp->base + mp->size) break;
+   }
+   return mp;
+}
+
+/*******************************************************************************
+ * Subroutine unmap_block - Free a block returned by Mem_map.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * p        pointer returned by Mem_map
+ * ctx      context
+ *
+ ******************************************************************************/
+
+static int unmap_block(void *p, primme_context ctx) {
+
+   primme_map *mp = find_map(p, ctx), **prev;
+   assert(mp && mp->base == (char *)p);
+   for (prev = &ctx.arena->maps; *prev != mp; prev = &(*prev)->next);
+   *prev = mp->next;
+
+#ifdef USE_MMAP
+   munmap(mp->base, mp->size);
+   close(mp->fd);
+#endif
+   free(mp);
+
+   return 0;
+}
 
 /*******************************************************************************
  * Subroutine Mem_push_frame - Push a new frame in the context.
@@ -175,8 +382,9 @@ int Mem_pop_clean_frame(primme_context ctx) {
    if (ctx.mm) ctx.mm->prev_alloc = NULL;
    while (a) {
       primme_alloc *a_prev = a->prev;
-      if (a->p) a->free_fn(a->p, ctx);
-      free(a);
+      free_fn_type free_fn = a->free_fn;
+      if (a->p) free_fn(a->p, ctx);
+      if (free_fn != free_block) free(a); /* a is in the block otherwise */
       a = a_prev;
    }
 
@@ -264,7 +472,470 @@ int Mem_deregister_alloc(void *p, primme_context ctx) {
 
    assert(a);
    *prev = a->prev;
-   free(a);
+   if (a->free_fn != free_block) free(a);
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_create_arena - Set a new arena in the context. The following
+ *    calls to Mem_malloc with the context take the memory from the arena.
+ *    If a workspace is given, the arena takes the memory from it first, and
+ *    only calls malloc when the workspace has no room.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * workspace   memory owned by the caller, or NULL
+ * lworkspace  size of workspace in bytes
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_create_arena(void *workspace, size_t lworkspace, primme_context *ctx) {
+
+   primme_arena *arena;
+   primme_arena_chunk *c = NULL;
+
+   /* The arena and the first chunk are placed at the beginning of the */
+   /* workspace, if it is large enough                                 */
+
+   arena = Mem_workspace_arena(workspace, lworkspace);
+   if (arena) {
+      c = (primme_arena_chunk *)(arena + 1);
+      c->base = (char *)arena + ARENA_HEADER_SIZE;
+      c->size = lworkspace - (size_t)((char *)arena - (char *)workspace) -
+                ARENA_HEADER_SIZE;
+      c->top = c->last = 0;
+      c->external = 1;
+      c->arena = arena;
+      c->prev = c->next = NULL;
+      arena->external = 1;
+   } else {
+      if (MALLOC_PRIMME(1, &arena)) return PRIMME_MALLOC_FAILURE;
+      arena->external = 0;
+   }
+   arena->chunks = arena->top = c;
+   arena->maps = NULL;
+   arena->used = arena->peak = 0;
+   arena->numAllocs = 0;
+   arena->numHeapAllocs = 0;
+   arena->dryRun = 0;
+   arena->refs = 1;
+   arena->self = arena;
+   ctx->arena = arena;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_create_dry_arena - Set a new dry arena in the context. The
+ *    blocks taken from it have no room for data, so the memory returned by
+ *    Mem_malloc should not be accessed; but the arena records in peak the
+ *    bytes that the blocks would take from a workspace.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_create_dry_arena(primme_context *ctx) {
+
+   int ierr = Mem_create_arena(NULL, 0, ctx);
+   if (ierr != 0) return ierr;
+   ctx->arena->dryRun = 1;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_attach_arena - Set in the context the arena of an enclosing
+ *    call (for instance, the eigensolver and the callbacks of primme_svds
+ *    take the memory from the arena of primme_svds).
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * arena    arena in use by the enclosing call, or NULL
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_attach_arena(primme_arena *arena, primme_context *ctx) {
+
+   if (arena) {
+      assert(arena->self == arena && arena->refs > 0);
+      arena->refs++;
+   }
+   ctx->arena = arena;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Function Mem_workspace_arena - Return where Mem_create_arena places the
+ *    arena in the workspace, or NULL if the workspace is too small for it.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * workspace   memory owned by the caller, or NULL
+ * lworkspace  size of workspace in bytes
+ *
+ ******************************************************************************/
+
+primme_arena *Mem_workspace_arena(void *workspace, size_t lworkspace) {
+
+   if (!workspace || lworkspace < Mem_workspace_size(0)) return NULL;
+   return (primme_arena *)ALIGN_SIZE((uintptr_t)workspace);
+}
+
+/*******************************************************************************
+ * Subroutine Mem_destroy_arena - Free the arena in the context, unless other
+ *    contexts share it. All blocks taken from the arena should have been
+ *    freed already.
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_destroy_arena(primme_context *ctx) {
+
+   /* Quick exit */
+
+   if (!ctx->arena) return 0;
+
+   if (--ctx->arena->refs > 0) {
+      ctx->arena = NULL;
+      return 0;
+   }
+
+   /* Warn if the workspace given by the user was too small */
+
+   if (ctx->arena->external && ctx->arena->numHeapAllocs > 0) {
+      PRINTFALLCTX(*ctx, 1,
+            "Warning: the workspace has no room for all buffers; it should "
+            "have %zu bytes",
+            Mem_workspace_size(ctx->arena->peak));
+   }
+
+   primme_arena_chunk *c = ctx->arena->chunks;
+   while (c) {
+      primme_arena_chunk *c_next = c->next;
+      assert(c->top == 0);
+      if (!c->external) free(c);
+      c = c_next;
+   }
+   assert(!ctx->arena->maps && ctx->arena->used == 0);
+   ctx->arena->self = NULL;
+   if (!ctx->arena->external) free(ctx->arena);
+   ctx->arena = NULL;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Function Mem_block_size - Return the bytes that Mem_malloc takes from an
+ *    arena for an allocation of the given size.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * size     Size of the allocation in bytes
+ *
+ ******************************************************************************/
+
+size_t Mem_block_size(size_t size) {
+   return BLOCK_HEADER_SIZE + ALIGN_SIZE(size);
+}
+
+/*******************************************************************************
+ * Function Mem_workspace_size - Return the size of a workspace passed to
+ *    Mem_create_arena that can hold the given amount of bytes of blocks,
+ *    regardless of the alignment of the workspace.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * used     Bytes taken by the blocks, as added up from Mem_block_size
+ *
+ ******************************************************************************/
+
+size_t Mem_workspace_size(size_t used) {
+   return BLOCK_ALIGN - 1 + ARENA_HEADER_SIZE + used;
+}
+
+/*******************************************************************************
+ * Function Mem_dry_run - Return whether the context takes the memory from a
+ *    dry arena (see Mem_create_dry_arena).
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_dry_run(primme_context ctx) {
+   return ctx.arena && ctx.arena->dryRun;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_malloc - Allocate memory and register it in the current
+ *    frame. If the context has an arena, the memory is taken from it.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * size     Size in bytes
+ * ctx      context
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * p        Pointer to the allocated memory
+ *
+ ******************************************************************************/
+
+int Mem_malloc(size_t size, void **p, primme_context ctx) {
+
+   assert(ctx.mm);
+
+   primme_block *b;
+   if (ctx.arena) {
+      b = arena_alloc(ctx.arena, size);
+      ctx.arena->numAllocs++;
+   } else {
+      b = (primme_block *)malloc(BLOCK_HEADER_SIZE + size);
+      if (b) b->chunk = NULL;
+   }
+   if (!b) {
+      *p = NULL;
+      return PRIMME_MALLOC_FAILURE;
+   }
+   *p = (char *)b + BLOCK_HEADER_SIZE;
+
+   /* Register the block */
+
+   b->a.p = *p;
+   b->a.free_fn = free_block;
+   b->a.prev = ctx.mm->prev_alloc;
+#ifndef NDEBUG
+   b->a.debug = NULL;
+#endif
+   ctx.mm->prev_alloc = &b->a;
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_free - Deregister and free memory allocated by Mem_malloc.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * p        Pointer returned by Mem_malloc
+ * ctx      context
+ *
+ ******************************************************************************/
+
+int Mem_free(void *p, primme_context ctx) {
+
+   /* Quick exit */
+
+   if (!p) return 0;
+
+   Mem_deregister_alloc(p, ctx);
+   if (find_map(p, ctx)) {
+      unmap_block(p, ctx);
+   } else {
+      free_block(p, ctx);
+   }
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutine Mem_map - Allocate memory backed by a temporary file in the
+ *    given directory and register it in the current frame. The file is
+ *    removed from the directory right away, so it goes away with the mapping
+ *    even if the process is killed. Free the memory with Mem_free.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * size     Size in bytes
+ * dir      Directory where to create the file
+ * ctx      context
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * p        Pointer to the allocated memory
+ *
+ ******************************************************************************/
+
+int Mem_map(size_t size, const char *dir, void **p, primme_context ctx) {
+
+   *p = NULL;
+
+   /* Quick exit */
+
+   if (size == 0) return 0;
+
+#ifdef USE_MMAP
+   CHKERRM(!ctx.arena, PRIMME_FUNCTION_UNAVAILABLE,
+         "Memory-mapped arrays need an arena in the context");
+
+   /* Create the file and make it large enough */
+
+   char path[1024];
+   CHKERRM(snprintf(path, sizeof(path), "%s/primme-XXXXXX", dir) >=
+                 (int)sizeof(path),
+         PRIMME_MALLOC_FAILURE, "Directory name too long: %s", dir);
+   int fd = mkstemp(path);
+   CHKERRM(fd < 0, PRIMME_MALLOC_FAILURE, "Could not create a file in %s: %s",
+         dir, strerror(errno));
+   unlink(path);
+   if (ftruncate(fd, (off_t)size) != 0) {
+      int err = errno;
+      close(fd);
+      CHKERRM(1, PRIMME_MALLOC_FAILURE, "Could not grow %s to %g bytes: %s",
+            path, (double)size, strerror(err));
+   }
+
+   /* Map the file and register the mapping in the arena */
+
+   void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   if (base == MAP_FAILED) {
+      int err = errno;
+      close(fd);
+      CHKERRM(1, PRIMME_MALLOC_FAILURE, "Could not map %s: %s", path,
+            strerror(err));
+   }
+   primme_map *mp;
+   if (MALLOC_PRIMME(1, &mp) != 0) {
+      munmap(base, size);
+      close(fd);
+      return PRIMME_MALLOC_FAILURE;
+   }
+   mp->base = (char *)base;
+   mp->size = size;
+   mp->fd = fd;
+   mp->next = ctx.arena->maps;
+   ctx.arena->maps = mp;
+
+   /* Register the block */
+
+   if (Mem_register_alloc(base, unmap_block, ctx) != 0) {
+      unmap_block(base, ctx);
+      return PRIMME_MALLOC_FAILURE;
+   }
+   *p = base;
+
+   return 0;
+#else
+   (void)dir;
+   (void)ctx;
+   CHKERRM(1, PRIMME_FUNCTION_UNAVAILABLE,
+         "Memory-mapped arrays are not supported in this platform");
+#endif
+}
+
+/*******************************************************************************
+ * Subroutine Mem_stream_rows - Hint that rows i:i+m-1 of the columns of x are
+ *    going to be processed next, in a pass over all rows of x in order. It does
+ *    nothing unless x was allocated with Mem_map. Otherwise, when the pass
+ *    enters a new window of STREAM_WINDOW bytes of each column, that window
+ *    and the next one are read ahead, and the windows already processed are
+ *    written back and dropped from the process. So the pass keeps at most
+ *    three windows per column in memory and overlaps the disk transfers with
+ *    the computation.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * x        pointer to the first element of the matrix
+ * elemSize size of an element in bytes
+ * ldx      leading dimension of x
+ * mx       number of rows of x
+ * n        number of columns of x
+ * i        first row of the panel
+ * m        number of rows in the panel
+ * ctx      context
+ *
+ ******************************************************************************/
+
+#define STREAM_WINDOW ((size_t)1 << 20)
+
+#ifdef USE_MMAP
+static void advise_rows(primme_map *mp, char *x, size_t elemSize,
+      PRIMME_INT ldx, int n, PRIMME_INT i0, PRIMME_INT i1, int release) {
+
+   size_t page = (size_t)sysconf(_SC_PAGESIZE);
+   int j;
+   for (j = 0; j < n; j++) {
+      /* Round out the range if reading ahead, and round it in if dropping, */
+      /* so that pages shared with the next window or column are not dropped */
+      uintptr_t b = (uintptr_t)(x + (j * ldx + i0) * elemSize);
+      uintptr_t e = (uintptr_t)(x + (j * ldx + i1) * elemSize);
+      b = release ? (b + page - 1) / page * page : b / page * page;
+      e = release ? e / page * page : (e + page - 1) / page * page;
+      if ((char *)b < mp->base) b = (uintptr_t)mp->base;
+      if ((char *)e > mp->base + mp->size) e = (uintptr_t)(mp->base + mp->size);
+      if (b >= e) continue;
+      if (!release) {
+         madvise((void *)b, e - b, MADV_WILLNEED);
+         continue;
+      }
+#ifdef SYNC_FILE_RANGE_WRITE
+      sync_file_range(mp->fd, (off_t)((char *)b - mp->base), (off_t)(e - b),
+            SYNC_FILE_RANGE_WRITE);
+#else
+      msync((void *)b, e - b, MS_ASYNC);
+#endif
+      madvise((void *)b, e - b, MADV_DONTNEED);
+   }
+}
+#endif
+
+int Mem_stream_rows(void *x, size_t elemSize, PRIMME_INT ldx, PRIMME_INT mx,
+      int n, PRIMME_INT i, PRIMME_INT m, primme_context ctx) {
+
+   /* Quick exit */
+
+   if (!x || !ctx.arena || !ctx.arena->maps || n <= 0 || m <= 0) return 0;
+
+#ifdef USE_MMAP
+   primme_map *mp = find_map(x, ctx);
+   if (!mp) return 0;
+
+   PRIMME_INT w = max(1, (PRIMME_INT)(STREAM_WINDOW / elemSize));
+   PRIMME_INT wb = i / w, we = (i + m - 1) / w; /* windows in the panel */
+
+   /* When the pass enters a window, read it ahead along with the next one, */
+   /* and drop the window before the previous one, which is not in use      */
+
+   if (i % w == 0 || wb != we) {
+      PRIMME_INT wn = (i % w == 0) ? wb : we;
+      advise_rows(mp, (char *)x, elemSize, ldx, n, wn * w,
+            min((wn + 2) * w, mx), 0 /* read ahead */);
+      if (wn >= 2) {
+         advise_rows(mp, (char *)x, elemSize, ldx, n, (wn - 2) * w,
+               (wn - 1) * w, 1 /* drop */);
+      }
+   }
+
+   /* At the end of the pass, drop the windows left, unless the columns are */
+   /* that short that the pass never drops a window                        */
+
+   if (i + m >= mx && we >= 2) {
+      advise_rows(mp, (char *)x, elemSize, ldx, n, max(0, we - 1) * w, mx,
+            1 /* drop */);
+   }
+#else
+   (void)elemSize;
+   (void)ldx;
+   (void)mx;
+   (void)i;
+#endif
 
    return 0;
 }
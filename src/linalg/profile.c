@@ -0,0 +1,781 @@
+/*******************************************************************************
+ * Copyright (c) 2018, College of William & Mary
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the College of William & Mary nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COLLEGE OF WILLIAM & MARY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * PRIMME: https://github.com/primme/primme
+ * Contact: Andreas Stathopoulos, a n d r e a s _at_ c s . w m . e d u
+ *******************************************************************************
+ * File: profile.c
+ *
+ * Purpose - Record the calls profiled by PROFILE_BEGIN and PROFILE_END in
+ *           a call tree and a ring buffer of events, and export them.
+ *
+ ******************************************************************************/
+
+#ifndef THIS_FILE
+#define THIS_FILE "../linalg/profile.c"
+#endif
+
+#if !defined(_POSIX_C_SOURCE) && defined(__unix__)
+#define _POSIX_C_SOURCE 199309L   /* clock_gettime */
+#endif
+
+#include <stdlib.h>   /* malloc, free, qsort */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "primme.h"
+#include "wtime.h"
+#include "profile.h"
+
+#ifdef PRIMME_PROFILE
+#include <regex.h>
+#endif
+
+/* Node of the call tree. The root is node 0 and has no site */
+
+typedef struct {
+   primme_profiler_site *site;
+   int siteIdx;               /* index of the site in primme_profiler.sites */
+   int parent;                /* parent node                                */
+   int hint;                  /* last child entered                         */
+   PRIMME_INT count;          /* number of calls                            */
+   double time;               /* total time of the calls                    */
+   double childTime;          /* time spent on the children                 */
+} profile_node;
+
+/* Finished call */
+
+typedef struct {
+   int node;                  /* node of the call                           */
+   double t0;                 /* starting time                              */
+   double dur;                /* duration                                   */
+} profile_event;
+
+struct primme_profiler {
+   profile_node *nodes;       /* call tree                                  */
+   int numNodes, maxNodes;
+   int current;               /* node of the innermost running call         */
+   PRIMME_INT numDropped;     /* calls not recorded because the tree is full*/
+   profile_event *events;     /* ring buffer of the last finished calls     */
+   int maxEvents;
+   int nextEvent;             /* where the next event goes                  */
+   PRIMME_INT numEvents;      /* events recorded since the last reset       */
+   primme_profiler_site **sites; /* distinct sites in the tree        */
+   PRIMME_INT *siteCount;     /* calls of every site                        */
+   double *siteTime;          /* time of the calls of every site            */
+   int *siteThrottled;        /* whether the site is throttled              */
+   int numSites;
+   int *nodeHash;             /* open addressing tables of indices in nodes */
+   int *siteHash;             /* and in sites                               */
+   int hashMask;
+   PRIMME_INT throttleCalls;  /* throttle a site after these calls if...    */
+   double throttleTime;       /* ...the average time is below this          */
+   double t0;                 /* time of the creation or the last reset     */
+   unsigned int tag;          /* identifies the profiler and its throttling */
+                              /* state in primme_profiler_site.tag          */
+};
+
+/******************************************************************************
+ * Function new_tag - return a tag that no profiler has taken before
+ *
+ ******************************************************************************/
+
+static unsigned int new_tag(void) {
+   static unsigned int lastTag = 0;
+   unsigned int tag;
+   do {
+#if defined(__GNUC__) || defined(__clang__)
+      tag = __atomic_add_fetch(&lastTag, 1, __ATOMIC_RELAXED);
+#else
+      tag = ++lastTag;
+#endif
+   } while (tag == 0);
+   return tag;
+}
+
+/******************************************************************************
+ * Function profile_time - return a monotonic time in seconds
+ *
+ ******************************************************************************/
+
+static double profile_time(void) {
+#ifdef CLOCK_MONOTONIC
+   struct timespec ts;
+   if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+      return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+   }
+#endif
+   return primme_wTimer();
+}
+
+/******************************************************************************
+ * Function primme_profiler_create - allocate a profiler
+ *
+ * PARAMETERS
+ * ---------------------------
+ * maxNodes    maximum number of distinct call stacks; if zero, 4096
+ * maxEvents   number of last calls kept for the trace; if zero, 65536
+ *
+ * RETURN
+ * ------
+ * the profiler, or NULL if the allocation failed or the library is not
+ * built with PRIMME_PROFILE
+ *
+ ******************************************************************************/
+
+primme_profiler *primme_profiler_create(int maxNodes, int maxEvents) {
+
+#ifndef PRIMME_PROFILE
+   /* The calls are not instrumented */
+
+   (void)maxNodes;
+   (void)maxEvents;
+   return NULL;
+#else
+   if (maxNodes < 0 || maxEvents < 0) return NULL;
+   if (maxNodes == 0) maxNodes = 4096;
+   if (maxEvents == 0) maxEvents = 65536;
+
+   int hashSize = 1;
+   while (hashSize < 2 * maxNodes) hashSize *= 2;
+
+   primme_profiler *prof = (primme_profiler *)malloc(sizeof(primme_profiler));
+   if (!prof) return NULL;
+   prof->nodes = (profile_node *)malloc(sizeof(profile_node) * maxNodes);
+   prof->events = (profile_event *)malloc(sizeof(profile_event) * maxEvents);
+   prof->sites = (primme_profiler_site **)malloc(
+         sizeof(primme_profiler_site *) * maxNodes);
+   prof->siteCount = (PRIMME_INT *)malloc(sizeof(PRIMME_INT) * maxNodes);
+   prof->siteTime = (double *)malloc(sizeof(double) * maxNodes);
+   prof->siteThrottled = (int *)malloc(sizeof(int) * maxNodes);
+   prof->nodeHash = (int *)malloc(sizeof(int) * hashSize);
+   prof->siteHash = (int *)malloc(sizeof(int) * hashSize);
+   if (!prof->nodes || !prof->events || !prof->sites || !prof->siteCount ||
+         !prof->siteTime || !prof->siteThrottled || !prof->nodeHash ||
+         !prof->siteHash) {
+      primme_profiler_destroy(prof);
+      return NULL;
+   }
+   prof->maxNodes = maxNodes;
+   prof->maxEvents = maxEvents;
+   prof->hashMask = hashSize - 1;
+   prof->numSites = 0;
+   primme_profiler_throttle(prof, 10, 5e-5);
+   primme_profiler_reset(prof);
+   return prof;
+#endif
+}
+
+/******************************************************************************
+ * Function primme_profiler_throttle - set when a call site is throttled. The
+ *    calls from a throttled site are no longer recorded by this profiler, and
+ *    their time is accounted for the caller. The sites throttled so far are
+ *    recorded again.
+ *
+ * PARAMETERS
+ * ---------------------------
+ * prof     profiler
+ * calls    throttle a site after this number of calls if they took on
+ *          average less than time; if zero, never throttle
+ * time     average time in seconds
+ *
+ * RETURN
+ * ------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_profiler_throttle(primme_profiler *prof, int calls, double time) {
+
+   if (!prof || calls < 0) return -1;
+   prof->throttleCalls = (calls > 0 ? calls : PRIMME_INT_MAX);
+   prof->throttleTime = time;
+
+   /* Start over the counters of the sites, and take a new tag, so that */
+   /* no site is considered throttled by this profiler                  */
+
+   int i;
+   for (i = 0; i < prof->numSites; i++) {
+      prof->siteCount[i] = 0;
+      prof->siteTime[i] = 0.0;
+      prof->siteThrottled[i] = 0;
+   }
+   prof->tag = new_tag();
+   return 0;
+}
+
+/******************************************************************************
+ * Function primme_profiler_tag - return the tag that PROFILE_BEGIN compares
+ *    with the one of the site. It changes when the profiler is reset or
+ *    throttled, so the profiler should not be reset or throttled during a
+ *    solve.
+ *
+ ******************************************************************************/
+
+unsigned int primme_profiler_tag(primme_profiler *prof) {
+   return prof ? prof->tag : 0;
+}
+
+/******************************************************************************
+ * Function primme_profiler_reset - forget all recorded calls
+ *
+ * RETURN
+ * ------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_profiler_reset(primme_profiler *prof) {
+
+   if (!prof) return -1;
+
+   profile_node *root = &prof->nodes[0];
+   root->site = NULL;
+   root->siteIdx = -1;
+   root->parent = root->hint = -1;
+   root->count = 0;
+   root->time = root->childTime = 0.0;
+   prof->numNodes = 1;
+   prof->current = 0;
+   prof->numDropped = 0;
+   prof->nextEvent = 0;
+   prof->numEvents = 0;
+   prof->numSites = 0;
+   memset(prof->nodeHash, -1, sizeof(int) * (prof->hashMask + 1));
+   memset(prof->siteHash, -1, sizeof(int) * (prof->hashMask + 1));
+   prof->tag = new_tag();
+   prof->t0 = profile_time();
+   return 0;
+}
+
+/******************************************************************************
+ * Function primme_profiler_destroy - free the profiler
+ *
+ * RETURN
+ * ------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_profiler_destroy(primme_profiler *prof) {
+
+   if (!prof) return -1;
+   free(prof->nodes);
+   free(prof->events);
+   free(prof->sites);
+   free(prof->siteCount);
+   free(prof->siteTime);
+   free(prof->siteThrottled);
+   free(prof->nodeHash);
+   free(prof->siteHash);
+   free(prof);
+   return 0;
+}
+
+/******************************************************************************
+ * Function site_index - return the index of the site in prof->sites, adding
+ *    it if it is new
+ *
+ ******************************************************************************/
+
+static int site_index(primme_profiler *prof, primme_profiler_site *site) {
+
+   size_t h = ((size_t)site >> 3) * 2654435761u;
+   int i;
+   for (i = (int)(h & prof->hashMask); prof->siteHash[i] >= 0;
+         i = (i + 1) & prof->hashMask) {
+      if (prof->sites[prof->siteHash[i]] == site) return prof->siteHash[i];
+   }
+   prof->sites[prof->numSites] = site;
+   prof->siteCount[prof->numSites] = 0;
+   prof->siteTime[prof->numSites] = 0.0;
+   prof->siteThrottled[prof->numSites] = 0;
+   prof->siteHash[i] = prof->numSites;
+   return prof->numSites++;
+}
+
+/******************************************************************************
+ * Function primme_profiler_begin - enter a call from site
+ *
+ * PARAMETERS
+ * ---------------------------
+ * prof     profiler
+ * site     call site
+ * t0       (output) starting time, to pass to primme_profiler_end
+ *
+ * RETURN
+ * ------
+ * the node to pass to primme_profiler_end, or -1 if the call is not recorded
+ *
+ * NOTE: it is called when the tag of the site is not the one of prof, that
+ * is, when the site is not throttled by prof or another profiler throttled
+ * it later.
+ *
+ ******************************************************************************/
+
+int primme_profiler_begin(primme_profiler *prof,
+      primme_profiler_site *site, double *t0) {
+
+   /* Without profiler, the tag of the context is zero; clear the tag of */
+   /* the site, so that PROFILE_BEGIN doesn't call here again             */
+
+   if (!prof) {
+      PROFILE_SET_SITE_TAG(*site, 0);
+      return -1;
+   }
+
+   int parent = prof->current;
+   profile_node *p = &prof->nodes[parent];
+
+   /* Usually the same call as the last time is entered, so try first the */
+   /* last child entered, and then look for the child in the hash table   */
+
+   int c = p->hint;
+   if (c < 0 || prof->nodes[c].site != site) {
+      size_t h = (((size_t)site >> 3) ^ ((size_t)parent << 16)) * 2654435761u;
+      int i;
+      for (i = (int)(h & prof->hashMask);
+            (c = prof->nodeHash[i]) >= 0 &&
+            (prof->nodes[c].site != site || prof->nodes[c].parent != parent);
+            i = (i + 1) & prof->hashMask)
+         ;
+      if (c < 0) {
+         if (prof->numNodes >= prof->maxNodes) {
+            prof->numDropped++;
+            return -1;
+         }
+         c = prof->numNodes++;
+         profile_node *n = &prof->nodes[c];
+         n->site = site;
+         n->siteIdx = site_index(prof, site);
+         n->parent = parent;
+         n->hint = -1;
+         n->count = 0;
+         n->time = n->childTime = 0.0;
+         prof->nodeHash[i] = c;
+      }
+      p->hint = c;
+   }
+
+   /* Skip the site if it is throttled, and mark it again for PROFILE_BEGIN */
+
+   if (prof->siteThrottled[prof->nodes[c].siteIdx]) {
+      PROFILE_SET_SITE_TAG(*site, prof->tag);
+      return -1;
+   }
+
+   prof->current = c;
+   *t0 = profile_time();
+   return parent;
+}
+
+/******************************************************************************
+ * Function primme_profiler_end - finish the current call
+ *
+ * PARAMETERS
+ * ---------------------------
+ * prof     profiler
+ * parent   value returned by primme_profiler_begin
+ * t0       starting time returned by primme_profiler_begin
+ *
+ ******************************************************************************/
+
+void primme_profiler_end(primme_profiler *prof, int parent, double t0) {
+
+   double dur = profile_time() - t0;
+   int c = prof->current;
+   profile_node *n = &prof->nodes[c];
+   n->count++;
+   n->time += dur;
+   prof->nodes[parent].childTime += dur;
+   prof->current = parent;
+
+   /* Stop recording the calls from the site if they are frequent and too */
+   /* short for the overhead of the profiler to be acceptable             */
+
+   int s = n->siteIdx;
+   prof->siteCount[s]++;
+   prof->siteTime[s] += dur;
+   if (prof->siteCount[s] >= prof->throttleCalls &&
+         prof->siteTime[s] < prof->throttleTime * prof->siteCount[s]) {
+      prof->siteThrottled[s] = 1;
+      PROFILE_SET_SITE_TAG(*n->site, prof->tag);
+   }
+
+   profile_event *e = &prof->events[prof->nextEvent];
+   e->node = c;
+   e->t0 = t0;
+   e->dur = dur;
+   if (++prof->nextEvent >= prof->maxEvents) prof->nextEvent = 0;
+   prof->numEvents++;
+}
+
+/******************************************************************************
+ * Function site_name - write a short name for the site as function@file:line,
+ *    where function is the first function called in the text of the call.
+ *    Characters that have a meaning in the exported formats are replaced.
+ *
+ ******************************************************************************/
+
+static void site_name(primme_profiler_site *site, char *s, int len) {
+
+   if (!site) {
+      snprintf(s, len, "primme");
+      return;
+   }
+
+   /* Find the first identifier followed by a parenthesis */
+
+   const char *call = site->call, *f = NULL;
+   int flen = 0, i;
+   for (i = 0; call[i] && !f; i++) {
+      if ((call[i] == '_' || (call[i] >= 'a' && call[i] <= 'z') ||
+                (call[i] >= 'A' && call[i] <= 'Z')) &&
+            (i == 0 || !(call[i - 1] == '_' || call[i - 1] == '.' ||
+                             (call[i - 1] >= '0' && call[i - 1] <= '9') ||
+                             (call[i - 1] >= 'a' && call[i - 1] <= 'z') ||
+                             (call[i - 1] >= 'A' && call[i - 1] <= 'Z')))) {
+         int j = i;
+         while (call[j] == '_' || (call[j] >= '0' && call[j] <= '9') ||
+                (call[j] >= 'a' && call[j] <= 'z') ||
+                (call[j] >= 'A' && call[j] <= 'Z'))
+            j++;
+         int k = j;
+         while (call[k] == ' ') k++;
+         if (call[k] == '(') {
+            f = &call[i];
+            flen = j - i;
+         }
+         i = j - 1;
+      }
+   }
+   if (!f) {
+      f = call;
+      flen = (int)strlen(call);
+   }
+   if (flen > 40) flen = 40;
+
+   const char *file = strrchr(site->file, '/');
+   file = file ? file + 1 : site->file;
+   snprintf(s, len, "%.*s@%s:%d", flen, f, file, site->line);
+   for (i = 0; s[i]; i++) {
+      if (s[i] == ';' || s[i] == '"' || s[i] == '\\' || s[i] < ' ') s[i] = '_';
+   }
+}
+
+/******************************************************************************
+ * Function primme_profiler_write_trace - write the last recorded calls in
+ *    the Chrome trace event format, to be opened by chrome://tracing or
+ *    Perfetto. The times are in microseconds since the creation or the last
+ *    reset of the profiler.
+ *
+ * PARAMETERS
+ * ---------------------------
+ * prof     profiler
+ * f        output file
+ *
+ * RETURN
+ * ------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_profiler_write_trace(primme_profiler *prof, FILE *f) {
+
+   if (!prof || !f) return -1;
+
+   int n = (prof->numEvents < prof->maxEvents ? (int)prof->numEvents
+                                              : prof->maxEvents);
+   int first = (prof->numEvents < prof->maxEvents ? 0 : prof->nextEvent);
+   int i;
+   char name[128];
+
+   fprintf(f, "{\"traceEvents\":[\n");
+   for (i = 0; i < n; i++) {
+      profile_event *e = &prof->events[(first + i) % prof->maxEvents];
+      site_name(prof->nodes[e->node].site, name, sizeof(name));
+      fprintf(f,
+            "{\"name\":\"%s\",\"cat\":\"primme\",\"ph\":\"X\",\"ts\":%.3f,"
+            "\"dur\":%.3f,\"pid\":0,\"tid\":0}%s\n",
+            name, (e->t0 - prof->t0) * 1e6, e->dur * 1e6,
+            i < n - 1 ? "," : "");
+   }
+   fprintf(f, "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"calls\":%" PRIMME_INT_P
+              ",\"overwritten\":%" PRIMME_INT_P "}}\n",
+         prof->numEvents, prof->numEvents - n);
+   return ferror(f) ? -1 : 0;
+}
+
+/******************************************************************************
+ * Function primme_profiler_write_folded - write the call tree as folded
+ *    stacks, one line per node with the names of the calls from the root
+ *    separated by semicolons and the exclusive time in microseconds, as
+ *    taken by flamegraph.pl and speedscope.
+ *
+ * PARAMETERS
+ * ---------------------------
+ * prof     profiler
+ * f        output file
+ *
+ * RETURN
+ * ------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_profiler_write_folded(primme_profiler *prof, FILE *f) {
+
+   if (!prof || !f) return -1;
+
+   /* The stack of a node is the stack of its parent, which is always */
+   /* created before, plus the node name. Write the nodes in creation */
+   /* order keeping the offset of each stack in a buffer              */
+
+   int i;
+   size_t *offset = (size_t *)malloc(sizeof(size_t) * prof->numNodes);
+   size_t *len = (size_t *)malloc(sizeof(size_t) * prof->numNodes);
+   size_t size = 0, capacity = 4096;
+   char *buf = (char *)malloc(capacity);
+   char name[128];
+   if (!offset || !len || !buf) {
+      free(offset);
+      free(len);
+      free(buf);
+      return -1;
+   }
+
+   for (i = 0; i < prof->numNodes; i++) {
+      profile_node *n = &prof->nodes[i];
+      site_name(n->site, name, sizeof(name));
+      size_t plen = (n->parent >= 0 ? len[n->parent] : 0);
+      size_t nlen = strlen(name);
+      if (size + plen + nlen + 2 > capacity) {
+         while (size + plen + nlen + 2 > capacity) capacity *= 2;
+         char *newbuf = (char *)realloc(buf, capacity);
+         if (!newbuf) break;
+         buf = newbuf;
+      }
+      offset[i] = size;
+      if (plen > 0) {
+         memcpy(&buf[size], &buf[offset[n->parent]], plen);
+         buf[size + plen] = ';';
+         plen++;
+      }
+      memcpy(&buf[size + plen], name, nlen);
+      len[i] = plen + nlen;
+      size += len[i];
+
+      double self = (i == 0 ? 0.0 : n->time - n->childTime);
+      long long us = (long long)(self * 1e6 + .5);
+      if (us > 0) fprintf(f, "%.*s %lld\n", (int)len[i], &buf[offset[i]], us);
+   }
+   int ret = (i < prof->numNodes || ferror(f)) ? -1 : 0;
+
+   free(offset);
+   free(len);
+   free(buf);
+   return ret;
+}
+
+/******************************************************************************
+ * Function primme_profiler_num_sites - return the number of distinct call
+ *    sites recorded
+ *
+ ******************************************************************************/
+
+int primme_profiler_num_sites(primme_profiler *prof) {
+   return prof ? prof->numSites : -1;
+}
+
+/******************************************************************************
+ * Function primme_profiler_site_stats - return the aggregated counters of a
+ *    call site over all call stacks where it appears
+ *
+ * PARAMETERS
+ * ---------------------------
+ * prof     profiler
+ * i        site index, from 0 to primme_profiler_num_sites(prof)-1
+ * call     (output) text of the call; if NULL, it isn't returned
+ * file     (output) file name; if NULL, it isn't returned
+ * line     (output) line number; if NULL, it isn't returned
+ * count    (output) number of calls; if NULL, it isn't returned
+ * time     (output) inclusive time; if NULL, it isn't returned
+ * selfTime (output) time excluding the profiled calls inside; if NULL, it
+ *          isn't returned
+ *
+ * RETURN
+ * ------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_profiler_site_stats(primme_profiler *prof, int i, const char **call,
+      const char **file, int *line, PRIMME_INT *count, double *time,
+      double *selfTime) {
+
+   if (!prof || i < 0 || i >= prof->numSites) return -1;
+
+   PRIMME_INT c = 0;
+   double t = 0.0, st = 0.0;
+   int j;
+   for (j = 1; j < prof->numNodes; j++) {
+      profile_node *n = &prof->nodes[j];
+      if (n->siteIdx != i) continue;
+      c += n->count;
+      t += n->time;
+      st += n->time - n->childTime;
+   }
+   if (call) *call = prof->sites[i]->call;
+   if (file) *file = prof->sites[i]->file;
+   if (line) *line = prof->sites[i]->line;
+   if (count) *count = c;
+   if (time) *time = t;
+   if (selfTime) *selfTime = st;
+   return 0;
+}
+
+/******************************************************************************
+ * Function primme_profiler_write_summary - write a table with the
+ *    aggregated counters of every call site, sorted by exclusive time
+ *
+ * PARAMETERS
+ * ---------------------------
+ * prof     profiler
+ * f        output file
+ *
+ * RETURN
+ * ------
+ * error code
+ *
+ ******************************************************************************/
+
+typedef struct {
+   int site;
+   PRIMME_INT count;
+   double time, selfTime;
+} profile_site_stats;
+
+static int cmp_self_time(const void *a, const void *b) {
+   double ta = ((const profile_site_stats *)a)->selfTime;
+   double tb = ((const profile_site_stats *)b)->selfTime;
+   return ta < tb ? 1 : (ta > tb ? -1 : 0);
+}
+
+int primme_profiler_write_summary(primme_profiler *prof, FILE *f) {
+
+   if (!prof || !f) return -1;
+
+   int i;
+   profile_site_stats *s = (profile_site_stats *)calloc(
+         prof->numSites > 0 ? prof->numSites : 1, sizeof(profile_site_stats));
+   if (!s) return -1;
+   for (i = 0; i < prof->numSites; i++) s[i].site = i;
+   for (i = 1; i < prof->numNodes; i++) {
+      profile_node *n = &prof->nodes[i];
+      s[n->siteIdx].count += n->count;
+      s[n->siteIdx].time += n->time;
+      s[n->siteIdx].selfTime += n->time - n->childTime;
+   }
+   qsort(s, prof->numSites, sizeof(profile_site_stats), cmp_self_time);
+
+   char name[128];
+   fprintf(f, "%12s %12s %12s  %s\n", "calls", "time", "self time", "site");
+   for (i = 0; i < prof->numSites; i++) {
+      site_name(prof->sites[s[i].site], name, sizeof(name));
+      fprintf(f, "%12" PRIMME_INT_P " %12g %12g  %s%s\n", s[i].count, s[i].time,
+            s[i].selfTime, name,
+            prof->siteThrottled[s[i].site] ? " (throttled)" : "");
+   }
+   if (prof->numDropped > 0) {
+      fprintf(f, "%12" PRIMME_INT_P " calls not recorded; increase maxNodes\n",
+            prof->numDropped);
+   }
+   free(s);
+   return ferror(f) ? -1 : 0;
+}
+
+#ifdef PRIMME_PROFILE
+
+/******************************************************************************
+ * Function primme_profiler_report - pass to report the total time of the
+ *    call stacks that match the regular expression pattern. The stacks are
+ *    written as ~call@file:line for every call from the root.
+ *
+ * PARAMETERS
+ * ---------------------------
+ * prof     profiler
+ * pattern  POSIX regular expression
+ * report   callback
+ * arg      passed to report
+ *
+ * RETURN
+ * ------
+ * error code
+ *
+ ******************************************************************************/
+
+int primme_profiler_report(primme_profiler *prof, const char *pattern,
+      int (*report)(const char *path, double time, void *arg), void *arg) {
+
+   regex_t re;
+   int ierr = regcomp(&re, pattern, REG_NOSUB);
+   if (ierr) {
+      char errmsg[100];
+      regerror(ierr, &re, errmsg, 100);
+      report(errmsg, -1, arg);
+      return -1;
+   }
+
+   /* Compose the stack of every node from the one of its parent, as in */
+   /* primme_profiler_write_folded                                      */
+
+   int i, ret = 0;
+   char **path = (char **)calloc(prof->numNodes, sizeof(char *));
+   if (!path) ret = -1;
+   for (i = 1; ret == 0 && i < prof->numNodes; i++) {
+      profile_node *n = &prof->nodes[i];
+      const char *ppath = n->parent > 0 ? path[n->parent] : "";
+      size_t len = strlen(ppath) + strlen(n->site->file) + 70;
+      path[i] = (char *)malloc(len);
+      if (!path[i]) {
+         ret = -1;
+         break;
+      }
+      snprintf(path[i], len, "%s~%.40s@%s:%d", ppath, n->site->call,
+            n->site->file, n->site->line);
+      if (n->count > 0 && regexec(&re, path[i], 0, NULL, 0) == 0) {
+         ret = report(path[i], n->time, arg);
+      }
+   }
+   if (path) {
+      for (i = 0; i < prof->numNodes; i++) free(path[i]);
+      free(path);
+   }
+   regfree(&re);
+   return ret;
+}
+
+#endif /* PRIMME_PROFILE */
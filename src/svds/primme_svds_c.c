@@ -94,7 +94,7 @@ static int monitor_report(const char *fun, double time, primme_context ctx) {
 
 #ifdef PRIMME_PROFILE
       /* Avoid profiling this function. It will turn out in a recursive call */
-      ctx.path = NULL;
+      ctx.profiler = NULL;
 #endif
 
       CHKERRM((ctx.primme_svds->monitorFun(NULL, NULL, NULL, NULL, NULL, NULL,
@@ -107,16 +107,33 @@ static int monitor_report(const char *fun, double time, primme_context ctx) {
 }
 
 
+#ifdef PRIMME_PROFILE
+
+/******************************************************************************
+ * Function profile_report - pass to ctx.report the time of a call stack
+ *
+ ******************************************************************************/
+
+static int profile_report(const char *path, double time, void *ctx) {
+   return ((primme_context *)ctx)->report(path, time, *(primme_context *)ctx);
+}
+
+#endif
+
 /******************************************************************************
  * Function primme_svds_get_context - return a context from the primme_svds_params
  *
  * PARAMETERS
  * ---------------------------
  * primme_svds      primme_svds_params struct
+ * nested           if nonzero, the context is for a callback from the
+ *                  eigensolver, which takes the memory from the arena of the
+ *                  enclosing call to primme_svds
  *
  ******************************************************************************/
 
-static primme_context primme_svds_get_context(primme_svds_params *primme_svds) {
+static primme_context primme_svds_get_context(
+      primme_svds_params *primme_svds, int nested) {
    primme_context ctx;
    memset(&ctx, 0, sizeof(primme_context));
    if (primme_svds) {
@@ -129,25 +146,17 @@ static primme_context primme_svds_get_context(primme_svds_params *primme_svds) {
       ctx.queue = primme_svds->queue;
       ctx.report = monitor_report;
 #ifdef PRIMME_PROFILE
-      if (primme_svds->profile) {
-         /* Compile regex. If there is no errors, set path to a nonzero       */
-         /* value. Set ctx.report to the function that will channel the       */
-         /* reports to the monitor. Report errors if they are.                */
-
-         int ierr = regcomp(&ctx.profile, primme_svds->profile, REG_NOSUB);
-         if (ierr || MALLOC_PRIMME(1, &ctx.timeoff)) {
-            char errmsg[100];
-            regerror(ierr, &ctx.profile, errmsg, 100);
-            if (ctx.report && ierr != 0) ctx.report(errmsg, -1, ctx);
-            regfree(&ctx.profile);
-            ctx.path = NULL;
-         } else {
-            *ctx.timeoff = 0.0;
-            ctx.path = "";
-         }
-      } else {
-         ctx.path = NULL;
+      ctx.profiler = primme_svds->profiler;
+
+      /* Record the calls in a profiler owned by the context if none is    */
+      /* given, and report the ones matching the pattern when the context  */
+      /* is freed                                                          */
+
+      if (primme_svds->profile && !ctx.profiler) {
+         ctx.profiler = primme_profiler_create(0, 1);
+         if (ctx.profiler) ctx.profile = primme_svds->profile;
       }
+      ctx.profilerTag = primme_profiler_tag(ctx.profiler);
 #endif
    }
 
@@ -155,6 +164,20 @@ static primme_context primme_svds_get_context(primme_svds_params *primme_svds) {
 
    Mem_push_frame(&ctx);
 
+   /* If the user gives a workspace, take the memory from an arena on it. */
+   /* The eigensolvers and the callbacks share the same arena.            */
+
+   if (primme_svds && primme_svds->workspace) {
+      if (nested) {
+         Mem_attach_arena(Mem_workspace_arena(primme_svds->workspace,
+                                primme_svds->lworkspace),
+               &ctx);
+      } else {
+         Mem_create_arena(
+               primme_svds->workspace, primme_svds->lworkspace, &ctx);
+      }
+   }
+
    return ctx;
 } 
 
@@ -169,15 +192,29 @@ static primme_context primme_svds_get_context(primme_svds_params *primme_svds) {
 
 static void primme_svds_free_context(primme_context ctx) {
 
+#ifdef PRIMME_PROFILE
+   /* Report the calls matching the pattern */
+
+   if (ctx.profile && ctx.report) {
+      primme_profiler *profiler = ctx.profiler;
+      ctx.profiler = NULL;
+      primme_profiler_report(profiler, ctx.profile, profile_report, &ctx);
+      ctx.profiler = profiler;
+   }
+#endif
+
    /* Pop frame pushed in primme_get_context */
 
    Mem_pop_frame(&ctx);
 
+   /* Free the arena */
+
+   Mem_destroy_arena(&ctx);
+
    /* Free profiler */
 
 #ifdef PRIMME_PROFILE
-   if (ctx.path) regfree(&ctx.profile);
-   if (ctx.timeoff) free(ctx.timeoff);
+   if (ctx.profile) primme_profiler_destroy(ctx.profiler);
 #endif
 }
 
@@ -274,7 +311,7 @@ STATIC int Xprimme_svds_aux(void *svals, XSCALAR *svecs, void *resNorms,
 
    /* Generate context */
 
-   primme_context ctx = primme_svds_get_context(primme_svds);
+   primme_context ctx = primme_svds_get_context(primme_svds, 0);
 
    /* Set the current type as the default type for user's operators */
 
@@ -397,8 +434,9 @@ int wrapper_svds_Sprimme(void *svals_, void *svecs_, void *resNorms_,
    /* ------------------------------------ */
    /* Set defaults for sequential programs */
    /* ------------------------------------ */
-   if (primme_svds->numProcs <= 1 && svals_ != NULL && svecs_ != NULL &&
-         resNorms_ != NULL) {
+   int query = (svals_ == NULL && svecs_ == NULL && resNorms_ == NULL);
+   if (primme_svds->numProcs <= 1 &&
+         (query || (svals_ != NULL && svecs_ != NULL && resNorms_ != NULL))) {
       primme_svds->mLocal = primme_svds->m;
       primme_svds->nLocal = primme_svds->n;
       primme_svds->procID = 0;
@@ -410,10 +448,15 @@ int wrapper_svds_Sprimme(void *svals_, void *svecs_, void *resNorms_,
    /* ------------------ */
    primme_svds_set_defaults(primme_svds);
 
-   /* Deprecated input  */
+   /* Memory query: if svals, svecs and resNorms are NULL, return in */
+   /* primme_svds->lworkspace the size of the workspace for the solver */
 
-   if (svals_ == NULL && svecs_ == NULL && resNorms_ == NULL)
+   if (query) {
+      CHKERR(workspace_svds_size(svals_resNorms_type, svecs_type,
+            &primme_svds->lworkspace, ctx));
+      *outInitSize = primme_svds->initSize;
       return 0;
+   }
 
    /* ----------------------------------------------------------- */
    /* Primme_svds_initialize must be called by users unless users */  
@@ -489,7 +532,7 @@ int wrapper_svds_Sprimme(void *svals_, void *svecs_, void *resNorms_,
             NULL, &allocatedTargetShifts, &svecs0, ctx));
 
    ret = Xprimme_aux_Sprimme(svals, (XSCALAR *)svecs0, resNorms,
-         &primme_svds->primme, PRIMME_OP_HREAL);
+         &primme_svds->primme, PRIMME_OP_HREAL, ctx.arena, 0);
 
    CHKERR(copy_last_params_to_svds(
             0, svals, svecs, resNorms, allocatedTargetShifts, ctx));
@@ -509,7 +552,7 @@ int wrapper_svds_Sprimme(void *svals_, void *svecs_, void *resNorms_,
       int nconv = primme_svds->numSvals - primme_svds->primmeStage2.numEvals;
 
       ret = Xprimme_aux_Sprimme(svals + nconv, (XSCALAR *)svecs0, resNorms + nconv,
-            &primme_svds->primmeStage2, PRIMME_OP_HREAL);
+            &primme_svds->primmeStage2, PRIMME_OP_HREAL, ctx.arena, 0);
 
       CHKERR(copy_last_params_to_svds(
             1, svals, svecs, resNorms, allocatedTargetShifts, ctx));
@@ -538,6 +581,459 @@ int wrapper_svds_Sprimme(void *svals_, void *svecs_, void *resNorms_,
    return ret;
 }
 
+/******************************************************************************
+ * Subroutine workspace_svds_size - return the size of primme_svds->workspace
+ *    so that all allocations in wrapper_svds_Sprimme, in the eigensolvers of
+ *    both stages and in the callbacks are taken from it. The allocations are
+ *    replayed on a dry arena in the same order as wrapper_svds_Sprimme does
+ *    them, and the size is the peak of that arena.
+ *
+ * INPUT
+ * -----
+ *  svals_resNorms_type  The type of the arrays svals and resNorms
+ *  svecs_type           The type of the array svecs
+ *
+ * OUTPUT
+ * ------
+ *  size                 Number of bytes
+ *
+ ******************************************************************************/
+
+STATIC int workspace_svds_size(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx) {
+
+   primme_svds_params *primme_svds = ctx.primme_svds;
+
+   CHKERR(Mem_create_dry_arena(&ctx));
+   Mem_push_frame(&ctx);
+
+   /* Copies of svals, svecs and resNorms in working precision */
+
+   HREAL *svals, *resNorms;
+   SCALAR *svecs;
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, primme_svds->numSvals, 1,
+         svals_resNorms_type, (void **)&svals, NULL, PRIMME_OP_HREAL,
+         1 /* alloc */, 0 /* not copy */, ctx));
+   CHKERR(Num_matrix_astype_Sprimme(NULL,
+         primme_svds->mLocal + primme_svds->nLocal,
+         primme_svds->numOrthoConst +
+               max(primme_svds->numSvals, primme_svds->initSize),
+         primme_svds->mLocal + primme_svds->nLocal, svecs_type,
+         (void **)&svecs, NULL, PRIMME_OP_SCALAR, 1 /* alloc */,
+         0 /* not copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, primme_svds->numSvals, 1,
+         svals_resNorms_type, (void **)&resNorms, NULL, PRIMME_OP_HREAL,
+         1 /* alloc */, 0 /* not copy */, ctx));
+
+   /* The eigensolvers of both stages, one after the other. In the second */
+   /* stage, the triplets that already pass the convergence criterion    */
+   /* become orthogonal constraints; replay every number of them.        */
+
+   CHKERR(stage_svds_workspace(0, 0, ctx));
+   if (primme_svds->methodStage2 != primme_svds_op_none) {
+      int nconv;
+      for (nconv = 0; nconv <= primme_svds->numSvals; nconv++) {
+         CHKERR(stage_svds_workspace(1, nconv, ctx));
+      }
+   }
+
+   if (svals) CHKERR(Num_free_RHprimme(svals, ctx));
+   if (svecs) CHKERR(Num_free_Sprimme(svecs, ctx));
+   if (resNorms) CHKERR(Num_free_RHprimme(resNorms, ctx));
+
+   *size = Mem_workspace_size(ctx.arena->peak);
+
+   Mem_pop_frame(&ctx);
+   CHKERR(Mem_destroy_arena(&ctx));
+
+   return 0;
+}
+
+/******************************************************************************
+ * Subroutine stage_svds_workspace - Take from the dry arena of the context the
+ *    same blocks that copy_last_params_from_svds, the eigensolver of the stage
+ *    and copy_last_params_to_svds take.
+ *
+ * INPUT
+ * -----
+ *  stage        0 for the first stage and 1 for the second stage
+ *  nconv        number of triplets passing the convergence criterion after
+ *               the first stage
+ *
+ ******************************************************************************/
+
+STATIC int stage_svds_workspace(int stage, int nconv, primme_context ctx) {
+
+   primme_svds_params *primme_svds = ctx.primme_svds;
+   primme_params *primme =
+         stage == 0 ? &primme_svds->primme : &primme_svds->primmeStage2;
+   primme_svds_operator method =
+         stage == 0 ? primme_svds->method : primme_svds->methodStage2;
+   if (method == primme_svds_op_none) return 0;
+
+   /* The parameters of the stage as copy_last_params_from_svds sets them */
+
+   primme_params primme0 = *primme;
+   primme0.initSize = stage == 0 ? primme_svds->initSize : primme_svds->numSvals;
+   primme0.numOrthoConst = primme_svds->numOrthoConst;
+   int n = primme0.initSize + primme0.numOrthoConst;
+   if (!primme0.matrixMatvec) {
+      primme0.matrixMatvec_type = primme_svds->matrixMatvec_type;
+   }
+   if (primme_svds->applyPreconditioner && !primme0.applyPreconditioner) {
+      primme0.applyPreconditioner_type = primme_svds->applyPreconditioner_type;
+   }
+   if (primme_svds->locking >= 0) primme0.locking = primme_svds->locking;
+
+   /* Shuffle of svecs for the augmented problem */
+
+   if (method == primme_svds_op_augmented) {
+      SCALAR *aux;
+      CHKERR(Num_malloc_Sprimme(primme0.nLocal * n, &aux, ctx));
+      CHKERR(Num_free_Sprimme(aux, ctx));
+   }
+
+   /* Shifts kept until copy_last_params_to_svds */
+
+   int numShifts = 0;
+   if ((stage == 0 && primme_svds->numTargetShifts > 0) ||
+         (stage == 1 && primme->targetShifts == NULL &&
+               primme_svds->target == primme_svds_closest_abs)) {
+      primme0.numTargetShifts = primme_svds->numTargetShifts;
+      if (stage == 0 &&
+            (method == primme_svds_op_AtA || method == primme_svds_op_AAt)) {
+         numShifts = primme_svds->numSvals;
+      }
+   } else if (stage == 1 && primme->targetShifts == NULL &&
+              primme_svds->target == primme_svds_smallest) {
+      numShifts = primme0.numTargetShifts = primme_svds->numSvals;
+   } else if (method == primme_svds_op_augmented &&
+              primme_svds->target == primme_svds_smallest &&
+              primme->targetShifts == NULL) {
+      numShifts = primme0.numTargetShifts = 1;
+   }
+   double *targetShifts = NULL;
+   if (numShifts > 0) {
+      CHKERR(Num_malloc_dprimme(numShifts, &targetShifts, ctx));
+   }
+
+   /* Initial guess [x; A'x] or [Ax; x] */
+
+   if (method == primme_svds_op_augmented && primme0.initSize <= 0) {
+      CHKERR(matrixMatvecSVDS_workspace_Sprimme(
+            1, primme_svds->m >= primme_svds->n, ctx));
+      CHKERR(globalSum_Rprimme_svds_workspace(2, 0 /* not in place */, ctx));
+      primme0.initSize = 1;
+      primme0.initBasisMode = primme_init_user;
+   }
+
+   /* Triplets from the first stage taken as orthogonal constraints */
+
+   if (stage == 1) {
+      int *flags;
+      CHKERR(Num_malloc_iprimme(primme0.initSize, &flags, ctx));
+      CHKERR(convTestFunSVDS_workspace_Sprimme(1, 1, method, ctx));
+      CHKERR(monitorFunSVDS_workspace_Sprimme(0, primme_svds->numSvals, ctx));
+      CHKERR(Num_free_iprimme(flags, ctx));
+      primme0.numOrthoConst += nconv;
+      primme0.initSize -= nconv;
+      primme0.numEvals -= nconv;
+   }
+
+   /* Blocks taken by the callbacks of the stage. They are taken on top of */
+   /* the blocks of the eigensolver at the time of the call; so hold a     */
+   /* block as large as the largest of them during the solve.              */
+
+   size_t callbacksSize;
+   CHKERR(callbacks_svds_workspace(stage, &primme0, &callbacksSize, ctx));
+   SCALAR *callbacks = NULL;
+   if (callbacksSize > 0) {
+      CHKERR(Num_malloc_Sprimme(
+            (callbacksSize - Mem_block_size(0)) / sizeof(SCALAR), &callbacks,
+            ctx));
+   }
+
+   /* The eigensolver replays its allocations on the dry arena of ctx */
+
+   primme0.convTestFun_type = PRIMME_OP_SCALAR;
+   primme0.convTestFun = method == primme_svds_op_augmented ? convTestFunAug
+                                                            : convTestFunATA;
+   if (!primme0.monitorFun) {
+      primme0.monitorFun = primme_svds->methodStage2 == primme_svds_op_none
+                                 ? monitor_single_stage
+                                 : (stage == 0 ? monitor_stage1 : monitor_stage2);
+      primme0.monitorFun_type = PRIMME_OP_SCALAR;
+   }
+   CHKERR(Xprimme_aux_Sprimme(
+         NULL, NULL, NULL, &primme0, PRIMME_OP_HREAL, ctx.arena, 0));
+
+   if (callbacks) CHKERR(Num_free_Sprimme(callbacks, ctx));
+
+   /* copy_last_params_to_svds */
+
+   int initSize = primme0.initSize + (stage == 1 ? nconv : 0);
+   n = initSize + primme_svds->numOrthoConst;
+   switch (method) {
+   case primme_svds_op_AtA:
+      CHKERR(matrixMatvecSVDS_workspace_Sprimme(initSize, 0, ctx));
+      CHKERR(globalSum_Rprimme_svds_workspace(1, 0 /* not in place */, ctx));
+      break;
+   case primme_svds_op_AAt:
+      CHKERR(matrixMatvecSVDS_workspace_Sprimme(initSize, 1, ctx));
+      CHKERR(globalSum_Rprimme_svds_workspace(1, 0 /* not in place */, ctx));
+      break;
+   case primme_svds_op_augmented: {
+      SCALAR *aux;
+      CHKERR(Num_malloc_Sprimme(primme0.nLocal * n, &aux, ctx));
+      CHKERR(Num_free_Sprimme(aux, ctx));
+      HREAL *norms2;
+      CHKERR(Num_malloc_RHprimme(2 * n, &norms2, ctx));
+      CHKERR(globalSum_Rprimme_svds_workspace(2 * n, 1 /* in place */, ctx));
+      CHKERR(Num_free_RHprimme(norms2, ctx));
+   } break;
+   case primme_svds_op_none:
+      break;
+   }
+
+   if (targetShifts) CHKERR(Num_free_dprimme(targetShifts, ctx));
+
+   return 0;
+}
+
+/******************************************************************************
+ * Subroutine callbacks_svds_workspace - return the largest amount of bytes
+ *    that the callbacks set by copy_last_params_from_svds take from the arena
+ *    in one call.
+ *
+ * INPUT
+ * -----
+ *  stage        0 for the first stage and 1 for the second stage
+ *  primme       parameters of the eigensolver of the stage
+ *
+ * OUTPUT
+ * ------
+ *  size         Number of bytes
+ *
+ ******************************************************************************/
+
+STATIC int callbacks_svds_workspace(int stage, primme_params *primme,
+      size_t *size, primme_context ctx) {
+
+   primme_svds_params *primme_svds = ctx.primme_svds;
+   primme_svds_operator method =
+         stage == 0 ? primme_svds->method : primme_svds->methodStage2;
+   int bs = max(1, primme->maxBlockSize);
+   int basisSize = primme->maxBasisSize;
+   int numLocked = primme->numEvals;
+
+   CHKERR(Mem_create_dry_arena(&ctx));
+   Mem_push_frame(&ctx);
+
+   /* matrixMatvec_eigs */
+
+   if ((!primme->matrixMatvec || primme->matrix == primme_svds) &&
+         !(primme_svds->matrixNormalMatvec &&
+               (method == primme_svds_op_AtA ||
+                     method == primme_svds_op_AAt))) {
+      SCALAR *aux;
+      if (method == primme_svds_op_AtA) {
+         CHKERR(Num_malloc_Sprimme(primme_svds->mLocal * bs, &aux, ctx));
+         CHKERR(Num_free_Sprimme(aux, ctx));
+      } else if (method == primme_svds_op_AAt) {
+         CHKERR(Num_malloc_Sprimme(primme_svds->nLocal * bs, &aux, ctx));
+         CHKERR(Num_free_Sprimme(aux, ctx));
+      }
+   }
+
+   /* convTestFunATA and convTestFunAug */
+
+   CHKERR(convTestFunSVDS_workspace_Sprimme(method != primme_svds_op_AtA,
+         method != primme_svds_op_AAt, method, ctx));
+
+   /* monitor_single_stage, monitor_stage1 and monitor_stage2 */
+
+   if (!primme->monitorFun || primme->monitorFun == monitor_single_stage ||
+         primme->monitorFun == monitor_stage1 ||
+         primme->monitorFun == monitor_stage2) {
+      HREAL *basisSvals, *basisSVNorms, *lockedSvals, *lockedSVNorms;
+      int *basisSVFlags, *iblockSV, *lockedSVFlags;
+      if (primme_svds->methodStage2 == primme_svds_op_none) {
+         CHKERR(Num_malloc_RHprimme(basisSize, &basisSvals, ctx));
+         CHKERR(Num_malloc_RHprimme(basisSize, &basisSVNorms, ctx));
+         CHKERR(Num_malloc_RHprimme(numLocked, &lockedSvals, ctx));
+         CHKERR(Num_malloc_RHprimme(numLocked, &lockedSVNorms, ctx));
+         CHKERR(monitorFunSVDS_workspace_Sprimme(basisSize, numLocked, ctx));
+         CHKERR(Num_free_RHprimme(basisSvals, ctx));
+         CHKERR(Num_free_RHprimme(basisSVNorms, ctx));
+         CHKERR(Num_free_RHprimme(lockedSvals, ctx));
+         CHKERR(Num_free_RHprimme(lockedSVNorms, ctx));
+      } else if (stage == 0) {
+         int basisSize0 = basisSize + numLocked;
+         CHKERR(Num_malloc_RHprimme(basisSize0, &basisSvals, ctx));
+         CHKERR(Num_malloc_RHprimme(basisSize0, &basisSVNorms, ctx));
+         CHKERR(Num_malloc_iprimme(basisSize0, &basisSVFlags, ctx));
+         CHKERR(Num_malloc_iprimme(bs, &iblockSV, ctx));
+         CHKERR(monitorFunSVDS_workspace_Sprimme(basisSize0, 0, ctx));
+         CHKERR(Num_free_RHprimme(basisSvals, ctx));
+         CHKERR(Num_free_RHprimme(basisSVNorms, ctx));
+         CHKERR(Num_free_iprimme(basisSVFlags, ctx));
+         CHKERR(Num_free_iprimme(iblockSV, ctx));
+      } else {
+         int numLockedSV = numLocked + primme_svds->numSvals - primme->numEvals;
+         CHKERR(Num_malloc_RHprimme(basisSize, &basisSvals, ctx));
+         CHKERR(Num_malloc_RHprimme(basisSize, &basisSVNorms, ctx));
+         CHKERR(Num_malloc_RHprimme(numLockedSV, &lockedSvals, ctx));
+         CHKERR(Num_malloc_RHprimme(numLockedSV, &lockedSVNorms, ctx));
+         CHKERR(Num_malloc_iprimme(numLockedSV, &lockedSVFlags, ctx));
+         CHKERR(monitorFunSVDS_workspace_Sprimme(basisSize, numLockedSV, ctx));
+         CHKERR(Num_free_RHprimme(basisSvals, ctx));
+         CHKERR(Num_free_RHprimme(basisSVNorms, ctx));
+         CHKERR(Num_free_RHprimme(lockedSvals, ctx));
+         CHKERR(Num_free_RHprimme(lockedSVNorms, ctx));
+         CHKERR(Num_free_iprimme(lockedSVFlags, ctx));
+      }
+   }
+
+   *size = ctx.arena->peak;
+
+   Mem_pop_frame(&ctx);
+   CHKERR(Mem_destroy_arena(&ctx));
+
+   return 0;
+}
+
+/*******************************************************************************
+ * Subroutines with the suffix _workspace - Take from the dry arena of the
+ *    context the same blocks that the function with the same name takes.
+ *    See workspace_svds_size.
+ ******************************************************************************/
+
+TEMPLATE_PLEASE
+int matrixMatvecSVDS_workspace_Sprimme(
+      int blockSize, int conj, primme_context ctx) {
+
+   primme_svds_params *primme_svds = ctx.primme_svds;
+
+   if (blockSize <= 0) return 0;
+
+   PRIMME_INT mV = conj ? primme_svds->mLocal : primme_svds->nLocal;
+   PRIMME_INT mW = conj ? primme_svds->nLocal : primme_svds->mLocal;
+   void *V0, *W0;
+   CHKERR(Num_matrix_astype_Sprimme(NULL, mV, blockSize, mV, PRIMME_OP_SCALAR,
+         &V0, NULL, primme_svds->matrixMatvec_type, 1 /* alloc */,
+         0 /* no copy */, ctx));
+   CHKERR(Num_matrix_astype_Sprimme(NULL, mW, blockSize, mW, PRIMME_OP_SCALAR,
+         &W0, NULL, primme_svds->matrixMatvec_type, 1 /* alloc */,
+         0 /* no copy */, ctx));
+   if (V0) CHKERR(Num_free_Sprimme((SCALAR*)V0, ctx));
+   if (W0) CHKERR(Num_free_Sprimme((SCALAR*)W0, ctx));
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int convTestFunSVDS_workspace_Sprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx) {
+
+   primme_svds_params *primme_svds = ctx.primme_svds;
+
+   /* wrapper_svds_Sprimme sets default_convTestFun if none is given */
+
+   int isDefault = !primme_svds->convTestFun ||
+                   primme_svds->convTestFun == default_convTestFun;
+   primme_op_datatype t =
+         isDefault ? PRIMME_OP_SCALAR : primme_svds->convTestFun_type;
+
+   void *leftsvec0 = NULL, *rightsvec0 = NULL;
+   if (givenLeftSvec) {
+      CHKERR(Num_matrix_astype_Sprimme(NULL, primme_svds->mLocal, 1,
+            primme_svds->mLocal, PRIMME_OP_SCALAR, &leftsvec0, NULL, t,
+            1 /* alloc */, 0 /* no copy */, ctx));
+   }
+   if (givenRightSvec) {
+      CHKERR(Num_matrix_astype_Sprimme(NULL, primme_svds->nLocal, 1,
+            primme_svds->nLocal, PRIMME_OP_SCALAR, &rightsvec0, NULL, t,
+            1 /* alloc */, 0 /* no copy */, ctx));
+   }
+
+   /* default_convTestFun computes the residual norm for the augmented */
+
+   if (isDefault && method == primme_svds_op_augmented && givenLeftSvec &&
+         givenRightSvec) {
+      SCALAR *Atu;
+      CHKERR(Num_malloc_Sprimme(
+            primme_svds->mLocal + primme_svds->nLocal, &Atu, ctx));
+      CHKERR(matrixMatvecSVDS_workspace_Sprimme(1, 1 /* trans */, ctx));
+      CHKERR(matrixMatvecSVDS_workspace_Sprimme(1, 0 /* notrans */, ctx));
+      CHKERR(globalSum_Rprimme_svds_workspace(3, 1 /* in place */, ctx));
+      CHKERR(globalSum_Rprimme_svds_workspace(1, 0 /* not in place */, ctx));
+      CHKERR(Num_free_Sprimme(Atu, ctx));
+   }
+
+   if (primme_svds->mLocal > 0 && leftsvec0) {
+      CHKERR(Num_free_Sprimme((SCALAR*)leftsvec0, ctx));
+   }
+   if (primme_svds->nLocal > 0 && rightsvec0) {
+      CHKERR(Num_free_Sprimme((SCALAR*)rightsvec0, ctx));
+   }
+
+   return 0;
+}
+
+TEMPLATE_PLEASE
+int monitorFunSVDS_workspace_Sprimme(
+      int basisSize, int numLocked, primme_context ctx) {
+
+   primme_svds_params *primme_svds = ctx.primme_svds;
+
+   /* wrapper_svds_Sprimme sets default_monitor_svds if none is given */
+
+   primme_op_datatype t = primme_svds->monitorFun ? primme_svds->monitorFun_type
+                                                  : PRIMME_OP_SCALAR;
+
+   void *basisSvals0, *basisNorms0, *lockedSvals0, *lockedNorms0, *LSRes0;
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, basisSize, 1, PRIMME_OP_HREAL,
+         (void **)&basisSvals0, NULL, t, 1 /* alloc */, 0 /* no copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, basisSize, 1, PRIMME_OP_HREAL,
+         (void **)&basisNorms0, NULL, t, 1 /* alloc */, 0 /* no copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, numLocked, 1, PRIMME_OP_HREAL,
+         (void **)&lockedSvals0, NULL, t, 1 /* alloc */, 0 /* no copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, numLocked, 1, PRIMME_OP_HREAL,
+         (void **)&lockedNorms0, NULL, t, 1 /* alloc */, 0 /* no copy */, ctx));
+   CHKERR(Num_matrix_astype_RHprimme(NULL, 1, 1, 1, PRIMME_OP_HREAL,
+         (void **)&LSRes0, NULL, t, 1 /* alloc */, 0 /* no copy */, ctx));
+
+   if (basisSvals0) CHKERR(Num_free_RHprimme((HREAL *)basisSvals0, ctx));
+   if (basisNorms0) CHKERR(Num_free_RHprimme((HREAL *)basisNorms0, ctx));
+   if (lockedSvals0) CHKERR(Num_free_RHprimme((HREAL *)lockedSvals0, ctx));
+   if (lockedNorms0) CHKERR(Num_free_RHprimme((HREAL *)lockedNorms0, ctx));
+   if (LSRes0) CHKERR(Num_free_RHprimme((HREAL *)LSRes0, ctx));
+
+   return 0;
+}
+
+STATIC int globalSum_Rprimme_svds_workspace(
+      int count, int inPlace, primme_context ctx) {
+
+   primme_svds_params *primme_svds = ctx.primme_svds;
+
+   if (!primme_svds || !primme_svds->globalSumReal) return 0;
+
+   void *sendBuf0, *recvBuf0 = NULL;
+   CHKERR(Num_matrix_astype_Rprimme(NULL, 1, count, 1, primme_op_default,
+         &sendBuf0, NULL, primme_svds->globalSumReal_type, 1 /* alloc */,
+         0 /* no copy */, ctx));
+   if (!inPlace) {
+      CHKERR(Num_matrix_astype_Rprimme(NULL, 1, count, 1, primme_op_default,
+            &recvBuf0, NULL, primme_svds->globalSumReal_type, 1 /* alloc */,
+            0 /* no copy */, ctx));
+   }
+   if (sendBuf0) CHKERR(Num_free_Sprimme((SCALAR *)sendBuf0, ctx));
+   if (recvBuf0) CHKERR(Num_free_Sprimme((SCALAR *)recvBuf0, ctx));
+
+   return 0;
+}
+
 STATIC int comp_double(const void *a, const void *b)
 {
    return *(double*)a <= *(double*)b ? -1 : 1;
@@ -846,8 +1342,9 @@ STATIC int copy_last_params_from_svds(int stage, HREAL *svals, SCALAR *svecs,
    /* Copy queue */
    primme->queue = primme_svds->queue;
 
-   /* Copy profile */
+   /* Copy profile and profiler */
    primme->profile = primme_svds->profile;
+   primme->profiler = primme_svds->profiler;
 
    return 0;
 }
@@ -1302,7 +1799,8 @@ int monitorFunSVDS_Sprimme(HREAL *basisSvals, int basisSize, int *basisFlags,
 /*******************************************************************************
  * Subroutine matrixMatvec_eigs - Computes y = B*x where B can be A'*A or A*A' or
  *    the augmented operator, A is the operator defined by
- *    primme_svds->matrixMatvec
+ *    primme_svds->matrixMatvec. A'*A and A*A' are computed by
+ *    primme_svds->matrixNormalMatvec if it is set.
  *
  * INPUT/OUPUT ARRAYS AND PARAMETERS
  * ---------------------------
@@ -1323,7 +1821,7 @@ void matrixMatvec_eigs_Sprimme(void *x_, PRIMME_INT *ldx, void *y_,
       PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
 
    primme_svds_params *primme_svds = (primme_svds_params *) primme->matrix;
-   primme_context ctx = primme_svds_get_context(primme_svds);
+   primme_context ctx = primme_svds_get_context(primme_svds, 1);
    int trans = 1, notrans = 0;
    SCALAR *x = (SCALAR*)x_, *y = (SCALAR*)y_, *aux;
    primme_svds_operator method = &primme_svds->primme == primme ?
@@ -1331,6 +1829,18 @@ void matrixMatvec_eigs_Sprimme(void *x_, PRIMME_INT *ldx, void *y_,
    int i, bs;
    *ierr = 0;
 
+   /* If the user provides the normal operator, apply it in one call, so   */
+   /* that the intermediate A*x or A'*x does not go through memory         */
+
+   if (primme_svds->matrixNormalMatvec &&
+         (method == primme_svds_op_AtA || method == primme_svds_op_AAt)) {
+      int mode = (int)method;
+      primme_svds->matrixNormalMatvec(
+            x, ldx, y, ldy, blockSize, &mode, primme_svds, ierr);
+      primme_svds_free_context(ctx);
+      return;
+   }
+
    switch(method) {
       case primme_svds_op_AtA:
          CHKERRA(Num_malloc_Sprimme(primme_svds->mLocal *
@@ -1609,7 +2119,7 @@ STATIC void default_convTestFun(double *sval, void *leftsvec_, void *rightsvec_,
          rightsvec) {
 
       HREAL rnorm;
-      primme_context ctx = primme_svds_get_context(primme_svds);
+      primme_context ctx = primme_svds_get_context(primme_svds, 1);
       CHKERRA(compute_resNorm(leftsvec, rightsvec, &rnorm, ctx), *ierr = 1);
       primme_svds_free_context(ctx);
 
@@ -1645,7 +2155,7 @@ STATIC void convTestFunATA(double *eval, void *evec, double *rNorm, int *isConv,
    assert(method == primme_svds_op_AtA || method == primme_svds_op_AAt);
    double aNorm = (primme->aNorm > 0.0) ?
       primme->aNorm : primme->stats.estimateLargestSVal;
-   primme_context ctx = primme_svds_get_context(primme_svds);
+   primme_context ctx = primme_svds_get_context(primme_svds, 1);
 
    /* Check machine precision limit */
 
@@ -1710,7 +2220,7 @@ STATIC void convTestFunAug(double *eval, void *evec, double *rNorm, int *isConv,
    assert(method == primme_svds_op_augmented);
    double aNorm = (primme->aNorm > 0.0) ?
       primme->aNorm : primme->stats.estimateLargestSVal;
-   primme_context ctx = primme_svds_get_context(primme_svds);
+   primme_context ctx = primme_svds_get_context(primme_svds, 1);
 
    /* NOTE: Don't check machine precision limit of the residual norm.      */
    /* Regardless of how small the residual is, we don't want to mark as    */
@@ -1897,7 +2407,7 @@ STATIC void monitor_single_stage(void *basisEvals_, int *basisSize,
       double *time, primme_event *event, primme_params *primme, int *err) {
 
    primme_svds_params *primme_svds = (primme_svds_params *) primme->matrix;
-   primme_context ctx = primme_svds_get_context(primme_svds);
+   primme_context ctx = primme_svds_get_context(primme_svds, 1);
 
    int i;
    XREAL *basisEvals = (XREAL*)basisEvals_, *basisNorms = (XREAL*)basisNorms_,
@@ -2035,7 +2545,7 @@ STATIC void monitor_stage1(void *basisEvals_, int *basisSize, int *basisFlags,
       primme_event *event, primme_params *primme, int *err) {
 
    primme_svds_params *primme_svds = (primme_svds_params *) primme->matrix;
-   primme_context ctx = primme_svds_get_context(primme_svds);
+   primme_context ctx = primme_svds_get_context(primme_svds, 1);
 
    XREAL *basisEvals = (XREAL*)basisEvals_, *basisNorms = (XREAL*)basisNorms_,
          *lockedEvals = (XREAL*)lockedEvals_, *lockedNorms = (XREAL*)lockedNorms_,
@@ -2175,7 +2685,7 @@ STATIC void monitor_stage2(void *basisEvals_, int *basisSize, int *basisFlags,
          *LSRes = (XREAL*)LSRes_;
    assert(event != NULL && primme != NULL);
    primme_svds_params *primme_svds = (primme_svds_params *) primme->matrix;
-   primme_context ctx = primme_svds_get_context(primme_svds);
+   primme_context ctx = primme_svds_get_context(primme_svds, 1);
    int i;
 
    /* Included the converged triplets after the first stage as locked */
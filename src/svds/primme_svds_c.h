@@ -131,6 +131,301 @@ int Xprimme_svds_auxdprimme(void *svals, dummy_type_dprimme *svecs, void *resNor
 int wrapper_svds_dprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(workspace_svds_size)
+#  define workspace_svds_size CONCAT(workspace_svds_size,SCALAR_SUF)
+#endif
+int workspace_svds_sizedprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(stage_svds_workspace)
+#  define stage_svds_workspace CONCAT(stage_svds_workspace,SCALAR_SUF)
+#endif
+int stage_svds_workspacedprimme(int stage, int nconv, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(callbacks_svds_workspace)
+#  define callbacks_svds_workspace CONCAT(callbacks_svds_workspace,SCALAR_SUF)
+#endif
+int callbacks_svds_workspacedprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Sprimme)
+#  define matrixMatvecSVDS_workspace_Sprimme CONCAT(matrixMatvecSVDS_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Rprimme)
+#  define matrixMatvecSVDS_workspace_Rprimme CONCAT(matrixMatvecSVDS_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SHprimme)
+#  define matrixMatvecSVDS_workspace_SHprimme CONCAT(matrixMatvecSVDS_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RHprimme)
+#  define matrixMatvecSVDS_workspace_RHprimme CONCAT(matrixMatvecSVDS_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SXprimme)
+#  define matrixMatvecSVDS_workspace_SXprimme CONCAT(matrixMatvecSVDS_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RXprimme)
+#  define matrixMatvecSVDS_workspace_RXprimme CONCAT(matrixMatvecSVDS_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Shprimme)
+#  define matrixMatvecSVDS_workspace_Shprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Rhprimme)
+#  define matrixMatvecSVDS_workspace_Rhprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Ssprimme)
+#  define matrixMatvecSVDS_workspace_Ssprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Rsprimme)
+#  define matrixMatvecSVDS_workspace_Rsprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Sdprimme)
+#  define matrixMatvecSVDS_workspace_Sdprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Rdprimme)
+#  define matrixMatvecSVDS_workspace_Rdprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Sqprimme)
+#  define matrixMatvecSVDS_workspace_Sqprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_Rqprimme)
+#  define matrixMatvecSVDS_workspace_Rqprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SXhprimme)
+#  define matrixMatvecSVDS_workspace_SXhprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RXhprimme)
+#  define matrixMatvecSVDS_workspace_RXhprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SXsprimme)
+#  define matrixMatvecSVDS_workspace_SXsprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RXsprimme)
+#  define matrixMatvecSVDS_workspace_RXsprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SXdprimme)
+#  define matrixMatvecSVDS_workspace_SXdprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RXdprimme)
+#  define matrixMatvecSVDS_workspace_RXdprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SXqprimme)
+#  define matrixMatvecSVDS_workspace_SXqprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RXqprimme)
+#  define matrixMatvecSVDS_workspace_RXqprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SHhprimme)
+#  define matrixMatvecSVDS_workspace_SHhprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RHhprimme)
+#  define matrixMatvecSVDS_workspace_RHhprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SHsprimme)
+#  define matrixMatvecSVDS_workspace_SHsprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RHsprimme)
+#  define matrixMatvecSVDS_workspace_RHsprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SHdprimme)
+#  define matrixMatvecSVDS_workspace_SHdprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RHdprimme)
+#  define matrixMatvecSVDS_workspace_RHdprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_SHqprimme)
+#  define matrixMatvecSVDS_workspace_SHqprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(matrixMatvecSVDS_workspace_RHqprimme)
+#  define matrixMatvecSVDS_workspace_RHqprimme CONCAT(matrixMatvecSVDS_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int matrixMatvecSVDS_workspace_dprimme(
+      int blockSize, int conj, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Sprimme)
+#  define convTestFunSVDS_workspace_Sprimme CONCAT(convTestFunSVDS_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Rprimme)
+#  define convTestFunSVDS_workspace_Rprimme CONCAT(convTestFunSVDS_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SHprimme)
+#  define convTestFunSVDS_workspace_SHprimme CONCAT(convTestFunSVDS_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RHprimme)
+#  define convTestFunSVDS_workspace_RHprimme CONCAT(convTestFunSVDS_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SXprimme)
+#  define convTestFunSVDS_workspace_SXprimme CONCAT(convTestFunSVDS_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RXprimme)
+#  define convTestFunSVDS_workspace_RXprimme CONCAT(convTestFunSVDS_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Shprimme)
+#  define convTestFunSVDS_workspace_Shprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Rhprimme)
+#  define convTestFunSVDS_workspace_Rhprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Ssprimme)
+#  define convTestFunSVDS_workspace_Ssprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Rsprimme)
+#  define convTestFunSVDS_workspace_Rsprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Sdprimme)
+#  define convTestFunSVDS_workspace_Sdprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Rdprimme)
+#  define convTestFunSVDS_workspace_Rdprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Sqprimme)
+#  define convTestFunSVDS_workspace_Sqprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_Rqprimme)
+#  define convTestFunSVDS_workspace_Rqprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SXhprimme)
+#  define convTestFunSVDS_workspace_SXhprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RXhprimme)
+#  define convTestFunSVDS_workspace_RXhprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SXsprimme)
+#  define convTestFunSVDS_workspace_SXsprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RXsprimme)
+#  define convTestFunSVDS_workspace_RXsprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SXdprimme)
+#  define convTestFunSVDS_workspace_SXdprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RXdprimme)
+#  define convTestFunSVDS_workspace_RXdprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SXqprimme)
+#  define convTestFunSVDS_workspace_SXqprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RXqprimme)
+#  define convTestFunSVDS_workspace_RXqprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SHhprimme)
+#  define convTestFunSVDS_workspace_SHhprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RHhprimme)
+#  define convTestFunSVDS_workspace_RHhprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SHsprimme)
+#  define convTestFunSVDS_workspace_SHsprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RHsprimme)
+#  define convTestFunSVDS_workspace_RHsprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SHdprimme)
+#  define convTestFunSVDS_workspace_SHdprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RHdprimme)
+#  define convTestFunSVDS_workspace_RHdprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_SHqprimme)
+#  define convTestFunSVDS_workspace_SHqprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(convTestFunSVDS_workspace_RHqprimme)
+#  define convTestFunSVDS_workspace_RHqprimme CONCAT(convTestFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int convTestFunSVDS_workspace_dprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Sprimme)
+#  define monitorFunSVDS_workspace_Sprimme CONCAT(monitorFunSVDS_workspace_,SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Rprimme)
+#  define monitorFunSVDS_workspace_Rprimme CONCAT(monitorFunSVDS_workspace_,REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SHprimme)
+#  define monitorFunSVDS_workspace_SHprimme CONCAT(monitorFunSVDS_workspace_,HOST_SCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RHprimme)
+#  define monitorFunSVDS_workspace_RHprimme CONCAT(monitorFunSVDS_workspace_,HOST_REAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SXprimme)
+#  define monitorFunSVDS_workspace_SXprimme CONCAT(monitorFunSVDS_workspace_,XSCALAR_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RXprimme)
+#  define monitorFunSVDS_workspace_RXprimme CONCAT(monitorFunSVDS_workspace_,XREAL_SUF)
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Shprimme)
+#  define monitorFunSVDS_workspace_Shprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Rhprimme)
+#  define monitorFunSVDS_workspace_Rhprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Ssprimme)
+#  define monitorFunSVDS_workspace_Ssprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Rsprimme)
+#  define monitorFunSVDS_workspace_Rsprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Sdprimme)
+#  define monitorFunSVDS_workspace_Sdprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Rdprimme)
+#  define monitorFunSVDS_workspace_Rdprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Sqprimme)
+#  define monitorFunSVDS_workspace_Sqprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_Rqprimme)
+#  define monitorFunSVDS_workspace_Rqprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(STEM_C,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SXhprimme)
+#  define monitorFunSVDS_workspace_SXhprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(h,k)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RXhprimme)
+#  define monitorFunSVDS_workspace_RXhprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,h),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SXsprimme)
+#  define monitorFunSVDS_workspace_SXsprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RXsprimme)
+#  define monitorFunSVDS_workspace_RXsprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SXdprimme)
+#  define monitorFunSVDS_workspace_SXdprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RXdprimme)
+#  define monitorFunSVDS_workspace_RXdprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SXqprimme)
+#  define monitorFunSVDS_workspace_SXqprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RXqprimme)
+#  define monitorFunSVDS_workspace_RXqprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SHhprimme)
+#  define monitorFunSVDS_workspace_SHhprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RHhprimme)
+#  define monitorFunSVDS_workspace_RHhprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SHsprimme)
+#  define monitorFunSVDS_workspace_SHsprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(s,c)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RHsprimme)
+#  define monitorFunSVDS_workspace_RHsprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,s),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SHdprimme)
+#  define monitorFunSVDS_workspace_SHdprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(d,z)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RHdprimme)
+#  define monitorFunSVDS_workspace_RHdprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,d),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_SHqprimme)
+#  define monitorFunSVDS_workspace_SHqprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,USE_ARITH(q,w)),primme),))
+#endif
+#if !defined(CHECK_TEMPLATE) && !defined(monitorFunSVDS_workspace_RHqprimme)
+#  define monitorFunSVDS_workspace_RHqprimme CONCAT(monitorFunSVDS_workspace_,CONCAT(CONCAT(CONCAT(,q),primme),))
+#endif
+int monitorFunSVDS_workspace_dprimme(
+      int basisSize, int numLocked, primme_context ctx);
+#if !defined(CHECK_TEMPLATE) && !defined(globalSum_Rprimme_svds_workspace)
+#  define globalSum_Rprimme_svds_workspace CONCAT(globalSum_Rprimme_svds_workspace,SCALAR_SUF)
+#endif
+int globalSum_Rprimme_svds_workspacedprimme(
+      int count, int inPlace, primme_context ctx);
 #if !defined(CHECK_TEMPLATE) && !defined(comp_double)
 #  define comp_double CONCAT(comp_double,SCALAR_SUF)
 #endif
@@ -685,6 +980,19 @@ int Xprimme_svds_auxhprimme(void *svals, dummy_type_hprimme *svecs, void *resNor
 int wrapper_svds_hprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizehprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacehprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacehprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_hprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_hprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_hprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacehprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublehprimme(const void *a, const void *b);
 int copy_last_params_from_svdshprimme(int stage, dummy_type_sprimme *svals, dummy_type_hprimme *svecs,
       dummy_type_sprimme *rnorms, int *allocatedTargetShifts,
@@ -747,6 +1055,19 @@ int Xprimme_svds_auxkprimme(void *svals, dummy_type_kprimme *svecs, void *resNor
 int wrapper_svds_kprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizekprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacekprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacekprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_kprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_kprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_kprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacekprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublekprimme(const void *a, const void *b);
 int copy_last_params_from_svdskprimme(int stage, dummy_type_sprimme *svals, dummy_type_kprimme *svecs,
       dummy_type_sprimme *rnorms, int *allocatedTargetShifts,
@@ -809,6 +1130,19 @@ int Xprimme_svds_auxsprimme(void *svals, dummy_type_sprimme *svecs, void *resNor
 int wrapper_svds_sprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizesprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacesprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacesprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_sprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_sprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_sprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacesprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublesprimme(const void *a, const void *b);
 int copy_last_params_from_svdssprimme(int stage, dummy_type_sprimme *svals, dummy_type_sprimme *svecs,
       dummy_type_sprimme *rnorms, int *allocatedTargetShifts,
@@ -871,6 +1205,19 @@ int Xprimme_svds_auxcprimme(void *svals, dummy_type_cprimme *svecs, void *resNor
 int wrapper_svds_cprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizecprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacecprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacecprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_cprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_cprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_cprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacecprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublecprimme(const void *a, const void *b);
 int copy_last_params_from_svdscprimme(int stage, dummy_type_sprimme *svals, dummy_type_cprimme *svecs,
       dummy_type_sprimme *rnorms, int *allocatedTargetShifts,
@@ -933,6 +1280,19 @@ int Xprimme_svds_auxzprimme(void *svals, dummy_type_zprimme *svecs, void *resNor
 int wrapper_svds_zprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizezprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacezprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacezprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_zprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_zprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_zprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacezprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublezprimme(const void *a, const void *b);
 int copy_last_params_from_svdszprimme(int stage, dummy_type_dprimme *svals, dummy_type_zprimme *svecs,
       dummy_type_dprimme *rnorms, int *allocatedTargetShifts,
@@ -995,6 +1355,19 @@ int Xprimme_svds_auxmagma_hprimme(void *svals, dummy_type_hprimme *svecs, void *
 int wrapper_svds_magma_hprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizemagma_hprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacemagma_hprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacemagma_hprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_magma_hprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_magma_hprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_magma_hprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacemagma_hprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublemagma_hprimme(const void *a, const void *b);
 int copy_last_params_from_svdsmagma_hprimme(int stage, dummy_type_sprimme *svals, dummy_type_magma_hprimme *svecs,
       dummy_type_sprimme *rnorms, int *allocatedTargetShifts,
@@ -1057,6 +1430,19 @@ int Xprimme_svds_auxmagma_kprimme(void *svals, dummy_type_kprimme *svecs, void *
 int wrapper_svds_magma_kprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizemagma_kprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacemagma_kprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacemagma_kprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_magma_kprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_magma_kprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_magma_kprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacemagma_kprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublemagma_kprimme(const void *a, const void *b);
 int copy_last_params_from_svdsmagma_kprimme(int stage, dummy_type_sprimme *svals, dummy_type_magma_kprimme *svecs,
       dummy_type_sprimme *rnorms, int *allocatedTargetShifts,
@@ -1119,6 +1505,19 @@ int Xprimme_svds_auxmagma_sprimme(void *svals, dummy_type_sprimme *svecs, void *
 int wrapper_svds_magma_sprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizemagma_sprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacemagma_sprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacemagma_sprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_magma_sprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_magma_sprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_magma_sprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacemagma_sprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublemagma_sprimme(const void *a, const void *b);
 int copy_last_params_from_svdsmagma_sprimme(int stage, dummy_type_sprimme *svals, dummy_type_magma_sprimme *svecs,
       dummy_type_sprimme *rnorms, int *allocatedTargetShifts,
@@ -1181,6 +1580,19 @@ int Xprimme_svds_auxmagma_cprimme(void *svals, dummy_type_cprimme *svecs, void *
 int wrapper_svds_magma_cprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizemagma_cprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacemagma_cprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacemagma_cprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_magma_cprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_magma_cprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_magma_cprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacemagma_cprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublemagma_cprimme(const void *a, const void *b);
 int copy_last_params_from_svdsmagma_cprimme(int stage, dummy_type_sprimme *svals, dummy_type_magma_cprimme *svecs,
       dummy_type_sprimme *rnorms, int *allocatedTargetShifts,
@@ -1243,6 +1655,19 @@ int Xprimme_svds_auxmagma_dprimme(void *svals, dummy_type_dprimme *svecs, void *
 int wrapper_svds_magma_dprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizemagma_dprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacemagma_dprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacemagma_dprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_magma_dprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_magma_dprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_magma_dprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacemagma_dprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublemagma_dprimme(const void *a, const void *b);
 int copy_last_params_from_svdsmagma_dprimme(int stage, dummy_type_dprimme *svals, dummy_type_magma_dprimme *svecs,
       dummy_type_dprimme *rnorms, int *allocatedTargetShifts,
@@ -1305,6 +1730,19 @@ int Xprimme_svds_auxmagma_zprimme(void *svals, dummy_type_zprimme *svecs, void *
 int wrapper_svds_magma_zprimme(void *svals_, void *svecs_, void *resNorms_,
       primme_op_datatype svals_resNorms_type, primme_op_datatype svecs_type,
       int *outInitSize, primme_context ctx);
+int workspace_svds_sizemagma_zprimme(primme_op_datatype svals_resNorms_type,
+      primme_op_datatype svecs_type, size_t *size, primme_context ctx);
+int stage_svds_workspacemagma_zprimme(int stage, int nconv, primme_context ctx);
+int callbacks_svds_workspacemagma_zprimme(int stage, primme_params *primme,
+      size_t *size, primme_context ctx);
+int matrixMatvecSVDS_workspace_magma_zprimme(
+      int blockSize, int conj, primme_context ctx);
+int convTestFunSVDS_workspace_magma_zprimme(int givenLeftSvec, int givenRightSvec,
+      int method, primme_context ctx);
+int monitorFunSVDS_workspace_magma_zprimme(
+      int basisSize, int numLocked, primme_context ctx);
+int globalSum_Rprimme_svds_workspacemagma_zprimme(
+      int count, int inPlace, primme_context ctx);
 int comp_doublemagma_zprimme(const void *a, const void *b);
 int copy_last_params_from_svdsmagma_zprimme(int stage, dummy_type_dprimme *svals, dummy_type_magma_zprimme *svecs,
       dummy_type_dprimme *rnorms, int *allocatedTargetShifts,
@@ -55,6 +55,8 @@ typedef union {
    PRIMME_INT int_v;
    void (*matFunc_v) (void*,PRIMME_INT*,void*,PRIMME_INT*,int*,int*,struct primme_svds_params*,int*);
    void (*globalSumRealFunc_v) (void *,void *,int *,struct primme_svds_params*,int*);
+   void (*globalSumRealBeginFunc_v) (void *,void *,int *,struct primme_svds_params*,void**,int*);
+   void (*globalSumRealWaitFunc_v) (void **,struct primme_svds_params*,int*);
    void (*broadcastRealFunc_v) (void *,int *,struct primme_svds_params*,int*);
    void (*convTestFun_v)(double *sval, void *leftsvec, void *rightsvec,
          double *rNorm, int *method, int *isconv,
@@ -72,6 +74,10 @@ typedef const char *str_v;
 static void copy_params_from_svds(primme_svds_params *primme_svds, int stage);
 static void globalSumRealSvds(void *sendBuf, void *recvBuf, int *count, 
                          primme_params *primme, int *ierr);
+static void globalSumRealBeginSvds(void *sendBuf, void *recvBuf, int *count,
+      primme_params *primme, void **request, int *ierr);
+static void globalSumRealWaitSvds(
+      void **request, primme_params *primme, int *ierr);
 static void broadcastRealSvds(
       void *buffer, int *count, primme_params *primme, int *ierr);
 
@@ -126,9 +132,13 @@ void primme_svds_initialize(primme_svds_params *primme_svds) {
    primme_svds->commInfo                = NULL;
    primme_svds->globalSumReal           = NULL;
    primme_svds->globalSumReal_type      = primme_op_default;
+   primme_svds->globalSumRealBegin      = NULL;
+   primme_svds->globalSumRealWait       = NULL;
    primme_svds->broadcastReal           = NULL;
    primme_svds->broadcastReal_type      = primme_op_default;
    primme_svds->internalPrecision       = primme_op_default;
+   primme_svds->workspace               = NULL;
+   primme_svds->lworkspace              = 0;
 
    /* Use these pointers to provide matrix/preconditioner */
    primme_svds->matrix                  = NULL;
@@ -139,6 +149,7 @@ void primme_svds_initialize(primme_svds_params *primme_svds) {
    primme_svds->matrixMatvec_type       = primme_op_default;
    primme_svds->applyPreconditioner     = NULL;
    primme_svds->applyPreconditioner_type= primme_op_default;
+   primme_svds->matrixNormalMatvec      = NULL;
 
    /* Other important parameters users may set */
    primme_svds->aNorm                   = 0.0L;
@@ -183,6 +194,7 @@ void primme_svds_initialize(primme_svds_params *primme_svds) {
    primme_svds->monitor                 = NULL;
    primme_svds->queue                   = NULL;
    primme_svds->profile                 = NULL;
+   primme_svds->profiler                = NULL;
 
    primme_initialize(&primme_svds->primme);
    primme_initialize(&primme_svds->primmeStage2);
@@ -344,10 +356,22 @@ static void copy_params_from_svds(primme_svds_params *primme_svds, int stage) {
    if (primme_svds->globalSumReal != NULL) {
       primme->globalSumReal = globalSumRealSvds;
    }
+   if (primme_svds->globalSumRealBegin != NULL &&
+         primme_svds->globalSumRealWait != NULL) {
+      primme->globalSumRealBegin = globalSumRealBeginSvds;
+      primme->globalSumRealWait = globalSumRealWaitSvds;
+   }
    if (primme_svds->broadcastReal != NULL) {
       primme->broadcastReal = broadcastRealSvds;
    }
 
+   /* The eigensolver shares the arena set on primme_svds->workspace */
+
+   if (primme_svds->workspace != NULL) {
+      primme->workspace = primme_svds->workspace;
+      primme->lworkspace = primme_svds->lworkspace;
+   }
+
    switch(method) {
    case primme_svds_op_AtA:
       primme->n = primme_svds->n;
@@ -469,6 +493,7 @@ fprintf(outputFile, "// ---------------------------------------------------\n"
    PRINT(locking, %d);
    PRINT(initSize, %d);
    PRINT(numOrthoConst, %d);
+   PRINT(lworkspace, %zu);
    fprintf(outputFile, "primme_svds.iseed =");
    for (i=0; i<4;i++) {
       fprintf(outputFile, " %" PRIMME_INT_P, primme_svds.iseed[i]);
@@ -515,6 +540,64 @@ fprintf(outputFile, "// ---------------------------------------------------\n"
 }
 
 
+/*******************************************************************************
+ * Subroutine primme_svds_get_workspace_size - Return the size of the
+ *    workspace that the solver of the given precision takes for the problem in
+ *    primme_svds; that is, the value that the call to the solver with svals,
+ *    svecs and resNorms set to NULL returns in primme_svds->lworkspace.
+ *
+ * INPUT PARAMETERS
+ * ----------------------------------
+ * type        precision of svecs: primme_op_half, primme_op_float or
+ *             primme_op_double (hprimme_svds, sprimme_svds and dprimme_svds)
+ * isComplex   if nonzero, svecs is complex (kprimme_svds, cprimme_svds and
+ *             zprimme_svds)
+ *
+ * INPUT/OUTPUT PARAMETERS
+ * ----------------------------------
+ * primme_svds Structure containing various solver parameters and statistics;
+ *             the default values of the parameters are set as in the solver
+ *
+ * OUTPUT PARAMETERS
+ * ----------------------------------
+ * lworkspace  size of the workspace in bytes
+ *
+ * Return Value
+ * ------------
+ * error code from the solver
+ *
+ ******************************************************************************/
+
+int primme_svds_get_workspace_size(primme_svds_params *primme_svds,
+      primme_op_datatype type, int isComplex, size_t *lworkspace) {
+
+   /* The query returns the size in primme_svds->lworkspace; keep the */
+   /* value of the caller                                              */
+
+   size_t lworkspace0 = primme_svds->lworkspace;
+   int ret;
+   switch (type) {
+   case primme_op_half:
+      ret = isComplex ? kprimme_svds(NULL, NULL, NULL, primme_svds)
+                      : hprimme_svds(NULL, NULL, NULL, primme_svds);
+      break;
+   case primme_op_float:
+      ret = isComplex ? cprimme_svds(NULL, NULL, NULL, primme_svds)
+                      : sprimme_svds(NULL, NULL, NULL, primme_svds);
+      break;
+   case primme_op_default:
+   case primme_op_double:
+      ret = isComplex ? zprimme_svds(NULL, NULL, NULL, primme_svds)
+                      : dprimme_svds(NULL, NULL, NULL, primme_svds);
+      break;
+   default: ret = PRIMME_FUNCTION_UNAVAILABLE;
+   }
+   if (ret == 0) *lworkspace = primme_svds->lworkspace;
+   primme_svds->lworkspace = lworkspace0;
+
+   return ret;
+}
+
 /*******************************************************************************
  * Subroutine primme_svds_free - Free memory resources allocated by Sprimme_svds
  * 
@@ -541,6 +624,26 @@ static void globalSumRealSvds(void *sendBuf, void *recvBuf, int *count,
    primme_svds->globalSumReal(sendBuf, recvBuf, count, primme_svds, ierr);
 }
 
+/*******************************************************************************
+ * Subroutines globalSumRealBeginSvds and globalSumRealWaitSvds - implementation
+ *    of primme_params' globalSumRealBegin and globalSumRealWait that use the
+ *    callbacks defined in primme_svds_params.
+ * 
+ ******************************************************************************/
+
+static void globalSumRealBeginSvds(void *sendBuf, void *recvBuf, int *count,
+      primme_params *primme, void **request, int *ierr) {
+   primme_svds_params *primme_svds = (primme_svds_params *) primme->matrix;
+   primme_svds->globalSumRealBegin(
+         sendBuf, recvBuf, count, primme_svds, request, ierr);
+}
+
+static void globalSumRealWaitSvds(
+      void **request, primme_params *primme, int *ierr) {
+   primme_svds_params *primme_svds = (primme_svds_params *) primme->matrix;
+   primme_svds->globalSumRealWait(request, primme_svds, ierr);
+}
+
 /*******************************************************************************
  * Subroutine broadcastRealSvds - implementation of primme_params' broadcastReal
  *    that uses the callback defined in primme_svds_params.
@@ -603,6 +706,9 @@ int primme_svds_get_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_applyPreconditioner_type:
          *(PRIMME_INT*)value = primme_svds->applyPreconditioner_type;
          break;
+      case PRIMME_SVDS_matrixNormalMatvec :
+         v->matFunc_v = primme_svds->matrixNormalMatvec;
+         break;
       case PRIMME_SVDS_numProcs :
          *(PRIMME_INT*)value = primme_svds->numProcs;
          break;
@@ -624,6 +730,12 @@ int primme_svds_get_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_globalSumReal_type:
          *(PRIMME_INT*)value = primme_svds->globalSumReal_type;
          break;
+      case PRIMME_SVDS_globalSumRealBegin :
+         v->globalSumRealBeginFunc_v = primme_svds->globalSumRealBegin;
+         break;
+      case PRIMME_SVDS_globalSumRealWait :
+         v->globalSumRealWaitFunc_v = primme_svds->globalSumRealWait;
+         break;
       case PRIMME_SVDS_broadcastReal :
          v->broadcastRealFunc_v = primme_svds->broadcastReal;
          break;
@@ -633,6 +745,12 @@ int primme_svds_get_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_internalPrecision:
          *(PRIMME_INT*)value = primme_svds->internalPrecision;
          break;
+      case PRIMME_SVDS_workspace:
+         *(ptr_v*)value = primme_svds->workspace;
+         break;
+      case PRIMME_SVDS_lworkspace:
+         *(PRIMME_INT*)value = (PRIMME_INT)primme_svds->lworkspace;
+         break;
       case PRIMME_SVDS_numSvals :
          *(PRIMME_INT*)value = primme_svds->numSvals;
          break;
@@ -767,6 +885,9 @@ int primme_svds_get_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_profile:
          *(str_v*)value = primme_svds->profile;
          break;
+      case PRIMME_SVDS_profiler:
+         *(ptr_v*)value = primme_svds->profiler;
+         break;
       default:
          return 1;
    }
@@ -822,6 +943,9 @@ int primme_svds_set_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_applyPreconditioner_type:
          primme_svds->applyPreconditioner_type = (primme_op_datatype)*(PRIMME_INT*)value;
          break;
+      case PRIMME_SVDS_matrixNormalMatvec :
+         primme_svds->matrixNormalMatvec = v.matFunc_v;
+         break;
       case PRIMME_SVDS_numProcs :
          if (*(PRIMME_INT*)value > INT_MAX) return 1; else
          primme_svds->numProcs = (int)*(PRIMME_INT*)value;
@@ -845,12 +969,25 @@ int primme_svds_set_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_globalSumReal_type:
          primme_svds->globalSumReal_type = (primme_op_datatype)*(PRIMME_INT*)value;
          break;
+      case PRIMME_SVDS_globalSumRealBegin :
+         primme_svds->globalSumRealBegin = v.globalSumRealBeginFunc_v;
+         break;
+      case PRIMME_SVDS_globalSumRealWait :
+         primme_svds->globalSumRealWait = v.globalSumRealWaitFunc_v;
+         break;
       case PRIMME_SVDS_broadcastReal :
          primme_svds->broadcastReal = v.broadcastRealFunc_v;
          break;
       case PRIMME_SVDS_internalPrecision:
          primme_svds->internalPrecision = (primme_op_datatype)*(PRIMME_INT*)value;
          break;
+      case PRIMME_SVDS_workspace:
+         primme_svds->workspace = (ptr_v)value;
+         break;
+      case PRIMME_SVDS_lworkspace:
+         if (*(PRIMME_INT*)value < 0) return 1;
+         primme_svds->lworkspace = (size_t)*(PRIMME_INT*)value;
+         break;
       case PRIMME_SVDS_broadcastReal_type:
          primme_svds->broadcastReal_type = (primme_op_datatype)*(PRIMME_INT*)value;
          break;
@@ -988,6 +1125,9 @@ int primme_svds_set_member(primme_svds_params *primme_svds,
       case PRIMME_SVDS_profile:
          primme_svds->profile = (str_v)value;
          break;
+      case PRIMME_SVDS_profiler:
+         primme_svds->profiler = (primme_profiler *)value;
+         break;
       default:
          return 1;
    }
@@ -1041,6 +1181,7 @@ int primme_svds_member_info(primme_svds_params_label *label,
    IF_IS(matrixMatvec_type);
    IF_IS(applyPreconditioner);
    IF_IS(applyPreconditioner_type);
+   IF_IS(matrixNormalMatvec);
    IF_IS(numProcs);
    IF_IS(procID);
    IF_IS(mLocal);
@@ -1048,9 +1189,13 @@ int primme_svds_member_info(primme_svds_params_label *label,
    IF_IS(commInfo);
    IF_IS(globalSumReal);
    IF_IS(globalSumReal_type);
+   IF_IS(globalSumRealBegin);
+   IF_IS(globalSumRealWait);
    IF_IS(broadcastReal);
    IF_IS(broadcastReal_type);
    IF_IS(internalPrecision);
+   IF_IS(workspace);
+   IF_IS(lworkspace);
    IF_IS(numSvals);
    IF_IS(target);
    IF_IS(numTargetShifts);
@@ -1095,6 +1240,7 @@ int primme_svds_member_info(primme_svds_params_label *label,
    IF_IS(monitor);
    IF_IS(queue);
    IF_IS(profile);
+   IF_IS(profiler);
 #undef IF_IS
 
    /* Return error if no label was found */
@@ -1110,6 +1256,7 @@ int primme_svds_member_info(primme_svds_params_label *label,
       case PRIMME_SVDS_globalSumReal_type:
       case PRIMME_SVDS_broadcastReal_type:
       case PRIMME_SVDS_internalPrecision:
+      case PRIMME_SVDS_lworkspace:
       case PRIMME_SVDS_m: 
       case PRIMME_SVDS_n:
       case PRIMME_SVDS_numSvals:
@@ -1171,8 +1318,11 @@ int primme_svds_member_info(primme_svds_params_label *label,
       case PRIMME_SVDS_primmeStage2:
       case PRIMME_SVDS_matrixMatvec: 
       case PRIMME_SVDS_applyPreconditioner:
+      case PRIMME_SVDS_matrixNormalMatvec:
       case PRIMME_SVDS_commInfo:
       case PRIMME_SVDS_globalSumReal:
+      case PRIMME_SVDS_globalSumRealBegin:
+      case PRIMME_SVDS_globalSumRealWait:
       case PRIMME_SVDS_broadcastReal:
       case PRIMME_SVDS_matrix:
       case PRIMME_SVDS_preconditioner:
@@ -1182,6 +1332,8 @@ int primme_svds_member_info(primme_svds_params_label *label,
       case PRIMME_SVDS_monitorFun:
       case PRIMME_SVDS_monitor:
       case PRIMME_SVDS_queue:
+      case PRIMME_SVDS_workspace:
+      case PRIMME_SVDS_profiler:
       if (type) *type = primme_pointer;
       if (arity) *arity = 1;
       break;
@@ -29,26 +29,68 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <string.h>
 #include <math.h>
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
 #include "mmio.h"
 #include "primme.h"
 #include "csr.h"
 
 static int readfullMTX(const char *mtfile, SCALAR **A, int **JA, int **IA, int *m, int *n, int *nnz);
+static int readCacheCSR(const char *cacheFileName, CSRMatrix *matrix);
+static int writeCacheCSR(const char *cacheFileName, const CSRMatrix *matrix);
 #ifndef USE_DOUBLECOMPLEX
 static int readUpperMTX(const char *mtfile, double **A, int **JA, int **IA, int *n, int *nnz);
 int ssrcsr(int *job, int *value2, int *nrow, double *a, int *ja, int *ia, 
    int *nzmax, double *ao, int *jao, int *iao, int *indu, int *iwk, int *ierr);
 #endif
 
-int readMatrixNative(const char* matrixFileName, CSRMatrix **matrix_, double *fnorm) {
+static int endsWith(const char *s, const char *suffix) {
+   size_t ls = strlen(s), lsuffix = strlen(suffix);
+   return ls >= lsuffix && !strcmp(&s[ls-lsuffix], suffix);
+}
+
+/******************************************************************************
+ * Read a matrix from a MatrixMarket file (.mtx), an upper triangular
+ * coordinate file (ending in U) or a binary CSR cache (.csr). If
+ * cacheFileName is not NULL or empty, the matrix is taken from that cache
+ * when it is newer than the matrix file; otherwise the cache is written.
+ *
+******************************************************************************/
+
+int readMatrixNative(const char* matrixFileName, const char *cacheFileName,
+      CSRMatrix **matrix_, double *fnorm) {
    int ret;
    CSRMatrix *matrix;
+   struct stat stMatrix, stCache;
 
    matrix = (CSRMatrix*)primme_calloc(1, sizeof(CSRMatrix), "CSRMatrix");
-   if (!strcmp("mtx", &matrixFileName[strlen(matrixFileName)-3])) {  
+   memset(matrix, 0, sizeof(CSRMatrix));
+   if (cacheFileName && !cacheFileName[0]) cacheFileName = NULL;
+   if (endsWith(matrixFileName, ".csr")) {
+      /* binary CSR cache */
+      ret = readCacheCSR(matrixFileName, matrix);
+      if (ret < 0) {
+         fprintf(stderr, "ERROR: Could not read matrix file\n");
+         return(-1);
+      }
+      cacheFileName = NULL;
+   }
+   else if (cacheFileName && stat(matrixFileName, &stMatrix) == 0 &&
+         stat(cacheFileName, &stCache) == 0 &&
+         stCache.st_mtime >= stMatrix.st_mtime &&
+         readCacheCSR(cacheFileName, matrix) == 0) {
+      cacheFileName = NULL;
+   }
+   else if (endsWith(matrixFileName, "mtx")) {  
       /* coordinate format storing both lower and upper triangular parts */
       ret = readfullMTX(matrixFileName, &matrix->AElts, &matrix->JA, 
          &matrix->IA, &matrix->m, &matrix->n, &matrix->nnz);
@@ -62,6 +104,7 @@ int readMatrixNative(const char* matrixFileName, CSRMatrix **matrix_, double *fn
 #ifndef USE_DOUBLECOMPLEX
       ret = readUpperMTX(matrixFileName, &matrix->AElts, &matrix->JA,
          &matrix->IA, &matrix->n, &matrix->nnz);
+      matrix->m = matrix->n;
 #else
       /* TODO: support this in complex arithmetic */
       ret = -1;
@@ -80,6 +123,28 @@ int readMatrixNative(const char* matrixFileName, CSRMatrix **matrix_, double *fn
          return(-1);
       }
    }
+
+   /* Write the cache and use the arrays from it, which saves the memory  */
+   /* of the pages not used and checks that the cache is fine             */
+
+   if (cacheFileName) {
+      CSRMatrix cached;
+      memset(&cached, 0, sizeof(cached));
+      if (writeCacheCSR(cacheFileName, matrix) == 0 &&
+            readCacheCSR(cacheFileName, &cached) == 0) {
+         free(matrix->AElts);
+         free(matrix->IA);
+         free(matrix->JA);
+         *matrix = cached;
+      }
+      else {
+         fprintf(stderr, "WARNING: Could not write matrix cache '%s'\n",
+               cacheFileName);
+      }
+   }
+
+   matrix->op = CONCAT(SCALAR_SUF,_csr_create)(matrix->m, matrix->n,
+         matrix->IA, matrix->JA, matrix->AElts, 1);
    *matrix_ = matrix;
    if (fnorm)
       *fnorm = frobeniusNorm(matrix);
@@ -87,21 +152,88 @@ int readMatrixNative(const char* matrixFileName, CSRMatrix **matrix_, double *fn
    return 0;
 }
 
-static int *my_comp_ctx[2];
-static int my_comp(const void *a, const void *b)
-{
-   const int ia = *(int*)a, ib = *(int*)b;
-   int **p = my_comp_ctx;
-   return p[0][ia] != p[0][ib] ? p[0][ia] - p[0][ib] : p[1][ia] - p[1][ib];
+/* Number of threads used for reading, independently of the threads used  */
+/* later by the solver                                                      */
+
+static int loaderThreads(void) {
+#ifdef _OPENMP
+   return omp_get_num_procs();
+#else
+   return 1;
+#endif
+}
+
+/******************************************************************************
+ * Parallel MatrixMarket reader
+ *
+ * The file is mapped in memory and split in chunks of lines, which are parsed
+ * by different threads into a COO array. The COO is turned into CSR with a
+ * counting sort by rows: every thread counts the rows of its chunk, and
+ * scatters its entries after the ones of the previous threads in every row.
+ * Finally the entries of every row are sorted by column.
+ *
+******************************************************************************/
+
+typedef struct {
+   int j;
+   SCALAR a;
+} MTXEntry;
+
+static int MTXEntry_cmp(const void *a, const void *b) {
+   return ((const MTXEntry*)a)->j - ((const MTXEntry*)b)->j;
+}
+
+/* Return the position after the end of the line that p is in */
+
+static const char *nextLine(const char *p, const char *end) {
+   const char *q = (const char *)memchr(p, '\n', end - p);
+   return q ? q + 1 : end;
+}
+
+/* Return whether the line starting at p has something but blanks */
+
+static int isEntryLine(const char *p, const char *end) {
+   for (; p < end && *p != '\n'; p++)
+      if (*p != ' ' && *p != '\t' && *p != '\r') return 1;
+   return 0;
+}
+
+static const char *parseInt(const char *p, const char *end, int *v) {
+   long r = 0;
+   const char *p0;
+   while (p < end && (*p == ' ' || *p == '\t')) p++;
+   for (p0 = p; p < end && *p >= '0' && *p <= '9' && r <= INT_MAX; p++)
+      r = r*10 + (*p - '0');
+   if (p == p0 || r > INT_MAX) return NULL;
+   *v = (int)r;
+   return p;
+}
+
+static const char *parseReal(const char *p, const char *end, double *v) {
+   char buf[64], *bufend;
+   int n;
+   while (p < end && (*p == ' ' || *p == '\t')) p++;
+   for (n=0; p+n < end && n < 63 && p[n] != ' ' && p[n] != '\t' &&
+         p[n] != '\r' && p[n] != '\n'; n++) {
+      buf[n] = p[n];
+   }
+   buf[n] = 0;
+   *v = strtod(buf, &bufend);
+   if (bufend == buf) return NULL;
+   return p + (bufend - buf);
 }
 
 static int readfullMTX(const char *mtfile, SCALAR **AA, int **JA, int **IA, int *m, int *n, int *nnz) { 
-   int i,j, k, nzmax;
-   int *I, *J, *perm;
+   int t, nt, mirror, err=0;
+   int *I, *J, *cnt;
+   size_t *chunk, *first, ncoo, nzmax;
+   const char *base, *end;
+   struct stat st;
    SCALAR *A;
-   double re, im;
    FILE *matrixFile;
    MM_typecode type;
+   long offset;
+   int fd;
 
    matrixFile = fopen(mtfile, "r");
    if (matrixFile == NULL) {
@@ -122,56 +254,327 @@ static int readfullMTX(const char *mtfile, SCALAR **AA, int **JA, int **IA, int
    }
 
    if (mm_read_mtx_crd_size(matrixFile, m, n, nnz) != 0) return -1;
+   offset = ftell(matrixFile);
+   fclose(matrixFile);
+   mirror = mm_is_symmetric(type) || mm_is_hermitian(type) || mm_is_skew(type);
+
+   /* Map the file */
+
+   fd = open(mtfile, O_RDONLY);
+   if (fd < 0) return -1;
+   if (fstat(fd, &st) != 0 || st.st_size <= offset) {
+      close(fd);
+      if (*nnz == 0) {
+         *IA = (int *)primme_calloc(*m+1, sizeof(int), "IA");
+         for (t=0; t<=*m; t++) (*IA)[t] = 1;
+         *JA = (int *)primme_calloc(1, sizeof(int), "JA");
+         *AA = (SCALAR *)primme_calloc(1, sizeof(SCALAR), "AA");
+         return 0;
+      }
+      return -1;
+   }
+   base = (const char *)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (base == (const char *)MAP_FAILED) return -1;
+   end = base + st.st_size;
+
+   /* Split the entries in chunks of whole lines of 1MiB at least */
+
+   nt = max(1, min(loaderThreads(), (int)((st.st_size - offset) >> 20)));
+   chunk = (size_t *)primme_calloc(nt+1, sizeof(size_t), "chunk");
+   first = (size_t *)primme_calloc(nt+1, sizeof(size_t), "first");
+   first[0] = 0;
+   chunk[0] = offset;
+   chunk[nt] = st.st_size;
+   for (t=1; t<nt; t++) {
+      chunk[t] = nextLine(base + offset + (st.st_size - offset) / nt * t - 1,
+            end) - base;
+   }
 
-   nzmax = *nnz;
-   if (mm_is_symmetric(type) || mm_is_hermitian(type) || mm_is_skew(type)) nzmax *= 2;
-   A = (SCALAR *)primme_calloc(nzmax, sizeof(SCALAR), "A");
-   J = (int *)primme_calloc(nzmax, sizeof(int), "J");
-   I = (int *)primme_calloc(nzmax, sizeof(int), "I");
-
-   /* Read matrix in COO */
-   im = 0.0;
-   for (k=0, i=0; k<*nnz; k++, i++) {
-      if (mm_read_mtx_crd_entry(matrixFile, &I[i], &J[i], &re, &im, type)!=0) return -1;
-      if (mm_is_pattern(type)) A[i] = 1;
-      else if (mm_is_real(type)) A[i] = re;
-      else A[i] = re + IMAGINARY*im;
-      if (I[i] != J[i]) {
-         if ((mm_is_symmetric(type) || mm_is_hermitian(type))) {
-            I[i+1] = J[i]; J[i+1] = I[i]; A[i+1] = CONJ(A[i]); i++;
-         }
-         else if (mm_is_skew(type)) {
-            I[i+1] = J[i]; J[i+1] = I[i]; A[i+1] = -A[i]; i++;
+   /* Count the entries in every chunk */
+
+   #pragma omp parallel for num_threads(nt) schedule(static, 1)
+   for (t=0; t<nt; t++) {
+      const char *p = base + chunk[t], *pend = base + chunk[t+1];
+      size_t c = 0;
+      for (; p < pend; p = nextLine(p, pend)) c += isEntryLine(p, pend);
+      first[t+1] = c;
+   }
+   for (t=0; t<nt; t++) first[t+1] += first[t];
+   ncoo = first[nt];
+   if (ncoo != (size_t)*nnz) {
+      fprintf(stderr, "ERROR: expected %d entries but found %lu\n", *nnz,
+            (unsigned long)ncoo);
+      munmap((void*)base, st.st_size);
+      free(chunk); free(first);
+      return -1;
+   }
+
+   /* Parse the entries in COO */
+
+   A = (SCALAR *)primme_calloc(ncoo, sizeof(SCALAR), "A");
+   J = (int *)primme_calloc(ncoo, sizeof(int), "J");
+   I = (int *)primme_calloc(ncoo, sizeof(int), "I");
+
+   #pragma omp parallel for num_threads(nt) schedule(static, 1) reduction(+:err)
+   for (t=0; t<nt; t++) {
+      const char *p = base + chunk[t], *pend = base + chunk[t+1];
+      size_t k = first[t];
+      for (; p < pend; p = nextLine(p, pend)) {
+         const char *q = p;
+         double re = 1.0, im = 0.0;
+         if (!isEntryLine(p, pend)) continue;
+         if (!(q = parseInt(q, pend, &I[k])) || !(q = parseInt(q, pend, &J[k]))
+               || (!mm_is_pattern(type) && !(q = parseReal(q, pend, &re)))
+               || (mm_is_complex(type) && !(q = parseReal(q, pend, &im)))
+               || I[k] < 1 || I[k] > *m || J[k] < 1 || J[k] > *n) {
+            err++;
+            break;
          }
+#ifdef USE_COMPLEX
+         A[k] = re + IMAGINARY*im;
+#else
+         A[k] = re;
+#endif
+         k++;
       }
    }
-   nzmax = *nnz = i;
+   munmap((void*)base, st.st_size);
+   free(chunk);
+   if (err) {
+      fprintf(stderr, "ERROR: invalid entry in '%s'\n", mtfile);
+      free(A); free(I); free(J); free(first);
+      return -1;
+   }
 
-   /* Sort COO by columns */
-   perm = (int *)primme_calloc(nzmax, sizeof(int), "perm");
-   for (i=0; i<nzmax; i++) perm[i] = i;
-   my_comp_ctx[0] = I;
-   my_comp_ctx[1] = J;
-   qsort(perm, nzmax, sizeof(int), my_comp);
+   /* Count the entries of every row in every chunk, mirrored ones included */
+
+   cnt = (int *)primme_calloc((size_t)nt*(*m), sizeof(int), "cnt");
+   #pragma omp parallel for num_threads(nt) schedule(static, 1)
+   for (t=0; t<nt; t++) {
+      int *c = &cnt[(size_t)*m*t], i;
+      size_t k;
+      for (i=0; i<*m; i++) c[i] = 0;
+      for (k=first[t]; k<first[t+1]; k++) {
+         c[I[k]-1]++;
+         if (mirror && I[k] != J[k]) c[J[k]-1]++;
+      }
+   }
+
+   /* Set where every row starts, and where every chunk puts its entries */
 
-   /* Collapse columns */
    *IA = (int *)primme_calloc(*m+1, sizeof(int), "IA");
-   (*IA)[0] = 1;
-   for (i=0, j=1; i<nzmax; i++)
-      while (j < I[perm[i]]) (*IA)[j++] = i+1;
-   while (j <= *m) (*IA)[j++] = nzmax+1;
-
-   /* Copy rows and values sorted */
-   *JA = I;
-   for (i=0; i<nzmax; i++) (*JA)[i] = J[perm[i]];
-   free(J);
-   *AA = (SCALAR *)primme_calloc(nzmax, sizeof(SCALAR), "AA");
-   for (i=0; i<nzmax; i++) (*AA)[i] = A[perm[i]];
-   free(A);
-   free(perm);
+   for (t=0, nzmax=0; t<*m && nzmax < INT_MAX; t++) {
+      int c;
+      (*IA)[t] = (int)nzmax + 1;
+      for (c=0; c<nt; c++) {
+         size_t nr = cnt[(size_t)*m*c+t];
+         cnt[(size_t)*m*c+t] = (int)nzmax;
+         nzmax += nr;
+      }
+   }
+   if (nzmax >= INT_MAX) {
+      fprintf(stderr, "ERROR: too many nonzeros in '%s'\n", mtfile);
+      free(A); free(I); free(J); free(first); free(cnt); free(*IA);
+      return -1;
+   }
+   (*IA)[*m] = (int)nzmax + 1;
+   *nnz = (int)nzmax;
+
+   /* Scatter the entries on their rows */
+
+   *JA = (int *)primme_calloc(max(nzmax, 1), sizeof(int), "JA");
+   *AA = (SCALAR *)primme_calloc(max(nzmax, 1), sizeof(SCALAR), "AA");
+   #pragma omp parallel for num_threads(nt) schedule(static, 1)
+   for (t=0; t<nt; t++) {
+      int *c = &cnt[(size_t)*m*t];
+      size_t k;
+      for (k=first[t]; k<first[t+1]; k++) {
+         int p = c[I[k]-1]++;
+         (*JA)[p] = J[k];
+         (*AA)[p] = A[k];
+         if (mirror && I[k] != J[k]) {
+            p = c[J[k]-1]++;
+            (*JA)[p] = I[k];
+            (*AA)[p] = mm_is_skew(type) ? -A[k] : CONJ(A[k]);
+         }
+      }
+   }
+   free(A); free(I); free(J); free(first); free(cnt);
+
+   /* Sort every row by columns */
+
+   #pragma omp parallel for num_threads(nt) schedule(dynamic, 1024)
+   for (t=0; t<*m; t++) {
+      int p0 = (*IA)[t]-1, p1 = (*IA)[t+1]-1, p, q;
+      if (p1 - p0 > 16) {
+         MTXEntry *e = (MTXEntry *)primme_calloc(p1-p0, sizeof(MTXEntry), "e");
+         for (p=p0; p<p1; p++) e[p-p0].j = (*JA)[p], e[p-p0].a = (*AA)[p];
+         qsort(e, p1-p0, sizeof(MTXEntry), MTXEntry_cmp);
+         for (p=p0; p<p1; p++) (*JA)[p] = e[p-p0].j, (*AA)[p] = e[p-p0].a;
+         free(e);
+      }
+      else {
+         for (p=p0+1; p<p1; p++) {
+            int j = (*JA)[p];
+            SCALAR a = (*AA)[p];
+            for (q=p; q>p0 && (*JA)[q-1] > j; q--) {
+               (*JA)[q] = (*JA)[q-1];
+               (*AA)[q] = (*AA)[q-1];
+            }
+            (*JA)[q] = j;
+            (*AA)[q] = a;
+         }
+      }
+   }
 
-   fclose(matrixFile);
+   return 0;
+}
+
+/******************************************************************************
+ * Binary CSR cache
+ *
+ * The file has a header followed by IA, JA and AElts as in CSRMatrix (with
+ * Fortran indexing), every array aligned to 16 bytes, so that the arrays are
+ * used directly from the file mapped in memory. The header has a checksum of
+ * the rest of the file, that is checked every time the file is read.
+ *
+******************************************************************************/
+
+#define CSR_CACHE_MAGIC "PRIMMCSR"
+#define CSR_CACHE_VERSION 1
+#define CSR_CACHE_ALIGN(x) (((x) + 15) & ~(size_t)15)
+
+typedef struct {
+   char magic[8];        /* CSR_CACHE_MAGIC */
+   int32_t version;      /* CSR_CACHE_VERSION */
+   int32_t scalarSize;   /* sizeof(SCALAR) */
+   int32_t isComplex;    /* whether SCALAR is complex */
+   int32_t reserved0;
+   int64_t m, n, nnz;    /* dimensions and number of nonzeros */
+   uint64_t checksum;    /* checksum of the rest of the file */
+   int64_t reserved1;
+} CSRCacheHeader;
+
+static void cacheLayout(int64_t m, int64_t nnz, size_t *offJA, size_t *offA,
+      size_t *size) {
+   *offJA = CSR_CACHE_ALIGN(sizeof(CSRCacheHeader) + sizeof(int)*(m+1));
+   *offA = CSR_CACHE_ALIGN(*offJA + sizeof(int)*nnz);
+   *size = CSR_CACHE_ALIGN(*offA + sizeof(SCALAR)*nnz);
+}
+
+/* Sum of the 64-bit words mixed with their positions, as in splitmix64 */
+
+static uint64_t cacheChecksum(const void *data, size_t size) {
+   const uint64_t *w = (const uint64_t *)data;
+   uint64_t cs = 0;
+   long k, nw = (long)(size / sizeof(uint64_t));
+
+   #pragma omp parallel for num_threads(loaderThreads()) reduction(+:cs)
+   for (k=0; k<nw; k++) {
+      uint64_t z = w[k] + 0x9e3779b97f4a7c15ULL*(uint64_t)(k+1);
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      cs += z ^ (z >> 31);
+   }
+   return cs;
+}
+
+/* Set matrix with the arrays of the cache file, or return -1 if the file  */
+/* does not exist or it is not valid for the current SCALAR                */
+
+static int readCacheCSR(const char *cacheFileName, CSRMatrix *matrix) {
+   int fd;
+   struct stat st;
+   char *map;
+   CSRCacheHeader h;
+   size_t offJA, offA, size;
+
+   fd = open(cacheFileName, O_RDONLY);
+   if (fd < 0) return -1;
+   if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(h)) {
+      close(fd);
+      return -1;
+   }
+   map = (char *)mmap(NULL, st.st_size, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd,
+         0);
+   close(fd);
+   if (map == (char *)MAP_FAILED) return -1;
+   memcpy(&h, map, sizeof(h));
+   if (memcmp(h.magic, CSR_CACHE_MAGIC, 8) || h.version != CSR_CACHE_VERSION
+         || h.scalarSize != (int)sizeof(SCALAR)
+#ifdef USE_COMPLEX
+         || !h.isComplex
+#else
+         || h.isComplex
+#endif
+         || h.m < 0 || h.m > INT_MAX || h.n < 0 || h.n > INT_MAX || h.nnz < 0
+         || h.nnz >= INT_MAX) {
+      munmap(map, st.st_size);
+      return -1;
+   }
+   cacheLayout(h.m, h.nnz, &offJA, &offA, &size);
+   if (size != (size_t)st.st_size || cacheChecksum(map + sizeof(h),
+            size - sizeof(h)) != h.checksum) {
+      fprintf(stderr, "WARNING: corrupted matrix cache '%s'\n", cacheFileName);
+      munmap(map, st.st_size);
+      return -1;
+   }
+   matrix->m = (int)h.m;
+   matrix->n = (int)h.n;
+   matrix->nnz = (int)h.nnz;
+   matrix->IA = (int *)(map + sizeof(h));
+   matrix->JA = (int *)(map + offJA);
+   matrix->AElts = (SCALAR *)(map + offA);
+   matrix->map = map;
+   matrix->lmap = size;
+   return 0;
+}
 
+/* Write the arrays of matrix into the cache file, through a temporary file */
+/* so that an interrupted write does not leave an invalid cache             */
+
+static int writeCacheCSR(const char *cacheFileName, const CSRMatrix *matrix) {
+   int fd;
+   char *map, *tmpFileName;
+   CSRCacheHeader h;
+   size_t offJA, offA, size;
+
+   tmpFileName = (char *)primme_calloc(strlen(cacheFileName)+5, sizeof(char),
+         "tmpFileName");
+   sprintf(tmpFileName, "%s.tmp", cacheFileName);
+   cacheLayout(matrix->m, matrix->nnz, &offJA, &offA, &size);
+   fd = open(tmpFileName, O_RDWR|O_CREAT|O_TRUNC, 0644);
+   if (fd < 0 || ftruncate(fd, size) != 0 ||
+         (map = (char *)mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd,
+            0)) == (char *)MAP_FAILED) {
+      if (fd >= 0) close(fd), remove(tmpFileName);
+      free(tmpFileName);
+      return -1;
+   }
+   close(fd);
+
+   memcpy(map + sizeof(h), matrix->IA, sizeof(int)*(matrix->m+1));
+   memcpy(map + offJA, matrix->JA, sizeof(int)*matrix->nnz);
+   memcpy(map + offA, matrix->AElts, sizeof(SCALAR)*matrix->nnz);
+   memset(&h, 0, sizeof(h));
+   memcpy(h.magic, CSR_CACHE_MAGIC, 8);
+   h.version = CSR_CACHE_VERSION;
+   h.scalarSize = (int)sizeof(SCALAR);
+#ifdef USE_COMPLEX
+   h.isComplex = 1;
+#endif
+   h.m = matrix->m;
+   h.n = matrix->n;
+   h.nnz = matrix->nnz;
+   h.checksum = cacheChecksum(map + sizeof(h), size - sizeof(h));
+   memcpy(map, &h, sizeof(h));
+   if (munmap(map, size) != 0 || rename(tmpFileName, cacheFileName) != 0) {
+      remove(tmpFileName);
+      free(tmpFileName);
+      return -1;
+   }
+   free(tmpFileName);
    return 0;
 }
 
@@ -285,8 +688,18 @@ void shiftCSRMatrix(double shift, CSRMatrix *matrix) {
 
 void freeCSRMatrix(CSRMatrix *matrix) {
    if (!matrix) return;
-   free(matrix->AElts);
-   free(matrix->IA);
-   free(matrix->JA);
+   primme_csr_destroy(matrix->op);
+   free(matrix->levelptr[0]);
+   free(matrix->levelptr[1]);
+   free(matrix->levelrows[0]);
+   free(matrix->levelrows[1]);
+   if (matrix->map) {
+      munmap(matrix->map, matrix->lmap);
+   }
+   else {
+      free(matrix->AElts);
+      free(matrix->IA);
+      free(matrix->JA);
+   }
    free(matrix);
 }
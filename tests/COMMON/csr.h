@@ -37,9 +37,16 @@ typedef struct {
    int m; /* number of rows */
    int n; /* number of columns */
    int nnz;
+   primme_csr *op; /* operator for matvecs, referencing the arrays above */
+   void *map;      /* if not NULL, the arrays above are in this mapped cache */
+   size_t lmap;    /* size of map in bytes */
+   int nlevels[2]; /* ILU factors: number of levels of L and U */
+   int *levelptr[2];  /* ILU factors: start of every level in levelrows */
+   int *levelrows[2]; /* ILU factors: rows of L and U sorted by level */
 } CSRMatrix;
 
-int readMatrixNative(const char* matrixFileName, CSRMatrix **matrix_, double *fnorm);
+int readMatrixNative(const char* matrixFileName, const char *cacheFileName,
+      CSRMatrix **matrix_, double *fnorm);
 double frobeniusNorm(const CSRMatrix *matrix);
 void shiftCSRMatrix(double shift, CSRMatrix *matrix);
 void freeCSRMatrix(CSRMatrix *matrix);
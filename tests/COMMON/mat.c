@@ -33,6 +33,9 @@
 #include <string.h>
 #include <math.h>
 #include "native.h"
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
 
 static void getDiagonal(const CSRMatrix *matrix, double *diag);
 
@@ -41,17 +44,11 @@ extern "C" {
 #endif
 
 #ifndef USE_DOUBLECOMPLEX
-void FORTRAN_FUNCTION(amux)(int*, double*, double*, double*, int*, int*);
-void FORTRAN_FUNCTION(atmuxr)(int*, int*, double*, double*, double*, int*, int*);
 void FORTRAN_FUNCTION(ilut)(int*, double*, int*, int*, int*, double*, double*, int*, int*, int*,
                             double*, double*, int*, int*, int*, int*);
-void FORTRAN_FUNCTION(lusol0)(int*, double*, double*, double*, int*, int*);
 #else
-void FORTRAN_FUNCTION(zamux)(int*, SCALAR*, SCALAR*, SCALAR*, int*, int*);
-void FORTRAN_FUNCTION(zatmuxr)(int*, int*, SCALAR*, SCALAR*, SCALAR*, int*, int*);
 void FORTRAN_FUNCTION(zilut)(int*, SCALAR*, int*, int*, int*, double*, SCALAR*, int*, int*, int*,
                              SCALAR*, int*, int*);
-void FORTRAN_FUNCTION(zlusol)(int*, SCALAR*, SCALAR*, SCALAR*, int*, int*);
 #endif
 
 #ifdef __cplusplus
@@ -59,70 +56,37 @@ void FORTRAN_FUNCTION(zlusol)(int*, SCALAR*, SCALAR*, SCALAR*, int*, int*);
 #endif
 
 /******************************************************************************
- * Applies the matrix vector multiplication on a block of vectors.
- * Because a block function is not available, we call blockSize times
- * the SPARSKIT function amux(). Note the (void *) parameters x, y that must 
- * be cast as doubles for use in amux()
+ * Applies the matrix vector multiplication on a block of vectors with the
+ * CSR operator of the library, which computes the whole block in one pass
+ * over the nonzeros.
  *
 ******************************************************************************/
 void CSRMatrixMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
    
-   int i;
-   int n = (int)primme->n;
-   SCALAR *xvec, *yvec;
    CSRMatrix *matrix;
    
    matrix = (CSRMatrix *)primme->matrix;
-   xvec = (SCALAR *)x;
-   yvec = (SCALAR *)y;
-
-   for (i=0;i<*blockSize;i++) {
-#ifndef USE_DOUBLECOMPLEX
-      FORTRAN_FUNCTION(amux)
-#else
-      FORTRAN_FUNCTION(zamux)
-#endif
-            (&n, &xvec[*ldx*i], &yvec[*ldy*i], 
-             matrix->AElts, matrix->JA, matrix->IA);
-   }
-   *ierr = 0;
+   *ierr = primme_csr_apply(matrix->op, 0, *blockSize, x, *ldx, y, *ldy);
 }
 
 void CSRMatrixMatvecSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
       int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr) {
    
-   int i;
-   int m = (int)primme_svds->m;
-   int n = (int)primme_svds->n;
-   SCALAR *xvec, *yvec;
    CSRMatrix *matrix;
    
    matrix = (CSRMatrix *)primme_svds->matrix;
-   xvec = (SCALAR *)x;
-   yvec = (SCALAR *)y;
+   *ierr = primme_csr_apply(matrix->op, *trans, *blockSize, x, *ldx, y, *ldy);
+}
 
-   if (*trans == 0) {
-      for (i=0;i<*blockSize;i++) {
-#ifndef USE_DOUBLECOMPLEX
-         FORTRAN_FUNCTION(amux)
-#else
-         FORTRAN_FUNCTION(zamux)
-#endif
-              (&m, &xvec[(*ldx)*i], &yvec[(*ldy)*i], 
-               matrix->AElts, matrix->JA, matrix->IA);
-      }
-   } else {
-      for (i=0;i<*blockSize;i++) {
-#ifndef USE_DOUBLECOMPLEX
-         FORTRAN_FUNCTION(atmuxr)
-#else
-         FORTRAN_FUNCTION(zatmuxr)
-#endif
-           (&n, &m, &xvec[(*ldx)*i], 
-            &yvec[(*ldy)*i], matrix->AElts, matrix->JA, matrix->IA);
-      }
-   }
-   *ierr = 0;
+void CSRMatrixNormalMatvecSVD(void *x, PRIMME_INT *ldx, void *y,
+      PRIMME_INT *ldy, int *blockSize, int *mode,
+      primme_svds_params *primme_svds, int *ierr) {
+   
+   CSRMatrix *matrix;
+   
+   matrix = (CSRMatrix *)primme_svds->matrix;
+   *ierr = primme_csr_apply_normal(matrix->op, *mode == primme_svds_op_AAt,
+         *blockSize, x, *ldx, y, *ldy);
 }
 
 
@@ -198,10 +162,150 @@ void ApplyInvDavidsonDiagPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_IN
  *    y(i) = U^(-1)*( L^(-1)*x(i)), i=1:blockSize, 
  *    with L,U = ilut(A-shift) 
  * 
- * It calls the SPARSKIT lusol0 function for each block vector.
+ * The factors are computed by the SPARSKIT ilut function, or by ILU(0) if
+ * driver.level and driver.threshold are zero, in MSR format. The
+ * triangular solves are done for all vectors at once. With several threads
+ * the rows are processed following a level schedule computed after the
+ * factorization: a row of L is in the level after the largest level of the
+ * rows it depends on, and the same for U starting from the last row. The
+ * result is the same as the SPARSKIT lusol0 function.
  *
 ******************************************************************************/
 
+#define ILU_BLOCK 16
+
+/* Sort the rows of L (t=0) or U (t=1) by level */
+
+static void setILULevels(CSRMatrix *factors) {
+   const int *jlu = factors->JA, *ju = factors->IA;
+   int n = factors->n, *level, t, i, k;
+
+   level = (int *)primme_calloc(max(n, 1), sizeof(int), "level");
+   for (t=0; t<2; t++) {
+      int nlevels = 0, *ptr, *rows;
+
+      /* Compute the level of every row */
+
+      for (i=0; i<n; i++) {
+         int row = t == 0 ? i : n-1-i, lev = 0;
+         int k0 = t == 0 ? jlu[row]-1 : ju[row]-1;
+         int k1 = t == 0 ? ju[row]-1 : jlu[row+1]-1;
+         for (k=k0; k<k1; k++) lev = max(lev, level[jlu[k]-1] + 1);
+         level[row] = lev;
+         nlevels = max(nlevels, lev + 1);
+      }
+
+      /* Bucket the rows by level, keeping the order of the solve */
+
+      ptr = (int *)primme_calloc(nlevels+1, sizeof(int), "levelptr");
+      rows = (int *)primme_calloc(max(n, 1), sizeof(int), "levelrows");
+      for (i=0; i<=nlevels; i++) ptr[i] = 0;
+      for (i=0; i<n; i++) ptr[level[i]+1]++;
+      for (i=0; i<nlevels; i++) ptr[i+1] += ptr[i];
+      for (i=0; i<n; i++) {
+         int row = t == 0 ? i : n-1-i;
+         rows[ptr[level[row]]++] = row;
+      }
+      for (i=nlevels; i>0; i--) ptr[i] = ptr[i-1];
+      ptr[0] = 0;
+
+      factors->nlevels[t] = nlevels;
+      factors->levelptr[t] = ptr;
+      factors->levelrows[t] = rows;
+   }
+   free(level);
+}
+
+/* ILU(0) of A-shift, with the factors in the MSR format of ilut. This is  */
+/* the SPARSKIT ilu0 function; the rows of A must be sorted by columns, as */
+/* readMatrixNative returns them, and a missing diagonal is taken as zero. */
+
+static int createILU0PrecNative(const CSRMatrix *matrix, double shift,
+                                CSRMatrix **prec) {
+   const int n = matrix->n, *ia = matrix->IA, *ja = matrix->JA;
+   const SCALAR *a = (const SCALAR *)matrix->AElts;
+   int lenFactors = n + 1 + matrix->nnz, *jlu, *ju, *iw, ii, j, jj, ju0;
+   SCALAR *alu;
+   CSRMatrix *factors;
+
+   factors = (CSRMatrix *)primme_calloc(1,  sizeof(CSRMatrix), "factors");
+   alu = (SCALAR *)primme_calloc(lenFactors, sizeof(SCALAR), "iluElts");
+   jlu = (int *)primme_calloc(lenFactors, sizeof(int), "Jilu");
+   ju = (int *)primme_calloc(n+1, sizeof(int), "Iilu");
+   iw = (int *)primme_calloc(max(n, 1), sizeof(int), "iw");
+   for (ii=0; ii<n; ii++) iw[ii] = -1;
+
+   /* The positions in jlu and ju are one-based as in SPARSKIT; iw maps */
+   /* the columns of the current row to their zero-based positions      */
+
+   ju0 = n+1;
+   jlu[0] = ju0+1;
+   for (ii=0; ii<n; ii++) {
+      int js = ju0;
+
+      /* Copy row ii of A-shift, with the diagonal in alu[ii] */
+
+      alu[ii] = -shift;
+      ju[ii] = 0;
+      iw[ii] = ii;
+      for (j=ia[ii]-1; j<ia[ii+1]-1; j++) {
+         int col = ja[j]-1;
+         if (col == ii) {
+            alu[ii] += a[j];
+            continue;
+         }
+         if (col > ii && ju[ii] == 0) ju[ii] = ju0+1;
+         alu[ju0] = a[j];
+         jlu[ju0] = col+1;
+         iw[col] = ju0++;
+      }
+      if (ju[ii] == 0) ju[ii] = ju0+1;
+      jlu[ii+1] = ju0+1;
+
+      /* Eliminate the entries of L in increasing column order, updating */
+      /* only the entries in the pattern of the row                      */
+
+      for (j=js; j<ju[ii]-1; j++) {
+         int jrow = jlu[j]-1;
+         SCALAR tl = alu[j]*alu[jrow];
+         alu[j] = tl;
+         for (jj=ju[jrow]-1; jj<jlu[jrow+1]-1; jj++) {
+            int jw = iw[jlu[jj]-1];
+            if (jw >= 0) alu[jw] -= tl*alu[jj];
+         }
+      }
+
+      if (alu[ii] == 0.0) {
+         fprintf(stderr, "ILU(0) factorization could not be completed: zero "
+               "pivot in row %d\n", ii+1);
+         free(alu); free(jlu); free(ju); free(iw); free(factors);
+         return(-1);
+      }
+      alu[ii] = 1.0/alu[ii];
+
+      iw[ii] = -1;
+      for (j=js; j<ju0; j++) iw[jlu[j]-1] = -1;
+   }
+   free(iw);
+
+   factors->AElts = alu;
+   factors->JA = jlu;
+   factors->IA = ju;
+   factors->n = n;
+   factors->nnz = lenFactors;
+   factors->op = NULL;
+   factors->map = NULL;
+   factors->levelptr[0] = factors->levelptr[1] = NULL;
+   factors->levelrows[0] = factors->levelrows[1] = NULL;
+
+   setILULevels(factors);
+   *prec = factors;
+   return 0;
+}
+
+/* ILUT(A-shift) with SPARSKIT ilut; if level and threshold are zero, which */
+/* in ilut would keep only the diagonal, ILU(0) is computed instead        */
+
 int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
                          double threshold, double filter, CSRMatrix **prec) {
 #ifdef USE_DOUBLECOMPLEX
@@ -211,6 +315,10 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
    int *iW;
    CSRMatrix *factors;
 
+   if (level == 0 && threshold == 0.0) {
+      return createILU0PrecNative(matrix, shift, prec);
+   }
+
    if (shift != 0.0) {
       shiftCSRMatrix(-shift, (CSRMatrix*)matrix);
    }
@@ -229,6 +337,10 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
    factors->IA = (int *)primme_calloc(matrix->n+1, sizeof(int), "Iilu");
    factors->n = matrix->n;
    factors->nnz = lenFactors;
+   factors->op = NULL;
+   factors->map = NULL;
+   factors->levelptr[0] = factors->levelptr[1] = NULL;
+   factors->levelrows[0] = factors->levelrows[1] = NULL;
    
    FORTRAN_FUNCTION(zilut)
          ((int*)&matrix->n, (SCALAR*)matrix->AElts, (int*)matrix->JA,
@@ -247,6 +359,7 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
    /* free workspace */
    free(W); free(iW);
 
+   setILULevels(factors);
    *prec = factors;
    return 0;
 #else
@@ -256,6 +369,10 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
    int *iW1, *iW2, *iW3;
    CSRMatrix *factors;
 
+   if (level == 0 && threshold == 0.0) {
+      return createILU0PrecNative(matrix, shift, prec);
+   }
+
    if (shift != 0.0) {
       shiftCSRMatrix(-shift, (CSRMatrix*)matrix);
    }
@@ -275,6 +392,10 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
    factors->IA = (int *)primme_calloc(matrix->n+1, sizeof(int), "Iilu");
    factors->n = matrix->n;
    factors->nnz = lenFactors;
+   factors->op = NULL;
+   factors->map = NULL;
+   factors->levelptr[0] = factors->levelptr[1] = NULL;
+   factors->levelrows[0] = factors->levelrows[1] = NULL;
    
    FORTRAN_FUNCTION(ilut)
         ((int*)&matrix->n, (double*)matrix->AElts, (int*)matrix->JA,
@@ -294,30 +415,82 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
    /* free workspace */
    free(W1); free(W2); free(iW1); free(iW2); free(iW3);
 
+   setILULevels(factors);
    *prec = factors;
    return 0;
 #endif
 }
 
+/* Solve row i of L (t=0) or U (t=1) for the bs vectors in w stored by rows */
+
+static inline void solveILURow(const CSRMatrix *prec, int t, int i, SCALAR *w,
+      int bs) {
+   const SCALAR *alu = prec->AElts;
+   const int *jlu = prec->JA, *ju = prec->IA;
+   int k, j, k0, k1;
+   SCALAR s[ILU_BLOCK];
+
+   k0 = t == 0 ? jlu[i]-1 : ju[i]-1;
+   k1 = t == 0 ? ju[i]-1 : jlu[i+1]-1;
+   if (bs == 1) {
+      SCALAR s0 = w[i];
+      for (k=k0; k<k1; k++) s0 -= alu[k]*w[jlu[k]-1];
+      w[i] = t == 1 ? s0*alu[i] : s0;
+      return;
+   }
+   for (j=0; j<bs; j++) s[j] = w[(size_t)bs*i+j];
+   for (k=k0; k<k1; k++) {
+      const SCALAR a = alu[k];
+      const SCALAR *wc = &w[(size_t)bs*(jlu[k]-1)];
+      for (j=0; j<bs; j++) s[j] -= a*wc[j];
+   }
+   if (t == 1) for (j=0; j<bs; j++) s[j] *= alu[i];
+   for (j=0; j<bs; j++) w[(size_t)bs*i+j] = s[j];
+}
+
 void ApplyILUTPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
-   int i;
-   int n = (int)primme->n;
-   SCALAR *xvec, *yvec;
-   CSRMatrix *prec;
-   
-   prec = (CSRMatrix *)primme->preconditioner;
-   xvec = (SCALAR *)x;
-   yvec = (SCALAR *)y;
+   CSRMatrix *prec = (CSRMatrix *)primme->preconditioner;
+   SCALAR *xvec = (SCALAR *)x, *yvec = (SCALAR *)y, *w;
+   int n = prec->n, b, i, j, t, nthreads = 1;
 
-   for (i=0; i<*blockSize; i++) {
-#ifdef USE_DOUBLECOMPLEX
-      FORTRAN_FUNCTION(zlusol)
-#else
-      FORTRAN_FUNCTION(lusol0)
+#ifdef _OPENMP
+   nthreads = omp_get_max_threads();
 #endif
-             (&n, &xvec[*ldx*i], &yvec[*ldy*i],
-              prec->AElts, prec->JA, prec->IA);
+
+   /* Copy the vectors by rows in chunks of ILU_BLOCK, so that every row */
+   /* of the factors is loaded once per chunk                             */
+
+   w = (SCALAR *)primme_calloc((size_t)n*min(*blockSize, ILU_BLOCK),
+         sizeof(SCALAR), "w");
+   for (b=0; b<*blockSize; b+=ILU_BLOCK) {
+      int bs = min(*blockSize-b, ILU_BLOCK);
+      for (i=0; i<n; i++)
+         for (j=0; j<bs; j++) w[(size_t)bs*i+j] = xvec[*ldx*(b+j)+i];
+
+      for (t=0; t<2; t++) {
+         if (nthreads <= 1) {
+            /* Sequential solve: forward with L and backward with U */
+            for (i=0; i<n; i++) solveILURow(prec, t, t == 0 ? i : n-1-i, w, bs);
+         }
+         else {
+            /* Rows in the same level do not depend on each other */
+            int l;
+            for (l=0; l<prec->nlevels[t]; l++) {
+               int r, r0 = prec->levelptr[t][l], r1 = prec->levelptr[t][l+1];
+               #ifdef _OPENMP
+               #pragma omp parallel for if (r1-r0 > 64)
+               #endif
+               for (r=r0; r<r1; r++) {
+                  solveILURow(prec, t, prec->levelrows[t][r], w, bs);
+               }
+            }
+         }
+      }
+
+      for (i=0; i<n; i++)
+         for (j=0; j<bs; j++) yvec[*ldy*(b+j)+i] = w[(size_t)bs*i+j];
    }
+   free(w);
    *ierr = 0;
 }
 
@@ -43,6 +43,9 @@ int createILUTPrecNative(const CSRMatrix *matrix, double shift, int level,
 void ApplyILUTPrecNative(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr);
 void CSRMatrixMatvecSVD(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy,
       int *blockSize, int *trans, primme_svds_params *primme_svds, int *ierr);
+void CSRMatrixNormalMatvecSVD(void *x, PRIMME_INT *ldx, void *y,
+      PRIMME_INT *ldy, int *blockSize, int *mode,
+      primme_svds_params *primme_svds, int *ierr);
 int createInvNormalPrecNative(const CSRMatrix *matrix, double shift, double **prec);
 void ApplyInvNormalPrecNative(void *x, PRIMME_INT *ldx, void *y,
       PRIMME_INT *ldy, int *blockSize, int *mode,
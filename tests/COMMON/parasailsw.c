@@ -61,11 +61,15 @@ int readMatrixAndPrecondParaSails(const char* matrixFileName, double shift,
    /* ---------------------------------------------------------------------- */
 
    if (procID == 0) {
-      if (readMatrixNative(matrixFileName, &matrix, fnorm) !=0 )
+      if (readMatrixNative(matrixFileName, NULL, &matrix, fnorm) !=0 )
          return -1;
    }
    else {
       matrix = (CSRMatrix *)primme_calloc(1, sizeof(CSRMatrix), "CSRMatrix");
+      matrix->op = NULL;
+      matrix->map = NULL;
+      matrix->levelptr[0] = matrix->levelptr[1] = NULL;
+      matrix->levelrows[0] = matrix->levelrows[1] = NULL;
    }
    MPI_Bcast(&matrix->nnz, 1, MPI_INT, 0, MPI_COMM_WORLD);
    MPI_Bcast(&matrix->m, 1, MPI_INT, 0, MPI_COMM_WORLD);
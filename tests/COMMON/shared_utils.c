@@ -160,6 +160,16 @@ int read_solver_params(char *configFileName, char *outputFileName,
             OPTION(initBasisMode, primme_init_krylov)
             OPTION(initBasisMode, primme_init_random)
             OPTION(initBasisMode, primme_init_user)
+            OPTION(initBasisMode, primme_init_checkpoint)
+         );
+
+         READ_FIELD_OP(orth,
+            OPTION(orth, primme_orth_default)
+            OPTION(orth, primme_orth_implicit_I)
+            OPTION(orth, primme_orth_explicit_I)
+            OPTION(orth, primme_orth_cholqr2)
+            OPTION(orth, primme_orth_shifted_cholqr3)
+            OPTION(orth, primme_orth_dcgs2)
          );
 
          READ_FIELD(numTargetShifts, "%d");
@@ -182,6 +192,10 @@ int read_solver_params(char *configFileName, char *outputFileName,
  
          READ_FIELD(dynamicMethodSwitch, "%d");
          READ_FIELD(locking, "%d");
+         READ_FIELD(recycle, "%d");
+         READ_FIELD(checkpointFrequency, "%d");
+         READ_FIELD(adaptivePrecision, "%d");
+         READ_FIELD(commReduce, "%d");
          READ_FIELD(initSize, "%d");
          READ_FIELD(numOrthoConst, "%d");
 
@@ -204,6 +218,7 @@ int read_solver_params(char *configFileName, char *outputFileName,
          READ_FIELDParams(correction, robustShifts, "%d");
          READ_FIELDParams(correction, maxInnerIterations, "%d");
          READ_FIELDParams(correction, relTolBase, "%lf");
+         READ_FIELDParams(correction, chebyshevDegree, "%d");
 
          READ_FIELD_OPParams(correction, convTest,
             OPTIONParams(correction, convTest, primme_full_LTolerance)
@@ -321,6 +336,9 @@ int read_driver_params(char *configFileName, driver_params *driver) {
          else if (strcmp(ident, "driver.matrixFile") == 0) {
             ret = fscanf(configFile, "%s", driver->matrixFileName);
          }
+         else if (strcmp(ident, "driver.matrixCache") == 0) {
+            ret = fscanf(configFile, "%s", driver->matrixCacheFileName);
+         }
          else if (strcmp(ident, "driver.initialGuessesFile") == 0) {
             ret = fscanf(configFile, "%s", driver->initialGuessesFileName);
          }
@@ -336,6 +354,51 @@ int read_driver_params(char *configFileName, driver_params *driver) {
          else if (strcmp(ident, "driver.checkInterface") == 0) {
             ret = fscanf(configFile, "%d", &driver->checkInterface);
          }
+         else if (strcmp(ident, "driver.useWorkspace") == 0) {
+            ret = fscanf(configFile, "%d", &driver->useWorkspace);
+         }
+         else if (strcmp(ident, "driver.useSolver") == 0) {
+            ret = fscanf(configFile, "%d", &driver->useSolver);
+         }
+         else if (strcmp(ident, "driver.warmUp") == 0) {
+            ret = fscanf(configFile, "%d", &driver->warmUp);
+         }
+         else if (strcmp(ident, "driver.splitGlobalSum") == 0) {
+            ret = fscanf(configFile, "%d", &driver->splitGlobalSum);
+         }
+         else if (strcmp(ident, "driver.checkpointFile") == 0) {
+            ret = fscanf(configFile, "%s", driver->checkpointFileName);
+         }
+         else if (strcmp(ident, "driver.outOfCoreDir") == 0) {
+            ret = fscanf(configFile, "%s", driver->outOfCoreDir);
+         }
+         else if (strcmp(ident, "driver.sellC") == 0) {
+            ret = fscanf(configFile, "%d", &driver->sellC);
+         }
+         else if (strcmp(ident, "driver.sellSigma") == 0) {
+            ret = fscanf(configFile, "%d", &driver->sellSigma);
+         }
+         else if (strcmp(ident, "driver.normalMatvec") == 0) {
+            ret = fscanf(configFile, "%d", &driver->normalMatvec);
+         }
+         else if (strcmp(ident, "driver.sliceSize") == 0) {
+            ret = fscanf(configFile, "%d", &driver->sliceSize);
+         }
+         else if (strcmp(ident, "driver.sliceLower") == 0) {
+            ret = fscanf(configFile, "%le", &driver->sliceLower);
+         }
+         else if (strcmp(ident, "driver.sliceUpper") == 0) {
+            ret = fscanf(configFile, "%le", &driver->sliceUpper);
+         }
+         else if (strcmp(ident, "driver.sliceGroups") == 0) {
+            ret = fscanf(configFile, "%d", &driver->sliceGroups);
+         }
+         else if (strcmp(ident, "driver.batch") == 0) {
+            ret = fscanf(configFile, "%d", &driver->batch);
+         }
+         else if (strcmp(ident, "driver.profile") == 0) {
+            ret = fscanf(configFile, "%d", &driver->profile);
+         }
          else if (strcmp(ident, "driver.matrixChoice") == 0) {
             ret = fscanf(configFile, "%s", stringValue);
             if (ret == 1) {
@@ -444,12 +507,28 @@ fprintf(outputFile, "// ---------------------------------------------------\n"
 fprintf(outputFile, "driver.partId        = %s\n", driver.partId);
 fprintf(outputFile, "driver.partDir       = %s\n", driver.partDir);
 fprintf(outputFile, "driver.matrixFile    = %s\n", driver.matrixFileName);
+fprintf(outputFile, "driver.matrixCache   = %s\n", driver.matrixCacheFileName);
 fprintf(outputFile, "driver.matrixChoice  = %s\n", strMatrixChoice[driver.matrixChoice]);
 fprintf(outputFile, "driver.initialGuessesFile = %s\n", driver.initialGuessesFileName);
 fprintf(outputFile, "driver.initialGuessesPert = %e\n", driver.initialGuessesPert);
 fprintf(outputFile, "driver.saveXFile     = %s\n", driver.saveXFileName);
 fprintf(outputFile, "driver.checkXFile    = %s\n", driver.checkXFileName);
 fprintf(outputFile, "driver.checkInterface = %d\n", driver.checkInterface);
+fprintf(outputFile, "driver.useWorkspace  = %d\n", driver.useWorkspace);
+fprintf(outputFile, "driver.useSolver     = %d\n", driver.useSolver);
+fprintf(outputFile, "driver.warmUp        = %d\n", driver.warmUp);
+fprintf(outputFile, "driver.splitGlobalSum = %d\n", driver.splitGlobalSum);
+fprintf(outputFile, "driver.checkpointFile = %s\n", driver.checkpointFileName);
+fprintf(outputFile, "driver.outOfCoreDir  = %s\n", driver.outOfCoreDir);
+fprintf(outputFile, "driver.sellC         = %d\n", driver.sellC);
+fprintf(outputFile, "driver.sellSigma     = %d\n", driver.sellSigma);
+fprintf(outputFile, "driver.normalMatvec  = %d\n", driver.normalMatvec);
+fprintf(outputFile, "driver.sliceSize     = %d\n", driver.sliceSize);
+fprintf(outputFile, "driver.sliceLower    = %e\n", driver.sliceLower);
+fprintf(outputFile, "driver.sliceUpper    = %e\n", driver.sliceUpper);
+fprintf(outputFile, "driver.sliceGroups   = %d\n", driver.sliceGroups);
+fprintf(outputFile, "driver.batch         = %d\n", driver.batch);
+fprintf(outputFile, "driver.profile       = %d\n", driver.profile);
 fprintf(outputFile, "driver.PrecChoice    = %s\n", strPrecChoice[driver.PrecChoice]);
 fprintf(outputFile, "driver.shift         = %e\n", driver.shift);
 fprintf(outputFile, "driver.isymm         = %d\n", driver.isymm);
@@ -495,6 +574,42 @@ void driver_display_methodsvd(primme_svds_preset_method method, const char* meth
 
 }
 
+/* Check that the profiler recorded calls with consistent times, and that */
+/* it can export them                                                     */
+
+int check_profiler(primme_profiler *prof, FILE *outputFile) {
+
+   int i, n = primme_profiler_num_sites(prof), ret = 0;
+   if (n <= 0) {
+      fprintf(outputFile, "Error: the profiler recorded no calls\n");
+      return 1;
+   }
+   for (i = 0; i < n; i++) {
+      const char *call, *file;
+      int line;
+      PRIMME_INT count;
+      double time, selfTime;
+      primme_profiler_site_stats(
+            prof, i, &call, &file, &line, &count, &time, &selfTime);
+      if (count <= 0 || selfTime < -1e-6 || selfTime > time + 1e-6) {
+         fprintf(outputFile,
+               "Error: profiler site %s:%d has %" PRIMME_INT_P
+               " calls, time %g and self time %g\n",
+               file, line, count, time, selfTime);
+         ret = 1;
+      }
+   }
+   FILE *f = tmpfile();
+   if (!f || primme_profiler_write_trace(prof, f) != 0 ||
+         primme_profiler_write_folded(prof, f) != 0 ||
+         primme_profiler_write_summary(prof, f) != 0) {
+      fprintf(outputFile, "Error: exporting the profile failed\n");
+      ret = 1;
+   }
+   if (f) fclose(f);
+   fprintf(outputFile, "Profiled sites : %d\n", n);
+   return ret;
+}
 
 int read_solver_params_svds(char *configFileName, char *outputFileName,
                 primme_svds_params *primme_svds, const char* primmeprefix,
@@ -697,20 +812,9 @@ void broadCast(primme_params *primme, primme_preset_method *method,
 
    int i;
 
+   /* driver_params has no pointers, so it is sent as is */
    if (driver) {
-      MPI_Bcast(driver->outputFileName, 512, MPI_CHAR, 0, comm);
-      MPI_Bcast(driver->matrixFileName, 1024, MPI_CHAR, 0, comm);
-      MPI_Bcast(driver->initialGuessesFileName, 1024, MPI_CHAR, 0, comm);
-      MPI_Bcast(driver->saveXFileName, 1024, MPI_CHAR, 0, comm);
-      MPI_Bcast(driver->checkXFileName, 1024, MPI_CHAR, 0, comm);
-      MPI_Bcast(&driver->initialGuessesPert, 1, MPI_DOUBLE, 0, comm);
-      MPI_Bcast(&driver->matrixChoice, 1, MPI_INT, 0, comm);
-      MPI_Bcast(&driver->PrecChoice, 1, MPI_INT, 0, comm);
-      MPI_Bcast(&driver->isymm, 1, MPI_INT, 0, comm);
-      MPI_Bcast(&driver->level, 1, MPI_INT, 0, comm);
-      MPI_Bcast(&driver->threshold, 1, MPI_DOUBLE, 0, comm);
-      MPI_Bcast(&driver->filter, 1, MPI_DOUBLE, 0, comm);
-      MPI_Bcast(&driver->shift, 1, MPI_DOUBLE, 0, comm);
+      MPI_Bcast(driver, sizeof(driver_params), MPI_BYTE, 0, comm);
    }
 
    MPI_Bcast(&(primme->numEvals), 1, MPI_INT, 0, comm);
@@ -737,6 +841,11 @@ void broadCast(primme_params *primme, primme_preset_method *method,
    MPI_Bcast(&(primme->eps), 1, MPI_DOUBLE, 0, comm);
    MPI_Bcast(&(primme->printLevel), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->initBasisMode), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->adaptivePrecision), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->commReduce), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->recycle), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->checkpointFrequency), 1, MPI_INT, 0, comm);
+   MPI_Bcast(&(primme->orth), 1, MPI_INT, 0, comm);
 
    MPI_Bcast(&(primme->projectionParams.projection), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->restartingParams.maxPrevRetain), 1, MPI_INT, 0, comm);
@@ -746,6 +855,7 @@ void broadCast(primme_params *primme, primme_preset_method *method,
    MPI_Bcast(&(primme->correctionParams.maxInnerIterations),1, MPI_INT, 0,comm);
    MPI_Bcast(&(primme->correctionParams.convTest), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->correctionParams.relTolBase), 1, MPI_DOUBLE, 0, comm);
+   MPI_Bcast(&(primme->correctionParams.chebyshevDegree), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme->correctionParams.projectors.LeftQ),  1, MPI_INT, 0,comm);
    MPI_Bcast(&(primme->correctionParams.projectors.LeftX),  1, MPI_INT, 0,comm);
    MPI_Bcast(&(primme->correctionParams.projectors.RightQ), 1, MPI_INT, 0,comm);
@@ -767,19 +877,8 @@ void broadCast_svds(primme_svds_params *primme_svds, primme_svds_preset_method *
    primme_preset_method *primmemethod, primme_preset_method *primmemethodStage2,
    driver_params *driver, int master, MPI_Comm comm){
 
-   MPI_Bcast(driver->outputFileName, 512, MPI_CHAR, 0, comm);
-   MPI_Bcast(driver->matrixFileName, 1024, MPI_CHAR, 0, comm);
-   MPI_Bcast(driver->initialGuessesFileName, 1024, MPI_CHAR, 0, comm);
-   MPI_Bcast(driver->saveXFileName, 1024, MPI_CHAR, 0, comm);
-   MPI_Bcast(driver->checkXFileName, 1024, MPI_CHAR, 0, comm);
-   MPI_Bcast(&driver->initialGuessesPert, 1, MPI_DOUBLE, 0, comm);
-   MPI_Bcast(&driver->matrixChoice, 1, MPI_INT, 0, comm);
-   MPI_Bcast(&driver->PrecChoice, 1, MPI_INT, 0, comm);
-   MPI_Bcast(&driver->isymm, 1, MPI_INT, 0, comm);
-   MPI_Bcast(&driver->level, 1, MPI_INT, 0, comm);
-   MPI_Bcast(&driver->threshold, 1, MPI_DOUBLE, 0, comm);
-   MPI_Bcast(&driver->filter, 1, MPI_DOUBLE, 0, comm);
-   MPI_Bcast(&driver->shift, 1, MPI_DOUBLE, 0, comm);
+   /* driver_params has no pointers, so it is sent as is */
+   MPI_Bcast(driver, sizeof(driver_params), MPI_BYTE, 0, comm);
 
    MPI_Bcast(&(primme_svds->numSvals), 1, MPI_INT, 0, comm);
    MPI_Bcast(&(primme_svds->target), 1, MPI_INT, 0, comm);
@@ -835,6 +934,51 @@ void par_GlobalSumDouble(void *sendBuf, void *recvBuf, int *count,
 #endif
 }
 
+/******************************************************************************
+ * MPI globalSumDoubleBegin and globalSumDoubleWait functions
+ *
+******************************************************************************/
+static void par_GlobalSumDoubleBegin0(void *sendBuf, void *recvBuf, int *count,
+                         MPI_Comm communicator, void **request, int *ierr) {
+   MPI_Request *req = (MPI_Request *)malloc(sizeof(MPI_Request));
+   *request = req;
+   if (sendBuf == recvBuf) {
+     *ierr = MPI_Iallreduce(MPI_IN_PLACE, recvBuf, *count, MPI_DOUBLE, MPI_SUM, communicator, req) != MPI_SUCCESS;
+   } else {
+     *ierr = MPI_Iallreduce(sendBuf, recvBuf, *count, MPI_DOUBLE, MPI_SUM, communicator, req) != MPI_SUCCESS;
+   }
+}
+
+static void par_GlobalSumDoubleWait0(void **request, int *ierr) {
+   MPI_Request *req = (MPI_Request *)*request;
+   *ierr = MPI_Wait(req, MPI_STATUS_IGNORE) != MPI_SUCCESS;
+   free(req);
+   *request = NULL;
+}
+
+void par_GlobalSumDoubleBegin(void *sendBuf, void *recvBuf, int *count, 
+                         primme_params *primme, void **request, int *ierr) {
+   par_GlobalSumDoubleBegin0(sendBuf, recvBuf, count,
+         *(MPI_Comm *) primme->commInfo, request, ierr);
+}
+
+void par_GlobalSumDoubleWait(void **request, primme_params *primme, int *ierr) {
+   (void)primme;
+   par_GlobalSumDoubleWait0(request, ierr);
+}
+
+void par_GlobalSumDoubleBeginSvds(void *sendBuf, void *recvBuf, int *count, 
+                         primme_svds_params *primme_svds, void **request, int *ierr) {
+   par_GlobalSumDoubleBegin0(sendBuf, recvBuf, count,
+         *(MPI_Comm *) primme_svds->commInfo, request, ierr);
+}
+
+void par_GlobalSumDoubleWaitSvds(void **request, primme_svds_params *primme_svds,
+                         int *ierr) {
+   (void)primme_svds;
+   par_GlobalSumDoubleWait0(request, ierr);
+}
+
 void par_GlobalSumDoubleSvds(void *sendBuf, void *recvBuf, int *count, 
                          primme_svds_params *primme_svds, int *ierr) {
    MPI_Comm communicator = *(MPI_Comm *) primme_svds->commInfo;
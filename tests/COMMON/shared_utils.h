@@ -48,7 +48,8 @@ typedef enum {
    driver_noprecond,    /* no preconditioning */
    driver_jacobi,       /* K=Diag(A-shift),   shift provided once by user */
    driver_jacobi_i,     /* Diag(A-shift_i), shifts provided by primme every step */
-   driver_ilut,         /* ILUT(A-shift)  , shift provided once by user */
+   driver_ilut,         /* ILUT(A-shift)  , shift provided once by user; */
+                        /* ILU(0) if level and threshold are 0           */
    driver_normal,       /* precond based on A*A, only for SVD */
    driver_bjacobi       /* block jacobi */
 } driver_prec;
@@ -60,11 +61,27 @@ typedef struct driver_params {
    char testId[256];
    char partDir[1024];
    char matrixFileName[1024];
+   char matrixCacheFileName[1024];
    char initialGuessesFileName[1024];
    char saveXFileName[1024];
    double initialGuessesPert;
    char checkXFileName[1024];
    int checkInterface;
+   int useWorkspace;
+   int useSolver;
+   int warmUp;
+   char checkpointFileName[1024];
+   char outOfCoreDir[1024];
+   int sellC;
+   int sellSigma;
+   int normalMatvec;
+   int sliceSize;
+   double sliceLower;
+   double sliceUpper;
+   int sliceGroups;
+   int batch;
+   int profile;
+   int splitGlobalSum;
 
    driver_mat matrixChoice;
 
@@ -93,12 +110,20 @@ int read_driver_params(char *configFileName, driver_params *driver);
 void driver_display_params(driver_params driver, FILE *outputFile);
 void driver_display_method(primme_preset_method method, const char *methodstr, FILE *outputFile);
 void driver_display_methodsvd(primme_svds_preset_method method, const char *methodstr, FILE *outputFile);
+int check_profiler(primme_profiler *prof, FILE *outputFile);
 #ifdef USE_MPI
 #include <mpi.h>
 void par_GlobalSumDouble(void *sendBuf, void *recvBuf, int *count, 
                          primme_params *primme, int *ierr);
 void par_GlobalSumDoubleSvds(void *sendBuf, void *recvBuf, int *count, 
                          primme_svds_params *primme, int *ierr);
+void par_GlobalSumDoubleBegin(void *sendBuf, void *recvBuf, int *count, 
+                         primme_params *primme, void **request, int *ierr);
+void par_GlobalSumDoubleWait(void **request, primme_params *primme, int *ierr);
+void par_GlobalSumDoubleBeginSvds(void *sendBuf, void *recvBuf, int *count, 
+                         primme_svds_params *primme_svds, void **request, int *ierr);
+void par_GlobalSumDoubleWaitSvds(void **request, primme_svds_params *primme_svds,
+                         int *ierr);
 void broadCast_svds(primme_svds_params *primme_svds, primme_svds_preset_method *method,
    primme_preset_method *primmemethod, primme_preset_method *primmemethod0,
    driver_params *driver, int master, MPI_Comm comm);
@@ -79,6 +79,12 @@ PetscLogEvent PRIMME_GLOBAL_SUM;
 static int real_main (int argc, char *argv[]);
 static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int **permutation);
 static int destroyMatrixAndPrecond(driver_params *driver, primme_params *primme, int *permutation);
+static void unchangedMatrixDeltaMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr);
+#if defined(USE_MPI) && defined(USE_NATIVE)
+static void distributeNative(primme_params *primme, int **permutation);
+static void splitCommNative(int *numGroups, int *group, primme_params *primme_group, primme_params *primme, int *ierr);
+static int sliceGroups;
+#endif
 
 
 
@@ -264,16 +270,196 @@ static int real_main (int argc, char *argv[]) {
    }
 
 
+   /* Keep the search basis in files (optional) */
+
+   if (driver.outOfCoreDir[0]) primme.outOfCoreDir = driver.outOfCoreDir;
+
+   /* ---------------------------------------------- */
+   /* Give primme the memory for the solve (optional) */
+   /* ---------------------------------------------- */
+
+   void *workspace = NULL;
+   if (driver.useWorkspace) {
+      ASSERT_MSG(Sprimme(NULL, NULL, NULL, &primme) == 0, -1, "");
+      workspace = primme_calloc(primme.lworkspace, 1, "workspace");
+      primme.workspace = workspace;
+   }
+
+   /* ------------------------------------ */
+   /* Record the calls of PRIMME (optional) */
+   /* ------------------------------------ */
+
+   primme_profiler *profiler = NULL;
+   if (driver.profile) {
+      /* There is no profiler if PRIMME is not built with PRIMME_PROFILE */
+      profiler = primme_profiler_create(0, 0);
+      primme.profiler = profiler;
+   }
+
    /* ------------- */
    /*  Call primme  */
    /* ------------- */
 
-   ret = Sprimme(evals, evecs, rnorms, &primme);
+   PRIMME_INT firstMatvecs = 0; /* matvecs of the first solve with useSolver */
+   if (driver.useSolver) {
+      /* Solve twice with the same handle; the second solve starts from the */
+      /* vectors returned by the first one and reuses its workspace         */
+      primme_solver *solver = primme_solver_create(&primme);
+      ASSERT_MSG(solver != NULL, -1, "");
+      /* The matrix doesn't change between the solves */
+      if (primme.recycle) primme.matrixDeltaMatvec = unchangedMatrixDeltaMatvec;
+      ret = Sprimme_solve(evals, evecs, rnorms, solver);
+      firstMatvecs = primme.stats.numMatvecs;
+      /* With recycle, the second solve starts only from the kept basis */
+      if (primme.recycle) primme.initSize = 0;
+      if (ret == 0) ret = Sprimme_solve(evals, evecs, rnorms, solver);
+      primme_solver_destroy(solver);
+   }
+   else if (driver.warmUp) {
+      /* Solve once to warm up, and solve again from the same initial    */
+      /* vectors and seed with a workspace of the size that the first   */
+      /* solve needed; the second solve should not use the heap          */
+      int initSize = primme.initSize;
+      PRIMME_INT iseed[4];
+      memcpy(iseed, primme.iseed, sizeof(iseed));
+      size_t nX = (size_t)primme.nLocal * (primme.numOrthoConst + initSize);
+      SCALAR *evecs0 = (SCALAR *)primme_calloc(nX + 1, sizeof(SCALAR), "evecs0");
+      memcpy(evecs0, evecs, sizeof(SCALAR) * nX);
+      ret = Sprimme(evals, evecs, rnorms, &primme);
+      if (ret == 0) {
+         primme.lworkspace = (size_t)primme.stats.lworkspaceNeeded;
+         workspace = primme_calloc(primme.lworkspace, 1, "workspace");
+         primme.workspace = workspace;
+         primme.initSize = initSize;
+         memcpy(primme.iseed, iseed, sizeof(iseed));
+         memcpy(evecs, evecs0, sizeof(SCALAR) * nX);
+         ret = Sprimme(evals, evecs, rnorms, &primme);
+      }
+      free(evecs0);
+   }
+   else if (driver.checkpointFileName[0]) {
+      /* Solve once to count the matvecs; solve again stopping at half of */
+      /* them, and resume the last solve from the last checkpoint         */
+      /* In parallel every process saves into the file name followed by */
+      /* its process ID                                                  */
+      PRIMME_INT maxMatvecs = primme.maxMatvecs;
+      char checkpointFile[1100];
+      if (primme.numProcs > 1) {
+         sprintf(checkpointFile, "%s.%d", driver.checkpointFileName,
+               primme.procID);
+      } else {
+         strcpy(checkpointFile, driver.checkpointFileName);
+      }
+      primme.checkpointFile = driver.checkpointFileName;
+      if (primme.checkpointFrequency <= 0) primme.checkpointFrequency = 1;
+      ret = Sprimme(evals, evecs, rnorms, &primme);
+      if (ret == 0) {
+         primme.maxMatvecs = primme.stats.numMatvecs / 2;
+         primme.initSize = 0;
+         remove(checkpointFile);
+         Sprimme(evals, evecs, rnorms, &primme);
+         primme.maxMatvecs = maxMatvecs;
+         primme.initBasisMode = primme_init_checkpoint;
+         ret = Sprimme(evals, evecs, rnorms, &primme);
+      }
+      remove(checkpointFile);
+   }
+   else if (driver.sliceSize > 0) {
+      /* Find the eigenpairs in [sliceLower, sliceUpper]; numEvals is the */
+      /* room in evals, evecs and rnorms                                  */
+      int numEvals = primme.numEvals;
+      ret = Sprimme_slicing(driver.sliceLower, driver.sliceUpper,
+            driver.sliceSize, evals, evecs, rnorms, &numEvals, &primme);
+      primme.initSize = numEvals;
+   }
+   else if (driver.batch > 1) {
+      /* Solve batch copies of the problem together; check the first one */
+      /* and that all of them converge the same way                      */
+      int i, k = driver.batch;
+      primme_params *batch = (primme_params *)primme_calloc(
+            k, sizeof(primme_params), "batch");
+      double **bevals = (double **)primme_calloc(k, sizeof(double *), "bevals");
+      SCALAR **bevecs = (SCALAR **)primme_calloc(k, sizeof(SCALAR *), "bevecs");
+      double **brnorms =
+            (double **)primme_calloc(k, sizeof(double *), "brnorms");
+      int *bret = (int *)primme_calloc(k, sizeof(int), "bret");
+      for (i = 0; i < k; i++) {
+         batch[i] = primme;
+         if (i == 0) {
+            bevals[i] = evals;
+            bevecs[i] = evecs;
+            brnorms[i] = rnorms;
+            continue;
+         }
+         bevals[i] = (double *)primme_calloc(
+               primme.numEvals, sizeof(double), "evals");
+         bevecs[i] = (SCALAR *)primme_calloc(
+               primme.nLocal * primme.numEvals, sizeof(SCALAR), "evecs");
+         brnorms[i] = (double *)primme_calloc(
+               primme.numEvals, sizeof(double), "rnorms");
+         memcpy(bevecs[i], evecs, sizeof(SCALAR) * primme.nLocal *
+                                        (primme.initSize + primme.numOrthoConst));
+      }
+      ret = Sprimme_batch(k, bevals, bevecs, brnorms, batch, bret);
+      for (i = 1; i < k; i++) {
+         if (bret[i] != bret[0] || batch[i].initSize != batch[0].initSize) {
+            fprintf(primme.outputFile,
+                  "Error: problem %d in the batch returned %d with %d pairs "
+                  "instead of %d with %d\n",
+                  i, bret[i], batch[i].initSize, bret[0], batch[0].initSize);
+            ret = -1;
+         }
+         free(bevals[i]);
+         free(bevecs[i]);
+         free(brnorms[i]);
+      }
+      primme.initSize = batch[0].initSize;
+      primme.stats = batch[0].stats;
+      free(batch);
+      free(bevals);
+      free(bevecs);
+      free(brnorms);
+      free(bret);
+   }
+   else {
+      ret = Sprimme(evals, evecs, rnorms, &primme);
+   }
 
    if (driver.checkXFileName[0]) {
       retX = check_solution(driver.checkXFileName, &primme, evals, evecs, rnorms, permutation);
    }
 
+   /* Check the recorded calls */
+
+   if (profiler) {
+      if (master && check_profiler(profiler, primme.outputFile)) retX = 1;
+      primme.profiler = NULL;
+      primme_profiler_destroy(profiler);
+   }
+
+   /* Check that the solve from the recycled basis took clearly fewer */
+   /* matvecs than the first one, which started from scratch           */
+
+   if (driver.useSolver && primme.recycle && ret == 0 &&
+         4 * primme.stats.numMatvecs > 3 * firstMatvecs) {
+      fprintf(primme.outputFile,
+            "Error: the solve from the recycled basis took %" PRIMME_INT_P
+            " matvecs, and the first solve %" PRIMME_INT_P "\n",
+            primme.stats.numMatvecs, firstMatvecs);
+      retX = 1;
+   }
+
+   /* Check that primme didn't take memory out of the workspace */
+
+   if ((driver.useWorkspace || driver.useSolver || driver.warmUp) &&
+         primme.stats.numHeapAllocs > 0) {
+      fprintf(primme.outputFile,
+            "Error: the workspace was not enough (%" PRIMME_INT_P
+            " allocations from the heap)\n",
+            primme.stats.numHeapAllocs);
+      retX = 1;
+   }
+
    /* --------------------------------------------------------------------- */
    /* Save evecs and primme params  (optional)                              */
    /* --------------------------------------------------------------------- */
@@ -299,6 +485,7 @@ static int real_main (int argc, char *argv[]) {
       fprintf(primme.outputFile, "Restarts   : %-" PRIMME_INT_P "\n", primme.stats.numRestarts);
       fprintf(primme.outputFile, "Matvecs    : %-" PRIMME_INT_P "\n", primme.stats.numMatvecs);
       fprintf(primme.outputFile, "Preconds   : %-" PRIMME_INT_P "\n", primme.stats.numPreconds);
+      fprintf(primme.outputFile, "GlobalSums : %-" PRIMME_INT_P "\n", primme.stats.numGlobalSum);
       fprintf(primme.outputFile, "Time matvecs  : %f\n",  primme.stats.timeMatvec);
       fprintf(primme.outputFile, "Time precond  : %f\n",  primme.stats.timePrecond);
       fprintf(primme.outputFile, "Time ortho    : %f\n",  primme.stats.timeOrtho);
@@ -329,6 +516,7 @@ static int real_main (int argc, char *argv[]) {
    free(evals);
    free(evecs);
    free(rnorms);
+   free(workspace);
 
    if (ret != 0 && master) {
       fprintf(primme.outputFile, 
@@ -375,10 +563,12 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
          driver->matrixChoice = driver_native;
 #        endif
       } else {
-#        ifdef USE_PETSC
+#        if defined(USE_PETSC)
             driver->matrixChoice = driver_petsc;
-#        else
+#        elif defined(USE_PARASAILS)
             driver->matrixChoice = driver_parasails;
+#        else
+            driver->matrixChoice = driver_native;
 #        endif
       }
    }
@@ -391,13 +581,6 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
       fprintf(stderr, "ERROR: NATIVE is needed!\n");
       return -1;
 #else
-#  if defined(USE_MPI)
-      if (numProcs != 1) {
-         fprintf(stderr, "ERROR: MPI is not supported with NATIVE, use other!\n");
-         return -1;
-      }
-      *(MPI_Comm*)primme->commInfo = MPI_COMM_WORLD;
-#  endif
       {
          CSRMatrix *matrix, *prec;
          double *diag;
@@ -406,7 +589,11 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
          omp_set_num_threads(1);
          #endif
           
-         if (readMatrixNative(driver->matrixFileName, &matrix, &aNorm) !=0 )
+         if (readMatrixNative(driver->matrixFileName,
+                  driver->matrixCacheFileName, &matrix, &aNorm) !=0 )
+            return -1;
+         if (driver->sellC &&
+               primme_csr_sell(matrix->op, driver->sellC, driver->sellSigma) != 0)
             return -1;
          primme->matrix = matrix;
          primme->matrixMatvec = CSRMatrixMatvec;
@@ -436,6 +623,13 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
             fprintf(stderr, "ERROR: preconditioner is not supported with NATIVE, use other!\n");
             return -1;
          }
+#  if defined(USE_MPI)
+         if (numProcs > 1) distributeNative(primme, permutation);
+         if (numProcs > 1 && driver->sliceGroups != 1) {
+            sliceGroups = driver->sliceGroups;
+            primme->splitComm = splitCommNative;
+         }
+#  endif
       }
 #endif
       break;
@@ -576,6 +770,10 @@ static int setMatrixAndPrecond(driver_params *driver, primme_params *primme, int
 
 #if defined(USE_MPI)
    primme->globalSumReal = par_GlobalSumDouble;
+   if (driver->splitGlobalSum) {
+      primme->globalSumRealBegin = par_GlobalSumDoubleBegin;
+      primme->globalSumRealWait = par_GlobalSumDoubleWait;
+   }
 #endif
 
 #ifdef NOT_USE_ALIGNMENT
@@ -684,3 +882,116 @@ static int destroyMatrixAndPrecond(driver_params *driver, primme_params *primme,
    if (permutation) free(permutation);
    return 0;
 }
+
+/* Difference between the matrices of two consecutive solves with the same */
+/* matrix, used with primme.recycle                                         */
+
+static void unchangedMatrixDeltaMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
+   int i;
+   PRIMME_INT j;
+   (void)x;
+   (void)ldx;
+   for (i=0; i<*blockSize; i++)
+      for (j=0; j<primme->nLocal; j++)
+         ((SCALAR*)y)[*ldy*i+j] = 0.0;
+   *ierr = 0;
+}
+
+#if defined(USE_MPI) && defined(USE_NATIVE)
+
+/* Native matrices in parallel runs: every process keeps the whole matrix and */
+/* preconditioner, and applies them to the vectors gathered from all          */
+/* processes; it returns the rows of its block. This is only meant to test   */
+/* the communication in PRIMME.                                               */
+
+static void (*nativeMatvec)(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr);
+static void (*nativePrecond)(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr);
+
+static void applyGatheredNative(void (*apply)(void *, PRIMME_INT *, void *, PRIMME_INT *, int *, primme_params *, int *),
+      void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
+
+   MPI_Comm comm = *(MPI_Comm *)primme->commInfo;
+   int np = primme->numProcs, w = sizeof(SCALAR)/sizeof(double), i;
+   PRIMME_INT n = primme->n, j;
+   int *counts = (int *)primme_calloc(np*2, sizeof(int), "counts"), *displs = &counts[np];
+   SCALAR *xg = (SCALAR *)primme_calloc(n*(*blockSize)*2, sizeof(SCALAR), "xg"), *yg = &xg[n*(*blockSize)];
+
+   for (i=0; i<np; i++) {
+      counts[i] = (int)(n/np + (n%np > i ? 1 : 0))*w;
+      displs[i] = i == 0 ? 0 : displs[i-1] + counts[i-1];
+   }
+   *ierr = 0;
+   for (i=0; i<*blockSize && !*ierr; i++) {
+      *ierr = MPI_Allgatherv((SCALAR *)x + *ldx*i, counts[primme->procID], MPI_DOUBLE,
+            &xg[n*i], counts, displs, MPI_DOUBLE, comm) != MPI_SUCCESS;
+   }
+   if (!*ierr) {
+      primme_params primme0 = *primme;
+      primme0.nLocal = n;
+      apply(xg, &n, yg, &n, blockSize, &primme0, ierr);
+   }
+   for (i=0; i<*blockSize && !*ierr; i++) {
+      for (j=0; j<primme->nLocal; j++) {
+         ((SCALAR *)y)[*ldy*i+j] = yg[n*i + displs[primme->procID]/w + j];
+      }
+   }
+   free(counts);
+   free(xg);
+}
+
+static void distributedNativeMatvec(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
+   applyGatheredNative(nativeMatvec, x, ldx, y, ldy, blockSize, primme, ierr);
+}
+
+static void distributedNativePrecond(void *x, PRIMME_INT *ldx, void *y, PRIMME_INT *ldy, int *blockSize, primme_params *primme, int *ierr) {
+   applyGatheredNative(nativePrecond, x, ldx, y, ldy, blockSize, primme, ierr);
+}
+
+static void distributeNative(primme_params *primme, int **permutation) {
+   PRIMME_INT n = primme->n, row0, j;
+
+   MPI_Comm_size(MPI_COMM_WORLD, &primme->numProcs);
+   MPI_Comm_rank(MPI_COMM_WORLD, &primme->procID);
+   primme->nLocal = n/primme->numProcs + (n%primme->numProcs > primme->procID ? 1 : 0);
+   row0 = n/primme->numProcs*primme->procID + min(n%primme->numProcs, primme->procID);
+
+   /* The global row of every local row, used to read and check vectors */
+   *permutation = (int *)primme_calloc(primme->nLocal, sizeof(int), "permutation");
+   for (j=0; j<primme->nLocal; j++) (*permutation)[j] = (int)(row0 + j);
+
+   nativeMatvec = primme->matrixMatvec;
+   primme->matrixMatvec = distributedNativeMatvec;
+   if (primme->applyPreconditioner) {
+      nativePrecond = primme->applyPreconditioner;
+      primme->applyPreconditioner = distributedNativePrecond;
+   }
+}
+
+/* Groups of processes for the slicing. Every process keeps the whole matrix, */
+/* so a group only needs a communicator and the block of rows of the process  */
+/* in the group. If driver.sliceGroups is positive, it limits the groups.     */
+
+static void splitCommNative(int *numGroups, int *group, primme_params *primme_group, primme_params *primme, int *ierr) {
+   PRIMME_INT n = primme->n;
+   MPI_Comm *comm;
+
+   if (*numGroups == 0) {
+      *ierr = MPI_Comm_free((MPI_Comm *)primme_group->commInfo) != MPI_SUCCESS;
+      free(primme_group->commInfo);
+      return;
+   }
+   if (sliceGroups > 0 && *numGroups > sliceGroups) *numGroups = sliceGroups;
+   *group = primme->procID * (*numGroups) / primme->numProcs;
+   comm = (MPI_Comm *)primme_calloc(1, sizeof(MPI_Comm), "MPI_Comm");
+   *ierr = MPI_Comm_split(*(MPI_Comm *)primme->commInfo, *group, primme->procID, comm) != MPI_SUCCESS;
+   if (*ierr) {
+      free(comm);
+      return;
+   }
+   primme_group->commInfo = comm;
+   MPI_Comm_size(*comm, &primme_group->numProcs);
+   MPI_Comm_rank(*comm, &primme_group->procID);
+   primme_group->nLocal = n/primme_group->numProcs + (n%primme_group->numProcs > primme_group->procID ? 1 : 0);
+}
+
+#endif /* USE_MPI && USE_NATIVE */
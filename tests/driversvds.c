@@ -302,6 +302,28 @@ static int real_main (int argc, char *argv[]) {
    }
 
 
+   /* --------------------------------------------------- */
+   /* Give primme_svds the memory for the solve (optional) */
+   /* --------------------------------------------------- */
+
+   void *workspace = NULL;
+   if (driver.useWorkspace) {
+      ASSERT_MSG(Sprimme_svds(NULL, NULL, NULL, &primme_svds) == 0, -1, "");
+      workspace = primme_calloc(primme_svds.lworkspace, 1, "workspace");
+      primme_svds.workspace = workspace;
+   }
+
+   /* ------------------------------------ */
+   /* Record the calls of PRIMME (optional) */
+   /* ------------------------------------ */
+
+   primme_profiler *profiler = NULL;
+   if (driver.profile) {
+      /* There is no profiler if PRIMME is not built with PRIMME_PROFILE */
+      profiler = primme_profiler_create(0, 0);
+      primme_svds.profiler = profiler;
+   }
+
    /* ------------------ */
    /*  Call svds_primme  */
    /* ------------------ */
@@ -312,6 +334,24 @@ static int real_main (int argc, char *argv[]) {
       retX = check_solution_svds(driver.checkXFileName, &primme_svds, svals, svecs, rnorms, permutation);
    }
 
+   /* Check the recorded calls */
+
+   if (profiler) {
+      if (master && check_profiler(profiler, primme_svds.outputFile)) retX = 1;
+      primme_svds.profiler = NULL;
+      primme_profiler_destroy(profiler);
+   }
+
+   /* Check that primme_svds didn't take memory out of the workspace */
+
+   if (driver.useWorkspace && (primme_svds.primme.stats.numHeapAllocs > 0 ||
+                                    primme_svds.primmeStage2.stats.numHeapAllocs > 0)) {
+      fprintf(primme_svds.outputFile,
+            "Error: the workspace of %zu bytes was not enough\n",
+            primme_svds.lworkspace);
+      retX = 1;
+   }
+
    /* --------------------------------------------------------------------- */
    /* Save svecs and primme_svds_params  (optional)                         */
    /* --------------------------------------------------------------------- */
@@ -364,6 +404,7 @@ static int real_main (int argc, char *argv[]) {
    free(svals);
    free(svecs);
    free(rnorms);
+   free(workspace);
 
    if (ret != 0 && master) {
       fprintf(primme_svds.outputFile, 
@@ -442,10 +483,17 @@ static int setMatrixAndPrecond(driver_params *driver,
          omp_set_num_threads(1);
          #endif
           
-         if (readMatrixNative(driver->matrixFileName, &matrix, &aNorm) !=0 )
+         if (readMatrixNative(driver->matrixFileName,
+                  driver->matrixCacheFileName, &matrix, &aNorm) !=0 )
+            return -1;
+         if (driver->sellC &&
+               primme_csr_sell(matrix->op, driver->sellC, driver->sellSigma) != 0)
             return -1;
          primme_svds->matrix = matrix;
          primme_svds->matrixMatvec = CSRMatrixMatvecSVD;
+         if (driver->normalMatvec) {
+            primme_svds->matrixNormalMatvec = CSRMatrixNormalMatvecSVD;
+         }
          primme_svds->m = primme_svds->mLocal = matrix->m;
          primme_svds->n = primme_svds->nLocal = matrix->n;
          switch(driver->PrecChoice) {
@@ -704,6 +752,10 @@ static int setMatrixAndPrecond(driver_params *driver,
 
 #if defined(USE_MPI)
    primme_svds->globalSumReal = par_GlobalSumDoubleSvds;
+   if (driver->splitGlobalSum) {
+      primme_svds->globalSumRealBegin = par_GlobalSumDoubleBeginSvds;
+      primme_svds->globalSumRealWait = par_GlobalSumDoubleWaitSvds;
+   }
 #endif
    return 0;
 }
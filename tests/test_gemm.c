@@ -0,0 +1,212 @@
+/*******************************************************************************
+ *   PRIMME PReconditioned Iterative MultiMethod Eigensolver
+ *   Copyright (C) 2018 College of William & Mary,
+ *   James R. McCombs, Eloy Romero Alcalde, Andreas Stathopoulos, Lingfei Wu
+ *
+ *   This file is part of PRIMME.
+ *
+ *   PRIMME is free software; you can redistribute it and/or
+ *   modify it under the terms of the GNU Lesser General Public
+ *   License as published by the Free Software Foundation; either
+ *   version 2.1 of the License, or (at your option) any later version.
+ *
+ *   PRIMME is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *   Lesser General Public License for more details.
+ *
+ *   You should have received a copy of the GNU Lesser General Public
+ *   License along with this library; if not, write to the Free Software
+ *   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ *******************************************************************************
+ * File: test_gemm.c
+ *
+ * Purpose - Compare Num_gemm_dprimme, which computes the products of a tall
+ *           and skinny matrix by a few vectors with its own kernels, with the
+ *           BLAS dgemm.
+ *
+ * Usage   - test_gemm         compare the results for random shapes and
+ *                             leading dimensions
+ *           test_gemm -b      time both for the shapes of V'*W and V*h
+ *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "primme.h"
+#include "../src/linalg/blaslapack_private.h"
+#include "wtime.h"
+
+#define MAX_ROWS 2000
+#define MAX_COLS 80
+#define MAX_N 20
+#define MAX_PAD 5
+
+static double rand_double(void) { return 2.0 * rand() / RAND_MAX - 1.0; }
+
+static int rand_int(int n) { return rand() % n; }
+
+static primme_context get_dummy_context(void) {
+   primme_context ctx;
+   memset(&ctx, 0, sizeof(primme_context));
+   return ctx;
+}
+
+/* Compare C = alpha*op(A)*B + beta*C computed by Num_gemm_dprimme and by */
+/* dgemm for random sizes, leading dimensions, alpha and beta              */
+
+static int fuzz(int ntests) {
+   double *a = (double *)malloc(sizeof(double) * (MAX_ROWS + MAX_PAD) * MAX_COLS);
+   double *b = (double *)malloc(sizeof(double) * (MAX_ROWS + MAX_PAD) * MAX_N);
+   double *c0 = (double *)malloc(sizeof(double) * (MAX_ROWS + MAX_PAD) * MAX_N);
+   double *c1 = (double *)malloc(sizeof(double) * (MAX_ROWS + MAX_PAD) * MAX_N);
+   primme_context ctx = get_dummy_context();
+   int t, i, fails = 0;
+   double maxerr = 0.0;
+
+   for (t = 0; t < ntests; t++) {
+      int tn = rand_int(2);
+      int rows = rand_int(4) == 0 ? rand_int(70) : rand_int(MAX_ROWS) + 1;
+      int cols = rand_int(MAX_COLS) + 1;
+      int n = rand_int(MAX_N) + 1;
+      double alpha = rand_int(4) == 0 ? 1.0 : rand_double();
+      double beta = rand_int(3) == 0 ? 0.0 : rand_double();
+      PRIMME_BLASINT m, k, lda, ldb, ldc, nb = n;
+      if (tn) {
+         /* C(cols x n) = alpha * A(rows x cols)' * B(rows x n) + beta * C */
+         m = cols, k = rows;
+         lda = rows + rand_int(MAX_PAD);
+         ldb = rows + rand_int(MAX_PAD);
+         ldc = cols + rand_int(MAX_PAD);
+      } else {
+         /* C(rows x n) = alpha * A(rows x cols) * B(cols x n) + beta * C */
+         m = rows, k = cols;
+         lda = rows + rand_int(MAX_PAD);
+         ldb = cols + rand_int(MAX_PAD);
+         ldc = rows + rand_int(MAX_PAD);
+      }
+      if (lda == 0) lda = 1;
+      if (ldb == 0) ldb = 1;
+      if (ldc == 0) ldc = 1;
+      for (i = 0; i < lda * (tn ? m : k); i++) a[i] = rand_double();
+      for (i = 0; i < ldb * n; i++) b[i] = rand_double();
+      for (i = 0; i < ldc * n; i++) c0[i] = c1[i] = rand_double();
+
+      if (Num_gemm_dprimme(tn ? "C" : "N", "N", m, n, k, alpha, a, lda, b,
+                ldb, beta, c0, ldc, ctx) != 0) {
+         fprintf(stderr, "Error: Num_gemm_dprimme failed\n");
+         fails++;
+         continue;
+      }
+      if (k > 0) {
+         XGEMM(tn ? "T" : "N", "N", &m, &nb, &k, &alpha, a, &lda, b, &ldb,
+               &beta, c1, &ldc);
+      } else {
+         for (i = 0; i < ldc * n; i++) {
+            if (i % ldc < m) c1[i] = (beta == 0.0 ? 0.0 : beta * c1[i]);
+         }
+      }
+
+      /* Compare C and check that the rows beyond m are not touched */
+
+      double err = 0.0;
+      for (i = 0; i < ldc * n; i++) {
+         double e = fabs(c0[i] - c1[i]);
+         if (i % ldc >= m) e = (c0[i] == c1[i] ? 0.0 : HUGE_VAL);
+         if (e > err) err = e;
+      }
+      err /= (k > 0 ? k : 1);
+      if (err > maxerr) maxerr = err;
+      if (err > 1e-14) {
+         fprintf(stderr,
+               "Error: %s m=%d n=%d k=%d lda=%d ldb=%d ldc=%d alpha=%g "
+               "beta=%g: error/k %g\n",
+               tn ? "A'*B" : "A*B", (int)m, n, (int)k, (int)lda, (int)ldb,
+               (int)ldc, alpha, beta, err);
+         fails++;
+      }
+   }
+
+   printf("%d products, %d failed, max error/k %g\n", ntests, fails, maxerr);
+   free(a);
+   free(b);
+   free(c0);
+   free(c1);
+   return fails ? 1 : 0;
+}
+
+/* Time V'*W and V*h with Num_gemm_dprimme and with dgemm */
+
+static double best_time(int tn, int useBlas, PRIMME_BLASINT rows,
+      PRIMME_BLASINT cols, PRIMME_BLASINT n, double *V, double *W, double *h,
+      int reps) {
+   primme_context ctx = get_dummy_context();
+   double one = 1.0, zero = 0.0, best = HUGE_VAL;
+   int i, r;
+   for (i = 0; i < 3; i++) {
+      double t0 = primme_wTimer();
+      for (r = 0; r < reps; r++) {
+         if (tn && useBlas) {
+            XGEMM("T", "N", &cols, &n, &rows, &one, V, &rows, W, &rows, &zero,
+                  h, &cols);
+         } else if (tn) {
+            Num_gemm_dprimme(
+                  "C", "N", cols, n, rows, 1.0, V, rows, W, rows, 0.0, h, cols, ctx);
+         } else if (useBlas) {
+            XGEMM("N", "N", &rows, &n, &cols, &one, V, &rows, h, &cols, &zero,
+                  W, &rows);
+         } else {
+            Num_gemm_dprimme(
+                  "N", "N", rows, n, cols, 1.0, V, rows, h, cols, 0.0, W, rows, ctx);
+         }
+      }
+      double t = (primme_wTimer() - t0) / reps;
+      if (t < best) best = t;
+   }
+   return best;
+}
+
+static int bench(void) {
+   static const int shapes[][2] = {
+         {512, 16}, {512, 32}, {512, 64}, {4096, 32}, {100000, 24}};
+   static const int ns[] = {1, 2, 4, 8, 16};
+   int s, j;
+   PRIMME_BLASINT i;
+
+   printf("Speedup of Num_gemm_dprimme over dgemm for V'*W / V*h\n");
+   printf("  rows x cols ");
+   for (j = 0; j < 5; j++) printf("  n=%-8d", ns[j]);
+   printf("\n");
+   for (s = 0; s < 5; s++) {
+      PRIMME_BLASINT rows = shapes[s][0], cols = shapes[s][1];
+      double *V = (double *)malloc(sizeof(double) * rows * cols);
+      double *W = (double *)malloc(sizeof(double) * rows * 16);
+      double *h = (double *)malloc(sizeof(double) * cols * 16);
+      for (i = 0; i < rows * cols; i++) V[i] = rand_double();
+      for (i = 0; i < rows * 16; i++) W[i] = rand_double();
+      for (i = 0; i < cols * 16; i++) h[i] = rand_double();
+      int reps = (int)(2e8 / ((double)rows * cols)) + 1;
+      printf("%7d x %-4d", (int)rows, (int)cols);
+      for (j = 0; j < 5; j++) {
+         double tn = best_time(1, 1, rows, cols, ns[j], V, W, h, reps) /
+                     best_time(1, 0, rows, cols, ns[j], V, W, h, reps);
+         double nn = best_time(0, 1, rows, cols, ns[j], V, W, h, reps) /
+                     best_time(0, 0, rows, cols, ns[j], V, W, h, reps);
+         printf("  %4.2f/%4.2f", tn, nn);
+      }
+      printf("\n");
+      free(V);
+      free(W);
+      free(h);
+   }
+   return 0;
+}
+
+int main(int argc, char **argv) {
+   srand(1);
+   if (argc > 1 && strcmp(argv[1], "-b") == 0) return bench();
+   return fuzz(3000);
+}